@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h>
+
+#include <fmt/format.h>
+
+#include <themachinethatgoesping/tools_nanobind/classhelper.hpp>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/backwardgridder.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+
+namespace nb   = nanobind;
+namespace xtnb = xt::nanobind;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define DOC_BackwardGridder(ARG)                                                                   \
+    DOC(themachinethatgoesping, algorithms, gridding, BackwardGridder, ARG)
+
+template<typename t_float, size_t Dim>
+void init_BackwardGridder_float(nb::module_& m, const std::string& suffix)
+{
+    using T_BackwardGridder      = BackwardGridder<t_float, Dim>;
+    using t_gridder              = typename T_BackwardGridder::t_gridder;
+    using t_pytensor             = xtnb::pytensor<t_float, 1>;
+    const std::string class_name = fmt::format("BackwardGridder{}D{}", Dim, suffix);
+
+    auto cls = nb::class_<T_BackwardGridder>(
+        m, class_name.c_str(), DOC(themachinethatgoesping, algorithms, gridding, BackwardGridder));
+
+    if constexpr (Dim == 2)
+    {
+        cls.def(nb::init<t_gridder, const t_pytensor&, const t_pytensor&, t_float, int>(),
+                DOC_BackwardGridder(BackwardGridder),
+                nb::arg("gridder"),
+                nb::arg("sx"),
+                nb::arg("sy"),
+                nb::arg("max_distance"),
+                nb::arg("mp_cores") = 1);
+    }
+    else
+    {
+        cls.def(nb::init<t_gridder,
+                         const t_pytensor&,
+                         const t_pytensor&,
+                         const t_pytensor&,
+                         t_float,
+                         int>(),
+                DOC_BackwardGridder(BackwardGridder_2),
+                nb::arg("gridder"),
+                nb::arg("sx"),
+                nb::arg("sy"),
+                nb::arg("sz"),
+                nb::arg("max_distance"),
+                nb::arg("mp_cores") = 1);
+    }
+
+    cls.def("interpolate_nearest",
+            &T_BackwardGridder::template interpolate_nearest<t_pytensor>,
+            DOC_BackwardGridder(interpolate_nearest),
+            nb::arg("s_val"),
+            nb::arg("mp_cores") = 1)
+        .def("get_nearest_point_indices",
+             &T_BackwardGridder::get_nearest_point_indices,
+             nb::rv_policy::reference_internal,
+             DOC_BackwardGridder(get_nearest_point_indices))
+        .def("get_nearest_point_distances",
+             &T_BackwardGridder::get_nearest_point_distances,
+             nb::rv_policy::reference_internal,
+             DOC_BackwardGridder(get_nearest_point_distances))
+        .def("get_gridder", &T_BackwardGridder::get_gridder, DOC_BackwardGridder(get_gridder))
+        .def("get_max_distance",
+             &T_BackwardGridder::get_max_distance,
+             DOC_BackwardGridder(get_max_distance))
+        .def("get_number_of_points",
+             &T_BackwardGridder::get_number_of_points,
+             DOC_BackwardGridder(get_number_of_points))
+        .def("get_number_of_filled_cells",
+             &T_BackwardGridder::get_number_of_filled_cells,
+             DOC_BackwardGridder(get_number_of_filled_cells))
+        __PYCLASS_DEFAULT_PRINTING__(T_BackwardGridder)
+        ;
+}
+
+void init_c_backwardgridder(nb::module_& m)
+{
+    init_BackwardGridder_float<double, 2>(m, "");
+    init_BackwardGridder_float<float, 2>(m, "F");
+    init_BackwardGridder_float<double, 3>(m, "");
+    init_BackwardGridder_float<float, 3>(m, "F");
+}
+
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -80,19 +80,28 @@ void init_ForwardGridder1D_float(nb::module_& m, const std::string& suffix)
              DOC_ForwardGridder1D(group_blocks),
              nb::arg("sx").noconvert(),
              nb::arg("sv").noconvert())
+          .def("group_blocks_csr",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&, const xtnb::pytensor<t_float, 1>&, const int>(
+                 &T_ForwardGridder1D::template group_blocks_csr<xtnb::pytensor<t_float, 1>>, nb::const_),
+             DOC_ForwardGridder1D(group_blocks_csr),
+             nb::arg("sx").noconvert(),
+             nb::arg("sv").noconvert(),
+             nb::arg("mp_cores") = 1)
           .def("interpolate_block_mean",
-                nb::overload_cast<const xtnb::pytensor<t_float, 1>&, const xtnb::pytensor<t_float, 1>&>(
+                nb::overload_cast<const xtnb::pytensor<t_float, 1>&, const xtnb::pytensor<t_float, 1>&, const int>(
                      &T_ForwardGridder1D::template interpolate_block_mean<xt::nanobind::pytensor<t_float, 1>,
                                                                                        xtnb::pytensor<t_float, 1>>,
                  nb::const_),
              DOC_ForwardGridder1D(interpolate_block_mean),
              nb::arg("sx"),
-             nb::arg("s_val"))
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_block_mean_inplace",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                xtnb::pytensor<t_float, 1>&,
-                               xtnb::pytensor<t_float, 1>&>(
+                               xtnb::pytensor<t_float, 1>&,
+                               const int>(
                  &T_ForwardGridder1D::template interpolate_block_mean_inplace<
                      xtnb::pytensor<t_float, 1>,
                      xtnb::pytensor<t_float, 1>>,
@@ -101,20 +110,23 @@ void init_ForwardGridder1D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sx"),
              nb::arg("s_val"),
              nb::arg("image_values").noconvert(),
-             nb::arg("image_weights").noconvert())
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
           .def("interpolate_weighted_mean",
-                nb::overload_cast<const xtnb::pytensor<t_float, 1>&, const xtnb::pytensor<t_float, 1>&>(
+                nb::overload_cast<const xtnb::pytensor<t_float, 1>&, const xtnb::pytensor<t_float, 1>&, const int>(
                      &T_ForwardGridder1D::template interpolate_weighted_mean<xt::nanobind::pytensor<t_float, 1>,
                                                                                            xtnb::pytensor<t_float, 1>>,
                  nb::const_),
              DOC_ForwardGridder1D(interpolate_weighted_mean),
              nb::arg("sx"),
-             nb::arg("s_val"))
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_weighted_mean_inplace",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                xtnb::pytensor<t_float, 1>&,
-                               xtnb::pytensor<t_float, 1>&>(
+                               xtnb::pytensor<t_float, 1>&,
+                               const int>(
                  &T_ForwardGridder1D::template interpolate_weighted_mean_inplace<
                      xtnb::pytensor<t_float, 1>,
                      xtnb::pytensor<t_float, 1>>,
@@ -123,7 +135,152 @@ void init_ForwardGridder1D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sx"),
              nb::arg("s_val"),
              nb::arg("image_values").noconvert(),
-             nb::arg("image_weights").noconvert())
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_min",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_min<
+                     xtnb::pytensor<t_float, 1>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_min),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_min_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_min_inplace<
+                     xtnb::pytensor<t_float, 1>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_min_inplace),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("image_min").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_max",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_max<
+                     xtnb::pytensor<t_float, 1>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_max),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_max_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_max_inplace<
+                     xtnb::pytensor<t_float, 1>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_max_inplace),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("image_max").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_count",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_count<
+                     xtnb::pytensor<t_float, 1>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_count),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_count_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_count_inplace<
+                     xtnb::pytensor<t_float, 1>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_count_inplace),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("image_count").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_variance",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_variance<
+                     xtnb::pytensor<t_float, 1>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_variance),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_variance_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_variance_inplace<
+                     xtnb::pytensor<t_float, 1>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_variance_inplace),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("image_count").noconvert(),
+             nb::arg("image_mean").noconvert(),
+             nb::arg("image_m2").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_histogram",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               const size_t,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_histogram<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_histogram),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("hist_min"),
+             nb::arg("hist_max"),
+             nb::arg("n_bins"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_histogram_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
+                 &T_ForwardGridder1D::template interpolate_block_histogram_inplace<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder1D(interpolate_block_histogram_inplace),
+             nb::arg("sx"),
+             nb::arg("s_val"),
+             nb::arg("hist_min"),
+             nb::arg("hist_max"),
+             nb::arg("image_histogram").noconvert(),
+             nb::arg("mp_cores") = 1)
         .def("get_xres", &T_ForwardGridder1D::get_xres, DOC_ForwardGridder1D(xres))
         .def("get_xmin", &T_ForwardGridder1D::get_xmin, DOC_ForwardGridder1D(xmin))
         .def("get_xmax", &T_ForwardGridder1D::get_xmax, DOC_ForwardGridder1D(xmax))
@@ -72,6 +72,17 @@ void init_ForwardGridder2D_float(nb::module_& m, const std::string& suffix)
                     nb::arg("max_x"),
                     nb::arg("min_y"),
                     nb::arg("max_y"))
+        .def_static("from_cells",
+                    &T_ForwardGridder2D::from_cells,
+                    DOC_ForwardGridder2D(from_cells),
+                    nb::arg("xres"),
+                    nb::arg("yres"),
+                    nb::arg("xmin"),
+                    nb::arg("nx"),
+                    nb::arg("ymin"),
+                    nb::arg("ny"),
+                    nb::arg("xbase") = 0.0,
+                    nb::arg("ybase") = 0.0)
         .def_static("from_data",
                     nb::overload_cast<t_float,
                                       const xtnb::pytensor<t_float, 1>&,
@@ -93,23 +104,37 @@ void init_ForwardGridder2D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sx").noconvert(),
              nb::arg("sy").noconvert(),
              nb::arg("sv").noconvert())
+        .def("group_blocks_csr",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder2D::template group_blocks_csr<xtnb::pytensor<t_float, 1>>, nb::const_),
+             DOC_ForwardGridder2D(group_blocks_csr),
+             nb::arg("sx").noconvert(),
+             nb::arg("sy").noconvert(),
+             nb::arg("sv").noconvert(),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_block_mean",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
-                               const xtnb::pytensor<t_float, 1>&>(
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
                  &T_ForwardGridder2D::template interpolate_block_mean<xt::nanobind::pytensor<t_float, 2>,
                                                                       xtnb::pytensor<t_float, 1>>,
                  nb::const_),
              DOC_ForwardGridder2D(interpolate_block_mean),
              nb::arg("sx"),
              nb::arg("sy"),
-             nb::arg("s_val"))
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_block_mean_inplace",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                xtnb::pytensor<t_float, 2>&,
-                               xtnb::pytensor<t_float, 2>&>(
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
                  &T_ForwardGridder2D::template interpolate_block_mean_inplace<xtnb::pytensor<t_float, 2>,
                                                                             xtnb::pytensor<t_float, 1>>,
                  nb::const_),
@@ -118,24 +143,28 @@ void init_ForwardGridder2D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sy"),
              nb::arg("s_val"),
              nb::arg("image_values").noconvert(),
-             nb::arg("image_weights").noconvert())
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_weighted_mean",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
-                               const xtnb::pytensor<t_float, 1>&>(
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
                  &T_ForwardGridder2D::template interpolate_weighted_mean<xt::nanobind::pytensor<t_float, 2>,
                                                                          xtnb::pytensor<t_float, 1>>,
                  nb::const_),
              DOC_ForwardGridder2D(interpolate_weighted_mean),
              nb::arg("sx"),
              nb::arg("sy"),
-             nb::arg("s_val"))
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_weighted_mean_inplace",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                xtnb::pytensor<t_float, 2>&,
-                               xtnb::pytensor<t_float, 2>&>(
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
                  &T_ForwardGridder2D::template interpolate_weighted_mean_inplace<
                      xtnb::pytensor<t_float, 2>,
                      xtnb::pytensor<t_float, 1>>,
@@ -145,7 +174,274 @@ void init_ForwardGridder2D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sy"),
              nb::arg("s_val"),
              nb::arg("image_values").noconvert(),
-             nb::arg("image_weights").noconvert())
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean_multichannel",
+             &T_ForwardGridder2D::template interpolate_weighted_mean_multichannel<
+                 xtnb::pytensor<t_float, 3>,
+                 xtnb::pytensor<t_float, 1>,
+                 xtnb::pytensor<t_float, 2>>,
+             DOC_ForwardGridder2D(interpolate_weighted_mean_multichannel),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean_multichannel_inplace",
+             &T_ForwardGridder2D::template interpolate_weighted_mean_multichannel_inplace<
+                 xtnb::pytensor<t_float, 1>,
+                 xtnb::pytensor<t_float, 2>,
+                 xtnb::pytensor<t_float, 3>>,
+             DOC_ForwardGridder2D(interpolate_weighted_mean_multichannel_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_gaussian_splat",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_gaussian_splat<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_gaussian_splat),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("radius"),
+             nb::arg("sigma"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_gaussian_splat_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               xtnb::pytensor<t_float, 2>&,
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_gaussian_splat_inplace<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_gaussian_splat_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("radius"),
+             nb::arg("sigma"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_inverse_distance_splat",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_inverse_distance_splat<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_inverse_distance_splat),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("radius"),
+             nb::arg("power") = 2,
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_inverse_distance_splat_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               xtnb::pytensor<t_float, 2>&,
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_inverse_distance_splat_inplace<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_inverse_distance_splat_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("radius"),
+             nb::arg("power"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_min",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_min<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_min),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_min_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_min_inplace<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_min_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("image_min").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_max",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_max<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_max),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_max_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_max_inplace<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_max_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("image_max").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_count",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_count<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_count),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_count_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_count_inplace<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_count_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("image_count").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_variance",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_variance<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_variance),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_variance_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 2>&,
+                               xtnb::pytensor<t_float, 2>&,
+                               xtnb::pytensor<t_float, 2>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_variance_inplace<
+                     xtnb::pytensor<t_float, 2>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_variance_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("image_count").noconvert(),
+             nb::arg("image_mean").noconvert(),
+             nb::arg("image_m2").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_histogram",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               const size_t,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_histogram<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_histogram),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("hist_min"),
+             nb::arg("hist_max"),
+             nb::arg("n_bins"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_histogram_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
+                 &T_ForwardGridder2D::template interpolate_block_histogram_inplace<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder2D(interpolate_block_histogram_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("s_val"),
+             nb::arg("hist_min"),
+             nb::arg("hist_max"),
+             nb::arg("image_histogram").noconvert(),
+             nb::arg("mp_cores") = 1)
         .def("get_xres", &T_ForwardGridder2D::get_xres, DOC_ForwardGridder2D(xres))
         .def("get_yres", &T_ForwardGridder2D::get_yres, DOC_ForwardGridder2D(yres))
         .def("get_xmin", &T_ForwardGridder2D::get_xmin, DOC_ForwardGridder2D(xmin))
@@ -252,6 +548,17 @@ void init_ForwardGridder2D_float(nb::module_& m, const std::string& suffix)
         .def("get_y_coordinates",
              &T_ForwardGridder2D::get_y_coordinates,
              DOC_ForwardGridder2D(get_y_coordinates))
+        .def("get_pyramid_gridder",
+             &T_ForwardGridder2D::get_pyramid_gridder,
+             DOC_ForwardGridder2D(get_pyramid_gridder),
+             nb::arg("level"))
+        .def("compute_pyramid",
+             &T_ForwardGridder2D::template compute_pyramid<xtnb::pytensor<t_float, 2>>,
+             DOC_ForwardGridder2D(compute_pyramid),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("n_levels"),
+             nb::arg("mp_cores") = 1)
         .def_static("get_minmax",
                     nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                       const xtnb::pytensor<t_float, 1>&>(
@@ -90,6 +90,21 @@ void init_ForwardGridder3D_float(nb::module_& m, const std::string& suffix)
             nb::arg("max_y"),
             nb::arg("min_z"),
             nb::arg("max_z"))
+        .def_static("from_cells",
+                    &T_ForwardGridder3D::from_cells,
+                    DOC_ForwardGridder3D(from_cells),
+                    nb::arg("xres"),
+                    nb::arg("yres"),
+                    nb::arg("zres"),
+                    nb::arg("xmin"),
+                    nb::arg("nx"),
+                    nb::arg("ymin"),
+                    nb::arg("ny"),
+                    nb::arg("zmin"),
+                    nb::arg("nz"),
+                    nb::arg("xbase") = 0.0,
+                    nb::arg("ybase") = 0.0,
+                    nb::arg("zbase") = 0.0)
         .def_static("from_data",
                     nb::overload_cast<t_float,
                                       const xtnb::pytensor<t_float, 1>&,
@@ -115,11 +130,25 @@ void init_ForwardGridder3D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sy").noconvert(),
              nb::arg("sz").noconvert(),
              nb::arg("sv").noconvert())
+        .def("group_blocks_csr",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder3D::template group_blocks_csr<xtnb::pytensor<t_float, 1>>, nb::const_),
+             DOC_ForwardGridder3D(group_blocks_csr),
+             nb::arg("sx").noconvert(),
+             nb::arg("sy").noconvert(),
+             nb::arg("sz").noconvert(),
+             nb::arg("sv").noconvert(),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_block_mean",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
-                               const xtnb::pytensor<t_float, 1>&>(
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
                  &T_ForwardGridder3D::template interpolate_block_mean<xt::nanobind::pytensor<t_float, 3>,
                                                                       xtnb::pytensor<t_float, 1>>,
                  nb::const_),
@@ -127,14 +156,16 @@ void init_ForwardGridder3D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sx"),
              nb::arg("sy"),
              nb::arg("sz"),
-             nb::arg("s_val"))
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_block_mean_inplace",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                xtnb::pytensor<t_float, 3>&,
-                               xtnb::pytensor<t_float, 3>&>(
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
                  &T_ForwardGridder3D::template interpolate_block_mean_inplace<
                      xtnb::pytensor<t_float, 3>,
                      xtnb::pytensor<t_float, 1>>,
@@ -145,12 +176,14 @@ void init_ForwardGridder3D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sz"),
              nb::arg("s_val"),
              nb::arg("image_values").noconvert(),
-             nb::arg("image_weights").noconvert())
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_weighted_mean",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
-                               const xtnb::pytensor<t_float, 1>&>(
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
                  &T_ForwardGridder3D::template interpolate_weighted_mean<xt::nanobind::pytensor<t_float, 3>,
                                                                          xtnb::pytensor<t_float, 1>>,
                  nb::const_),
@@ -158,14 +191,16 @@ void init_ForwardGridder3D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sx"),
              nb::arg("sy"),
              nb::arg("sz"),
-             nb::arg("s_val"))
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
         .def("interpolate_weighted_mean_inplace",
              nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                const xtnb::pytensor<t_float, 1>&,
                                xtnb::pytensor<t_float, 3>&,
-                               xtnb::pytensor<t_float, 3>&>(
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
                  &T_ForwardGridder3D::template interpolate_weighted_mean_inplace<
                      xtnb::pytensor<t_float, 3>,
                      xtnb::pytensor<t_float, 1>>,
@@ -176,7 +211,304 @@ void init_ForwardGridder3D_float(nb::module_& m, const std::string& suffix)
              nb::arg("sz"),
              nb::arg("s_val"),
              nb::arg("image_values").noconvert(),
-             nb::arg("image_weights").noconvert())
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean_multichannel",
+             &T_ForwardGridder3D::template interpolate_weighted_mean_multichannel<
+                 xtnb::pytensor<t_float, 4>,
+                 xtnb::pytensor<t_float, 1>,
+                 xtnb::pytensor<t_float, 2>>,
+             DOC_ForwardGridder3D(interpolate_weighted_mean_multichannel),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean_multichannel_inplace",
+             &T_ForwardGridder3D::template interpolate_weighted_mean_multichannel_inplace<
+                 xtnb::pytensor<t_float, 1>,
+                 xtnb::pytensor<t_float, 2>,
+                 xtnb::pytensor<t_float, 4>>,
+             DOC_ForwardGridder3D(interpolate_weighted_mean_multichannel_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_gaussian_splat",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_gaussian_splat<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_gaussian_splat),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("radius"),
+             nb::arg("sigma"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_gaussian_splat_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               xtnb::pytensor<t_float, 3>&,
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_gaussian_splat_inplace<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_gaussian_splat_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("radius"),
+             nb::arg("sigma"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_inverse_distance_splat",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_inverse_distance_splat<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_inverse_distance_splat),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("radius"),
+             nb::arg("power") = 2,
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_inverse_distance_splat_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               xtnb::pytensor<t_float, 3>&,
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_inverse_distance_splat_inplace<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_inverse_distance_splat_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("radius"),
+             nb::arg("power"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_min",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_min<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_min),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_min_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_min_inplace<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_min_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("image_min").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_max",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_max<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_max),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_max_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_max_inplace<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_max_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("image_max").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_count",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_count<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_count),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_count_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_count_inplace<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_count_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("image_count").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_variance",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_variance<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_variance),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_variance_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               xtnb::pytensor<t_float, 3>&,
+                               xtnb::pytensor<t_float, 3>&,
+                               xtnb::pytensor<t_float, 3>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_variance_inplace<
+                     xtnb::pytensor<t_float, 3>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_variance_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("image_count").noconvert(),
+             nb::arg("image_mean").noconvert(),
+             nb::arg("image_m2").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_histogram",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               const size_t,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_histogram<
+                     xtnb::pytensor<t_float, 4>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_histogram),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("hist_min"),
+             nb::arg("hist_max"),
+             nb::arg("n_bins"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_histogram_inplace",
+             nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const xtnb::pytensor<t_float, 1>&,
+                               const t_float,
+                               const t_float,
+                               xtnb::pytensor<t_float, 4>&,
+                               const int>(
+                 &T_ForwardGridder3D::template interpolate_block_histogram_inplace<
+                     xtnb::pytensor<t_float, 4>,
+                     xtnb::pytensor<t_float, 1>>,
+                 nb::const_),
+             DOC_ForwardGridder3D(interpolate_block_histogram_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("hist_min"),
+             nb::arg("hist_max"),
+             nb::arg("image_histogram").noconvert(),
+             nb::arg("mp_cores") = 1)
         .def("get_xres", &T_ForwardGridder3D::get_xres, DOC_ForwardGridder3D(xres))
         .def("get_yres", &T_ForwardGridder3D::get_yres, DOC_ForwardGridder3D(yres))
         .def("get_zres", &T_ForwardGridder3D::get_zres, DOC_ForwardGridder3D(zres))
@@ -334,6 +666,17 @@ void init_ForwardGridder3D_float(nb::module_& m, const std::string& suffix)
         .def("get_z_coordinates",
              &T_ForwardGridder3D::get_z_coordinates,
              DOC_ForwardGridder3D(get_z_coordinates))
+        .def("get_pyramid_gridder",
+             &T_ForwardGridder3D::get_pyramid_gridder,
+             DOC_ForwardGridder3D(get_pyramid_gridder),
+             nb::arg("level"))
+        .def("compute_pyramid",
+             &T_ForwardGridder3D::template compute_pyramid<xtnb::pytensor<t_float, 3>>,
+             DOC_ForwardGridder3D(compute_pyramid),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("n_levels"),
+             nb::arg("mp_cores") = 1)
         .def_static("get_minmax",
                     nb::overload_cast<const xtnb::pytensor<t_float, 1>&,
                                       const xtnb::pytensor<t_float, 1>&,
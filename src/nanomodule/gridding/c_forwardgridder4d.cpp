@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
+#include <nanobind/stl/vector.h>
+
+#include <themachinethatgoesping/tools_nanobind/classhelper.hpp>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/forwardgridder4d.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+
+namespace nb   = nanobind;
+namespace xtnb = xt::nanobind;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define DOC_ForwardGridder4D(ARG)                                                                  \
+    DOC(themachinethatgoesping, algorithms, gridding, ForwardGridder4D, ARG)
+
+template<typename t_float>
+void init_ForwardGridder4D_float(nb::module_& m, const std::string& suffix)
+{
+    using T_ForwardGridder4D     = ForwardGridder4D<t_float>;
+    const std::string class_name = std::string("ForwardGridder4D") + suffix;
+
+    nb::class_<T_ForwardGridder4D>(
+        m, class_name.c_str(), DOC(themachinethatgoesping, algorithms, gridding, ForwardGridder4D))
+        .def(nb::init<ForwardGridder3D<t_float>, double, double>(),
+             DOC_ForwardGridder4D(ForwardGridder4D),
+             nb::arg("gridder"),
+             nb::arg("tres"),
+             nb::arg("tbase") = 0.0)
+        .def("interpolate_block_mean_inplace",
+             &T_ForwardGridder4D::template interpolate_block_mean_inplace<
+                 xtnb::pytensor<t_float, 1>,
+                 xtnb::pytensor<double, 1>>,
+             DOC_ForwardGridder4D(interpolate_block_mean_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("st"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean_inplace",
+             &T_ForwardGridder4D::template interpolate_weighted_mean_inplace<
+                 xtnb::pytensor<t_float, 1>,
+                 xtnb::pytensor<double, 1>>,
+             DOC_ForwardGridder4D(interpolate_weighted_mean_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("st"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("add_slice_images",
+             &T_ForwardGridder4D::template add_slice_images<xtnb::pytensor<t_float, 3>>,
+             DOC_ForwardGridder4D(add_slice_images),
+             nb::arg("time_index"),
+             nb::arg("image_values"),
+             nb::arg("image_weights"))
+        .def("remove_slice",
+             &T_ForwardGridder4D::remove_slice,
+             DOC_ForwardGridder4D(remove_slice),
+             nb::arg("time_index"))
+        .def("clear", &T_ForwardGridder4D::clear, DOC_ForwardGridder4D(clear))
+        .def("get_time_index_fraction",
+             &T_ForwardGridder4D::get_time_index_fraction,
+             DOC_ForwardGridder4D(get_time_index_fraction),
+             nb::arg("t"))
+        .def("get_time_index",
+             &T_ForwardGridder4D::get_time_index,
+             DOC_ForwardGridder4D(get_time_index),
+             nb::arg("t"))
+        .def("get_time_value",
+             &T_ForwardGridder4D::get_time_value,
+             DOC_ForwardGridder4D(get_time_value),
+             nb::arg("time_index"))
+        .def("get_time_extent",
+             &T_ForwardGridder4D::get_time_extent,
+             DOC_ForwardGridder4D(get_time_extent),
+             nb::arg("time_index"))
+        .def("has_slice",
+             &T_ForwardGridder4D::has_slice,
+             DOC_ForwardGridder4D(has_slice),
+             nb::arg("time_index"))
+        .def("get_number_of_slices",
+             &T_ForwardGridder4D::get_number_of_slices,
+             DOC_ForwardGridder4D(get_number_of_slices))
+        .def("get_time_indices",
+             &T_ForwardGridder4D::get_time_indices,
+             DOC_ForwardGridder4D(get_time_indices))
+        .def("get_times", &T_ForwardGridder4D::get_times, DOC_ForwardGridder4D(get_times))
+        .def("get_slice",
+             &T_ForwardGridder4D::get_slice,
+             DOC_ForwardGridder4D(get_slice),
+             nb::arg("time_index"))
+        .def("get_images", &T_ForwardGridder4D::get_images, DOC_ForwardGridder4D(get_images))
+        .def("get_gridder", &T_ForwardGridder4D::get_gridder, DOC_ForwardGridder4D(get_gridder))
+        .def("get_tres", &T_ForwardGridder4D::get_tres, DOC_ForwardGridder4D(get_tres))
+        .def("get_tbase", &T_ForwardGridder4D::get_tbase, DOC_ForwardGridder4D(get_tbase))
+        __PYCLASS_DEFAULT_PRINTING__(T_ForwardGridder4D)
+        ;
+}
+
+void init_c_forwardgridder4d(nb::module_& m)
+{
+    init_ForwardGridder4D_float<double>(m, "");
+    init_ForwardGridder4D_float<float>(m, "F");
+}
+
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/array.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
+#include <nanobind/stl/vector.h>
+
+#include <fmt/format.h>
+
+#include <themachinethatgoesping/tools_nanobind/classhelper.hpp>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/forwardgriddern.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+
+namespace nb   = nanobind;
+namespace xtnb = xt::nanobind;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define DOC_ForwardGridderN(ARG)                                                                   \
+    DOC(themachinethatgoesping, algorithms, gridding, ForwardGridderN, ARG)
+
+template<typename t_float, size_t N>
+void init_ForwardGridderN_float(nb::module_& m, const std::string& suffix)
+{
+    using T_ForwardGridderN      = ForwardGridderN<t_float, N>;
+    using t_array                = std::array<t_float, N>;
+    using t_pytensor             = xtnb::pytensor<t_float, 1>;
+    using t_pytensor_2d          = xtnb::pytensor<t_float, 2>;
+    using t_pytensor_nd          = xtnb::pytensor<t_float, N>;
+    const std::string class_name = fmt::format("ForwardGridderN{}{}", N, suffix);
+
+    nb::class_<T_ForwardGridderN>(
+        m, class_name.c_str(), DOC(themachinethatgoesping, algorithms, gridding, ForwardGridderN))
+        .def(nb::init<const t_array&, const t_array&, const t_array&, const t_array&>(),
+             DOC_ForwardGridderN(ForwardGridderN),
+             nb::arg("res"),
+             nb::arg("min_values"),
+             nb::arg("max_values"),
+             nb::arg("base") = t_array{})
+        .def_static("from_data",
+                    &T_ForwardGridderN::template from_data<t_pytensor_2d>,
+                    DOC_ForwardGridderN(from_data),
+                    nb::arg("res"),
+                    nb::arg("s_coordinates"))
+        .def_static("from_res",
+                    &T_ForwardGridderN::from_res,
+                    DOC_ForwardGridderN(from_res),
+                    nb::arg("res"),
+                    nb::arg("min_values"),
+                    nb::arg("max_values"))
+        .def("get_empty_grd_images",
+             &T_ForwardGridderN::template get_empty_grd_images<t_pytensor_nd>,
+             DOC_ForwardGridderN(get_empty_grd_images))
+        .def("interpolate_block_mean",
+             &T_ForwardGridderN::template interpolate_block_mean<t_pytensor_nd,
+                                                                 t_pytensor_2d,
+                                                                 t_pytensor>,
+             DOC_ForwardGridderN(interpolate_block_mean),
+             nb::arg("s_coordinates"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_block_mean_inplace",
+             &T_ForwardGridderN::template interpolate_block_mean_inplace<t_pytensor_2d,
+                                                                         t_pytensor,
+                                                                         t_pytensor_nd>,
+             DOC_ForwardGridderN(interpolate_block_mean_inplace),
+             nb::arg("s_coordinates"),
+             nb::arg("s_val"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean",
+             &T_ForwardGridderN::template interpolate_weighted_mean<t_pytensor_nd,
+                                                                    t_pytensor_2d,
+                                                                    t_pytensor>,
+             DOC_ForwardGridderN(interpolate_weighted_mean),
+             nb::arg("s_coordinates"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean_inplace",
+             &T_ForwardGridderN::template interpolate_weighted_mean_inplace<t_pytensor_2d,
+                                                                            t_pytensor,
+                                                                            t_pytensor_nd>,
+             DOC_ForwardGridderN(interpolate_weighted_mean_inplace),
+             nb::arg("s_coordinates"),
+             nb::arg("s_val"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("get_res", &T_ForwardGridderN::get_res, DOC_ForwardGridderN(res))
+        .def("get_base", &T_ForwardGridderN::get_base, DOC_ForwardGridderN(base))
+        .def("get_min", &T_ForwardGridderN::get_min, DOC_ForwardGridderN(min))
+        .def("get_max", &T_ForwardGridderN::get_max, DOC_ForwardGridderN(max))
+        .def("get_n", &T_ForwardGridderN::get_n, DOC_ForwardGridderN(n))
+        .def("get_border_min", &T_ForwardGridderN::get_border_min, DOC_ForwardGridderN(border_min))
+        .def("get_border_max", &T_ForwardGridderN::get_border_max, DOC_ForwardGridderN(border_max))
+        .def("get_index",
+             &T_ForwardGridderN::get_index,
+             DOC_ForwardGridderN(get_index),
+             nb::arg("axis"),
+             nb::arg("value"))
+        .def("get_index_fraction",
+             &T_ForwardGridderN::get_index_fraction,
+             DOC_ForwardGridderN(get_index_fraction),
+             nb::arg("axis"),
+             nb::arg("value"))
+        .def("get_value",
+             &T_ForwardGridderN::get_value,
+             DOC_ForwardGridderN(get_value),
+             nb::arg("axis"),
+             nb::arg("index"))
+        .def("get_grd_value",
+             &T_ForwardGridderN::get_grd_value,
+             DOC_ForwardGridderN(get_grd_value),
+             nb::arg("axis"),
+             nb::arg("value"))
+        .def("get_extent",
+             &T_ForwardGridderN::get_extent,
+             DOC_ForwardGridderN(get_extent),
+             nb::arg("axis"))
+        .def("get_coordinates",
+             &T_ForwardGridderN::get_coordinates,
+             DOC_ForwardGridderN(get_coordinates),
+             nb::arg("axis"))
+        .def("__eq__",
+             &T_ForwardGridderN::operator==,
+             DOC_ForwardGridderN(operator_eq),
+             nb::arg("other"))
+        __PYCLASS_DEFAULT_COPY__(T_ForwardGridderN)
+        __PYCLASS_DEFAULT_BINARY__(T_ForwardGridderN)
+        __PYCLASS_DEFAULT_PRINTING__(T_ForwardGridderN)
+        ;
+}
+
+void init_c_forwardgriddern(nb::module_& m)
+{
+    init_ForwardGridderN_float<double, 1>(m, "");
+    init_ForwardGridderN_float<float, 1>(m, "F");
+    init_ForwardGridderN_float<double, 2>(m, "");
+    init_ForwardGridderN_float<float, 2>(m, "F");
+    init_ForwardGridderN_float<double, 3>(m, "");
+    init_ForwardGridderN_float<float, 3>(m, "F");
+    init_ForwardGridderN_float<double, 4>(m, "");
+    init_ForwardGridderN_float<float, 4>(m, "F");
+}
+
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
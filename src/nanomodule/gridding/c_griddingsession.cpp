@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/array.h>
+#include <nanobind/stl/string.h>
+
+#include <fmt/format.h>
+
+#include <themachinethatgoesping/tools_nanobind/classhelper.hpp>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/griddingsession.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+
+namespace nb   = nanobind;
+namespace xtnb = xt::nanobind;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define DOC_GriddingSession(ARG)                                                                   \
+    DOC(themachinethatgoesping, algorithms, gridding, GriddingSession, ARG)
+
+template<typename t_float, size_t Dim>
+void init_GriddingSession_float(nb::module_& m, const std::string& suffix)
+{
+    using T_GriddingSession      = GriddingSession<t_float, Dim>;
+    using t_pytensor             = xtnb::pytensor<t_float, 1>;
+    const std::string class_name = fmt::format("GriddingSession{}D{}", Dim, suffix);
+
+    auto cls = nb::class_<T_GriddingSession>(
+        m, class_name.c_str(), DOC(themachinethatgoesping, algorithms, gridding, GriddingSession));
+
+    cls.def(nb::init<const std::array<t_float, Dim>&,
+                     size_t,
+                     const std::array<t_float, Dim>&,
+                     size_t>(),
+            DOC_GriddingSession(GriddingSession),
+            nb::arg("res"),
+            nb::arg("chunk_size") = 64,
+            nb::arg("base")       = std::array<t_float, Dim>{},
+            nb::arg("max_cells")  = size_t(1) << 28);
+
+    if constexpr (Dim == 2)
+    {
+        cls.def("add_block_mean",
+                &T_GriddingSession::template add_block_mean<t_pytensor>,
+                DOC_GriddingSession(add_block_mean),
+                nb::arg("sx"),
+                nb::arg("sy"),
+                nb::arg("s_val"),
+                nb::arg("mp_cores") = 1)
+            .def("add_weighted_mean",
+                 &T_GriddingSession::template add_weighted_mean<t_pytensor>,
+                 DOC_GriddingSession(add_weighted_mean),
+                 nb::arg("sx"),
+                 nb::arg("sy"),
+                 nb::arg("s_val"),
+                 nb::arg("mp_cores") = 1);
+    }
+    else
+    {
+        cls.def("add_block_mean",
+                &T_GriddingSession::template add_block_mean<t_pytensor>,
+                DOC_GriddingSession(add_block_mean_2),
+                nb::arg("sx"),
+                nb::arg("sy"),
+                nb::arg("sz"),
+                nb::arg("s_val"),
+                nb::arg("mp_cores") = 1)
+            .def("add_weighted_mean",
+                 &T_GriddingSession::template add_weighted_mean<t_pytensor>,
+                 DOC_GriddingSession(add_weighted_mean_2),
+                 nb::arg("sx"),
+                 nb::arg("sy"),
+                 nb::arg("sz"),
+                 nb::arg("s_val"),
+                 nb::arg("mp_cores") = 1);
+    }
+
+    cls.def("grow_to_cells",
+            &T_GriddingSession::grow_to_cells,
+            DOC_GriddingSession(grow_to_cells),
+            nb::arg("lo"),
+            nb::arg("hi"))
+        .def("clear", &T_GriddingSession::clear, DOC_GriddingSession(clear))
+        .def("get_image_values",
+             &T_GriddingSession::get_image_values,
+             nb::rv_policy::reference_internal,
+             DOC_GriddingSession(get_image_values))
+        .def("get_image_weights",
+             &T_GriddingSession::get_image_weights,
+             nb::rv_policy::reference_internal,
+             DOC_GriddingSession(get_image_weights))
+        .def("get_image",
+             &T_GriddingSession::get_image,
+             nb::rv_policy::reference_internal,
+             DOC_GriddingSession(get_image))
+        .def("empty", &T_GriddingSession::empty, DOC_GriddingSession(empty))
+        .def("get_chunk_size",
+             &T_GriddingSession::get_chunk_size,
+             DOC_GriddingSession(get_chunk_size))
+        .def("get_max_cells",
+             &T_GriddingSession::get_max_cells,
+             DOC_GriddingSession(get_max_cells))
+        .def("get_res", &T_GriddingSession::get_res, DOC_GriddingSession(get_res))
+        .def("get_base", &T_GriddingSession::get_base, DOC_GriddingSession(get_base))
+        .def("get_shape", &T_GriddingSession::get_shape, DOC_GriddingSession(get_shape))
+        .def("get_first_cell",
+             &T_GriddingSession::get_first_cell,
+             DOC_GriddingSession(get_first_cell))
+        .def("get_min", &T_GriddingSession::get_min, DOC_GriddingSession(get_min), nb::arg("axis"))
+        .def("get_max", &T_GriddingSession::get_max, DOC_GriddingSession(get_max), nb::arg("axis"))
+        .def("get_coordinates",
+             &T_GriddingSession::get_coordinates,
+             DOC_GriddingSession(get_coordinates),
+             nb::arg("axis"))
+        __PYCLASS_DEFAULT_PRINTING__(T_GriddingSession)
+        ;
+}
+
+void init_c_griddingsession(nb::module_& m)
+{
+    init_GriddingSession_float<double, 2>(m, "");
+    init_GriddingSession_float<float, 2>(m, "F");
+    init_GriddingSession_float<double, 3>(m, "");
+    init_GriddingSession_float<float, 3>(m, "F");
+}
+
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
+
+#include <themachinethatgoesping/tools_nanobind/classhelper.hpp>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/gridplan3d.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+
+namespace nb   = nanobind;
+namespace xtnb = xt::nanobind;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define DOC_GridPlan3D(ARG) DOC(themachinethatgoesping, algorithms, gridding, GridPlan3D, ARG)
+
+template<typename t_float>
+void init_GridPlan3D_float(nb::module_& m, const std::string& suffix)
+{
+    using T_GridPlan3D           = GridPlan3D<t_float>;
+    using t_pytensor             = xtnb::pytensor<t_float, 1>;
+    const std::string class_name = std::string("GridPlan3D") + suffix;
+
+    nb::class_<T_GridPlan3D>(
+        m, class_name.c_str(), DOC(themachinethatgoesping, algorithms, gridding, GridPlan3D))
+        .def_static("from_block_mean",
+                    &T_GridPlan3D::template from_block_mean<t_pytensor>,
+                    DOC_GridPlan3D(from_block_mean),
+                    nb::arg("gridder"),
+                    nb::arg("sx"),
+                    nb::arg("sy"),
+                    nb::arg("sz"))
+        .def_static("from_weighted_mean",
+                    &T_GridPlan3D::template from_weighted_mean<t_pytensor>,
+                    DOC_GridPlan3D(from_weighted_mean),
+                    nb::arg("gridder"),
+                    nb::arg("sx"),
+                    nb::arg("sy"),
+                    nb::arg("sz"))
+        .def("apply",
+             &T_GridPlan3D::template apply<xtnb::pytensor<t_float, 3>, t_pytensor>,
+             DOC_GridPlan3D(apply),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("apply_inplace",
+             &T_GridPlan3D::template apply_inplace<t_pytensor, xtnb::pytensor<t_float, 3>>,
+             DOC_GridPlan3D(apply_inplace),
+             nb::arg("s_val"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("apply_stack",
+             &T_GridPlan3D::template apply_stack<xtnb::pytensor<t_float, 4>,
+                                                 xtnb::pytensor<t_float, 2>>,
+             DOC_GridPlan3D(apply_stack),
+             nb::arg("s_vals"),
+             nb::arg("mp_cores") = 1)
+        .def("apply_stack_inplace",
+             &T_GridPlan3D::template apply_stack_inplace<xtnb::pytensor<t_float, 2>,
+                                                         xtnb::pytensor<t_float, 4>>,
+             DOC_GridPlan3D(apply_stack_inplace),
+             nb::arg("s_vals"),
+             nb::arg("image_values").noconvert(),
+             nb::arg("image_weights").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("get_gridder", &T_GridPlan3D::get_gridder, DOC_GridPlan3D(get_gridder))
+        .def("get_number_of_points",
+             &T_GridPlan3D::get_number_of_points,
+             DOC_GridPlan3D(get_number_of_points))
+        .def("get_number_of_entries",
+             &T_GridPlan3D::get_number_of_entries,
+             DOC_GridPlan3D(get_number_of_entries))
+        __PYCLASS_DEFAULT_PRINTING__(T_GridPlan3D)
+        ;
+}
+
+void init_c_gridplan3d(nb::module_& m)
+{
+    init_GridPlan3D_float<double>(m, "");
+    init_GridPlan3D_float<float>(m, "F");
+}
+
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
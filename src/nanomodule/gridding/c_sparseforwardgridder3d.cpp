@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
+
+#include <themachinethatgoesping/tools_nanobind/classhelper.hpp>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/sparseforwardgridder3d.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+
+namespace nb   = nanobind;
+namespace xtnb = xt::nanobind;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define DOC_SparseForwardGridder3D(ARG)                                                            \
+    DOC(themachinethatgoesping, algorithms, gridding, SparseForwardGridder3D, ARG)
+
+template<typename t_float>
+void init_SparseForwardGridder3D_float(nb::module_& m, const std::string& suffix)
+{
+    using T_SparseForwardGridder3D = SparseForwardGridder3D<t_float>;
+    const std::string class_name   = std::string("SparseForwardGridder3D") + suffix;
+
+    nb::class_<T_SparseForwardGridder3D>(
+        m,
+        class_name.c_str(),
+        DOC(themachinethatgoesping, algorithms, gridding, SparseForwardGridder3D))
+        .def(nb::init<ForwardGridder3D<t_float>>(),
+             DOC_SparseForwardGridder3D(SparseForwardGridder3D),
+             nb::arg("gridder"))
+        .def("interpolate_block_mean_inplace",
+             &T_SparseForwardGridder3D::template interpolate_block_mean_inplace<
+                 xtnb::pytensor<t_float, 1>>,
+             DOC_SparseForwardGridder3D(interpolate_block_mean_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean_inplace",
+             &T_SparseForwardGridder3D::template interpolate_weighted_mean_inplace<
+                 xtnb::pytensor<t_float, 1>>,
+             DOC_SparseForwardGridder3D(interpolate_weighted_mean_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("clear", &T_SparseForwardGridder3D::clear, DOC_SparseForwardGridder3D(clear))
+        .def("get_cells",
+             &T_SparseForwardGridder3D::get_cells,
+             DOC_SparseForwardGridder3D(get_cells))
+        .def("get_images",
+             &T_SparseForwardGridder3D::get_images,
+             DOC_SparseForwardGridder3D(get_images))
+        .def("get_gridder",
+             &T_SparseForwardGridder3D::get_gridder,
+             DOC_SparseForwardGridder3D(get_gridder))
+        .def("get_number_of_cells",
+             &T_SparseForwardGridder3D::get_number_of_cells,
+             DOC_SparseForwardGridder3D(get_number_of_cells))
+        .def("get_capacity",
+             &T_SparseForwardGridder3D::get_capacity,
+             DOC_SparseForwardGridder3D(get_capacity))
+        __PYCLASS_DEFAULT_PRINTING__(T_SparseForwardGridder3D)
+        ;
+}
+
+void init_c_sparseforwardgridder3d(nb::module_& m)
+{
+    init_SparseForwardGridder3D_float<double>(m, "");
+    init_SparseForwardGridder3D_float<float>(m, "F");
+}
+
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/array.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
+#include <nanobind/stl/vector.h>
+
+#include <themachinethatgoesping/tools_nanobind/classhelper.hpp>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/tiledforwardgridder3d.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+
+namespace nb   = nanobind;
+namespace xtnb = xt::nanobind;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define DOC_TiledForwardGridder3D(ARG)                                                             \
+    DOC(themachinethatgoesping, algorithms, gridding, TiledForwardGridder3D, ARG)
+
+template<typename t_float>
+void init_TiledForwardGridder3D_float(nb::module_& m, const std::string& suffix)
+{
+    using T_TiledForwardGridder3D = TiledForwardGridder3D<t_float>;
+    const std::string class_name  = std::string("TiledForwardGridder3D") + suffix;
+
+    nb::class_<T_TiledForwardGridder3D>(
+        m,
+        class_name.c_str(),
+        DOC(themachinethatgoesping, algorithms, gridding, TiledForwardGridder3D))
+        .def(nb::init<ForwardGridder3D<t_float>, int, int, int, std::string>(),
+             DOC_TiledForwardGridder3D(TiledForwardGridder3D),
+             nb::arg("gridder"),
+             nb::arg("tile_nx"),
+             nb::arg("tile_ny"),
+             nb::arg("tile_nz"),
+             nb::arg("tile_directory") = "")
+        .def("interpolate_block_mean_inplace",
+             &T_TiledForwardGridder3D::template interpolate_block_mean_inplace<
+                 xtnb::pytensor<t_float, 1>>,
+             DOC_TiledForwardGridder3D(interpolate_block_mean_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("interpolate_weighted_mean_inplace",
+             &T_TiledForwardGridder3D::template interpolate_weighted_mean_inplace<
+                 xtnb::pytensor<t_float, 1>>,
+             DOC_TiledForwardGridder3D(interpolate_weighted_mean_inplace),
+             nb::arg("sx"),
+             nb::arg("sy"),
+             nb::arg("sz"),
+             nb::arg("s_val"),
+             nb::arg("mp_cores") = 1)
+        .def("get_tile_indices",
+             &T_TiledForwardGridder3D::get_tile_indices,
+             DOC_TiledForwardGridder3D(get_tile_indices))
+        .def("get_loaded_tile_indices",
+             &T_TiledForwardGridder3D::get_loaded_tile_indices,
+             DOC_TiledForwardGridder3D(get_loaded_tile_indices))
+        .def("get_flushed_tile_indices",
+             &T_TiledForwardGridder3D::get_flushed_tile_indices,
+             DOC_TiledForwardGridder3D(get_flushed_tile_indices))
+        .def("get_tile_shape",
+             &T_TiledForwardGridder3D::get_tile_shape,
+             DOC_TiledForwardGridder3D(get_tile_shape),
+             nb::arg("tile_index"))
+        .def("get_tile_images",
+             &T_TiledForwardGridder3D::get_tile_images,
+             DOC_TiledForwardGridder3D(get_tile_images),
+             nb::arg("tile_index"))
+        .def("get_images",
+             &T_TiledForwardGridder3D::get_images,
+             DOC_TiledForwardGridder3D(get_images))
+        .def("flush_tiles",
+             &T_TiledForwardGridder3D::flush_tiles,
+             DOC_TiledForwardGridder3D(flush_tiles),
+             nb::arg("tile_indices"))
+        .def("flush_all_tiles",
+             &T_TiledForwardGridder3D::flush_all_tiles,
+             DOC_TiledForwardGridder3D(flush_all_tiles))
+        .def("clear", &T_TiledForwardGridder3D::clear, DOC_TiledForwardGridder3D(clear))
+        .def("get_tile_file",
+             &T_TiledForwardGridder3D::get_tile_file,
+             DOC_TiledForwardGridder3D(get_tile_file),
+             nb::arg("tile_index"))
+        .def("get_gridder",
+             &T_TiledForwardGridder3D::get_gridder,
+             DOC_TiledForwardGridder3D(get_gridder))
+        .def("get_tile_nx",
+             &T_TiledForwardGridder3D::get_tile_nx,
+             DOC_TiledForwardGridder3D(get_tile_nx))
+        .def("get_tile_ny",
+             &T_TiledForwardGridder3D::get_tile_ny,
+             DOC_TiledForwardGridder3D(get_tile_ny))
+        .def("get_tile_nz",
+             &T_TiledForwardGridder3D::get_tile_nz,
+             DOC_TiledForwardGridder3D(get_tile_nz))
+        .def("get_tile_directory",
+             &T_TiledForwardGridder3D::get_tile_directory,
+             DOC_TiledForwardGridder3D(get_tile_directory))
+        .def("get_number_of_tiles_x",
+             &T_TiledForwardGridder3D::get_number_of_tiles_x,
+             DOC_TiledForwardGridder3D(get_number_of_tiles_x))
+        .def("get_number_of_tiles_y",
+             &T_TiledForwardGridder3D::get_number_of_tiles_y,
+             DOC_TiledForwardGridder3D(get_number_of_tiles_y))
+        .def("get_number_of_tiles_z",
+             &T_TiledForwardGridder3D::get_number_of_tiles_z,
+             DOC_TiledForwardGridder3D(get_number_of_tiles_z))
+        __PYCLASS_DEFAULT_PRINTING__(T_TiledForwardGridder3D)
+        ;
+}
+
+void init_c_tiledforwardgridder3d(nb::module_& m)
+{
+    init_TiledForwardGridder3D_float<double>(m, "");
+    init_TiledForwardGridder3D_float<float>(m, "F");
+}
+
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
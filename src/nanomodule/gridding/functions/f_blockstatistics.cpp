@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/functions/blockstatistics.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+namespace py_functions {
+
+#define DOC_gridding_functions(ARG) DOC(themachinethatgoesping, algorithms, gridding, functions, ARG)
+
+template<typename t_float, size_t Dim>
+void init_histogram_quantile(nanobind::module_& m)
+{
+    namespace nb  = nanobind;
+    namespace xnb = xt::nanobind;
+    using namespace gridding::functions;
+
+    m.def("histogram_quantile",
+          nb::overload_cast<const xnb::pytensor<t_float, Dim + 1>&,
+                            const t_float,
+                            const t_float,
+                            const t_float,
+                            const int>(
+              &histogram_quantile<xnb::pytensor<t_float, Dim>,
+                                  xnb::pytensor<t_float, Dim + 1>,
+                                  t_float>),
+          DOC_gridding_functions(histogram_quantile),
+          nb::arg("image_histogram").noconvert(),
+          nb::arg("hist_min"),
+          nb::arg("hist_max"),
+          nb::arg("quantile") = 0.5,
+          nb::arg("mp_cores") = 1);
+}
+
+void init_f_blockstatistics(nanobind::module_& m)
+{
+    init_histogram_quantile<float, 1>(m);
+    init_histogram_quantile<float, 2>(m);
+    init_histogram_quantile<float, 3>(m);
+    init_histogram_quantile<double, 1>(m);
+    init_histogram_quantile<double, 2>(m);
+    init_histogram_quantile<double, 3>(m);
+}
+
+} // namespace py_functions
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -51,6 +51,30 @@ void init_gridfunctions(nanobind::module_& m)
           nb::arg("sy").noconvert(),
           nb::arg("sz").noconvert(),
           nb::arg("mp_cores") = 1);
+    m.def("get_minmax_count",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&, const int>(
+              &get_minmax_count<xnb::pytensor<t_float, 1>>),
+          DOC_gridding_functions(get_minmax_count),
+          nb::arg("sv").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("get_minmax_count",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const int>(&get_minmax_count<xnb::pytensor<t_float, 1>>),
+          DOC_gridding_functions(get_minmax_count_2),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("get_minmax_count",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const int>(&get_minmax_count<xnb::pytensor<t_float, 1>>),
+          DOC_gridding_functions(get_minmax_count_3),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sz").noconvert(),
+          nb::arg("mp_cores") = 1);
 
     m.def("get_index",
           nb::overload_cast<const t_float, const t_float, const t_float>(&get_index<t_float>),
@@ -122,6 +146,75 @@ void init_gridfunctions(nanobind::module_& m)
           nb::arg("xres"),
           nb::arg("nx"));
 
+    m.def("group_blocks_csr",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const int>(&group_blocks_csr<xnb::pytensor<t_float, 1>, t_float, int>),
+          DOC_gridding_functions(group_blocks_csr),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sz").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("zmin"),
+          nb::arg("zres"),
+          nb::arg("nz"),
+          nb::arg("mp_cores") = 1);
+
+    m.def("group_blocks_csr",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const int>(&group_blocks_csr<xnb::pytensor<t_float, 1>, t_float, int>),
+          DOC_gridding_functions(group_blocks_csr_2),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("mp_cores") = 1);
+
+    m.def("group_blocks_csr",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const int>(&group_blocks_csr<xnb::pytensor<t_float, 1>, t_float, int>),
+          DOC_gridding_functions(group_blocks_csr_3),
+          nb::arg("sx").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("mp_cores") = 1);
+
     m.def("get_index_fraction",
           nb::overload_cast<const t_float, const t_float, const t_float>(
               &get_index_fraction<t_float>),
@@ -176,7 +269,8 @@ void init_gridfunctions(nanobind::module_& m)
                             const t_float,
                             const int,
                             xnb::pytensor<t_float, 3>&,
-                            xnb::pytensor<t_float, 3>&>(
+                            xnb::pytensor<t_float, 3>&,
+                            const int>(
               &grd_weighted_mean<xnb::pytensor<t_float, 1>, xnb::pytensor<t_float, 3>, t_float, int>),
           DOC_gridding_functions(grd_weighted_mean),
           nb::arg("sx").noconvert(),
@@ -193,7 +287,8 @@ void init_gridfunctions(nanobind::module_& m)
           nb::arg("zres"),
           nb::arg("nz"),
           nb::arg("image_values").noconvert(),
-          nb::arg("image_weights").noconvert());
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
     m.def("grd_weighted_mean",
           nb::overload_cast<const xnb::pytensor<t_float, 1>&,
                             const xnb::pytensor<t_float, 1>&,
@@ -205,7 +300,8 @@ void init_gridfunctions(nanobind::module_& m)
                             const t_float,
                             const int,
                             xnb::pytensor<t_float, 2>&,
-                            xnb::pytensor<t_float, 2>&>(
+                            xnb::pytensor<t_float, 2>&,
+                            const int>(
               &grd_weighted_mean<xnb::pytensor<t_float, 1>, xnb::pytensor<t_float, 2>, t_float, int>),
           DOC_gridding_functions(grd_weighted_mean_2),
           nb::arg("sx").noconvert(),
@@ -218,7 +314,8 @@ void init_gridfunctions(nanobind::module_& m)
           nb::arg("yres"),
           nb::arg("ny"),
           nb::arg("image_values").noconvert(),
-          nb::arg("image_weights").noconvert());
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
 
     m.def("grd_weighted_mean",
           nb::overload_cast<const xnb::pytensor<t_float, 1>&,
@@ -227,7 +324,8 @@ void init_gridfunctions(nanobind::module_& m)
                             const t_float,
                             const int,
                             xnb::pytensor<t_float, 1>&,
-                            xnb::pytensor<t_float, 1>&>(
+                            xnb::pytensor<t_float, 1>&,
+                            const int>(
               &grd_weighted_mean<xnb::pytensor<t_float, 1>, xnb::pytensor<t_float, 1>, t_float, int>),
           DOC_gridding_functions(grd_weighted_mean_3),
           nb::arg("sx").noconvert(),
@@ -236,7 +334,169 @@ void init_gridfunctions(nanobind::module_& m)
           nb::arg("xres"),
           nb::arg("nx"),
           nb::arg("image_values").noconvert(),
-          nb::arg("image_weights").noconvert());
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+
+    m.def("grd_weighted_mean_multichannel",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 2>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 4>&,
+                            xnb::pytensor<t_float, 4>&,
+                            const int>(&grd_weighted_mean_multichannel<xnb::pytensor<t_float, 1>,
+                                                                       xnb::pytensor<t_float, 2>,
+                                                                       xnb::pytensor<t_float, 4>,
+                                                                       t_float,
+                                                                       int>),
+          DOC_gridding_functions(grd_weighted_mean_multichannel),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sz").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("zmin"),
+          nb::arg("zres"),
+          nb::arg("nz"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_weighted_mean_multichannel",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 2>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 3>&,
+                            xnb::pytensor<t_float, 3>&,
+                            const int>(&grd_weighted_mean_multichannel<xnb::pytensor<t_float, 1>,
+                                                                       xnb::pytensor<t_float, 2>,
+                                                                       xnb::pytensor<t_float, 3>,
+                                                                       t_float,
+                                                                       int>),
+          DOC_gridding_functions(grd_weighted_mean_multichannel_2),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+
+    m.def("grd_weighted_mean_xsimd",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 3>&,
+                            xnb::pytensor<t_float, 3>&,
+                            const int>(
+              &grd_weighted_mean_xsimd<xnb::pytensor<t_float, 1>,
+                                       xnb::pytensor<t_float, 3>,
+                                       t_float,
+                                       int>),
+          DOC_gridding_functions(grd_weighted_mean_xsimd),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sz").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("zmin"),
+          nb::arg("zres"),
+          nb::arg("nz"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_weighted_mean_xsimd",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 2>&,
+                            xnb::pytensor<t_float, 2>&,
+                            const int>(
+              &grd_weighted_mean_xsimd<xnb::pytensor<t_float, 1>,
+                                       xnb::pytensor<t_float, 2>,
+                                       t_float,
+                                       int>),
+          DOC_gridding_functions(grd_weighted_mean_xsimd_2),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+
+    m.def("grd_weighted_mean_xsimd",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 1>&,
+                            xnb::pytensor<t_float, 1>&,
+                            const int>(
+              &grd_weighted_mean_xsimd<xnb::pytensor<t_float, 1>,
+                                       xnb::pytensor<t_float, 1>,
+                                       t_float,
+                                       int>),
+          DOC_gridding_functions(grd_weighted_mean_xsimd_3),
+          nb::arg("sx").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
 
     m.def("grd_block_mean",
           nb::overload_cast<const xnb::pytensor<t_float, 1>&,
@@ -253,7 +513,8 @@ void init_gridfunctions(nanobind::module_& m)
                             const t_float,
                             const int,
                             xnb::pytensor<t_float, 3>&,
-                            xnb::pytensor<t_float, 3>&>(
+                            xnb::pytensor<t_float, 3>&,
+                            const int>(
               &grd_block_mean<xnb::pytensor<t_float, 1>, xnb::pytensor<t_float, 3>, t_float, int>),
           DOC_gridding_functions(grd_block_mean),
           nb::arg("sx").noconvert(),
@@ -270,7 +531,8 @@ void init_gridfunctions(nanobind::module_& m)
           nb::arg("zres"),
           nb::arg("nz"),
           nb::arg("image_values").noconvert(),
-          nb::arg("image_weights").noconvert());
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
     m.def("grd_block_mean",
           nb::overload_cast<const xnb::pytensor<t_float, 1>&,
                             const xnb::pytensor<t_float, 1>&,
@@ -282,7 +544,8 @@ void init_gridfunctions(nanobind::module_& m)
                             const t_float,
                             const int,
                             xnb::pytensor<t_float, 2>&,
-                            xnb::pytensor<t_float, 2>&>(
+                            xnb::pytensor<t_float, 2>&,
+                            const int>(
               &grd_block_mean<xnb::pytensor<t_float, 1>, xnb::pytensor<t_float, 2>, t_float, int>),
           DOC_gridding_functions(grd_block_mean_2),
           nb::arg("sx").noconvert(),
@@ -295,7 +558,8 @@ void init_gridfunctions(nanobind::module_& m)
           nb::arg("yres"),
           nb::arg("ny"),
           nb::arg("image_values").noconvert(),
-          nb::arg("image_weights").noconvert());
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
     m.def("grd_block_mean",
           nb::overload_cast<const xnb::pytensor<t_float, 1>&,
                             const xnb::pytensor<t_float, 1>&,
@@ -303,7 +567,8 @@ void init_gridfunctions(nanobind::module_& m)
                             const t_float,
                             const int,
                             xnb::pytensor<t_float, 1>&,
-                            xnb::pytensor<t_float, 1>&>(
+                            xnb::pytensor<t_float, 1>&,
+                            const int>(
               &grd_block_mean<xnb::pytensor<t_float, 1>, xnb::pytensor<t_float, 1>, t_float, int>),
           DOC_gridding_functions(grd_block_mean_3),
           nb::arg("sx").noconvert(),
@@ -312,13 +577,405 @@ void init_gridfunctions(nanobind::module_& m)
           nb::arg("xres"),
           nb::arg("nx"),
           nb::arg("image_values").noconvert(),
-          nb::arg("image_weights").noconvert());
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+
+    m.def("grd_gaussian_splat",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            xnb::pytensor<t_float, 3>&,
+                            xnb::pytensor<t_float, 3>&,
+                            const int>(
+              &grd_gaussian_splat<xnb::pytensor<t_float, 1>,
+                                  xnb::pytensor<t_float, 3>,
+                                  t_float,
+                                  int>),
+          DOC_gridding_functions(grd_gaussian_splat),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sz").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("zmin"),
+          nb::arg("zres"),
+          nb::arg("nz"),
+          nb::arg("radius"),
+          nb::arg("sigma"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_gaussian_splat",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            xnb::pytensor<t_float, 2>&,
+                            xnb::pytensor<t_float, 2>&,
+                            const int>(
+              &grd_gaussian_splat<xnb::pytensor<t_float, 1>,
+                                  xnb::pytensor<t_float, 2>,
+                                  t_float,
+                                  int>),
+          DOC_gridding_functions(grd_gaussian_splat_2),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("radius"),
+          nb::arg("sigma"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_inverse_distance_splat",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            xnb::pytensor<t_float, 3>&,
+                            xnb::pytensor<t_float, 3>&,
+                            const int>(
+              &grd_inverse_distance_splat<xnb::pytensor<t_float, 1>,
+                                          xnb::pytensor<t_float, 3>,
+                                          t_float,
+                                          int>),
+          DOC_gridding_functions(grd_inverse_distance_splat),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sz").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("zmin"),
+          nb::arg("zres"),
+          nb::arg("nz"),
+          nb::arg("radius"),
+          nb::arg("power"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_inverse_distance_splat",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            xnb::pytensor<t_float, 2>&,
+                            xnb::pytensor<t_float, 2>&,
+                            const int>(
+              &grd_inverse_distance_splat<xnb::pytensor<t_float, 1>,
+                                          xnb::pytensor<t_float, 2>,
+                                          t_float,
+                                          int>),
+          DOC_gridding_functions(grd_inverse_distance_splat_2),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("radius"),
+          nb::arg("power"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+
+    // float64 partial sums in reused row tiles (useful for float32 images)
+    m.def("grd_weighted_mean_f64tiles",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 3>&,
+                            xnb::pytensor<t_float, 3>&,
+                            const int>(
+              &grd_weighted_mean<xnb::pytensor<t_float, 1>,
+                                 xnb::pytensor<t_float, 3>,
+                                 t_float,
+                                 int,
+                                 double>),
+          DOC_gridding_functions(grd_weighted_mean),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sz").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("zmin"),
+          nb::arg("zres"),
+          nb::arg("nz"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_weighted_mean_f64tiles",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 2>&,
+                            xnb::pytensor<t_float, 2>&,
+                            const int>(
+              &grd_weighted_mean<xnb::pytensor<t_float, 1>,
+                                 xnb::pytensor<t_float, 2>,
+                                 t_float,
+                                 int,
+                                 double>),
+          DOC_gridding_functions(grd_weighted_mean_2),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_weighted_mean_f64tiles",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 1>&,
+                            xnb::pytensor<t_float, 1>&,
+                            const int>(
+              &grd_weighted_mean<xnb::pytensor<t_float, 1>,
+                                 xnb::pytensor<t_float, 1>,
+                                 t_float,
+                                 int,
+                                 double>),
+          DOC_gridding_functions(grd_weighted_mean_3),
+          nb::arg("sx").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_block_mean_f64tiles",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 3>&,
+                            xnb::pytensor<t_float, 3>&,
+                            const int>(
+              &grd_block_mean<xnb::pytensor<t_float, 1>,
+                                 xnb::pytensor<t_float, 3>,
+                                 t_float,
+                                 int,
+                                 double>),
+          DOC_gridding_functions(grd_block_mean),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sz").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("zmin"),
+          nb::arg("zres"),
+          nb::arg("nz"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_block_mean_f64tiles",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 2>&,
+                            xnb::pytensor<t_float, 2>&,
+                            const int>(
+              &grd_block_mean<xnb::pytensor<t_float, 1>,
+                                 xnb::pytensor<t_float, 2>,
+                                 t_float,
+                                 int,
+                                 double>),
+          DOC_gridding_functions(grd_block_mean_2),
+          nb::arg("sx").noconvert(),
+          nb::arg("sy").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("ymin"),
+          nb::arg("yres"),
+          nb::arg("ny"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_block_mean_f64tiles",
+          nb::overload_cast<const xnb::pytensor<t_float, 1>&,
+                            const xnb::pytensor<t_float, 1>&,
+                            const t_float,
+                            const t_float,
+                            const int,
+                            xnb::pytensor<t_float, 1>&,
+                            xnb::pytensor<t_float, 1>&,
+                            const int>(
+              &grd_block_mean<xnb::pytensor<t_float, 1>,
+                                 xnb::pytensor<t_float, 1>,
+                                 t_float,
+                                 int,
+                                 double>),
+          DOC_gridding_functions(grd_block_mean_3),
+          nb::arg("sx").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("xmin"),
+          nb::arg("xres"),
+          nb::arg("nx"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+}
+
+template<typename t_float, size_t N>
+void init_gridfunctions_nd(nanobind::module_& m)
+{
+    namespace nb  = nanobind;
+    namespace xnb = xt::nanobind;
+    using namespace gridding::functions;
+
+    m.def("grd_weighted_mean_nd",
+          &grd_weighted_mean_nd<xnb::pytensor<t_float, 2>,
+                                xnb::pytensor<t_float, 1>,
+                                xnb::pytensor<t_float, N>,
+                                N,
+                                t_float,
+                                int>,
+          DOC_gridding_functions(grd_weighted_mean_nd),
+          nb::arg("s_coordinates").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("mins"),
+          nb::arg("ress"),
+          nb::arg("ns"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("grd_block_mean_nd",
+          &grd_block_mean_nd<xnb::pytensor<t_float, 2>,
+                             xnb::pytensor<t_float, 1>,
+                             xnb::pytensor<t_float, N>,
+                             N,
+                             t_float,
+                             int>,
+          DOC_gridding_functions(grd_block_mean_nd),
+          nb::arg("s_coordinates").noconvert(),
+          nb::arg("sv").noconvert(),
+          nb::arg("mins"),
+          nb::arg("ress"),
+          nb::arg("ns"),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
 }
 
 void init_f_gridfunctions(nanobind::module_& m)
 {
     init_gridfunctions<float>(m);
     init_gridfunctions<double>(m);
+
+    init_gridfunctions_nd<float, 1>(m);
+    init_gridfunctions_nd<double, 1>(m);
+    init_gridfunctions_nd<float, 2>(m);
+    init_gridfunctions_nd<double, 2>(m);
+    init_gridfunctions_nd<float, 3>(m);
+    init_gridfunctions_nd<double, 3>(m);
+    init_gridfunctions_nd<float, 4>(m);
+    init_gridfunctions_nd<double, 4>(m);
 }
 
 } // namespace py_functions
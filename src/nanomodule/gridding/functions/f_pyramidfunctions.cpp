@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/tuple.h>
+#include <xtensor-python/nanobind/pytensor.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/functions/pyramidfunctions.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace pymodule {
+namespace py_gridding {
+namespace py_functions {
+
+#define DOC_gridding_functions(ARG) DOC(themachinethatgoesping, algorithms, gridding, functions, ARG)
+
+template<typename t_float>
+void init_downsample_accumulators(nanobind::module_& m)
+{
+    namespace nb  = nanobind;
+    namespace xnb = xt::nanobind;
+    using namespace gridding::functions;
+
+    m.def("downsample_accumulators",
+          nb::overload_cast<const xnb::pytensor<t_float, 3>&,
+                            const xnb::pytensor<t_float, 3>&,
+                            const int>(&downsample_accumulators<xnb::pytensor<t_float, 3>>),
+          DOC_gridding_functions(downsample_accumulators),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+    m.def("downsample_accumulators",
+          nb::overload_cast<const xnb::pytensor<t_float, 2>&,
+                            const xnb::pytensor<t_float, 2>&,
+                            const int>(&downsample_accumulators<xnb::pytensor<t_float, 2>>),
+          DOC_gridding_functions(downsample_accumulators_2),
+          nb::arg("image_values").noconvert(),
+          nb::arg("image_weights").noconvert(),
+          nb::arg("mp_cores") = 1);
+}
+
+void init_f_pyramidfunctions(nanobind::module_& m)
+{
+    init_downsample_accumulators<float>(m);
+    init_downsample_accumulators<double>(m);
+}
+
+} // namespace py_functions
+} // namespace py_gridding
+} // namespace pymodule
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -7,6 +7,7 @@
 #include <cstddef>
 
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/vector.h>
 #include <xtensor-python/nanobind/pytensor.hpp>
 
 #include <themachinethatgoesping/algorithms/gridding/functions/resamplingfunctions.hpp>
@@ -57,6 +58,33 @@ void init_resamplingfunctions(nanobind::module_& m)
         nb::arg("grid_min")  = std::numeric_limits<t_float>::quiet_NaN(),
         nb::arg("grid_max")  = std::numeric_limits<t_float>::quiet_NaN(),
         nb::arg("max_steps") = 1024);
+
+    m.def(
+        "compute_resampled_coordinates",
+        [](const xnb::pytensor<t_float, 2>& values_min,
+           const xnb::pytensor<t_float, 2>& values_max,
+           const xnb::pytensor<t_float, 2>& values_res,
+           const xnb::pytensor<t_float, 1>& grid_min,
+           const xnb::pytensor<t_float, 1>& grid_max,
+           const std::size_t                  max_steps,
+           const int                          mp_cores) {
+            auto grid_min_xt = xt::xtensor<t_float, 1>::from_shape(grid_min.shape());
+            auto grid_max_xt = xt::xtensor<t_float, 1>::from_shape(grid_max.shape());
+
+            grid_min_xt = grid_min;
+            grid_max_xt = grid_max;
+
+            return compute_resampled_coordinates<xt::xtensor<t_float, 1>>(
+                values_min, values_max, values_res, grid_min_xt, grid_max_xt, max_steps, mp_cores);
+        },
+        DOC_gridding_functions(compute_resampled_coordinates_2),
+        nb::arg("values_min").noconvert(),
+        nb::arg("values_max").noconvert(),
+        nb::arg("values_res").noconvert(),
+        nb::arg("grid_min").noconvert(),
+        nb::arg("grid_max").noconvert(),
+        nb::arg("max_steps") = 1024,
+        nb::arg("mp_cores")  = 1);
 }
 
 void init_f_resamplingfunctions(nanobind::module_& m)
@@ -14,6 +14,8 @@ namespace nb = nanobind;
 
 void init_f_resamplingfunctions(nb::module_& m); // f_resamplingfunctions.cpp
 void init_f_gridfunctions(nb::module_& m);       // f_gridfunctions.cpp
+void init_f_blockstatistics(nb::module_& m);     // f_blockstatistics.cpp
+void init_f_pyramidfunctions(nb::module_& m);    // f_pyramidfunctions.cpp
 
 void init_m_functions(nb::module_& m)
 {
@@ -23,6 +25,8 @@ void init_m_functions(nb::module_& m)
 
     init_f_resamplingfunctions(submodule);
     init_f_gridfunctions(submodule);
+    init_f_blockstatistics(submodule);
+    init_f_pyramidfunctions(submodule);
 }
 
 } // namespace py_functions
@@ -13,9 +13,16 @@ namespace py_gridding {
 
 namespace nb = nanobind;
 
-void init_c_forwardgridder1d(nb::module_& m); // c_forwardgridder1d.cpp
-void init_c_forwardgridder2d(nb::module_& m); // c_forwardgridder2d.cpp
-void init_c_forwardgridder3d(nb::module_& m); // c_forwardgridder3d.cpp
+void init_c_backwardgridder(nb::module_& m);        // c_backwardgridder.cpp
+void init_c_forwardgridder1d(nb::module_& m);       // c_forwardgridder1d.cpp
+void init_c_forwardgridder2d(nb::module_& m);       // c_forwardgridder2d.cpp
+void init_c_forwardgridder3d(nb::module_& m);       // c_forwardgridder3d.cpp
+void init_c_forwardgridder4d(nb::module_& m);       // c_forwardgridder4d.cpp
+void init_c_forwardgriddern(nb::module_& m);        // c_forwardgriddern.cpp
+void init_c_griddingsession(nb::module_& m);        // c_griddingsession.cpp
+void init_c_gridplan3d(nb::module_& m);             // c_gridplan3d.cpp
+void init_c_sparseforwardgridder3d(nb::module_& m); // c_sparseforwardgridder3d.cpp
+void init_c_tiledforwardgridder3d(nb::module_& m);  // c_tiledforwardgridder3d.cpp
 
 void init_m_gridding(nb::module_& m)
 {
@@ -23,9 +30,16 @@ void init_m_gridding(nb::module_& m)
         "gridding", "Submodule for gridding (raytracers and georefencing) echosounder samples");
 
     py_functions::init_m_functions(submodule);
+    init_c_backwardgridder(submodule);
     init_c_forwardgridder1d(submodule);
     init_c_forwardgridder2d(submodule);
     init_c_forwardgridder3d(submodule);
+    init_c_forwardgridder4d(submodule);
+    init_c_forwardgriddern(submodule);
+    init_c_griddingsession(submodule);
+    init_c_gridplan3d(submodule);
+    init_c_sparseforwardgridder3d(submodule);
+    init_c_tiledforwardgridder3d(submodule);
 }
 
 } // namespace py_gridding
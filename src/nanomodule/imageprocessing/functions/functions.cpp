@@ -2,10 +2,14 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include <array>
+#include <cstdint>
 #include <optional>
+#include <string>
 #include <type_traits>
 
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/array.h>
 #include <nanobind/stl/optional.h>
 #include <nanobind/stl/vector.h>
 #include <nanobind/stl/tuple.h>
@@ -98,6 +102,57 @@ void init_find_local_maxima(nanobind::module_& m)
           nb::arg("threshold")   = std::nullopt,
           nb::arg("accept_nans") = true,
           nb::arg("mp_cores")    = 1);
+
+    // find_local_maxima_radius
+    m.def("find_local_maxima_radius",
+          nb::overload_cast<const xt::nanobind::pytensor<t_float, 3>&,
+                            const int,
+                            const int,
+                            const std::optional<t_float>,
+                            const bool,
+                            const std::optional<double>,
+                            const int>(
+              &find_local_maxima_radius<xt::nanobind::pytensor<t_float, 3>>),
+          DOC_imageprocessing_functions(find_local_maxima_radius),
+          nb::arg("data").noconvert(),
+          nb::arg("radius"),
+          nb::arg("connectivity") = 26,
+          nb::arg("threshold")    = std::nullopt,
+          nb::arg("accept_nans")  = true,
+          nb::arg("min_distance") = std::nullopt,
+          nb::arg("mp_cores")     = 1);
+
+    m.def("find_local_maxima_radius",
+          nb::overload_cast<const xt::nanobind::pytensor<t_float, 2>&,
+                            const int,
+                            const int,
+                            const std::optional<t_float>,
+                            const bool,
+                            const std::optional<double>,
+                            const int>(
+              &find_local_maxima_radius<xt::nanobind::pytensor<t_float, 2>>),
+          DOC_imageprocessing_functions(find_local_maxima_radius_2),
+          nb::arg("data").noconvert(),
+          nb::arg("radius"),
+          nb::arg("connectivity") = 8,
+          nb::arg("threshold")    = std::nullopt,
+          nb::arg("accept_nans")  = true,
+          nb::arg("min_distance") = std::nullopt,
+          nb::arg("mp_cores")     = 1);
+
+    m.def("find_local_maxima_radius",
+          nb::overload_cast<const xt::nanobind::pytensor<t_float, 1>&,
+                            const int,
+                            const std::optional<t_float>,
+                            const bool,
+                            const std::optional<double>>(
+              &find_local_maxima_radius<xt::nanobind::pytensor<t_float, 1>>),
+          DOC_imageprocessing_functions(find_local_maxima_radius_3),
+          nb::arg("data").noconvert(),
+          nb::arg("radius"),
+          nb::arg("threshold")    = std::nullopt,
+          nb::arg("accept_nans")  = true,
+          nb::arg("min_distance") = std::nullopt);
 }
 
 void init_uniform_axis(nanobind::module_& m)
@@ -127,6 +182,100 @@ void init_uniform_axis(nanobind::module_& m)
                 DOC_imageprocessing_functions(UniformAxis_size));
 }
 
+template<typename t_value>
+void init_backward_mapping_plan_methods(
+    nanobind::class_<imageprocessing::functions::BackwardMappingPlan>& cls)
+{
+    namespace nb = nanobind;
+    using imageprocessing::functions::BackwardMappingPlan;
+
+    cls.def(
+           "map_nearest",
+           [](const BackwardMappingPlan&                self,
+              const xt::nanobind::pytensor<t_value, 2>& reference,
+              const int                                 mp_cores) {
+               return xt::nanobind::pytensor<t_value, 2>(self.map_nearest(reference, mp_cores));
+           },
+           DOC_imageprocessing_functions(BackwardMappingPlan_map_nearest),
+           nb::arg("reference").noconvert(),
+           nb::arg("mp_cores") = 1)
+        .def(
+            "map_bilinear",
+            [](const BackwardMappingPlan&                self,
+               const xt::nanobind::pytensor<t_value, 2>& reference,
+               const int                                 mp_cores) {
+                return xt::nanobind::pytensor<t_value, 2>(self.map_bilinear(reference, mp_cores));
+            },
+            DOC_imageprocessing_functions(BackwardMappingPlan_map_bilinear),
+            nb::arg("reference").noconvert(),
+            nb::arg("mp_cores") = 1)
+        .def("map_nearest_add",
+             &BackwardMappingPlan::map_nearest_add<xt::nanobind::pytensor<t_value, 2>,
+                                                   xt::nanobind::pytensor<t_value, 2>>,
+             DOC_imageprocessing_functions(BackwardMappingPlan_map_nearest_add),
+             nb::arg("reference").noconvert(),
+             nb::arg("target").noconvert(),
+             nb::arg("mp_cores") = 1)
+        .def("map_bilinear_add",
+             &BackwardMappingPlan::map_bilinear_add<xt::nanobind::pytensor<t_value, 2>,
+                                                    xt::nanobind::pytensor<t_value, 2>>,
+             DOC_imageprocessing_functions(BackwardMappingPlan_map_bilinear_add),
+             nb::arg("reference").noconvert(),
+             nb::arg("target").noconvert(),
+             nb::arg("mp_cores") = 1);
+}
+
+void init_backward_mapping_plan(nanobind::module_& m)
+{
+    namespace nb = nanobind;
+    using imageprocessing::functions::BackwardMappingPlan;
+    using imageprocessing::functions::UniformAxis;
+
+    auto cls =
+        nb::class_<BackwardMappingPlan>(
+            m, "BackwardMappingPlan", DOC_imageprocessing_functions(BackwardMappingPlan))
+            .def(nb::init<const xt::nanobind::pytensor<double, 1>&,
+                          const xt::nanobind::pytensor<double, 1>&,
+                          const xt::nanobind::pytensor<double, 1>&,
+                          const xt::nanobind::pytensor<double, 1>&>(),
+                 DOC_imageprocessing_functions(BackwardMappingPlan_BackwardMappingPlan_2),
+                 nb::arg("reference_x").noconvert(),
+                 nb::arg("reference_y").noconvert(),
+                 nb::arg("new_x").noconvert(),
+                 nb::arg("new_y").noconvert())
+            .def(nb::init<const xt::nanobind::pytensor<float, 1>&,
+                          const xt::nanobind::pytensor<float, 1>&,
+                          const xt::nanobind::pytensor<float, 1>&,
+                          const xt::nanobind::pytensor<float, 1>&>(),
+                 DOC_imageprocessing_functions(BackwardMappingPlan_BackwardMappingPlan_2),
+                 nb::arg("reference_x").noconvert(),
+                 nb::arg("reference_y").noconvert(),
+                 nb::arg("new_x").noconvert(),
+                 nb::arg("new_y").noconvert())
+            .def(nb::init<const UniformAxis&,
+                          const UniformAxis&,
+                          const UniformAxis&,
+                          const UniformAxis&>(),
+                 DOC_imageprocessing_functions(BackwardMappingPlan_BackwardMappingPlan_3),
+                 nb::arg("reference_x"),
+                 nb::arg("reference_y"),
+                 nb::arg("new_x"),
+                 nb::arg("new_y"))
+            .def_prop_ro("reference_x_size", &BackwardMappingPlan::get_reference_x_size)
+            .def_prop_ro("reference_y_size", &BackwardMappingPlan::get_reference_y_size)
+            .def_prop_ro("new_x_size", &BackwardMappingPlan::get_new_x_size)
+            .def_prop_ro("new_y_size", &BackwardMappingPlan::get_new_y_size)
+            .def_prop_ro("nearest_x", &BackwardMappingPlan::get_nearest_x)
+            .def_prop_ro("nearest_y", &BackwardMappingPlan::get_nearest_y);
+
+    init_backward_mapping_plan_methods<double>(cls);
+    init_backward_mapping_plan_methods<float>(cls);
+    init_backward_mapping_plan_methods<int64_t>(cls);
+    init_backward_mapping_plan_methods<int32_t>(cls);
+    init_backward_mapping_plan_methods<int16_t>(cls);
+    init_backward_mapping_plan_methods<int8_t>(cls);
+}
+
 template<typename t_value, typename t_coordinate>
 void init_backward_mapping(nanobind::module_& m)
 {
@@ -284,6 +433,322 @@ void init_grow_regions(nanobind::module_& m)
           nb::arg("force_negative_gradient") = true,
           nb::arg("eat_neighbor_regions")    = false,
           nb::arg("mp_cores")                = 1);
+
+    m.def("grow_regions_until_converged",
+          nb::overload_cast<xt::nanobind::pytensor<t_region, 3>&,
+                            const xt::nanobind::pytensor<t_value, 3>&,
+                            const t_region,
+                            const std::optional<t_value>,
+                            const bool,
+                            const bool,
+                            const std::optional<int64_t>,
+                            const int>(
+              &grow_regions_until_converged<xt::nanobind::pytensor<t_region, 3>,
+                                            xt::nanobind::pytensor<t_value, 3>>),
+          DOC_imageprocessing_functions(grow_regions_until_converged),
+          nb::arg("region_volume").noconvert(),
+          nb::arg("data_volume").noconvert(),
+          nb::arg("null_region")             = 0,
+          nb::arg("threshold")               = std::nullopt,
+          nb::arg("force_negative_gradient") = true,
+          nb::arg("eat_neighbor_regions")    = false,
+          nb::arg("max_iterations")          = std::nullopt,
+          nb::arg("mp_cores")                = 1);
+
+    m.def("grow_regions_until_converged",
+          nb::overload_cast<xt::nanobind::pytensor<t_region, 2>&,
+                            const xt::nanobind::pytensor<t_value, 2>&,
+                            const t_region,
+                            const std::optional<t_value>,
+                            const bool,
+                            const bool,
+                            const std::optional<int64_t>,
+                            const int>(
+              &grow_regions_until_converged<xt::nanobind::pytensor<t_region, 2>,
+                                            xt::nanobind::pytensor<t_value, 2>>),
+          DOC_imageprocessing_functions(grow_regions_until_converged_2),
+          nb::arg("region_image").noconvert(),
+          nb::arg("data_image").noconvert(),
+          nb::arg("null_region")             = 0,
+          nb::arg("threshold")               = std::nullopt,
+          nb::arg("force_negative_gradient") = true,
+          nb::arg("eat_neighbor_regions")    = false,
+          nb::arg("max_iterations")          = std::nullopt,
+          nb::arg("mp_cores")                = 1);
+
+    m.def("grow_regions_until_converged",
+          nb::overload_cast<xt::nanobind::pytensor<t_region, 1>&,
+                            const xt::nanobind::pytensor<t_value, 1>&,
+                            const t_region,
+                            const std::optional<t_value>,
+                            const bool,
+                            const bool,
+                            const std::optional<int64_t>,
+                            const int>(
+              &grow_regions_until_converged<xt::nanobind::pytensor<t_region, 1>,
+                                            xt::nanobind::pytensor<t_value, 1>>),
+          DOC_imageprocessing_functions(grow_regions_until_converged_3),
+          nb::arg("region_vector").noconvert(),
+          nb::arg("data_vector").noconvert(),
+          nb::arg("null_region")             = 0,
+          nb::arg("threshold")               = std::nullopt,
+          nb::arg("force_negative_gradient") = true,
+          nb::arg("eat_neighbor_regions")    = false,
+          nb::arg("max_iterations")          = std::nullopt,
+          nb::arg("mp_cores")                = 1);
+}
+
+template<typename t_region>
+void init_region_statistics_class(nanobind::module_& m, const std::string& suffix)
+{
+    namespace nb = nanobind;
+    using imageprocessing::functions::RegionStatistics;
+    using t_statistics = RegionStatistics<t_region>;
+
+    nb::class_<t_statistics>(m,
+                             ("RegionStatistics_" + suffix).c_str(),
+                             DOC_imageprocessing_functions(RegionStatistics))
+        .def_ro("regions",
+                &t_statistics::regions,
+                DOC_imageprocessing_functions(RegionStatistics_regions))
+        .def_ro("voxel_counts",
+                &t_statistics::voxel_counts,
+                DOC_imageprocessing_functions(RegionStatistics_voxel_counts))
+        .def_prop_ro(
+            "centroids",
+            [](const t_statistics& self) {
+                return xt::nanobind::pytensor<double, 2>(self.centroids);
+            },
+            DOC_imageprocessing_functions(RegionStatistics_centroids))
+        .def_prop_ro(
+            "bbox_min",
+            [](const t_statistics& self) {
+                return xt::nanobind::pytensor<int64_t, 2>(self.bbox_min);
+            },
+            DOC_imageprocessing_functions(RegionStatistics_bbox_min))
+        .def_prop_ro(
+            "bbox_max",
+            [](const t_statistics& self) {
+                return xt::nanobind::pytensor<int64_t, 2>(self.bbox_max);
+            },
+            DOC_imageprocessing_functions(RegionStatistics_bbox_max))
+        .def_prop_ro(
+            "valid_counts",
+            [](const t_statistics& self) {
+                return xt::nanobind::pytensor<int64_t, 2>(self.valid_counts);
+            },
+            DOC_imageprocessing_functions(RegionStatistics_valid_counts))
+        .def_prop_ro(
+            "sums",
+            [](const t_statistics& self) {
+                return xt::nanobind::pytensor<double, 2>(self.sums);
+            },
+            DOC_imageprocessing_functions(RegionStatistics_sums))
+        .def_prop_ro(
+            "means",
+            [](const t_statistics& self) {
+                return xt::nanobind::pytensor<double, 2>(self.means);
+            },
+            DOC_imageprocessing_functions(RegionStatistics_means))
+        .def_prop_ro(
+            "maxima",
+            [](const t_statistics& self) {
+                return xt::nanobind::pytensor<double, 2>(self.maxima);
+            },
+            DOC_imageprocessing_functions(RegionStatistics_maxima))
+        .def("__len__", &t_statistics::size);
+}
+
+template<typename t_region, typename t_value>
+void init_region_statistics(nanobind::module_& m)
+{
+    namespace nb = nanobind;
+    using namespace imageprocessing::functions;
+
+    m.def("compute_region_statistics",
+          &compute_region_statistics<xt::nanobind::pytensor<t_region, 3>,
+                                     xt::nanobind::pytensor<t_value, 3>>,
+          DOC_imageprocessing_functions(compute_region_statistics),
+          nb::arg("region_volume").noconvert(),
+          nb::arg("data_volumes").noconvert(),
+          nb::arg("null_region")  = 0,
+          nb::arg("db_to_linear") = false,
+          nb::arg("mp_cores")     = 1);
+
+    m.def("compute_region_statistics",
+          &compute_region_statistics<xt::nanobind::pytensor<t_region, 2>,
+                                     xt::nanobind::pytensor<t_value, 2>>,
+          DOC_imageprocessing_functions(compute_region_statistics_2),
+          nb::arg("region_image").noconvert(),
+          nb::arg("data_images").noconvert(),
+          nb::arg("null_region")  = 0,
+          nb::arg("db_to_linear") = false,
+          nb::arg("mp_cores")     = 1);
+}
+
+template<typename t_region>
+void init_region_statistics_region_type(nanobind::module_& m, const std::string& suffix)
+{
+    init_region_statistics_class<t_region>(m, suffix);
+    init_region_statistics<t_region, double>(m);
+    init_region_statistics<t_region, float>(m);
+}
+
+template<typename t_mask>
+void init_label_connected_components(nanobind::module_& m)
+{
+    namespace nb = nanobind;
+    using namespace imageprocessing::functions;
+
+    m.def(
+        "label_connected_components",
+        [](const xt::nanobind::pytensor<t_mask, 3>& mask,
+           const int                                connectivity,
+           const int                                mp_cores) {
+            auto [regions, voxel_counts, bbox_min, bbox_max] =
+                label_connected_components<int64_t>(mask, connectivity, mp_cores);
+            return std::make_tuple(xt::nanobind::pytensor<int64_t, 3>(std::move(regions)),
+                                   std::move(voxel_counts),
+                                   xt::nanobind::pytensor<int64_t, 2>(std::move(bbox_min)),
+                                   xt::nanobind::pytensor<int64_t, 2>(std::move(bbox_max)));
+        },
+        DOC_imageprocessing_functions(label_connected_components),
+        nb::arg("mask").noconvert(),
+        nb::arg("connectivity") = 26,
+        nb::arg("mp_cores")     = 1);
+
+    m.def(
+        "label_connected_components",
+        [](const xt::nanobind::pytensor<t_mask, 2>& mask,
+           const int                                connectivity,
+           const int                                mp_cores) {
+            auto [regions, voxel_counts, bbox_min, bbox_max] =
+                label_connected_components<int64_t>(mask, connectivity, mp_cores);
+            return std::make_tuple(xt::nanobind::pytensor<int64_t, 2>(std::move(regions)),
+                                   std::move(voxel_counts),
+                                   xt::nanobind::pytensor<int64_t, 2>(std::move(bbox_min)),
+                                   xt::nanobind::pytensor<int64_t, 2>(std::move(bbox_max)));
+        },
+        DOC_imageprocessing_functions(label_connected_components_2),
+        nb::arg("mask").noconvert(),
+        nb::arg("connectivity") = 8,
+        nb::arg("mp_cores")     = 1);
+}
+
+template<typename t_value>
+void init_filters(nanobind::module_& m)
+{
+    namespace nb = nanobind;
+    using namespace imageprocessing::functions;
+
+    // maximum_filter_inplace / minimum_filter_inplace / median_filter_inplace
+    m.def("maximum_filter_inplace",
+          nb::overload_cast<xt::nanobind::pytensor<t_value, 3>&,
+                            const std::array<int64_t, 3>&,
+                            const int>(
+              &maximum_filter_inplace<xt::nanobind::pytensor<t_value, 3>>),
+          DOC_imageprocessing_functions(maximum_filter_inplace),
+          nb::arg("data").noconvert(),
+          nb::arg("radii"),
+          nb::arg("mp_cores") = 1);
+
+    m.def("maximum_filter_inplace",
+          nb::overload_cast<xt::nanobind::pytensor<t_value, 2>&,
+                            const std::array<int64_t, 2>&,
+                            const int>(
+              &maximum_filter_inplace<xt::nanobind::pytensor<t_value, 2>>),
+          DOC_imageprocessing_functions(maximum_filter_inplace_2),
+          nb::arg("data").noconvert(),
+          nb::arg("radii"),
+          nb::arg("mp_cores") = 1);
+
+    m.def("minimum_filter_inplace",
+          nb::overload_cast<xt::nanobind::pytensor<t_value, 3>&,
+                            const std::array<int64_t, 3>&,
+                            const int>(
+              &minimum_filter_inplace<xt::nanobind::pytensor<t_value, 3>>),
+          DOC_imageprocessing_functions(minimum_filter_inplace),
+          nb::arg("data").noconvert(),
+          nb::arg("radii"),
+          nb::arg("mp_cores") = 1);
+
+    m.def("minimum_filter_inplace",
+          nb::overload_cast<xt::nanobind::pytensor<t_value, 2>&,
+                            const std::array<int64_t, 2>&,
+                            const int>(
+              &minimum_filter_inplace<xt::nanobind::pytensor<t_value, 2>>),
+          DOC_imageprocessing_functions(minimum_filter_inplace_2),
+          nb::arg("data").noconvert(),
+          nb::arg("radii"),
+          nb::arg("mp_cores") = 1);
+
+    m.def("median_filter_inplace",
+          nb::overload_cast<xt::nanobind::pytensor<t_value, 3>&,
+                            const std::array<int64_t, 3>&,
+                            const int>(
+              &median_filter_inplace<xt::nanobind::pytensor<t_value, 3>>),
+          DOC_imageprocessing_functions(median_filter_inplace),
+          nb::arg("data").noconvert(),
+          nb::arg("radii"),
+          nb::arg("mp_cores") = 1);
+
+    m.def("median_filter_inplace",
+          nb::overload_cast<xt::nanobind::pytensor<t_value, 2>&,
+                            const std::array<int64_t, 2>&,
+                            const int>(
+              &median_filter_inplace<xt::nanobind::pytensor<t_value, 2>>),
+          DOC_imageprocessing_functions(median_filter_inplace_2),
+          nb::arg("data").noconvert(),
+          nb::arg("radii"),
+          nb::arg("mp_cores") = 1);
+
+    // box_filter_inplace / gaussian_filter_inplace (floating point only)
+    if constexpr (std::is_floating_point_v<t_value>)
+    {
+        m.def("box_filter_inplace",
+              nb::overload_cast<xt::nanobind::pytensor<t_value, 3>&,
+                                const std::array<int64_t, 3>&,
+                                const int>(
+                  &box_filter_inplace<xt::nanobind::pytensor<t_value, 3>>),
+              DOC_imageprocessing_functions(box_filter_inplace),
+              nb::arg("data").noconvert(),
+              nb::arg("radii"),
+              nb::arg("mp_cores") = 1);
+
+        m.def("box_filter_inplace",
+              nb::overload_cast<xt::nanobind::pytensor<t_value, 2>&,
+                                const std::array<int64_t, 2>&,
+                                const int>(
+                  &box_filter_inplace<xt::nanobind::pytensor<t_value, 2>>),
+              DOC_imageprocessing_functions(box_filter_inplace_2),
+              nb::arg("data").noconvert(),
+              nb::arg("radii"),
+              nb::arg("mp_cores") = 1);
+
+        m.def("gaussian_filter_inplace",
+              nb::overload_cast<xt::nanobind::pytensor<t_value, 3>&,
+                                const std::array<double, 3>&,
+                                const double,
+                                const int>(
+                  &gaussian_filter_inplace<xt::nanobind::pytensor<t_value, 3>>),
+              DOC_imageprocessing_functions(gaussian_filter_inplace),
+              nb::arg("data").noconvert(),
+              nb::arg("sigmas"),
+              nb::arg("truncate") = 4.,
+              nb::arg("mp_cores") = 1);
+
+        m.def("gaussian_filter_inplace",
+              nb::overload_cast<xt::nanobind::pytensor<t_value, 2>&,
+                                const std::array<double, 2>&,
+                                const double,
+                                const int>(
+                  &gaussian_filter_inplace<xt::nanobind::pytensor<t_value, 2>>),
+              DOC_imageprocessing_functions(gaussian_filter_inplace_2),
+              nb::arg("data").noconvert(),
+              nb::arg("sigmas"),
+              nb::arg("truncate") = 4.,
+              nb::arg("mp_cores") = 1);
+    }
 }
 
 template<typename t_value>
@@ -309,6 +774,7 @@ void init_m_functions(nanobind::module_& m)
     init_find_local_maxima<int8_t>(submodule);
 
                   init_uniform_axis(submodule);
+    init_backward_mapping_plan(submodule);
 
       init_backward_mapping_value_type<double>(submodule);
       init_backward_mapping_value_type<float>(submodule);
@@ -323,6 +789,23 @@ void init_m_functions(nanobind::module_& m)
     init_grow_regions_value_type<int32_t>(submodule);
     init_grow_regions_value_type<int16_t>(submodule);
     init_grow_regions_value_type<int8_t>(submodule);
+
+    init_label_connected_components<bool>(submodule);
+    init_label_connected_components<uint8_t>(submodule);
+
+    init_region_statistics_region_type<int64_t>(submodule, "int64");
+    init_region_statistics_region_type<int32_t>(submodule, "int32");
+    init_region_statistics_region_type<int16_t>(submodule, "int16");
+    init_region_statistics_region_type<int8_t>(submodule, "int8");
+    init_region_statistics_region_type<double>(submodule, "float64");
+    init_region_statistics_region_type<float>(submodule, "float32");
+
+    init_filters<double>(submodule);
+    init_filters<float>(submodule);
+    init_filters<int64_t>(submodule);
+    init_filters<int32_t>(submodule);
+    init_filters<int16_t>(submodule);
+    init_filters<int8_t>(submodule);
 }
 
 } // namespace py_functions
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/backwardgridder.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test BackwardGridder", TESTTAG)
+{
+    // points cover only part of the grid (and some lie outside of it)
+    const size_t        n = 500;
+    std::vector<double> x(n), y(n), z(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, 0.0, 1.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = -2.0 + random_values(i) * 14.0;
+        y[i] = random_values(n + i) * 6.0;
+        z[i] = -1.0 + random_values(2 * n + i) * 4.0;
+        v[i] = random_values(3 * n + i);
+    }
+    x[10] = NAN;
+
+    // brute force nearest point (smallest index for ties)
+    auto brute_force = [&](const std::vector<double>& center, double max_distance) {
+        double  best_distance = std::numeric_limits<double>::infinity();
+        int64_t best_index    = -1;
+        for (size_t i = 0; i < n; ++i)
+        {
+            double distance_2 = 0;
+            for (size_t d = 0; d < center.size(); ++d)
+            {
+                const double delta = (d == 0 ? x[i] : d == 1 ? y[i] : z[i]) - center[d];
+                distance_2 += delta * delta;
+            }
+            if (!std::isfinite(distance_2))
+                continue;
+            if (distance_2 < best_distance)
+            {
+                best_distance = distance_2;
+                best_index    = int64_t(i);
+            }
+        }
+        if (best_distance > max_distance * max_distance)
+            return int64_t(-1);
+        return best_index;
+    };
+
+    SECTION("2D")
+    {
+        ForwardGridder2D<double> gridder(0.5, 0.25, 0.0, 10.0, -2.0, 8.0);
+
+        for (double max_distance : { 0.3, 1.0, std::numeric_limits<double>::infinity() })
+            for (int mp_cores : { 1, 3 })
+            {
+                BackwardGridder2D<double> backward_gridder(gridder, x, y, max_distance, mp_cores);
+
+                const auto& indices = backward_gridder.get_nearest_point_indices();
+                REQUIRE(indices.shape()[0] == size_t(gridder.get_nx()));
+                REQUIRE(indices.shape()[1] == size_t(gridder.get_ny()));
+
+                const auto image = backward_gridder.interpolate_nearest(v, mp_cores);
+                for (int ix = 0; ix < gridder.get_nx(); ++ix)
+                    for (int iy = 0; iy < gridder.get_ny(); ++iy)
+                    {
+                        const auto expected = brute_force(
+                            { gridder.get_xmin() + ix * 0.5, gridder.get_ymin() + iy * 0.25 },
+                            max_distance);
+                        REQUIRE(indices(ix, iy) == expected);
+
+                        if (expected < 0)
+                            CHECK(std::isnan(image(ix, iy)));
+                        else
+                            CHECK(image(ix, iy) == v[size_t(expected)]);
+                    }
+
+                if (std::isfinite(max_distance))
+                    CHECK(backward_gridder.get_number_of_filled_cells() < indices.size());
+                else
+                    CHECK(backward_gridder.get_number_of_filled_cells() == indices.size());
+            }
+    }
+
+    SECTION("points clustered in a small part of the grid")
+    {
+        // the ring search is limited by the bounding box of the occupied buckets
+        std::vector<double> cx(x.begin(), x.begin() + 20), cy(y.begin(), y.begin() + 20);
+        for (size_t i = 0; i < cx.size(); ++i)
+        {
+            cx[i] = 40.0 + cx[i] * 0.1;
+            cy[i] = -30.0 + cy[i] * 0.2;
+        }
+
+        ForwardGridder2D<double> gridder(0.5, 0.5, 0.0, 50.0, -40.0, 10.0);
+        for (double max_distance : { 5.0, std::numeric_limits<double>::infinity() })
+        {
+            BackwardGridder2D<double> backward_gridder(gridder, cx, cy, max_distance, 2);
+
+            const auto& indices = backward_gridder.get_nearest_point_indices();
+            for (int ix = 0; ix < gridder.get_nx(); ++ix)
+                for (int iy = 0; iy < gridder.get_ny(); ++iy)
+                {
+                    const double center_x = gridder.get_xmin() + ix * 0.5;
+                    const double center_y = gridder.get_ymin() + iy * 0.5;
+
+                    double  best_distance = std::numeric_limits<double>::infinity();
+                    int64_t expected      = -1;
+                    for (size_t i = 0; i < cx.size(); ++i)
+                    {
+                        if (!std::isfinite(cx[i]))
+                            continue;
+                        const double distance = std::hypot(cx[i] - center_x, cy[i] - center_y);
+                        if (distance < best_distance)
+                        {
+                            best_distance = distance;
+                            expected      = int64_t(i);
+                        }
+                    }
+                    if (best_distance > max_distance)
+                        expected = -1;
+
+                    REQUIRE(indices(ix, iy) == expected);
+                }
+        }
+
+        // no valid point at all
+        std::vector<double> nan_values(3, NAN);
+        BackwardGridder2D<double> empty_gridder(
+            gridder, nan_values, nan_values, std::numeric_limits<double>::infinity());
+        CHECK(empty_gridder.get_number_of_filled_cells() == 0);
+    }
+
+    SECTION("3D")
+    {
+        ForwardGridder3D<double> gridder(1.0, 1.0, 0.5, 0.0, 10.0, 0.0, 5.0, 0.0, 2.0);
+        BackwardGridder3D<double> backward_gridder(gridder, x, y, z, 0.8, 2);
+
+        const auto& indices   = backward_gridder.get_nearest_point_indices();
+        const auto& distances = backward_gridder.get_nearest_point_distances();
+        for (int ix = 0; ix < gridder.get_nx(); ++ix)
+            for (int iy = 0; iy < gridder.get_ny(); ++iy)
+                for (int iz = 0; iz < gridder.get_nz(); ++iz)
+                {
+                    const std::vector<double> center = { gridder.get_xmin() + ix * 1.0,
+                                                         gridder.get_ymin() + iy * 1.0,
+                                                         gridder.get_zmin() + iz * 0.5 };
+
+                    const auto expected = brute_force(center, 0.8);
+                    REQUIRE(indices(ix, iy, iz) == expected);
+                    if (expected >= 0)
+                        CHECK(distances(ix, iy, iz) <= 0.8);
+                    else
+                        CHECK(std::isnan(distances(ix, iy, iz)));
+                }
+
+        // wrong sizes
+        std::vector<double> short_values(n - 1);
+        CHECK_THROWS_AS(backward_gridder.interpolate_nearest(short_values), std::runtime_error);
+        CHECK_THROWS_AS(BackwardGridder3D<double>(gridder, x, y, z, 0.0), std::runtime_error);
+    }
+}
@@ -94,6 +94,18 @@ TEST_CASE("Test ForwardGridder2D factory methods", TESTTAG)
         CHECK(gridder.get_y_index(0.1) == 0);
         CHECK(gridder.get_y_index(4.9) == 10);
     }
+
+    SECTION("from_cells")
+    {
+        auto gridder = ForwardGridder2D<double>::from_cells(0.5, 0.5, 0.0, 11, 0.0, 11);
+        CHECK(gridder == ForwardGridder2D<double>::from_res(0.5, 0.1, 4.9, 0.1, 4.9));
+
+        // the number of cells is not affected by rounding of (max - min) / res
+        auto gridder_fine = ForwardGridder2D<double>::from_cells(0.1, 0.1, 0.0, 64, 0.0, 64);
+        CHECK(gridder_fine.get_nx() == 64);
+        CHECK(gridder_fine.get_ny() == 64);
+        CHECK(gridder_fine.get_xmax() == Catch::Approx(6.3));
+    }
 }
 
 TEST_CASE("Test get_empty_grd_images", TESTTAG)
@@ -232,3 +244,54 @@ TEST_CASE("Test coordinate methods", TESTTAG)
         CHECK(coords_y[2] == 2.0);
     }
 }
+
+TEST_CASE("Test compute_pyramid", TESTTAG)
+{
+    const size_t        n = 5000;
+    std::vector<double> x(n), y(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 3 * n }, 0.0, 1.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i) * 17.0;
+        y[i] = -3.0 + random_values(n + i) * 9.0;
+        v[i] = random_values(2 * n + i);
+    }
+
+    auto gridder = ForwardGridder2D<double>::from_data(0.25, x, y);
+    auto [image_values, image_weights] =
+        gridder.interpolate_block_mean<xt::xtensor<double, 2>>(x, y, v);
+
+    for (int mp_cores : { 1, 3 })
+    {
+        auto levels = gridder.compute_pyramid(image_values, image_weights, 4, mp_cores);
+        REQUIRE(levels.size() == 4);
+
+        for (int level = 1; level <= 4; ++level)
+        {
+            const auto& [level_gridder, level_values, level_weights] = levels[level - 1];
+            const int factor                                         = 1 << level;
+
+            CHECK(level_gridder == gridder.get_pyramid_gridder(level));
+            CHECK(level_gridder.get_xres() == 0.25 * factor);
+            CHECK(level_gridder.get_nx() == (gridder.get_nx() + factor - 1) / factor);
+            CHECK(level_gridder.get_ny() == (gridder.get_ny() + factor - 1) / factor);
+            CHECK(level_gridder.get_border_xmin() == Catch::Approx(gridder.get_border_xmin()));
+            CHECK(level_gridder.get_border_ymin() == Catch::Approx(gridder.get_border_ymin()));
+
+            // the coordinates line up: gridding the points directly gives the same means
+            auto [direct_values, direct_weights] =
+                level_gridder.interpolate_block_mean<xt::xtensor<double, 2>>(x, y, v);
+            REQUIRE(direct_values.shape() == level_values.shape());
+            for (size_t i = 0; i < direct_values.size(); ++i)
+            {
+                CHECK(level_values.data()[i] == Catch::Approx(direct_values.data()[i]));
+                CHECK(level_weights.data()[i] == direct_weights.data()[i]);
+            }
+        }
+    }
+
+    CHECK(gridder.get_pyramid_gridder(0) == gridder);
+    CHECK_THROWS_AS(gridder.get_pyramid_gridder(-1), std::runtime_error);
+}
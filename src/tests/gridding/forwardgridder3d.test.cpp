@@ -101,6 +101,20 @@ TEST_CASE("Test ForwardGridder3D factory methods", TESTTAG)
         CHECK(gridder.get_z_index(0.1) == 0);
         CHECK(gridder.get_z_index(4.9) == 10);
     }
+
+    SECTION("from_cells")
+    {
+        auto gridder =
+            ForwardGridder3D<double>::from_cells(0.5, 0.5, 0.5, 0.0, 11, 0.0, 11, 0.0, 11);
+        CHECK(gridder == ForwardGridder3D<double>::from_res(0.5, 0.1, 4.9, 0.1, 4.9, 0.1, 4.9));
+
+        // the number of cells is not affected by rounding of (max - min) / res
+        auto gridder_fine =
+            ForwardGridder3D<double>::from_cells(0.1, 0.1, 0.1, 0.0, 64, 0.0, 64, 0.0, 64);
+        CHECK(gridder_fine.get_nx() == 64);
+        CHECK(gridder_fine.get_nz() == 64);
+        CHECK(gridder_fine.get_zmax() == Catch::Approx(6.3));
+    }
 }
 
 TEST_CASE("Test get_empty_grd_images", TESTTAG)
@@ -273,3 +287,47 @@ TEST_CASE("Test coordinate methods", TESTTAG)
     }
     test_read_write(gridder, 5725600377409992654ULL);
 }
+
+TEST_CASE("Test ForwardGridder3D compute_pyramid", TESTTAG)
+{
+    const size_t        n = 5000;
+    std::vector<double> x(n), y(n), z(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, 0.0, 1.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i) * 17.0;
+        y[i] = -3.0 + random_values(n + i) * 9.0;
+        z[i] = random_values(2 * n + i) * 5.0;
+        v[i] = random_values(3 * n + i);
+    }
+
+    auto gridder = ForwardGridder3D<double>::from_data(0.5, x, y, z);
+    auto [image_values, image_weights] =
+        gridder.interpolate_block_mean<xt::xtensor<double, 3>>(x, y, z, v);
+
+    for (int mp_cores : { 1, 3 })
+    {
+        auto levels = gridder.compute_pyramid(image_values, image_weights, 3, mp_cores);
+        REQUIRE(levels.size() == 3);
+
+        for (int level = 1; level <= 3; ++level)
+        {
+            const auto& [level_gridder, level_values, level_weights] = levels[level - 1];
+
+            CHECK(level_gridder == gridder.get_pyramid_gridder(level));
+            CHECK(level_gridder.get_border_zmin() == Catch::Approx(gridder.get_border_zmin()));
+
+            // the coordinates line up: gridding the points directly gives the same means
+            auto [direct_values, direct_weights] =
+                level_gridder.interpolate_block_mean<xt::xtensor<double, 3>>(x, y, z, v);
+            REQUIRE(direct_values.shape() == level_values.shape());
+            for (size_t i = 0; i < direct_values.size(); ++i)
+            {
+                CHECK(level_values.data()[i] == Catch::Approx(direct_values.data()[i]));
+                CHECK(level_weights.data()[i] == direct_weights.data()[i]);
+            }
+        }
+    }
+}
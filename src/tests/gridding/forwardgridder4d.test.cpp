@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/forwardgridder4d.hpp>
+#include <themachinethatgoesping/algorithms/gridding/forwardgriddern.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test ForwardGridder4D", TESTTAG)
+{
+    // two "surveys" (hourly slices) far apart in time, some points outside the grid
+    const size_t        n = 4000;
+    std::vector<double> x(n), y(n), z(n), t(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 5 * n }, 0.0, 1.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = -1.0 + random_values(i) * 12.0;
+        y[i] = -1.0 + random_values(n + i) * 12.0;
+        z[i] = random_values(2 * n + i) * 4.0;
+        t[i] = (i < n / 2 ? 0.0 : 1000.0 * 3600.0) + random_values(3 * n + i) * 3.0 * 3600.0;
+        v[i] = random_values(4 * n + i);
+    }
+    v[10] = NAN;
+    t[20] = NAN;
+
+    ForwardGridder3D<double> gridder(1.0, 1.0, 0.5, 0.0, 10.0, 0.0, 10.0, 0.0, 4.0);
+    const double             tres = 3600.0;
+
+    // reference: dense 4D grid (t, x, y, z) covering the full time range
+    auto check_against_dense = [&](const ForwardGridder4D<double>& gridder4d, bool weighted) {
+        const auto   time_indices = gridder4d.get_time_indices();
+        const double tmin         = gridder4d.get_time_value(time_indices.front());
+        const double tmax         = gridder4d.get_time_value(time_indices.back());
+
+        ForwardGridderN<double, 4> gridder_n(
+            { tres, gridder.get_xres(), gridder.get_yres(), gridder.get_zres() },
+            { tmin, gridder.get_xmin(), gridder.get_ymin(), gridder.get_zmin() },
+            { tmax, gridder.get_xmax(), gridder.get_ymax(), gridder.get_zmax() },
+            { 0.0, gridder.get_xbase(), gridder.get_ybase(), gridder.get_zbase() });
+
+        // (the N-D gridder does not check the coordinates, points with invalid times are
+        // excluded using their value instead)
+        std::vector<double>    dense_v     = v;
+        xt::xtensor<double, 2> coordinates = xt::zeros<double>({ size_t(4), n });
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (!std::isfinite(t[i]))
+                dense_v[i] = NAN;
+            coordinates(0, i) = std::isfinite(t[i]) ? t[i] : tmin;
+            coordinates(1, i) = x[i];
+            coordinates(2, i) = y[i];
+            coordinates(3, i) = z[i];
+        }
+        auto [dense_values, dense_weights] =
+            weighted
+                ? gridder_n.interpolate_weighted_mean<xt::xtensor<double, 4>>(coordinates, dense_v)
+                : gridder_n.interpolate_block_mean<xt::xtensor<double, 4>>(coordinates, dense_v);
+
+        const size_t slice_size = dense_values.size() / dense_values.shape()[0];
+        size_t       n_occupied = 0;
+        for (size_t k = 0; k < dense_values.shape()[0]; ++k)
+        {
+            const int64_t time_index = time_indices.front() + int64_t(k);
+
+            double slice_weight = 0;
+            for (size_t c = 0; c < slice_size; ++c)
+                slice_weight += dense_weights.data()[k * slice_size + c];
+
+            // only occupied slices are stored
+            REQUIRE(gridder4d.has_slice(time_index) == (slice_weight > 0));
+            if (slice_weight == 0)
+                continue;
+            ++n_occupied;
+
+            const auto& [values, weights] = gridder4d.get_slice(time_index);
+            for (size_t c = 0; c < slice_size; ++c)
+            {
+                CHECK_THAT(values.data()[c],
+                           Catch::Matchers::WithinAbs(dense_values.data()[k * slice_size + c],
+                                                      1e-10));
+                CHECK_THAT(weights.data()[c],
+                           Catch::Matchers::WithinAbs(dense_weights.data()[k * slice_size + c],
+                                                      1e-10));
+            }
+        }
+        CHECK(n_occupied == gridder4d.get_number_of_slices());
+    };
+
+    for (bool weighted : { false, true })
+        for (int mp_cores : { 1, 3 })
+        {
+            ForwardGridder4D<double> gridder4d(gridder, tres);
+            if (weighted)
+                gridder4d.interpolate_weighted_mean_inplace(x, y, z, t, v, mp_cores);
+            else
+                gridder4d.interpolate_block_mean_inplace(x, y, z, t, v, mp_cores);
+
+            // 2 surveys with 3 (block mean: 4) hourly slices each, not 1000 hours
+            CHECK(gridder4d.get_number_of_slices() <= 10);
+            check_against_dense(gridder4d, weighted);
+
+            // adding the data incrementally (one survey after the other) yields the same slices
+            std::vector<double> x1(x.begin(), x.begin() + n / 2), x2(x.begin() + n / 2, x.end());
+            std::vector<double> y1(y.begin(), y.begin() + n / 2), y2(y.begin() + n / 2, y.end());
+            std::vector<double> z1(z.begin(), z.begin() + n / 2), z2(z.begin() + n / 2, z.end());
+            std::vector<double> t1(t.begin(), t.begin() + n / 2), t2(t.begin() + n / 2, t.end());
+            std::vector<double> v1(v.begin(), v.begin() + n / 2), v2(v.begin() + n / 2, v.end());
+
+            ForwardGridder4D<double> incremental(gridder, tres);
+            if (weighted)
+            {
+                incremental.interpolate_weighted_mean_inplace(x1, y1, z1, t1, v1, mp_cores);
+                incremental.interpolate_weighted_mean_inplace(x2, y2, z2, t2, v2, mp_cores);
+            }
+            else
+            {
+                incremental.interpolate_block_mean_inplace(x1, y1, z1, t1, v1, mp_cores);
+                incremental.interpolate_block_mean_inplace(x2, y2, z2, t2, v2, mp_cores);
+            }
+
+            REQUIRE(incremental.get_time_indices() == gridder4d.get_time_indices());
+            auto [stack_values, stack_weights] = gridder4d.get_images();
+            auto [inc_values, inc_weights]     = incremental.get_images();
+            CHECK(stack_values == inc_values);
+            CHECK(stack_weights == inc_weights);
+            CHECK(stack_values.shape()[0] == gridder4d.get_number_of_slices());
+        }
+
+    SECTION("slices equal ForwardGridder3D")
+    {
+        // all points within one time slice
+        std::vector<double> t0(n, 7.5 * 3600.0 + 0.25 * 3600.0);
+
+        ForwardGridder4D<double> gridder4d(gridder, tres);
+        gridder4d.interpolate_block_mean_inplace(x, y, z, t0, v);
+        auto [image_values, image_weights] =
+            gridder.interpolate_block_mean<xt::xtensor<double, 3>>(x, y, z, v);
+
+        REQUIRE(gridder4d.get_time_indices() == std::vector<int64_t>{ 8 });
+        CHECK(std::get<0>(gridder4d.get_slice(8)) == image_values);
+        CHECK(std::get<1>(gridder4d.get_slice(8)) == image_weights);
+
+        // add the same images again
+        gridder4d.add_slice_images(8, image_values, image_weights);
+        const auto& doubled_weights = std::get<1>(gridder4d.get_slice(8));
+        for (size_t c = 0; c < image_weights.size(); ++c)
+            CHECK(doubled_weights.data()[c] == 2.0 * image_weights.data()[c]);
+
+        CHECK(gridder4d.get_time_index(7.6 * 3600.0) == 8);
+        CHECK(gridder4d.get_time_value(8) == 8 * 3600.0);
+        CHECK(gridder4d.get_time_extent(8) == std::vector<double>{ 7.5 * 3600.0, 8.5 * 3600.0 });
+
+        CHECK(gridder4d.remove_slice(8));
+        CHECK(!gridder4d.remove_slice(8));
+        CHECK(gridder4d.get_number_of_slices() == 0);
+        CHECK_THROWS_AS(gridder4d.get_slice(8), std::runtime_error);
+
+        xt::xtensor<double, 3> wrong_image = xt::zeros<double>({ 3, 3, 3 });
+        CHECK_THROWS_AS(gridder4d.add_slice_images(0, wrong_image, wrong_image),
+                        std::runtime_error);
+        CHECK_THROWS_AS(ForwardGridder4D<double>(gridder, 0.0), std::runtime_error);
+    }
+}
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/forwardgridder1d.hpp>
+#include <themachinethatgoesping/algorithms/gridding/forwardgridder2d.hpp>
+#include <themachinethatgoesping/algorithms/gridding/forwardgridder3d.hpp>
+#include <themachinethatgoesping/algorithms/gridding/forwardgriddern.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test ForwardGridderN", TESTTAG)
+{
+    const size_t n = 3000;
+
+    xt::random::seed(0);
+    xt::xtensor<double, 2> coordinates = xt::random::rand<double>({ size_t(4), n }, -1.0, 11.0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ n }, 0.0, 1.0);
+
+    std::vector<double> x(n), y(n), z(n), v(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = coordinates(0, i);
+        y[i] = coordinates(1, i);
+        z[i] = coordinates(2, i);
+        v[i] = random_values(i);
+    }
+    v[10] = NAN;
+
+    auto check_equal = [](const auto& expected, const auto& image) {
+        REQUIRE(expected.size() == image.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+            CHECK(image.data()[i] == expected.data()[i]);
+    };
+
+    SECTION("N = 3 equals ForwardGridder3D")
+    {
+        ForwardGridder3D<double>   gridder_3d(1.0, 0.5, 2.0, 0.0, 10.0, 0.0, 10.0, 0.0, 10.0);
+        ForwardGridderN<double, 3> gridder({ 1.0, 0.5, 2.0 }, { 0.0, 0.0, 0.0 }, { 10, 10, 10 });
+        CHECK(gridder.get_n()[0] == gridder_3d.get_nx());
+        CHECK(gridder.get_n()[1] == gridder_3d.get_ny());
+        CHECK(gridder.get_n()[2] == gridder_3d.get_nz());
+        CHECK(gridder.get_border_min()[1] == gridder_3d.get_border_ymin());
+        CHECK(gridder.get_coordinates(2) == gridder_3d.get_z_coordinates());
+
+        xt::xtensor<double, 2> coordinates_3d = xt::zeros<double>({ size_t(3), n });
+        for (size_t d = 0; d < 3; ++d)
+            for (size_t i = 0; i < n; ++i)
+                coordinates_3d(d, i) = coordinates(d, i);
+
+        for (int mp_cores : { 1, 3 })
+        {
+            auto [expected_values, expected_weights] =
+                gridder_3d.interpolate_weighted_mean<xt::xtensor<double, 3>>(x, y, z, v, mp_cores);
+            auto [image_values, image_weights] =
+                gridder.interpolate_weighted_mean<xt::xtensor<double, 3>>(
+                    coordinates_3d, v, mp_cores);
+            check_equal(expected_values, image_values);
+            check_equal(expected_weights, image_weights);
+
+            auto [expected_block_values, expected_block_weights] =
+                gridder_3d.interpolate_block_mean<xt::xtensor<double, 3>>(x, y, z, v, mp_cores);
+            auto [block_values, block_weights] =
+                gridder.interpolate_block_mean<xt::xtensor<double, 3>>(coordinates_3d, v, mp_cores);
+            check_equal(expected_block_values, block_values);
+            check_equal(expected_block_weights, block_weights);
+        }
+    }
+
+    SECTION("N = 2 / N = 1 equal ForwardGridder2D / ForwardGridder1D")
+    {
+        ForwardGridder2D<double>   gridder_2d(0.5, 0.25, 0.0, 10.0, 0.0, 10.0);
+        ForwardGridderN<double, 2> gridder_n2({ 0.5, 0.25 }, { 0.0, 0.0 }, { 10.0, 10.0 });
+        ForwardGridder1D<double>   gridder_1d(0.5, 0.0, 10.0);
+        ForwardGridderN<double, 1> gridder_n1({ 0.5 }, { 0.0 }, { 10.0 });
+
+        xt::xtensor<double, 2> coordinates_2d = xt::zeros<double>({ size_t(2), n });
+        xt::xtensor<double, 2> coordinates_1d = xt::zeros<double>({ size_t(1), n });
+        for (size_t i = 0; i < n; ++i)
+        {
+            coordinates_2d(0, i) = x[i];
+            coordinates_2d(1, i) = y[i];
+            coordinates_1d(0, i) = x[i];
+        }
+
+        auto [expected_2d, expected_weights_2d] =
+            gridder_2d.interpolate_weighted_mean<xt::xtensor<double, 2>>(x, y, v);
+        auto [image_2d, image_weights_2d] =
+            gridder_n2.interpolate_weighted_mean<xt::xtensor<double, 2>>(coordinates_2d, v);
+        check_equal(expected_2d, image_2d);
+        check_equal(expected_weights_2d, image_weights_2d);
+
+        auto [expected_1d, expected_weights_1d] =
+            gridder_1d.interpolate_weighted_mean<xt::xtensor<double, 1>>(x, v);
+        auto [image_1d, image_weights_1d] =
+            gridder_n1.interpolate_weighted_mean<xt::xtensor<double, 1>>(coordinates_1d, v);
+        check_equal(expected_1d, image_1d);
+        check_equal(expected_weights_1d, image_weights_1d);
+    }
+
+    SECTION("N = 4")
+    {
+        auto gridder = ForwardGridderN<double, 4>::from_data(1.0, coordinates);
+        for (size_t d = 0; d < 4; ++d)
+        {
+            CHECK(gridder.get_n()[d] == 13);
+            CHECK(gridder.get_min()[d] == -1.0);
+        }
+
+        for (int mp_cores : { 1, 3 })
+        {
+            auto [image_values, image_weights] =
+                gridder.interpolate_weighted_mean<xt::xtensor<double, 4>>(
+                    coordinates, v, mp_cores);
+
+            // all points are inside the grid, the weights of each point sum up to 1
+            double total_weight = 0.0;
+            for (size_t i = 0; i < image_weights.size(); ++i)
+                total_weight += image_weights.data()[i];
+            CHECK(total_weight == Catch::Approx(double(n - 1)));
+        }
+
+        // wrong sizes
+        std::vector<double> short_values(n - 1);
+        CHECK_THROWS_AS(
+            (gridder.interpolate_block_mean<xt::xtensor<double, 4>>(coordinates, short_values)),
+            std::runtime_error);
+        CHECK_THROWS_AS((ForwardGridderN<double, 2>({ 0.0, 1.0 }, { 0.0, 0.0 }, { 1.0, 1.0 })),
+                        std::runtime_error);
+    }
+}
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include "../../../themachinethatgoesping/algorithms/gridding/functions/blockstatistics.hpp"
+#include "../../../themachinethatgoesping/algorithms/gridding/functions/gridfunctions.hpp"
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding::functions;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test block statistics (min, max, count, variance)", TESTTAG)
+{
+    const size_t        n = 1000;
+    std::vector<double> x(n), y(n), v(n);
+
+    xt::random::seed(1);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 3 * n }, -1.0, 6.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i);
+        y[i] = random_values(n + i);
+        v[i] = random_values(2 * n + i);
+    }
+    v[5] = NAN;
+
+    auto [cell_offsets, values] = group_blocks_csr(x, y, v, 0.0, 1.0, 5, 0.0, 1.0, 4);
+
+    for (int mp_cores : { 1, 4 })
+    {
+        xt::xtensor<double, 2> img_min = xt::empty<double>({ 5, 4 });
+        xt::xtensor<double, 2> img_max = xt::empty<double>({ 5, 4 });
+        img_min.fill(NAN);
+        img_max.fill(NAN);
+        xt::xtensor<double, 2> img_count     = xt::zeros<double>({ 5, 4 });
+        xt::xtensor<double, 2> img_var_count = xt::zeros<double>({ 5, 4 });
+        xt::xtensor<double, 2> img_mean      = xt::zeros<double>({ 5, 4 });
+        xt::xtensor<double, 2> img_m2        = xt::zeros<double>({ 5, 4 });
+
+        grd_block_min(cell_offsets, values, img_min, mp_cores);
+        grd_block_max(cell_offsets, values, img_max, mp_cores);
+        grd_block_count(cell_offsets, img_count, mp_cores);
+        grd_block_variance(cell_offsets, values, img_var_count, img_mean, img_m2, mp_cores);
+
+        for (size_t ix = 0; ix < 5; ++ix)
+            for (size_t iy = 0; iy < 4; ++iy)
+            {
+                // brute force statistics
+                std::vector<double> cell_values;
+                for (size_t i = 0; i < n; ++i)
+                    if (std::isfinite(v[i]) && get_index(x[i], 0.0, 1.0) == int(ix) &&
+                        get_index(y[i], 0.0, 1.0) == int(iy))
+                        cell_values.push_back(v[i]);
+
+                CHECK(img_count(ix, iy) == double(cell_values.size()));
+                CHECK(img_var_count(ix, iy) == double(cell_values.size()));
+
+                if (cell_values.empty())
+                {
+                    CHECK(std::isnan(img_min(ix, iy)));
+                    CHECK(std::isnan(img_max(ix, iy)));
+                    continue;
+                }
+
+                double mean = 0.0;
+                for (auto val : cell_values)
+                    mean += val;
+                mean /= cell_values.size();
+
+                double m2 = 0.0;
+                for (auto val : cell_values)
+                    m2 += (val - mean) * (val - mean);
+
+                CHECK(img_min(ix, iy) ==
+                      *std::min_element(cell_values.begin(), cell_values.end()));
+                CHECK(img_max(ix, iy) ==
+                      *std::max_element(cell_values.begin(), cell_values.end()));
+
+                CHECK(img_mean(ix, iy) == Catch::Approx(mean));
+                CHECK(img_m2(ix, iy) == Catch::Approx(m2));
+            }
+    }
+}
+
+TEST_CASE("Test grd_block_histogram / histogram_quantile", TESTTAG)
+{
+    const size_t        n = 10000;
+    std::vector<double> x(n), v(n);
+
+    xt::random::seed(1);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 2 * n }, 0.0, 1.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i) * 2.4;
+        v[i] = random_values(n + i) * 10.0;
+    }
+
+    // only cells 0-2 contain values
+    auto [cell_offsets, values] = group_blocks_csr(x, v, 0.0, 1.0, 4);
+
+    xt::xtensor<double, 2> img_histogram = xt::zeros<double>({ 4, 200 });
+    grd_block_histogram(cell_offsets, values, 0.0, 10.0, img_histogram, 4);
+
+    for (size_t c = 0; c < 4; ++c)
+    {
+        double count = 0.0;
+        for (size_t b = 0; b < 200; ++b)
+            count += img_histogram(c, b);
+        CHECK(count == double(cell_offsets(c + 1) - cell_offsets(c)));
+    }
+
+    for (double quantile : { 0.1, 0.5, 0.9 })
+    {
+        auto image_quantile =
+            histogram_quantile<xt::xtensor<double, 1>>(img_histogram, 0.0, 10.0, quantile, 4);
+        REQUIRE(image_quantile.size() == 4);
+
+        for (size_t c = 0; c < 3; ++c)
+        {
+            std::vector<double> cell_values(values.begin() + cell_offsets(c),
+                                            values.begin() + cell_offsets(c + 1));
+            std::sort(cell_values.begin(), cell_values.end());
+            const double exact = cell_values[size_t(quantile * (cell_values.size() - 1))];
+
+            // approximation error is bounded by the bin width (0.05)
+            CHECK_THAT(image_quantile(c), Catch::Matchers::WithinAbs(exact, 0.05));
+        }
+        CHECK(std::isnan(image_quantile(3)));
+    }
+
+    CHECK_THROWS_AS((histogram_quantile<xt::xtensor<double, 1>>(img_histogram, 0.0, 10.0, 1.5)),
+                    std::runtime_error);
+    CHECK_THROWS_AS(grd_block_histogram(cell_offsets, values, 1.0, 1.0, img_histogram),
+                    std::runtime_error);
+}
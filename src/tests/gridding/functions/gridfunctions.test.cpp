@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
@@ -27,6 +28,40 @@ TEST_CASE("Test get_minmax", TESTTAG)
     CHECK(maxy == 3.0);
     CHECK(minz == 3.0);
     CHECK(maxz == 4.0);
+
+    SECTION("non-finite values and finite count")
+    {
+        // longer than a simd batch, with a partial last batch
+        std::vector<double> sx(37), sy(37);
+        for (size_t i = 0; i < sx.size(); ++i)
+        {
+            sx[i] = double(i) - 10.0;
+            sy[i] = NAN;
+        }
+        sx[0]  = -INFINITY;
+        sx[36] = INFINITY;
+        sx[20] = NAN;
+        sy[5]  = 7.0;
+
+        for (int mp_cores : { 1, 3 })
+        {
+            auto [mx, Mx, my, My, nx, ny] = get_minmax_count(sx, sy, mp_cores);
+            CHECK(mx == -9.0);
+            CHECK(Mx == 25.0);
+            CHECK(my == 7.0);
+            CHECK(My == 7.0);
+            CHECK(nx == 34);
+            CHECK(ny == 1);
+        }
+
+        // all NaN: min/max are NaN (also for the 1D version)
+        std::vector<float> s_nan(5, NAN);
+        auto [minv, maxv] = get_minmax(s_nan);
+        CHECK(std::isnan(minv));
+        CHECK(std::isnan(maxv));
+        CHECK(std::get<2>(get_minmax_count(s_nan)) == 0);
+        CHECK_THROWS_AS(get_minmax(std::vector<float>()), std::runtime_error);
+    }
 }
 
 TEST_CASE("Test get_index", TESTTAG)
@@ -133,3 +168,783 @@ TEST_CASE("Test grd_block_mean", TESTTAG)
         CHECK(img_wgts(1) == Catch::Approx(1.0));
     }
 }
+
+TEST_CASE("Test grd_weighted_mean / grd_block_mean (multi-threaded)", TESTTAG)
+{
+    const size_t        n = 10000;
+    std::vector<double> x(n), y(n), z(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, -1.0, 11.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i);
+        y[i] = random_values(n + i);
+        z[i] = random_values(2 * n + i);
+        v[i] = random_values(3 * n + i);
+    }
+    v[10] = NAN;
+
+    auto check_equal = [](const auto& serial, const auto& parallel) {
+        REQUIRE(serial.size() == parallel.size());
+        for (size_t i = 0; i < serial.size(); ++i)
+            CHECK(parallel.data()[i] == Catch::Approx(serial.data()[i]).epsilon(1e-12));
+    };
+
+    SECTION("3D")
+    {
+        for (int mp_cores : { 2, 3, 8 })
+        {
+            xt::xtensor<double, 3> img_vals = xt::zeros<double>({ 10, 10, 10 });
+            xt::xtensor<double, 3> img_wgts = xt::zeros<double>({ 10, 10, 10 });
+            auto                   mp_vals  = img_vals;
+            auto                   mp_wgts  = img_wgts;
+
+            grd_weighted_mean(
+                x, y, z, v, 0.0, 1.0, 10, 0.0, 1.0, 10, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_weighted_mean(
+                x, y, z, v, 0.0, 1.0, 10, 0.0, 1.0, 10, 0.0, 1.0, 10, mp_vals, mp_wgts, mp_cores);
+            check_equal(img_vals, mp_vals);
+            check_equal(img_wgts, mp_wgts);
+
+            grd_block_mean(
+                x, y, z, v, 0.0, 1.0, 10, 0.0, 1.0, 10, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_block_mean(
+                x, y, z, v, 0.0, 1.0, 10, 0.0, 1.0, 10, 0.0, 1.0, 10, mp_vals, mp_wgts, mp_cores);
+            check_equal(img_vals, mp_vals);
+            check_equal(img_wgts, mp_wgts);
+        }
+    }
+    SECTION("2D")
+    {
+        for (int mp_cores : { 2, 3, 8 })
+        {
+            xt::xtensor<double, 2> img_vals = xt::zeros<double>({ 10, 10 });
+            xt::xtensor<double, 2> img_wgts = xt::zeros<double>({ 10, 10 });
+            auto                   mp_vals  = img_vals;
+            auto                   mp_wgts  = img_wgts;
+
+            grd_weighted_mean(x, y, v, 0.0, 1.0, 10, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_weighted_mean(x, y, v, 0.0, 1.0, 10, 0.0, 1.0, 10, mp_vals, mp_wgts, mp_cores);
+            check_equal(img_vals, mp_vals);
+            check_equal(img_wgts, mp_wgts);
+
+            grd_block_mean(x, y, v, 0.0, 1.0, 10, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_block_mean(x, y, v, 0.0, 1.0, 10, 0.0, 1.0, 10, mp_vals, mp_wgts, mp_cores);
+            check_equal(img_vals, mp_vals);
+            check_equal(img_wgts, mp_wgts);
+        }
+    }
+    SECTION("1D")
+    {
+        for (int mp_cores : { 2, 3, 8 })
+        {
+            xt::xtensor<double, 1> img_vals = xt::zeros<double>({ 10 });
+            xt::xtensor<double, 1> img_wgts = xt::zeros<double>({ 10 });
+            auto                   mp_vals  = img_vals;
+            auto                   mp_wgts  = img_wgts;
+
+            grd_weighted_mean(x, v, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_weighted_mean(x, v, 0.0, 1.0, 10, mp_vals, mp_wgts, mp_cores);
+            check_equal(img_vals, mp_vals);
+            check_equal(img_wgts, mp_wgts);
+
+            grd_block_mean(x, v, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_block_mean(x, v, 0.0, 1.0, 10, mp_vals, mp_wgts, mp_cores);
+            check_equal(img_vals, mp_vals);
+            check_equal(img_wgts, mp_wgts);
+        }
+    }
+}
+
+TEST_CASE("Test grd_weighted_mean / grd_block_mean (float64 accumulation)", TESTTAG)
+{
+    SECTION("many values in one float cell")
+    {
+        // 2e6 values in one cell: float accumulation drifts, float64 accumulation does not
+        const size_t       n = 2000000;
+        std::vector<float> x(n, 0.f), v(n, 0.1f);
+        const double       expected = double(n) * double(0.1f);
+
+        for (int mp_cores : { 1, 4 })
+        {
+            xt::xtensor<float, 1> img_vals = xt::zeros<float>({ 1 });
+            xt::xtensor<float, 1> img_wgts = xt::zeros<float>({ 1 });
+            grd_block_mean(x, v, 0.f, 1.f, 1, img_vals, img_wgts, mp_cores);
+
+            xt::xtensor<float, 1> img_vals_f64 = xt::zeros<float>({ 1 });
+            xt::xtensor<float, 1> img_wgts_f64 = xt::zeros<float>({ 1 });
+            grd_block_mean<std::vector<float>, xt::xtensor<float, 1>, float, int, double>(
+                x, v, 0.f, 1.f, 1, img_vals_f64, img_wgts_f64, mp_cores);
+
+            CHECK(img_wgts_f64(0) == float(n));
+            CHECK(std::abs(img_vals_f64(0) - expected) / expected < 1e-7);
+            if (mp_cores == 1)
+                CHECK(std::abs(img_vals(0) - expected) / expected > 1e-4);
+        }
+    }
+
+    SECTION("float images match double images")
+    {
+        const size_t        n = 10000;
+        std::vector<double> x(n), y(n), z(n), v(n);
+        std::vector<float>  xf(n), yf(n), zf(n), vf(n);
+
+        xt::random::seed(3);
+        xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, -1.0, 6.0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            x[i] = xf[i] = float(random_values(i));
+            y[i] = yf[i] = float(random_values(n + i));
+            z[i] = zf[i] = float(random_values(2 * n + i));
+            v[i] = vf[i] = float(random_values(3 * n + i));
+        }
+
+        xt::xtensor<double, 3> img_vals = xt::zeros<double>({ 5, 4, 3 });
+        xt::xtensor<double, 3> img_wgts = xt::zeros<double>({ 5, 4, 3 });
+        grd_weighted_mean(x, y, z, v, 0.0, 1.0, 5, 0.0, 1.0, 4, 0.0, 1.0, 3, img_vals, img_wgts);
+
+        for (int mp_cores : { 1, 3 })
+        {
+            xt::xtensor<float, 3> img_vals_f64 = xt::zeros<float>({ 5, 4, 3 });
+            xt::xtensor<float, 3> img_wgts_f64 = xt::zeros<float>({ 5, 4, 3 });
+            grd_weighted_mean<std::vector<float>, xt::xtensor<float, 3>, float, int, double>(
+                xf,
+                yf,
+                zf,
+                vf,
+                0.f,
+                1.f,
+                5,
+                0.f,
+                1.f,
+                4,
+                0.f,
+                1.f,
+                3,
+                img_vals_f64,
+                img_wgts_f64,
+                mp_cores);
+
+            for (size_t i = 0; i < img_vals.size(); ++i)
+            {
+                CHECK(img_vals_f64.data()[i] == Catch::Approx(img_vals.data()[i]).epsilon(1e-6));
+                CHECK(img_wgts_f64.data()[i] == Catch::Approx(img_wgts.data()[i]).epsilon(1e-6));
+            }
+        }
+    }
+
+    SECTION("images larger than one accumulation tile")
+    {
+        // 300 x 300 cells: the float64 partial sums are accumulated in several row tiles
+        const size_t        n = 20000;
+        std::vector<double> x(n), y(n), v(n);
+        std::vector<float>  xf(n), yf(n), vf(n);
+
+        xt::random::seed(4);
+        xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 3 * n }, -1.0, 300.0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            x[i] = xf[i] = float(random_values(i));
+            y[i] = yf[i] = float(random_values(n + i));
+            v[i] = vf[i] = float(random_values(2 * n + i));
+        }
+
+        xt::xtensor<double, 2> img_vals = xt::zeros<double>({ 300, 300 });
+        xt::xtensor<double, 2> img_wgts = xt::zeros<double>({ 300, 300 });
+        grd_weighted_mean(x, y, v, 0.0, 1.0, 300, 0.0, 1.0, 300, img_vals, img_wgts);
+
+        for (int mp_cores : { 1, 3 })
+        {
+            xt::xtensor<float, 2> img_vals_f64 = xt::zeros<float>({ 300, 300 });
+            xt::xtensor<float, 2> img_wgts_f64 = xt::zeros<float>({ 300, 300 });
+            grd_weighted_mean<std::vector<float>, xt::xtensor<float, 2>, float, int, double>(
+                xf, yf, vf, 0.f, 1.f, 300, 0.f, 1.f, 300, img_vals_f64, img_wgts_f64, mp_cores);
+
+            for (size_t i = 0; i < img_vals.size(); ++i)
+            {
+                CHECK(img_vals_f64.data()[i] ==
+                      Catch::Approx(img_vals.data()[i]).epsilon(1e-6).margin(1e-4));
+                CHECK(img_wgts_f64.data()[i] ==
+                      Catch::Approx(img_wgts.data()[i]).epsilon(1e-6).margin(1e-6));
+            }
+        }
+    }
+}
+
+TEST_CASE("Test grd_gaussian_splat / grd_inverse_distance_splat", TESTTAG)
+{
+    SECTION("single point (2D)")
+    {
+        std::vector<double> x{ 2.0 }, y{ 2.5 }, v{ 3.0 };
+
+        xt::xtensor<double, 2> img_vals = xt::zeros<double>({ 5, 6 });
+        xt::xtensor<double, 2> img_wgts = xt::zeros<double>({ 5, 6 });
+        grd_gaussian_splat(x, y, v, 0.0, 1.0, 5, 0.0, 0.5, 6, 1.5, 1.0, img_vals, img_wgts);
+
+        for (size_t ix = 0; ix < 5; ++ix)
+            for (size_t iy = 0; iy < 6; ++iy)
+            {
+                const double d2 = std::pow(ix - 2.0, 2) + std::pow(iy * 0.5 - 2.5, 2);
+                const double w  = d2 <= 1.5 * 1.5 ? std::exp(-0.5 * d2) : 0.0;
+                CHECK(img_wgts(ix, iy) == Catch::Approx(w));
+                CHECK(img_vals(ix, iy) == Catch::Approx(3.0 * w));
+            }
+
+        img_vals.fill(0);
+        img_wgts.fill(0);
+        grd_inverse_distance_splat(x, y, v, 0.0, 1.0, 5, 0.0, 0.5, 6, 1.5, 2.0, img_vals, img_wgts);
+
+        // distance is clamped to half the smallest resolution (0.25)
+        CHECK(img_wgts(2, 5) == Catch::Approx(1.0 / (0.25 * 0.25)));
+        CHECK(img_wgts(3, 5) == Catch::Approx(1.0));
+        CHECK(img_wgts(2, 2) == Catch::Approx(1.0 / 2.25));
+        CHECK(img_wgts(4, 5) == 0.0);
+        CHECK(img_vals(3, 5) == Catch::Approx(3.0));
+    }
+
+    SECTION("random points (3D)")
+    {
+        const size_t        n = 500;
+        std::vector<double> x(n), y(n), z(n), v(n);
+
+        xt::random::seed(2);
+        xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, -2.0, 8.0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            x[i] = random_values(i);
+            y[i] = random_values(n + i);
+            z[i] = random_values(2 * n + i) * 0.5;
+            v[i] = random_values(3 * n + i);
+        }
+        v[3] = NAN;
+
+        // brute force reference
+        const double           radius = 1.2, sigma = 0.8;
+        xt::xtensor<double, 3> ref_vals = xt::zeros<double>({ 7, 6, 5 });
+        xt::xtensor<double, 3> ref_wgts = xt::zeros<double>({ 7, 6, 5 });
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (!std::isfinite(v[i]))
+                continue;
+            for (size_t ix = 0; ix < 7; ++ix)
+                for (size_t iy = 0; iy < 6; ++iy)
+                    for (size_t iz = 0; iz < 5; ++iz)
+                    {
+                        const double d2 = std::pow(ix * 1.0 - x[i], 2) +
+                                          std::pow(iy * 1.0 - y[i], 2) +
+                                          std::pow(iz * 0.5 - z[i], 2);
+                        if (d2 > radius * radius)
+                            continue;
+
+                        const double w = std::exp(-0.5 * d2 / (sigma * sigma));
+                        ref_vals(ix, iy, iz) += v[i] * w;
+                        ref_wgts(ix, iy, iz) += w;
+                    }
+        }
+
+        for (int mp_cores : { 1, 4 })
+        {
+            xt::xtensor<double, 3> img_vals = xt::zeros<double>({ 7, 6, 5 });
+            xt::xtensor<double, 3> img_wgts = xt::zeros<double>({ 7, 6, 5 });
+            grd_gaussian_splat(x,
+                               y,
+                               z,
+                               v,
+                               0.0,
+                               1.0,
+                               7,
+                               0.0,
+                               1.0,
+                               6,
+                               0.0,
+                               0.5,
+                               5,
+                               radius,
+                               sigma,
+                               img_vals,
+                               img_wgts,
+                               mp_cores);
+
+            for (size_t i = 0; i < img_vals.size(); ++i)
+            {
+                CHECK(img_vals.data()[i] == Catch::Approx(ref_vals.data()[i]).margin(1e-12));
+                CHECK(img_wgts.data()[i] == Catch::Approx(ref_wgts.data()[i]).margin(1e-12));
+            }
+        }
+    }
+
+    SECTION("invalid parameters")
+    {
+        std::vector<double>    x{ 0.0 }, y{ 0.0 }, v{ 1.0 };
+        xt::xtensor<double, 2> img_vals = xt::zeros<double>({ 2, 2 });
+        xt::xtensor<double, 2> img_wgts = xt::zeros<double>({ 2, 2 });
+
+        CHECK_THROWS_AS(
+            grd_gaussian_splat(x, y, v, 0.0, 1.0, 2, 0.0, 1.0, 2, 1.0, 0.0, img_vals, img_wgts),
+            std::runtime_error);
+        CHECK_THROWS_AS(
+            grd_inverse_distance_splat(
+                x, y, v, 0.0, 1.0, 2, 0.0, 1.0, 2, -1.0, 2.0, img_vals, img_wgts),
+            std::runtime_error);
+    }
+}
+
+TEST_CASE("Test grd_weighted_mean_xsimd", TESTTAG)
+{
+    // n is not a multiple of the simd batch size
+    const size_t        n = 10003;
+    std::vector<double> x(n), y(n), z(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, -1.0, 11.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i);
+        y[i] = random_values(n + i);
+        z[i] = random_values(2 * n + i);
+        v[i] = random_values(3 * n + i);
+    }
+    v[10] = NAN;
+
+    // points exactly on grid cells (including the last cell)
+    x[20] = 3.0;
+    y[20] = 9.0;
+    z[20] = 0.0;
+
+    auto check_equal = [](const auto& scalar, const auto& simd) {
+        REQUIRE(scalar.size() == simd.size());
+        for (size_t i = 0; i < scalar.size(); ++i)
+            CHECK(simd.data()[i] == Catch::Approx(scalar.data()[i]).epsilon(1e-12));
+    };
+
+    SECTION("3D")
+    {
+        for (int mp_cores : { 1, 3 })
+        {
+            xt::xtensor<double, 3> img_vals = xt::zeros<double>({ 10, 10, 10 });
+            xt::xtensor<double, 3> img_wgts = xt::zeros<double>({ 10, 10, 10 });
+            auto                   xs_vals  = img_vals;
+            auto                   xs_wgts  = img_wgts;
+
+            grd_weighted_mean(
+                x, y, z, v, 0.0, 1.0, 10, 0.0, 1.0, 10, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_weighted_mean_xsimd(
+                x, y, z, v, 0.0, 1.0, 10, 0.0, 1.0, 10, 0.0, 1.0, 10, xs_vals, xs_wgts, mp_cores);
+            check_equal(img_vals, xs_vals);
+            check_equal(img_wgts, xs_wgts);
+        }
+    }
+    SECTION("2D")
+    {
+        for (int mp_cores : { 1, 3 })
+        {
+            xt::xtensor<double, 2> img_vals = xt::zeros<double>({ 10, 10 });
+            xt::xtensor<double, 2> img_wgts = xt::zeros<double>({ 10, 10 });
+            auto                   xs_vals  = img_vals;
+            auto                   xs_wgts  = img_wgts;
+
+            grd_weighted_mean(x, y, v, 0.0, 1.0, 10, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_weighted_mean_xsimd(
+                x, y, v, 0.0, 1.0, 10, 0.0, 1.0, 10, xs_vals, xs_wgts, mp_cores);
+            check_equal(img_vals, xs_vals);
+            check_equal(img_wgts, xs_wgts);
+        }
+    }
+    SECTION("1D")
+    {
+        for (int mp_cores : { 1, 3 })
+        {
+            xt::xtensor<double, 1> img_vals = xt::zeros<double>({ 10 });
+            xt::xtensor<double, 1> img_wgts = xt::zeros<double>({ 10 });
+            auto                   xs_vals  = img_vals;
+            auto                   xs_wgts  = img_wgts;
+
+            grd_weighted_mean(x, v, 0.0, 1.0, 10, img_vals, img_wgts);
+            grd_weighted_mean_xsimd(x, v, 0.0, 1.0, 10, xs_vals, xs_wgts, mp_cores);
+            check_equal(img_vals, xs_vals);
+            check_equal(img_wgts, xs_wgts);
+        }
+    }
+    SECTION("bitwise equal to the scalar kernel (float, mp_cores = 1)")
+    {
+        // both kernels share the corner / weight logic (detail::for_each_corner_cell)
+        std::vector<float> xf(x.begin(), x.end()), yf(y.begin(), y.end());
+        std::vector<float> zf(z.begin(), z.end()), vf(v.begin(), v.end());
+
+        xt::xtensor<float, 3> img_vals_3d = xt::zeros<float>({ 9, 8, 7 });
+        xt::xtensor<float, 3> img_wgts_3d = xt::zeros<float>({ 9, 8, 7 });
+        auto                  xs_vals_3d  = img_vals_3d;
+        auto                  xs_wgts_3d  = img_wgts_3d;
+        grd_weighted_mean(
+            xf, yf, zf, vf, -0.5f, 1.3f, 9, 0.2f, 1.1f, 8, -0.3f, 1.7f, 7, img_vals_3d, img_wgts_3d);
+        grd_weighted_mean_xsimd(
+            xf, yf, zf, vf, -0.5f, 1.3f, 9, 0.2f, 1.1f, 8, -0.3f, 1.7f, 7, xs_vals_3d, xs_wgts_3d);
+        CHECK(img_vals_3d == xs_vals_3d);
+        CHECK(img_wgts_3d == xs_wgts_3d);
+
+        xt::xtensor<float, 2> img_vals_2d = xt::zeros<float>({ 9, 8 });
+        xt::xtensor<float, 2> img_wgts_2d = xt::zeros<float>({ 9, 8 });
+        auto                  xs_vals_2d  = img_vals_2d;
+        auto                  xs_wgts_2d  = img_wgts_2d;
+        grd_weighted_mean(xf, yf, vf, -0.5f, 1.3f, 9, 0.2f, 1.1f, 8, img_vals_2d, img_wgts_2d);
+        grd_weighted_mean_xsimd(xf, yf, vf, -0.5f, 1.3f, 9, 0.2f, 1.1f, 8, xs_vals_2d, xs_wgts_2d);
+        CHECK(img_vals_2d == xs_vals_2d);
+        CHECK(img_wgts_2d == xs_wgts_2d);
+
+        xt::xtensor<float, 1> img_vals_1d = xt::zeros<float>({ 9 });
+        xt::xtensor<float, 1> img_wgts_1d = xt::zeros<float>({ 9 });
+        auto                  xs_vals_1d  = img_vals_1d;
+        auto                  xs_wgts_1d  = img_wgts_1d;
+        grd_weighted_mean(xf, vf, -0.5f, 1.3f, 9, img_vals_1d, img_wgts_1d);
+        grd_weighted_mean_xsimd(xf, vf, -0.5f, 1.3f, 9, xs_vals_1d, xs_wgts_1d);
+        CHECK(img_vals_1d == xs_vals_1d);
+        CHECK(img_wgts_1d == xs_wgts_1d);
+    }
+}
+
+TEST_CASE("Test grd_weighted_mean_multichannel", TESTTAG)
+{
+    // n_channels is not a multiple of the simd batch size
+    const size_t        n = 2000, n_channels = 5;
+    std::vector<double> x(n), y(n), z(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values =
+        xt::random::rand<double>({ (3 + n_channels) * n }, -1.0, 11.0);
+    xt::xtensor<double, 2> values = xt::zeros<double>({ n, n_channels });
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i);
+        y[i] = random_values(n + i);
+        z[i] = random_values(2 * n + i);
+        for (size_t c = 0; c < n_channels; ++c)
+            values(i, c) = random_values((3 + c) * n + i);
+    }
+    // non-finite values are ignored per channel
+    values(10, 1) = NAN;
+    values(20, 4) = INFINITY;
+
+    auto channel = [&](size_t c) {
+        std::vector<double> v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = values(i, c);
+        return v;
+    };
+
+    SECTION("3D")
+    {
+        for (int mp_cores : { 1, 3 })
+        {
+            xt::xtensor<double, 4> img_vals = xt::zeros<double>({ 10, 10, 10, int(n_channels) });
+            xt::xtensor<double, 4> img_wgts = xt::zeros<double>({ 10, 10, 10, int(n_channels) });
+            grd_weighted_mean_multichannel(x,
+                                           y,
+                                           z,
+                                           values,
+                                           0.0,
+                                           1.0,
+                                           10,
+                                           0.0,
+                                           1.0,
+                                           10,
+                                           0.0,
+                                           1.0,
+                                           10,
+                                           img_vals,
+                                           img_wgts,
+                                           mp_cores);
+
+            for (size_t c = 0; c < n_channels; ++c)
+            {
+                xt::xtensor<double, 3> ch_vals = xt::zeros<double>({ 10, 10, 10 });
+                xt::xtensor<double, 3> ch_wgts = xt::zeros<double>({ 10, 10, 10 });
+                grd_weighted_mean(x,
+                                  y,
+                                  z,
+                                  channel(c),
+                                  0.0,
+                                  1.0,
+                                  10,
+                                  0.0,
+                                  1.0,
+                                  10,
+                                  0.0,
+                                  1.0,
+                                  10,
+                                  ch_vals,
+                                  ch_wgts,
+                                  mp_cores);
+
+                for (size_t i = 0; i < ch_vals.size(); ++i)
+                {
+                    CHECK(img_vals.data()[i * n_channels + c] ==
+                          Catch::Approx(ch_vals.data()[i]).epsilon(1e-12));
+                    CHECK(img_wgts.data()[i * n_channels + c] ==
+                          Catch::Approx(ch_wgts.data()[i]).epsilon(1e-12));
+                }
+            }
+        }
+
+        // wrong shapes
+        xt::xtensor<double, 4> wrong_image = xt::zeros<double>({ 10, 10, 10, 3 });
+        CHECK_THROWS_AS(grd_weighted_mean_multichannel(x,
+                                                       y,
+                                                       z,
+                                                       values,
+                                                       0.0,
+                                                       1.0,
+                                                       10,
+                                                       0.0,
+                                                       1.0,
+                                                       10,
+                                                       0.0,
+                                                       1.0,
+                                                       10,
+                                                       wrong_image,
+                                                       wrong_image),
+                        std::runtime_error);
+    }
+    SECTION("2D")
+    {
+        for (int mp_cores : { 1, 3 })
+        {
+            xt::xtensor<double, 3> img_vals = xt::zeros<double>({ 10, 10, int(n_channels) });
+            xt::xtensor<double, 3> img_wgts = xt::zeros<double>({ 10, 10, int(n_channels) });
+            grd_weighted_mean_multichannel(
+                x, y, values, 0.0, 1.0, 10, 0.0, 1.0, 10, img_vals, img_wgts, mp_cores);
+
+            for (size_t c = 0; c < n_channels; ++c)
+            {
+                xt::xtensor<double, 2> ch_vals = xt::zeros<double>({ 10, 10 });
+                xt::xtensor<double, 2> ch_wgts = xt::zeros<double>({ 10, 10 });
+                grd_weighted_mean(
+                    x, y, channel(c), 0.0, 1.0, 10, 0.0, 1.0, 10, ch_vals, ch_wgts, mp_cores);
+
+                for (size_t i = 0; i < ch_vals.size(); ++i)
+                {
+                    CHECK(img_vals.data()[i * n_channels + c] ==
+                          Catch::Approx(ch_vals.data()[i]).epsilon(1e-12));
+                    CHECK(img_wgts.data()[i * n_channels + c] ==
+                          Catch::Approx(ch_wgts.data()[i]).epsilon(1e-12));
+                }
+            }
+        }
+    }
+}
+
+// hidden benchmark (run with: "[benchmark]"), divide the number of points by the mean time to
+// get points per second
+TEST_CASE("Benchmark grd_weighted_mean scalar vs xsimd", "[.][benchmark]" TESTTAG)
+{
+    const size_t        n = 1000000;
+    std::vector<double> x(n), y(n), z(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, -1.0, 101.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i);
+        y[i] = random_values(n + i);
+        z[i] = random_values(2 * n + i);
+        v[i] = random_values(3 * n + i);
+    }
+
+    xt::xtensor<double, 3> img_vals = xt::zeros<double>({ 100, 100, 100 });
+    xt::xtensor<double, 3> img_wgts = xt::zeros<double>({ 100, 100, 100 });
+
+    BENCHMARK("scalar (1e6 points)")
+    {
+        grd_weighted_mean(
+            x, y, z, v, 0.0, 1.0, 100, 0.0, 1.0, 100, 0.0, 1.0, 100, img_vals, img_wgts);
+        return img_vals(50, 50, 50);
+    };
+    BENCHMARK("xsimd (1e6 points)")
+    {
+        grd_weighted_mean_xsimd(
+            x, y, z, v, 0.0, 1.0, 100, 0.0, 1.0, 100, 0.0, 1.0, 100, img_vals, img_wgts);
+        return img_vals(50, 50, 50);
+    };
+}
+
+TEST_CASE("Benchmark get_minmax scalar reduction vs fused xsimd", "[.][benchmark]" TESTTAG)
+{
+    const size_t       n = 100000000;
+    std::vector<float> x(n), y(n), z(n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = float(i % 1000) * 0.1f;
+        y[i] = float(i % 777) * -0.1f;
+        z[i] = float(i % 333);
+    }
+    z[n / 2] = NAN;
+
+    // the previous implementation (scalar OpenMP reductions)
+    auto get_minmax_scalar = [](const std::vector<float>& sx,
+                                const std::vector<float>& sy,
+                                const std::vector<float>& sz,
+                                const int                 mp_cores) {
+        float minx = std::numeric_limits<float>::max(), maxx = std::numeric_limits<float>::lowest();
+        float miny = std::numeric_limits<float>::max(), maxy = std::numeric_limits<float>::lowest();
+        float minz = std::numeric_limits<float>::max(), maxz = std::numeric_limits<float>::lowest();
+
+#pragma omp parallel for num_threads(mp_cores) reduction(min : minx, miny, minz)                   \
+    reduction(max : maxx, maxy, maxz)
+        for (size_t i = 0; i < sx.size(); ++i)
+        {
+            const auto x = sx[i], y = sy[i], z = sz[i];
+            if (x < minx)
+                minx = x;
+            if (x > maxx)
+                maxx = x;
+            if (y < miny)
+                miny = y;
+            if (y > maxy)
+                maxy = y;
+            if (z < minz)
+                minz = z;
+            if (z > maxz)
+                maxz = z;
+        }
+        return std::make_tuple(minx, maxx, miny, maxy, minz, maxz);
+    };
+
+    for (int mp_cores : { 1, 8 })
+    {
+        BENCHMARK(fmt::format("scalar reduction (1e8 points, {} cores)", mp_cores))
+        {
+            return get_minmax_scalar(x, y, z, mp_cores);
+        };
+        BENCHMARK(fmt::format("fused xsimd (1e8 points, {} cores)", mp_cores))
+        {
+            return get_minmax(x, y, z, mp_cores);
+        };
+    }
+}
+
+TEST_CASE("Benchmark grd_weighted_mean float64 vs float32 images", "[.][benchmark]" TESTTAG)
+{
+    // float32 images need half the memory / bandwidth of float64 images. Float64 accumulation
+    // needs one size_t per point (8 MB) and reused float64 row tiles of at most about 1 MB per
+    // thread (2 MB for the straddling points), independent of the image size.
+    const size_t        n = 1000000;
+    std::vector<double> x(n), y(n), z(n), v(n);
+    std::vector<float>  xf(n), yf(n), zf(n), vf(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, -1.0, 101.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = xf[i] = float(random_values(i));
+        y[i] = yf[i] = float(random_values(n + i));
+        z[i] = zf[i] = float(random_values(2 * n + i));
+        v[i] = vf[i] = float(random_values(3 * n + i));
+    }
+
+    xt::xtensor<double, 3> img_vals   = xt::zeros<double>({ 100, 100, 100 });
+    xt::xtensor<double, 3> img_wgts   = xt::zeros<double>({ 100, 100, 100 });
+    xt::xtensor<float, 3>  img_vals_f = xt::zeros<float>({ 100, 100, 100 });
+    xt::xtensor<float, 3>  img_wgts_f = xt::zeros<float>({ 100, 100, 100 });
+
+    BENCHMARK("float64 images (1e6 points, 16 MB)")
+    {
+        grd_weighted_mean(
+            x, y, z, v, 0.0, 1.0, 100, 0.0, 1.0, 100, 0.0, 1.0, 100, img_vals, img_wgts);
+        return img_vals(50, 50, 50);
+    };
+    BENCHMARK("float32 images (1e6 points, 8 MB)")
+    {
+        grd_weighted_mean(
+            xf, yf, zf, vf, 0.f, 1.f, 100, 0.f, 1.f, 100, 0.f, 1.f, 100, img_vals_f, img_wgts_f);
+        return img_vals_f(50, 50, 50);
+    };
+    BENCHMARK("float32 images, float64 accumulation (1e6 points, 8 MB + 8 MB)")
+    {
+        grd_weighted_mean<std::vector<float>, xt::xtensor<float, 3>, float, int, double>(
+            xf, yf, zf, vf, 0.f, 1.f, 100, 0.f, 1.f, 100, 0.f, 1.f, 100, img_vals_f, img_wgts_f);
+        return img_vals_f(50, 50, 50);
+    };
+}
+
+TEST_CASE("Test group_blocks_csr", TESTTAG)
+{
+    const size_t        n = 1000;
+    std::vector<double> x(n), y(n), z(n), v(n);
+
+    xt::random::seed(1);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, -1.0, 6.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i);
+        y[i] = random_values(n + i);
+        z[i] = random_values(2 * n + i);
+        v[i] = random_values(3 * n + i);
+    }
+    v[5] = NAN;
+
+    SECTION("3D")
+    {
+        xt::xtensor<double, 3> img_vals = xt::zeros<double>({ 5, 4, 3 });
+        xt::xtensor<double, 3> img_wgts = xt::zeros<double>({ 5, 4, 3 });
+        grd_block_mean(x, y, z, v, 0.0, 1.0, 5, 0.0, 1.0, 4, 0.0, 1.0, 3, img_vals, img_wgts);
+
+        auto [cell_offsets, values] =
+            group_blocks_csr(x, y, z, v, 0.0, 1.0, 5, 0.0, 1.0, 4, 0.0, 1.0, 3);
+        REQUIRE(cell_offsets.size() == 5 * 4 * 3 + 1);
+        REQUIRE(values.size() == cell_offsets(5 * 4 * 3));
+
+        // row major cell index: sums and counts must match the block mean images
+        for (size_t ix = 0; ix < 5; ++ix)
+            for (size_t iy = 0; iy < 4; ++iy)
+                for (size_t iz = 0; iz < 3; ++iz)
+                {
+                    const size_t c   = (ix * 4 + iy) * 3 + iz;
+                    double       sum = 0.0;
+                    for (size_t i = cell_offsets(c); i < cell_offsets(c + 1); ++i)
+                        sum += values(i);
+
+                    CHECK(double(cell_offsets(c + 1) - cell_offsets(c)) ==
+                          img_wgts(ix, iy, iz));
+                    CHECK(sum == Catch::Approx(img_vals(ix, iy, iz)));
+                }
+
+        // result does not depend on the number of cores
+        auto [cell_offsets_mp, values_mp] =
+            group_blocks_csr(x, y, z, v, 0.0, 1.0, 5, 0.0, 1.0, 4, 0.0, 1.0, 3, 4);
+        CHECK(cell_offsets_mp == cell_offsets);
+        CHECK(values_mp == values);
+    }
+    SECTION("2D")
+    {
+        auto blocks                 = group_blocks(x, y, v, 0.0, 1.0, 5, 0.0, 1.0, 4);
+        auto [cell_offsets, values] = group_blocks_csr(x, y, v, 0.0, 1.0, 5, 0.0, 1.0, 4, 4);
+        REQUIRE(cell_offsets.size() == 5 * 4 + 1);
+
+        for (size_t c = 0; c < 5 * 4; ++c)
+        {
+            std::vector<double> csr_values(values.begin() + cell_offsets(c),
+                                           values.begin() + cell_offsets(c + 1));
+            if (blocks.contains(c))
+                CHECK(csr_values == blocks.at(c));
+            else
+                CHECK(csr_values.empty());
+        }
+    }
+    SECTION("1D")
+    {
+        auto blocks                 = group_blocks(x, v, 0.0, 1.0, 5);
+        auto [cell_offsets, values] = group_blocks_csr(x, v, 0.0, 1.0, 5, 4);
+        REQUIRE(cell_offsets.size() == 5 + 1);
+
+        for (size_t c = 0; c < 5; ++c)
+        {
+            std::vector<double> csr_values(values.begin() + cell_offsets(c),
+                                           values.begin() + cell_offsets(c + 1));
+            if (blocks.contains(c))
+                CHECK(csr_values == blocks.at(c));
+            else
+                CHECK(csr_values.empty());
+        }
+    }
+}
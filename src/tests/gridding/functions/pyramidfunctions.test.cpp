@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include "../../../themachinethatgoesping/algorithms/gridding/functions/pyramidfunctions.hpp"
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding::functions;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test downsample_accumulators", TESTTAG)
+{
+    xt::random::seed(0);
+
+    SECTION("2D")
+    {
+        // odd sizes: the last block only contains one cell
+        xt::xtensor<double, 2> image_values  = xt::random::rand<double>({ 75, 38 }, 0.0, 1.0);
+        xt::xtensor<double, 2> image_weights = xt::random::rand<double>({ 75, 38 }, 0.0, 1.0);
+
+        for (int mp_cores : { 1, 3 })
+        {
+            auto [values, weights] =
+                downsample_accumulators(image_values, image_weights, mp_cores);
+            REQUIRE(values.shape()[0] == 38);
+            REQUIRE(values.shape()[1] == 19);
+            REQUIRE(weights.shape() == values.shape());
+
+            for (size_t x = 0; x < 38; ++x)
+                for (size_t y = 0; y < 19; ++y)
+                {
+                    double value = 0, weight = 0;
+                    for (size_t ix = 2 * x; ix < std::min<size_t>(2 * x + 2, 75); ++ix)
+                        for (size_t iy = 2 * y; iy < 2 * y + 2; ++iy)
+                        {
+                            value += image_values(ix, iy);
+                            weight += image_weights(ix, iy);
+                        }
+                    CHECK(values(x, y) == Catch::Approx(value));
+                    CHECK(weights(x, y) == Catch::Approx(weight));
+                }
+        }
+    }
+
+    SECTION("3D")
+    {
+        xt::xtensor<double, 3> image_values  = xt::random::rand<double>({ 67, 5, 9 }, 0.0, 1.0);
+        xt::xtensor<double, 3> image_weights = xt::random::rand<double>({ 67, 5, 9 }, 0.0, 1.0);
+
+        for (int mp_cores : { 1, 3 })
+        {
+            auto [values, weights] =
+                downsample_accumulators(image_values, image_weights, mp_cores);
+            REQUIRE(values.shape()[0] == 34);
+            REQUIRE(values.shape()[1] == 3);
+            REQUIRE(values.shape()[2] == 5);
+
+            for (size_t x = 0; x < 34; ++x)
+                for (size_t y = 0; y < 3; ++y)
+                    for (size_t z = 0; z < 5; ++z)
+                    {
+                        double value = 0, weight = 0;
+                        for (size_t ix = 2 * x; ix < std::min<size_t>(2 * x + 2, 67); ++ix)
+                            for (size_t iy = 2 * y; iy < std::min<size_t>(2 * y + 2, 5); ++iy)
+                                for (size_t iz = 2 * z; iz < std::min<size_t>(2 * z + 2, 9); ++iz)
+                                {
+                                    value += image_values(ix, iy, iz);
+                                    weight += image_weights(ix, iy, iz);
+                                }
+                        CHECK(values(x, y, z) == Catch::Approx(value));
+                        CHECK(weights(x, y, z) == Catch::Approx(weight));
+                    }
+        }
+
+        xt::xtensor<double, 3> wrong_weights = xt::zeros<double>({ 67, 5, 8 });
+        CHECK_THROWS_AS(downsample_accumulators(image_values, wrong_weights), std::runtime_error);
+    }
+}
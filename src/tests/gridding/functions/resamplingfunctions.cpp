@@ -5,6 +5,10 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <random>
+
+#include <xtensor/misc/xsort.hpp>
+
 #include "../../../themachinethatgoesping/algorithms/gridding/functions/resamplingfunctions.hpp"
 
 using namespace themachinethatgoesping::algorithms::gridding::functions;
@@ -113,3 +117,128 @@ TEST_CASE("compute_resampled_coordinates: all-degenerate input stays valid", TES
     REQUIRE(coordinates(1) - coordinates(0) > 0.0f);
 }
 
+
+TEST_CASE("compute_resampled_coordinates: selection based quantiles", TESTTAG)
+{
+    // compare against the linear interpolation of the sorted values (numpy default)
+    std::vector<double> values = {9.0, -3.0, 4.5, 4.5, 12.0, 0.25, 7.0, -1.0, 3.0, 100.0, 2.0};
+    std::vector<double> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    const std::array<double, 5> probabilities = {0.0, 0.1, 0.25, 0.5, 0.9};
+    auto quantiles = detail::select_quantiles(values, probabilities);
+
+    for (size_t i = 0; i < probabilities.size(); ++i)
+    {
+        const double h        = double(sorted.size() - 1) * probabilities[i];
+        const size_t k        = size_t(std::floor(h));
+        const double expected = sorted[k] + (h - double(k)) * (sorted[k + 1] - sorted[k]);
+        REQUIRE(quantiles[i] == Catch::Approx(expected));
+    }
+}
+
+TEST_CASE("compute_resampled_coordinates: selection based quantiles match xt::quantile", TESTTAG)
+{
+    // random values with many duplicates
+    std::mt19937                       generator(42);
+    std::uniform_int_distribution<int> distribution(0, 20);
+
+    for (size_t n : {1, 2, 3, 10, 101, 1000})
+    {
+        auto values = xt::xtensor<double, 1>::from_shape({n});
+        for (auto& value : values)
+            value = double(distribution(generator)) * 0.5;
+
+        std::vector<double> selected(values.begin(), values.end());
+        const auto quantiles = detail::select_quantiles(
+            selected, std::array<double, 7>{0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0});
+        const auto expected = xt::quantile(values, {0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0});
+
+        for (size_t i = 0; i < quantiles.size(); ++i)
+            REQUIRE(quantiles[i] == Catch::Approx(expected.unchecked(i)));
+    }
+}
+
+TEST_CASE("compute_resampled_coordinates: large scratch buffers are released", TESTTAG)
+{
+    using t_scratch = detail::ResamplingScratch<double>;
+
+    const size_t n          = t_scratch::max_kept_capacity + 1;
+    auto         values_min = xt::xtensor<double, 1>::from_shape({n});
+    auto         values_max = xt::xtensor<double, 1>::from_shape({n});
+    auto         values_res = xt::xtensor<double, 1>::from_shape({n});
+    for (size_t i = 0; i < n; ++i)
+    {
+        values_min(i) = double(i % 100);
+        values_max(i) = double(i % 100) + 50.0;
+        values_res(i) = 1.0;
+    }
+
+    auto coordinates = compute_resampled_coordinates(values_min, values_max, values_res);
+    REQUIRE(coordinates.size() > 1);
+
+    const auto& scratch = detail::resampling_scratch<double>();
+    CHECK(scratch.values_min.capacity() == 0);
+    CHECK(scratch.values_max.capacity() == 0);
+    CHECK(scratch.values_res.capacity() == 0);
+
+    // small buffers are kept (cleared) for the next call
+    coordinates = compute_resampled_coordinates(
+        xt::xtensor<double, 1>({10.0, 15.0}), xt::xtensor<double, 1>({50.0, 55.0}),
+        xt::xtensor<double, 1>({1.0, 1.0}));
+    CHECK(scratch.values_min.empty());
+    CHECK(scratch.values_min.capacity() > 0);
+}
+
+TEST_CASE("compute_resampled_coordinates: batched axes match single axis", TESTTAG)
+{
+    // three axes (rows) with 5 elements each; the second axis uses explicit bounds
+    xt::xtensor<double, 2> values_min = {{10.0, 15.0, 20.0, 25.0, std::numeric_limits<double>::quiet_NaN()},
+                                         {5.0, 6.0, 5.5, 4.0, 6.5},
+                                         {7.0, 7.0, 7.0, 7.0, 7.0}};
+    xt::xtensor<double, 2> values_max = {{50.0, 55.0, 60.0, 65.0, 80.0},
+                                         {15.0, 16.0, 17.0, 15.5, 16.5},
+                                         {7.0, 7.0, 7.0, 7.0, 7.0}};
+    xt::xtensor<double, 2> values_res = {{1.0, 1.0, 0.5, 1.0, 1.0},
+                                         {0.5, 0.5, 0.5, 0.0, 0.25},
+                                         {0.0, 0.0, 0.0, 0.0, 0.0}};
+    xt::xtensor<double, 1> grid_min   = {std::numeric_limits<double>::quiet_NaN(), 7.0,
+                                         std::numeric_limits<double>::quiet_NaN()};
+    xt::xtensor<double, 1> grid_max   = {std::numeric_limits<double>::quiet_NaN(), 14.0,
+                                         std::numeric_limits<double>::quiet_NaN()};
+
+    for (int mp_cores : {1, 3})
+    {
+        auto coordinates = compute_resampled_coordinates(
+            values_min, values_max, values_res, grid_min, grid_max, 1024, mp_cores);
+        REQUIRE(coordinates.size() == 3);
+
+        for (size_t a = 0; a < 3; ++a)
+        {
+            auto row_min = xt::xtensor<double, 1>::from_shape({5});
+            auto row_max = xt::xtensor<double, 1>::from_shape({5});
+            auto row_res = xt::xtensor<double, 1>::from_shape({5});
+            for (size_t i = 0; i < 5; ++i)
+            {
+                row_min(i) = values_min(a, i);
+                row_max(i) = values_max(a, i);
+                row_res(i) = values_res(a, i);
+            }
+
+            auto expected = compute_resampled_coordinates(
+                row_min, row_max, row_res, grid_min(a), grid_max(a), 1024);
+
+            REQUIRE(coordinates[a].size() == expected.size());
+            for (size_t i = 0; i < expected.size(); ++i)
+                REQUIRE(coordinates[a](i) == expected(i));
+        }
+    }
+
+    // a failing axis is reported
+    xt::xtensor<double, 2> nan_values = {{std::numeric_limits<double>::quiet_NaN()},
+                                         {std::numeric_limits<double>::quiet_NaN()},
+                                         {std::numeric_limits<double>::quiet_NaN()}};
+    REQUIRE_THROWS_AS(compute_resampled_coordinates(
+                          nan_values, nan_values, nan_values, grid_min, grid_max, 1024, 3),
+                      std::invalid_argument);
+}
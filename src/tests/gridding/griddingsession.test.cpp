@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/functions/gridfunctions.hpp>
+#include <themachinethatgoesping/algorithms/gridding/griddingsession.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test GriddingSession", TESTTAG)
+{
+    // three batches (pings) that extend the grid in different directions
+    const size_t                     n = 2000;
+    std::vector<std::vector<double>> x(3), y(3), z(3), v(3);
+
+    xt::random::seed(0);
+    for (size_t b = 0; b < 3; ++b)
+    {
+        xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, 0.0, 1.0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            x[b].push_back(random_values(i) * 10.0 + double(b) * 7.0);
+            y[b].push_back(random_values(n + i) * 10.0 - double(b) * 5.0);
+            z[b].push_back(random_values(2 * n + i) * 3.0 - double(b));
+            v[b].push_back(random_values(3 * n + i));
+        }
+    }
+    v[1][10] = NAN;
+
+    auto check_equal = [](const auto& expected, const auto& session) {
+        REQUIRE(expected.size() == session.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+            CHECK_THAT(session.data()[i], Catch::Matchers::WithinAbs(expected.data()[i], 1e-12));
+    };
+
+    SECTION("2D")
+    {
+        GriddingSession2D<double> session_block({ 0.5, 0.25 }, 8, { 0.1, 0.0 });
+        GriddingSession2D<double> session_weighted({ 0.5, 0.25 }, 8, { 0.1, 0.0 });
+        REQUIRE(session_block.empty());
+
+        std::array<size_t, 2> shape = { 0, 0 };
+        for (size_t b = 0; b < 3; ++b)
+        {
+            session_block.add_block_mean(x[b], y[b], v[b]);
+            session_weighted.add_weighted_mean(x[b], y[b], v[b], 2);
+
+            // the grid only grows, in chunk_size steps
+            for (size_t d = 0; d < 2; ++d)
+            {
+                CHECK(session_block.get_shape()[d] >= shape[d]);
+                CHECK(session_block.get_shape()[d] % 8 == 0);
+                CHECK(session_block.get_first_cell()[d] % 8 == 0);
+            }
+            shape = session_block.get_shape();
+        }
+
+        // grid the same points in one go on the final extent
+        const auto nx = session_block.get_shape()[0], ny = session_block.get_shape()[1];
+        for (auto* session : { &session_block, &session_weighted })
+        {
+            xt::xtensor<double, 2> image_values  = xt::zeros<double>({ nx, ny });
+            xt::xtensor<double, 2> image_weights = xt::zeros<double>({ nx, ny });
+
+            for (size_t b = 0; b < 3; ++b)
+                if (session == &session_block)
+                    functions::grd_block_mean(x[b],
+                                              y[b],
+                                              v[b],
+                                              session->get_min(0),
+                                              0.5,
+                                              int(nx),
+                                              session->get_min(1),
+                                              0.25,
+                                              int(ny),
+                                              image_values,
+                                              image_weights);
+                else
+                    functions::grd_weighted_mean(x[b],
+                                                 y[b],
+                                                 v[b],
+                                                 session->get_min(0),
+                                                 0.5,
+                                                 int(nx),
+                                                 session->get_min(1),
+                                                 0.25,
+                                                 int(ny),
+                                                 image_values,
+                                                 image_weights);
+
+            check_equal(image_values, session->get_image_values());
+            check_equal(image_weights, session->get_image_weights());
+
+            // no point was lost
+            double sum_weights = 0;
+            for (size_t i = 0; i < image_weights.size(); ++i)
+                sum_weights += session->get_image_weights().data()[i];
+            CHECK(sum_weights == Catch::Approx(3 * n - 1));
+
+            const auto& image = session->get_image();
+            for (size_t i = 0; i < image.size(); ++i)
+            {
+                if (image_weights.data()[i] > 0)
+                    CHECK(image.data()[i] ==
+                          Catch::Approx(image_values.data()[i] / image_weights.data()[i]));
+                else
+                    CHECK(std::isnan(image.data()[i]));
+            }
+
+            // the image buffer is reused
+            CHECK(&session->get_image() == &image);
+        }
+
+        // coordinates are aligned to base + k * res
+        auto coordinates = session_block.get_coordinates(0);
+        REQUIRE(coordinates.size() == nx);
+        CHECK(coordinates(0) == Catch::Approx(session_block.get_min(0)));
+        CHECK(coordinates(nx - 1) == Catch::Approx(session_block.get_max(0)));
+        CHECK(std::fmod(coordinates(0) - 0.1, 0.5) == Catch::Approx(0.0).margin(1e-9));
+
+        session_block.clear();
+        CHECK(session_block.empty());
+    }
+
+    SECTION("maximum extent")
+    {
+        GriddingSession2D<double> session({ 0.1, 0.1 }, 64, {}, 64 * 64 * 6);
+        std::vector<double>       sx = { 0.05, 6.3 }, sy = { 0.0, 0.0 }, sv = { 1.0, 2.0 };
+        session.add_block_mean(sx, sy, sv);
+
+        const auto shape = session.get_shape();
+        CHECK(shape[0] * shape[1] <= session.get_max_cells());
+
+        // outliers throw and leave the session unchanged
+        std::vector<double> outlier_x = { 1e4 }, outlier_y = { 0.0 }, outlier_v = { 1.0 };
+        CHECK_THROWS_AS(session.add_block_mean(outlier_x, outlier_y, outlier_v),
+                        std::runtime_error);
+        outlier_x[0] = 1e30;
+        CHECK_THROWS_AS(session.add_weighted_mean(outlier_x, outlier_y, outlier_v),
+                        std::runtime_error);
+        CHECK(session.get_shape() == shape);
+
+        double sum_weights = 0;
+        for (size_t i = 0; i < session.get_image_weights().size(); ++i)
+            sum_weights += session.get_image_weights().data()[i];
+        CHECK(sum_weights == Catch::Approx(2.0));
+    }
+
+    SECTION("3D")
+    {
+        GriddingSession3D<double> session({ 1.0, 1.0, 0.5 }, 4);
+        CHECK_THROWS_AS(GriddingSession3D<double>({ 1.0, 0.0, 1.0 }), std::runtime_error);
+
+        for (size_t b = 0; b < 3; ++b)
+            session.add_weighted_mean(x[b], y[b], z[b], v[b]);
+
+        const auto [nx, ny, nz] = session.get_shape();
+
+        xt::xtensor<double, 3> image_values  = xt::zeros<double>({ nx, ny, nz });
+        xt::xtensor<double, 3> image_weights = xt::zeros<double>({ nx, ny, nz });
+        for (size_t b = 0; b < 3; ++b)
+            functions::grd_weighted_mean(x[b],
+                                         y[b],
+                                         z[b],
+                                         v[b],
+                                         session.get_min(0),
+                                         1.0,
+                                         int(nx),
+                                         session.get_min(1),
+                                         1.0,
+                                         int(ny),
+                                         session.get_min(2),
+                                         0.5,
+                                         int(nz),
+                                         image_values,
+                                         image_weights);
+
+        check_equal(image_values, session.get_image_values());
+        check_equal(image_weights, session.get_image_weights());
+
+        // explicit growth keeps the accumulated data
+        const auto first_cell = session.get_first_cell();
+        session.grow_to_cells({ -100, 0, 0 }, { 0, 0, 0 });
+        CHECK(session.get_first_cell()[0] == -100);
+        CHECK(session.get_shape()[0] == nx + size_t(first_cell[0] + 100));
+
+        double sum_weights = 0;
+        for (size_t i = 0; i < session.get_image_weights().size(); ++i)
+            sum_weights += session.get_image_weights().data()[i];
+        CHECK(sum_weights == Catch::Approx(3 * n - 1));
+    }
+}
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/gridplan3d.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test GridPlan3D", TESTTAG)
+{
+    // one set of coordinates, three value arrays (some points outside the grid)
+    const size_t        n = 3000;
+    std::vector<double> x(n), y(n), z(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 6 * n }, -1.0, 11.0);
+    xt::xtensor<double, 2> values        = xt::zeros<double>({ size_t(3), n });
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i]         = random_values(i);
+        y[i]         = random_values(n + i);
+        z[i]         = random_values(2 * n + i) * 0.5;
+        values(0, i) = random_values(3 * n + i);
+        values(1, i) = random_values(4 * n + i);
+        values(2, i) = random_values(5 * n + i);
+    }
+    values(1, 10) = NAN;
+    values(2, 20) = INFINITY;
+
+    ForwardGridder3D<double> gridder(1.0, 1.0, 0.5, 0.0, 10.0, 0.0, 10.0, 0.0, 4.0);
+
+    auto check_equal = [](const auto& expected, const auto& plan, size_t offset = 0) {
+        for (size_t i = 0; i < expected.size(); ++i)
+            CHECK(plan.data()[offset + i] == expected.data()[i]);
+    };
+
+    for (bool weighted_mean : { false, true })
+    {
+        const auto plan = weighted_mean ? GridPlan3D<double>::from_weighted_mean(gridder, x, y, z)
+                                        : GridPlan3D<double>::from_block_mean(gridder, x, y, z);
+        REQUIRE(plan.get_number_of_points() == n);
+        CHECK(plan.get_number_of_entries() <= (weighted_mean ? 8 * n : n));
+
+        for (int mp_cores : { 1, 3 })
+        {
+            auto [stack_values, stack_weights] =
+                plan.apply_stack<xt::xtensor<double, 4>>(values, mp_cores);
+
+            for (size_t a = 0; a < 3; ++a)
+            {
+                std::vector<double> v(n);
+                for (size_t i = 0; i < n; ++i)
+                    v[i] = values(a, i);
+
+                auto [image_values, image_weights] =
+                    weighted_mean
+                        ? gridder.interpolate_weighted_mean<xt::xtensor<double, 3>>(
+                              x, y, z, v, mp_cores)
+                        : gridder.interpolate_block_mean<xt::xtensor<double, 3>>(
+                              x, y, z, v, mp_cores);
+
+                auto [plan_values, plan_weights] = plan.apply<xt::xtensor<double, 3>>(v, mp_cores);
+                check_equal(image_values, plan_values);
+                check_equal(image_weights, plan_weights);
+
+                // stack: the images of array a are stored contiguously
+                check_equal(image_values, stack_values, a * image_values.size());
+                check_equal(image_weights, stack_weights, a * image_weights.size());
+            }
+        }
+    }
+
+    // wrong sizes
+    auto                plan = GridPlan3D<double>::from_block_mean(gridder, x, y, z);
+    std::vector<double> short_values(n - 1);
+    CHECK_THROWS_AS((plan.apply<xt::xtensor<double, 3>>(short_values)), std::runtime_error);
+
+    xt::xtensor<double, 3> wrong_image = xt::zeros<double>({ 3, 3, 3 });
+    std::vector<double>    v(n, 1.0);
+    CHECK_THROWS_AS(plan.apply_inplace(v, wrong_image, wrong_image), std::runtime_error);
+}
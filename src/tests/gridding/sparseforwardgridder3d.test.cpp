@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/sparseforwardgridder3d.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test SparseForwardGridder3D", TESTTAG)
+{
+    // a small "plume" within a large grid (and some points outside the grid)
+    const size_t        n = 5000;
+    std::vector<double> x(n), y(n), z(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, 0.0, 1.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = 40.0 + random_values(i) * 12.0;
+        y[i] = 10.0 + random_values(n + i) * 6.0;
+        z[i] = -1.0 + random_values(2 * n + i) * 8.0;
+        v[i] = random_values(3 * n + i);
+    }
+    v[10] = NAN;
+
+    ForwardGridder3D<double>       gridder(1.0, 1.0, 0.5, 0.0, 100.0, 0.0, 50.0, 0.0, 20.0);
+    SparseForwardGridder3D<double> sparse_gridder(gridder);
+
+    auto check_equal = [](const auto& expected, const auto& sparse) {
+        REQUIRE(expected.size() == sparse.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+            CHECK_THAT(sparse.data()[i], Catch::Matchers::WithinAbs(expected.data()[i], 1e-12));
+    };
+
+    auto count_filled = [](const auto& image_weights) {
+        size_t filled = 0;
+        for (size_t i = 0; i < image_weights.size(); ++i)
+            if (image_weights.data()[i] != 0)
+                ++filled;
+        return filled;
+    };
+
+    SECTION("block mean")
+    {
+        for (int mp_cores : { 1, 4 })
+        {
+            sparse_gridder.clear();
+            auto [image_values, image_weights] =
+                gridder.interpolate_block_mean<xt::xtensor<double, 3>>(x, y, z, v);
+
+            sparse_gridder.interpolate_block_mean_inplace(x, y, z, v, mp_cores);
+
+            // add a second batch
+            gridder.interpolate_block_mean_inplace(x, y, z, v, image_values, image_weights);
+            sparse_gridder.interpolate_block_mean_inplace(x, y, z, v, mp_cores);
+
+            auto [sparse_values, sparse_weights] = sparse_gridder.get_images();
+            check_equal(image_values, sparse_values);
+            check_equal(image_weights, sparse_weights);
+
+            CHECK(sparse_gridder.get_number_of_cells() == count_filled(image_weights));
+            CHECK(sparse_gridder.get_capacity() < image_values.size() / 10);
+        }
+    }
+
+    SECTION("weighted mean")
+    {
+        auto [image_values, image_weights] =
+            gridder.interpolate_weighted_mean<xt::xtensor<double, 3>>(x, y, z, v);
+
+        sparse_gridder.interpolate_weighted_mean_inplace(x, y, z, v, 3);
+
+        auto [sparse_values, sparse_weights] = sparse_gridder.get_images();
+        check_equal(image_values, sparse_values);
+        check_equal(image_weights, sparse_weights);
+
+        // coordinate lists are sorted and match the dense images
+        auto [ix, iy, iz, values, weights] = sparse_gridder.get_cells();
+        REQUIRE(ix.size() == sparse_gridder.get_number_of_cells());
+        REQUIRE(ix.size() == count_filled(image_weights));
+        for (size_t i = 0; i < ix.size(); ++i)
+        {
+            CHECK(values(i) == sparse_values(ix(i), iy(i), iz(i)));
+            CHECK(weights(i) == sparse_weights(ix(i), iy(i), iz(i)));
+            if (i > 0)
+                CHECK(std::make_tuple(ix(i - 1), iy(i - 1), iz(i - 1)) <
+                      std::make_tuple(ix(i), iy(i), iz(i)));
+        }
+    }
+}
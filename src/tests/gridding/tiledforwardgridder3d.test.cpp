@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <filesystem>
+
+#include <xtensor/generators/xrandom.hpp>
+
+#include <themachinethatgoesping/algorithms/gridding/tiledforwardgridder3d.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::gridding;
+
+#define TESTTAG "[gridding]"
+
+TEST_CASE("Test TiledForwardGridder3D", TESTTAG)
+{
+    const size_t        n = 5000;
+    std::vector<double> x(n), y(n), z(n), v(n);
+
+    xt::random::seed(0);
+    xt::xtensor<double, 1> random_values = xt::random::rand<double>({ 4 * n }, -1.0, 11.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = random_values(i);
+        y[i] = random_values(n + i);
+        z[i] = random_values(2 * n + i) * 0.5;
+        v[i] = random_values(3 * n + i);
+    }
+    v[10] = NAN;
+
+    ForwardGridder3D<double> gridder(1.0, 1.0, 1.0, 0.0, 10.0, 0.0, 10.0, 0.0, 4.0);
+
+    const auto tile_directory =
+        (std::filesystem::temp_directory_path() / "tiledforwardgridder3d_test").string();
+    std::filesystem::remove_all(tile_directory);
+
+    // tile sizes do not divide the grid size (smaller tiles at the upper borders)
+    TiledForwardGridder3D<double> tiled_gridder(gridder, 4, 3, 2, tile_directory);
+
+    REQUIRE(tiled_gridder.get_number_of_tiles_x() == 3);
+    REQUIRE(tiled_gridder.get_number_of_tiles_y() == 4);
+    REQUIRE(tiled_gridder.get_number_of_tiles_z() == 3);
+    CHECK(tiled_gridder.get_tile_shape({ 2, 3, 2 }) == std::array<size_t, 3>{ 3, 2, 1 });
+    CHECK_THROWS_AS(tiled_gridder.get_tile_shape({ 3, 0, 0 }), std::runtime_error);
+    CHECK_THROWS_AS(TiledForwardGridder3D<double>(gridder, 0, 1, 1), std::runtime_error);
+
+    auto check_equal = [](const auto& expected, const auto& tiled) {
+        REQUIRE(expected.size() == tiled.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+            CHECK(tiled.data()[i] == expected.data()[i]);
+    };
+
+    SECTION("block mean")
+    {
+        auto [image_values, image_weights] =
+            gridder.interpolate_block_mean<xt::xtensor<double, 3>>(x, y, z, v);
+
+        tiled_gridder.interpolate_block_mean_inplace(x, y, z, v, 3);
+
+        // flush, touch the flushed tiles again and compare
+        tiled_gridder.flush_all_tiles();
+        CHECK(tiled_gridder.get_loaded_tile_indices().empty());
+        CHECK(!tiled_gridder.get_flushed_tile_indices().empty());
+
+        gridder.interpolate_block_mean_inplace(x, y, z, v, image_values, image_weights);
+        tiled_gridder.interpolate_block_mean_inplace(x, y, z, v, 3);
+
+        auto [tiled_values, tiled_weights] = tiled_gridder.get_images();
+        check_equal(image_values, tiled_values);
+        check_equal(image_weights, tiled_weights);
+    }
+    SECTION("weighted mean")
+    {
+        auto [image_values, image_weights] =
+            gridder.interpolate_weighted_mean<xt::xtensor<double, 3>>(x, y, z, v);
+
+        tiled_gridder.interpolate_weighted_mean_inplace(x, y, z, v, 3);
+
+        // flush a single tile only
+        const auto tile_indices = tiled_gridder.get_tile_indices();
+        tiled_gridder.flush_tiles({ tile_indices.front() });
+        CHECK(tiled_gridder.get_flushed_tile_indices().size() == 1);
+        CHECK(tiled_gridder.get_tile_indices() == tile_indices);
+
+        auto [tiled_values, tiled_weights] = tiled_gridder.get_images();
+        check_equal(image_values, tiled_values);
+        check_equal(image_weights, tiled_weights);
+
+        // truncated tile files are detected
+        const auto tile_file = tiled_gridder.get_tile_file(tile_indices.front());
+        REQUIRE(std::filesystem::exists(tile_file));
+        std::filesystem::resize_file(tile_file, std::filesystem::file_size(tile_file) - 1);
+        CHECK_THROWS_AS(tiled_gridder.get_tile_images(tile_indices.front()), std::runtime_error);
+
+        // clear removes the tile files
+        tiled_gridder.clear();
+        CHECK(!std::filesystem::exists(tile_file));
+        CHECK(tiled_gridder.get_tile_indices().empty());
+    }
+    SECTION("more points than one block")
+    {
+        // the points are processed in blocks of 65536 points
+        std::vector<double> xs, ys, zs, vs;
+        for (size_t k = 0; k < 15; ++k)
+        {
+            xs.insert(xs.end(), x.begin(), x.end());
+            ys.insert(ys.end(), y.begin(), y.end());
+            zs.insert(zs.end(), z.begin(), z.end());
+            vs.insert(vs.end(), v.begin(), v.end());
+        }
+
+        auto [image_values, image_weights] =
+            gridder.interpolate_weighted_mean<xt::xtensor<double, 3>>(xs, ys, zs, vs);
+
+        for (int mp_cores : { 1, 3 })
+        {
+            TiledForwardGridder3D<double> block_gridder(gridder, 4, 3, 2);
+            block_gridder.interpolate_weighted_mean_inplace(xs, ys, zs, vs, mp_cores);
+
+            auto [tiled_values, tiled_weights] = block_gridder.get_images();
+            check_equal(image_values, tiled_values);
+            check_equal(image_weights, tiled_weights);
+        }
+    }
+
+    std::filesystem::remove_all(tile_directory);
+}
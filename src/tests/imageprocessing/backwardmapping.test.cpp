@@ -4,6 +4,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <stdexcept>
+#include <vector>
 
 #include <xtensor/containers/xtensor.hpp>
 
@@ -234,3 +235,76 @@ TEST_CASE("backward_map throws when coordinate axes mismatch", TESTTAG)
     REQUIRE_THROWS_AS(
         backward_map_bilinear(reference, zero_spacing_axis, ref_y_axis, new_axis, new_axis), std::invalid_argument);
 }
+
+TEST_CASE("BackwardMappingPlan can be reused for images that share the same axes", TESTTAG)
+{
+    xt::xtensor<double, 1> reference_x = { 0.0, 1.0, 2.0, 3.0 };
+    xt::xtensor<double, 1> reference_y = { 0.0, 0.5, 1.0 };
+
+    xt::xtensor<double, 1> new_x = { -0.5, 0.4, 1.6, 2.5, 3.5 };
+    xt::xtensor<double, 1> new_y = { 0.1, 0.3, 0.8, 1.2 };
+
+    const BackwardMappingPlan plan(reference_x, reference_y, new_x, new_y);
+
+    REQUIRE(plan.get_reference_x_size() == reference_x.size());
+    REQUIRE(plan.get_reference_y_size() == reference_y.size());
+    REQUIRE(plan.get_new_x_size() == new_x.size());
+    REQUIRE(plan.get_new_y_size() == new_y.size());
+    REQUIRE(plan.get_nearest_x() == std::vector<size_t>{ 0, 0, 2, 2, 3 });
+    REQUIRE(plan.get_nearest_y() == std::vector<size_t>{ 0, 1, 2, 2 });
+
+    for (size_t tile = 0; tile < 3; ++tile)
+    {
+        xt::xtensor<double, 2> reference = xt::zeros<double>({ reference_x.size(), reference_y.size() });
+        for (size_t ix = 0; ix < reference_x.size(); ++ix)
+            for (size_t iy = 0; iy < reference_y.size(); ++iy)
+                reference(ix, iy) = double(tile) * 100.0 + reference_x(ix) * 3.0 - reference_y(iy);
+
+        for (int mp_cores : { 1, 2 })
+        {
+            const auto nearest  = plan.map_nearest(reference, mp_cores);
+            const auto bilinear = plan.map_bilinear(reference, mp_cores);
+
+            const auto expected_nearest =
+                backward_map_nearest(reference, reference_x, reference_y, new_x, new_y);
+            const auto expected_bilinear =
+                backward_map_bilinear(reference, reference_x, reference_y, new_x, new_y);
+
+            xt::xtensor<double, 2> nearest_target  = xt::ones<double>({ new_x.size(), new_y.size() });
+            xt::xtensor<double, 2> bilinear_target = xt::ones<double>({ new_x.size(), new_y.size() });
+            plan.map_nearest_add(reference, nearest_target, mp_cores);
+            plan.map_bilinear_add(reference, bilinear_target, mp_cores);
+
+            for (size_t ix = 0; ix < new_x.size(); ++ix)
+                for (size_t iy = 0; iy < new_y.size(); ++iy)
+                {
+                    REQUIRE(nearest(ix, iy) == expected_nearest(ix, iy));
+                    REQUIRE(bilinear(ix, iy) == Catch::Approx(expected_bilinear(ix, iy)));
+                    REQUIRE(nearest_target(ix, iy) == Catch::Approx(1.0 + expected_nearest(ix, iy)));
+                    REQUIRE(bilinear_target(ix, iy) == Catch::Approx(1.0 + expected_bilinear(ix, iy)));
+                }
+        }
+    }
+
+    // the plan checks the image shapes
+    xt::xtensor<double, 2> wrong_reference = xt::zeros<double>({ 3, 3 });
+    xt::xtensor<double, 2> reference       = xt::zeros<double>({ 4, 3 });
+    xt::xtensor<double, 2> wrong_target    = xt::zeros<double>({ 5, 3 });
+
+    REQUIRE_THROWS_AS(plan.map_nearest(wrong_reference), std::invalid_argument);
+    REQUIRE_THROWS_AS(plan.map_bilinear(wrong_reference), std::invalid_argument);
+    REQUIRE_THROWS_AS(plan.map_nearest_add(reference, wrong_target), std::invalid_argument);
+    REQUIRE_THROWS_AS(plan.map_bilinear_add(reference, wrong_target), std::invalid_argument);
+
+    // uniform axes
+    const BackwardMappingPlan uniform_plan(UniformAxis{ 0.0, 1.0, 4 },
+                                           UniformAxis{ 0.0, 0.5, 3 },
+                                           UniformAxis{ -0.5, 1.0, 5 },
+                                           UniformAxis{ 0.1, 0.4, 3 });
+    REQUIRE(uniform_plan.get_nearest_x() == std::vector<size_t>{ 0, 0, 1, 2, 3 });
+    REQUIRE(uniform_plan.get_nearest_y() == std::vector<size_t>{ 0, 1, 2 });
+    REQUIRE_THROWS_AS(
+        BackwardMappingPlan(
+            UniformAxis{ 0.0, 0.0, 2 }, UniformAxis{ 0.0, 1.0, 2 }, UniformAxis{ 0.0, 1.0, 0 }, UniformAxis{ 0.0, 1.0, 0 }),
+        std::invalid_argument);
+}
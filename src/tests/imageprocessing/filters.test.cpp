@@ -0,0 +1,300 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/algorithms/imageprocessing/functions/filters.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::imageprocessing::functions;
+
+#define TESTTAG "[imageprocessing]"
+
+namespace {
+enum class t_reference
+{
+    maximum,
+    minimum,
+    mean,
+    median,
+    gaussian
+};
+
+/**
+ * @brief Brute force reference: apply the filter over the clipped box window of each cell of a
+ * (nx, ny, nz) row major volume (NaNs are ignored)
+ */
+std::vector<float> reference_filter(const std::vector<float>&     values,
+                                    const std::array<int64_t, 3>& shape,
+                                    const std::array<int64_t, 3>& radii,
+                                    const t_reference             reference,
+                                    const std::array<double, 3>&  sigmas = { 1., 1., 1. })
+{
+    std::vector<float> result(values.size());
+    std::vector<float> window;
+    for (int64_t x = 0; x < shape[0]; ++x)
+        for (int64_t y = 0; y < shape[1]; ++y)
+            for (int64_t z = 0; z < shape[2]; ++z)
+            {
+                window.clear();
+                double weighted_sum = 0, weight_sum = 0;
+                for (int64_t a = std::max<int64_t>(x - radii[0], 0);
+                     a < std::min(x + radii[0] + 1, shape[0]);
+                     ++a)
+                    for (int64_t b = std::max<int64_t>(y - radii[1], 0);
+                         b < std::min(y + radii[1] + 1, shape[1]);
+                         ++b)
+                        for (int64_t c = std::max<int64_t>(z - radii[2], 0);
+                             c < std::min(z + radii[2] + 1, shape[2]);
+                             ++c)
+                        {
+                            const float value = values[(a * shape[1] + b) * shape[2] + c];
+                            if (std::isnan(value))
+                                continue;
+                            window.push_back(value);
+
+                            double weight = 1;
+                            if (sigmas[0] > 0)
+                                weight *= std::exp(-0.5 * double((a - x) * (a - x)) /
+                                                   (sigmas[0] * sigmas[0]));
+                            if (sigmas[1] > 0)
+                                weight *= std::exp(-0.5 * double((b - y) * (b - y)) /
+                                                   (sigmas[1] * sigmas[1]));
+                            if (sigmas[2] > 0)
+                                weight *= std::exp(-0.5 * double((c - z) * (c - z)) /
+                                                   (sigmas[2] * sigmas[2]));
+                            weighted_sum += weight * value;
+                            weight_sum += weight;
+                        }
+
+                float filtered = std::numeric_limits<float>::quiet_NaN();
+                if (!window.empty())
+                {
+                    std::sort(window.begin(), window.end());
+                    switch (reference)
+                    {
+                        case t_reference::maximum:
+                            filtered = window.back();
+                            break;
+                        case t_reference::minimum:
+                            filtered = window.front();
+                            break;
+                        case t_reference::mean:
+                            [[fallthrough]];
+                        case t_reference::gaussian:
+                            filtered = float(weighted_sum / weight_sum);
+                            break;
+                        case t_reference::median:
+                            filtered = window[(window.size() - 1) / 2];
+                            break;
+                    }
+                }
+                result[(x * shape[1] + y) * shape[2] + z] = filtered;
+            }
+
+    return result;
+}
+
+template<typename t_xtensor>
+void require_equal(const t_xtensor& data, const std::vector<float>& reference)
+{
+    REQUIRE(data.size() == reference.size());
+    for (size_t i = 0; i < reference.size(); ++i)
+    {
+        if (std::isnan(reference[i]))
+            REQUIRE(std::isnan(data.data()[i]));
+        else
+            REQUIRE(data.data()[i] == Catch::Approx(reference[i]).margin(1e-4));
+    }
+}
+} // namespace
+
+TEST_CASE("maximum/minimum/median filters should match a brute force reference", TESTTAG)
+{
+    std::srand(11);
+
+    const std::array<int64_t, 3> shape = { 13, 9, 7 };
+    std::vector<float>           values(shape[0] * shape[1] * shape[2]);
+    for (auto& value : values)
+        value = (std::rand() % 10 == 0) ? std::numeric_limits<float>::quiet_NaN()
+                                        : float(std::rand() % 1000) * 0.1f - 50.f;
+    // a block of NaNs larger than the smallest windows
+    for (int64_t z = 0; z < 3; ++z)
+        for (int64_t y = 0; y < 3; ++y)
+            values[(0 * shape[1] + y) * shape[2] + z] = std::numeric_limits<float>::quiet_NaN();
+
+    auto make_volume = [&]() {
+        xt::xtensor<float, 3> volume = xt::zeros<float>({ 13, 9, 7 });
+        std::copy(values.begin(), values.end(), volume.data());
+        return volume;
+    };
+
+    for (const std::array<int64_t, 3> radii : { std::array<int64_t, 3>{ 1, 1, 1 },
+                                                std::array<int64_t, 3>{ 2, 0, 3 },
+                                                std::array<int64_t, 3>{ 7, 2, 1 } })
+        for (int mp_cores : { 1, 3 })
+        {
+            auto volume = make_volume();
+            maximum_filter_inplace(volume, radii, mp_cores);
+            require_equal(volume, reference_filter(values, shape, radii, t_reference::maximum));
+
+            volume = make_volume();
+            minimum_filter_inplace(volume, radii, mp_cores);
+            require_equal(volume, reference_filter(values, shape, radii, t_reference::minimum));
+
+            volume = make_volume();
+            median_filter_inplace(volume, radii, mp_cores);
+            require_equal(volume, reference_filter(values, shape, radii, t_reference::median));
+        }
+
+    // 2D images use the same code path with a z axis of size 1
+    xt::xtensor<float, 2> image = xt::zeros<float>({ 13, 63 });
+    std::copy(values.begin(), values.begin() + image.size(), image.data());
+    const std::vector<float> image_values(image.data(), image.data() + image.size());
+    const std::array<int64_t, 3> image_shape = { 13, 63, 1 };
+
+    for (int mp_cores : { 1, 4 })
+    {
+        auto filtered = image;
+        maximum_filter_inplace(filtered, { 2, 3 }, mp_cores);
+        require_equal(
+            filtered,
+            reference_filter(image_values, image_shape, { 2, 3, 0 }, t_reference::maximum));
+
+        filtered = image;
+        minimum_filter_inplace(filtered, { 3, 1 }, mp_cores);
+        require_equal(
+            filtered,
+            reference_filter(image_values, image_shape, { 3, 1, 0 }, t_reference::minimum));
+
+        filtered = image;
+        median_filter_inplace(filtered, { 1, 2 }, mp_cores);
+        require_equal(
+            filtered,
+            reference_filter(image_values, image_shape, { 1, 2, 0 }, t_reference::median));
+    }
+}
+
+TEST_CASE("box and gaussian filters should match a brute force reference", TESTTAG)
+{
+    std::srand(3);
+
+    // without NaNs the per axis normalized passes equal the full window filters
+    const std::array<int64_t, 3> shape = { 11, 8, 6 };
+    std::vector<float>           values(shape[0] * shape[1] * shape[2]);
+    for (auto& value : values)
+        value = float(std::rand() % 1000) * 0.1f - 50.f;
+
+    xt::xtensor<float, 3> volume = xt::zeros<float>({ 11, 8, 6 });
+    for (int mp_cores : { 1, 3 })
+    {
+        std::copy(values.begin(), values.end(), volume.data());
+        box_filter_inplace(volume, { 2, 1, 3 }, mp_cores);
+        require_equal(volume,
+                      reference_filter(values, shape, { 2, 1, 3 }, t_reference::mean, { 0, 0, 0 }));
+
+        std::copy(values.begin(), values.end(), volume.data());
+        gaussian_filter_inplace(volume, { 1., 0.5, 0. }, 3., mp_cores);
+        require_equal(
+            volume,
+            reference_filter(values, shape, { 3, 2, 0 }, t_reference::gaussian, { 1., 0.5, 0. }));
+    }
+
+    // with NaNs the value and weight sums are divided once (no mean of means)
+    for (auto& value : values)
+        if (std::rand() % 4 == 0)
+            value = std::numeric_limits<float>::quiet_NaN();
+    for (int mp_cores : { 1, 3 })
+    {
+        std::copy(values.begin(), values.end(), volume.data());
+        box_filter_inplace(volume, { 2, 1, 3 }, mp_cores);
+        require_equal(volume,
+                      reference_filter(values, shape, { 2, 1, 3 }, t_reference::mean, { 0, 0, 0 }));
+
+        std::copy(values.begin(), values.end(), volume.data());
+        gaussian_filter_inplace(volume, { 1., 0.5, 0. }, 3., mp_cores);
+        require_equal(
+            volume,
+            reference_filter(values, shape, { 3, 2, 0 }, t_reference::gaussian, { 1., 0.5, 0. }));
+    }
+
+    const float           nan   = std::numeric_limits<float>::quiet_NaN();
+    xt::xtensor<float, 2> holes = { { 1.f, nan }, { 2.f, 6.f } };
+    box_filter_inplace(holes, { 1, 1 }, 1);
+    for (const auto value : holes)
+        CHECK(value == Catch::Approx(3.f)); // a mean of means would be 3.75
+
+    // NaNs are ignored, windows without valid values become NaN
+    xt::xtensor<float, 2> image = xt::zeros<float>({ 5, 6 });
+    image.fill(std::numeric_limits<float>::quiet_NaN());
+    image.unchecked(2, 3) = 4.f;
+    image.unchecked(2, 4) = 8.f;
+
+    auto box = image;
+    box_filter_inplace(box, { 0, 1 }, 2);
+    CHECK(std::isnan(box.unchecked(2, 1)));
+    CHECK(box.unchecked(2, 2) == Catch::Approx(4.f));
+    CHECK(box.unchecked(2, 3) == Catch::Approx(6.f));
+    CHECK(box.unchecked(2, 5) == Catch::Approx(8.f));
+    CHECK(std::isnan(box.unchecked(1, 3)));
+
+    // infinite values only affect the windows that contain them
+    const float           inf  = std::numeric_limits<float>::infinity();
+    xt::xtensor<float, 2> line = { { 1.f, 2.f, -inf, 3.f, 4.f, 5.f, inf, 6.f, 7.f } };
+    box_filter_inplace(line, { 0, 1 }, 1);
+    CHECK(line.unchecked(0, 0) == Catch::Approx(1.5f));
+    CHECK(line.unchecked(0, 1) == -inf);
+    CHECK(line.unchecked(0, 3) == -inf);
+    CHECK(line.unchecked(0, 4) == Catch::Approx(4.f));
+    CHECK(line.unchecked(0, 5) == inf);
+    CHECK(line.unchecked(0, 8) == Catch::Approx(6.5f));
+
+    xt::xtensor<float, 2> both = { { 1.f, inf, -inf, 2.f } };
+    box_filter_inplace(both, { 0, 1 }, 1);
+    CHECK(both.unchecked(0, 0) == inf);
+    CHECK(std::isnan(both.unchecked(0, 1)));
+    CHECK(std::isnan(both.unchecked(0, 2)));
+    CHECK(both.unchecked(0, 3) == -inf);
+
+    auto gaussian = image;
+    gaussian_filter_inplace(gaussian, { 1., 1. }, 4., 2);
+    const float w2 = std::exp(-2.f), w3 = std::exp(-4.5f), w4 = std::exp(-8.f);
+    CHECK(gaussian.unchecked(0, 0) == Catch::Approx((4.f * w3 + 8.f * w4) / (w3 + w4)));
+    CHECK(gaussian.unchecked(4, 5) ==
+          Catch::Approx((4.f * w2 + 8.f * std::exp(-0.5f)) / (w2 + std::exp(-0.5f))));
+}
+
+TEST_CASE("filters should reject invalid parameters", TESTTAG)
+{
+    xt::xtensor<float, 3> volume = xt::zeros<float>({ 4, 4, 4 });
+    xt::xtensor<float, 2> image  = xt::zeros<float>({ 4, 4 });
+
+    REQUIRE_THROWS_AS(maximum_filter_inplace(volume, { 1, -1, 1 }), std::invalid_argument);
+    REQUIRE_THROWS_AS(minimum_filter_inplace(image, { -1, 1 }), std::invalid_argument);
+    REQUIRE_THROWS_AS(box_filter_inplace(volume, { 1, 1, -2 }), std::invalid_argument);
+    REQUIRE_THROWS_AS(median_filter_inplace(image, { 1, -3 }), std::invalid_argument);
+    REQUIRE_THROWS_AS(gaussian_filter_inplace(volume, { 1., -1., 1. }), std::invalid_argument);
+    REQUIRE_THROWS_AS(gaussian_filter_inplace(image, { 1., 1. }, 0.), std::invalid_argument);
+
+    // radius 0 / sigma 0 disables the filter
+    image.unchecked(1, 2) = 3.f;
+    auto unchanged        = image;
+    maximum_filter_inplace(unchanged, { 0, 0 });
+    gaussian_filter_inplace(unchanged, { 0., 0. });
+    median_filter_inplace(unchanged, { 0, 0 });
+    REQUIRE(unchanged == image);
+}
@@ -9,6 +9,7 @@
 #include <fmt/format.h>
 #include <xtensor/misc/xsort.hpp>
 #include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
 
 #include <themachinethatgoesping/algorithms/imageprocessing/functions/find_local_maxima.hpp>
 
@@ -240,3 +241,132 @@ TEST_CASE("find_local_maxima functions should reproduce previously computed resu
         REQUIRE(std::get<1>(maxima)[i] == Approx(peak.value).margin(2.0)); // margin because of noise
     }
 }
+
+TEST_CASE("find_local_maxima should match a brute force neighborhood search", TESTTAG)
+{
+    // plateaus (equal neighbors), NaNs and a threshold
+    std::srand(1);
+    auto random_value = []() { return float(std::rand() % 8); };
+
+    const size_t          nx = 23, ny = 17, nz = 11;
+    xt::xtensor<float, 3> data3 = xt::empty<float>({ nx, ny, nz });
+    xt::xtensor<float, 2> data2 = xt::empty<float>({ nx, ny });
+    xt::xtensor<float, 1> data1 = xt::empty<float>({ nx });
+    for (size_t x = 0; x < nx; ++x)
+    {
+        data1(x) = random_value();
+        for (size_t y = 0; y < ny; ++y)
+        {
+            data2(x, y) = random_value();
+            for (size_t z = 0; z < nz; ++z)
+                data3(x, y, z) = random_value();
+        }
+    }
+    data3(5, 5, 5) = NAN;
+    data3(10, 3, 7) = NAN;
+    data2(7, 7)     = NAN;
+    data1(4)        = NAN;
+
+    // returns true if val is >= all (non NaN) values in the neighborhood
+    auto is_max = [](float val, const std::vector<float>& neighborhood, bool accept_nans) {
+        for (float v : neighborhood)
+        {
+            if (std::isnan(v) && !accept_nans)
+                return false;
+            if (v > val)
+                return false;
+        }
+        return true;
+    };
+
+    for (bool accept_nans : { true, false })
+        for (float threshold : { 2.0f, std::numeric_limits<float>::lowest() })
+        {
+            // 3D
+            std::vector<int64_t> X, Y, Z;
+            std::vector<float>   V;
+            for (int64_t x = 1; x < int64_t(nx) - 1; ++x)
+                for (int64_t y = 1; y < int64_t(ny) - 1; ++y)
+                    for (int64_t z = 1; z < int64_t(nz) - 1; ++z)
+                    {
+                        std::vector<float> neighborhood;
+                        for (int64_t dx = -1; dx <= 1; ++dx)
+                            for (int64_t dy = -1; dy <= 1; ++dy)
+                                for (int64_t dz = -1; dz <= 1; ++dz)
+                                    neighborhood.push_back(data3(x + dx, y + dy, z + dz));
+
+                        const float val = data3(x, y, z);
+                        if (val > threshold && is_max(val, neighborhood, accept_nans))
+                        {
+                            X.push_back(x);
+                            Y.push_back(y);
+                            Z.push_back(z);
+                            V.push_back(val);
+                        }
+                    }
+
+            // 2D
+            std::vector<int64_t> X2, Y2;
+            std::vector<float>   V2;
+            for (int64_t x = 1; x < int64_t(nx) - 1; ++x)
+                for (int64_t y = 1; y < int64_t(ny) - 1; ++y)
+                {
+                    std::vector<float> neighborhood;
+                    for (int64_t dx = -1; dx <= 1; ++dx)
+                        for (int64_t dy = -1; dy <= 1; ++dy)
+                            neighborhood.push_back(data2(x + dx, y + dy));
+
+                    const float val = data2(x, y);
+                    if (val > threshold && is_max(val, neighborhood, accept_nans))
+                    {
+                        X2.push_back(x);
+                        Y2.push_back(y);
+                        V2.push_back(val);
+                    }
+                }
+
+            // 1D
+            std::vector<int64_t> X1;
+            std::vector<float>   V1;
+            for (int64_t x = 1; x < int64_t(nx) - 1; ++x)
+            {
+                const float val = data1(x);
+                if (val > threshold &&
+                    is_max(val, { data1(x - 1), val, data1(x + 1) }, accept_nans))
+                {
+                    X1.push_back(x);
+                    V1.push_back(val);
+                }
+            }
+            REQUIRE(X.size() > 0);
+            REQUIRE(X2.size() > 0);
+            REQUIRE(X1.size() > 0);
+
+            // results are ordered by index for any number of cores
+            for (int mp_cores : { 1, 3, 64 })
+            {
+                CHECK(find_local_maxima(data3, threshold, accept_nans, mp_cores) ==
+                      std::tuple(X, Y, Z, V));
+                CHECK(find_local_maxima(data2, threshold, accept_nans, mp_cores) ==
+                      std::tuple(X2, Y2, V2));
+                CHECK(find_local_maxima(data1, threshold, accept_nans, mp_cores) ==
+                      std::tuple(X1, V1));
+            }
+        }
+
+    // images without interior cells
+    xt::xtensor<float, 3> flat = xt::empty<float>({ size_t(5), size_t(2), size_t(5) });
+    CHECK(std::get<0>(find_local_maxima(flat)).empty());
+
+    // shapes with less than 3 cells along x must not read outside the data
+    for (size_t nx : { 0, 1, 2 })
+    {
+        xt::xtensor<float, 3> volume = xt::ones<float>({ nx, size_t(5), size_t(5) });
+        xt::xtensor<float, 2> image  = xt::ones<float>({ nx, size_t(5) });
+        for (int mp_cores : { 1, 4 })
+        {
+            CHECK(std::get<0>(find_local_maxima(volume, std::nullopt, true, mp_cores)).empty());
+            CHECK(std::get<0>(find_local_maxima(image, std::nullopt, true, mp_cores)).empty());
+        }
+    }
+}
@@ -200,3 +200,28 @@ TEST_CASE("find_local_maxima2 in 1D", TESTTAG)
 
     }
 }
+
+TEST_CASE("find_local_maxima2 results should be ordered and independent of mp_cores", TESTTAG)
+{
+    std::srand(7);
+    xt::xtensor<float, 3> data = xt::empty<float>({ 40, 30, 20 });
+    std::generate(data.begin(), data.end(), []() { return float(std::rand() % 16); });
+
+    auto maxima = find_local_maxima2(data, 2.0f);
+    REQUIRE(maxima.size() > 1);
+
+    // ordered by x, y, z
+    for (size_t i = 1; i < maxima.size(); ++i)
+        REQUIRE(std::lexicographical_compare(maxima[i - 1].begin(),
+                                             maxima[i - 1].end(),
+                                             maxima[i].begin(),
+                                             maxima[i].end()));
+
+    for (int mp_cores : { 2, 3, 64 })
+    {
+        auto maxima_mp = find_local_maxima2(data, 2.0f, true, mp_cores);
+        REQUIRE(maxima_mp.size() == maxima.size());
+        for (size_t i = 0; i < maxima.size(); ++i)
+            REQUIRE(maxima_mp[i] == maxima[i]);
+    }
+}
@@ -0,0 +1,311 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/algorithms/imageprocessing/functions/find_local_maxima.hpp>
+#include <themachinethatgoesping/algorithms/imageprocessing/functions/find_local_maxima_radius.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::imageprocessing::functions;
+
+#define TESTTAG "[location]"
+
+namespace {
+// brute force reference: compare each interior cell with all cells of the neighborhood
+template<typename t_value>
+bool is_maximum_brute_force(const t_value                 val,
+                            const std::vector<t_value>&   neighbors,
+                            const std::optional<t_value>& threshold,
+                            const bool                    accept_nans)
+{
+    if (!(val > threshold.value_or(std::numeric_limits<t_value>::lowest())))
+        return false;
+
+    for (const auto neighbor : neighbors)
+    {
+        if (std::isnan(neighbor))
+        {
+            if (accept_nans)
+                continue;
+            return false;
+        }
+        if (neighbor > val)
+            return false;
+    }
+
+    return true;
+}
+
+auto find_local_maxima_radius_brute_force(const xt::xtensor<float, 3>& data,
+                                          const int                    radius,
+                                          const int                    connectivity,
+                                          const std::optional<float>   threshold,
+                                          const bool                   accept_nans)
+{
+    std::vector<int64_t> X, Y, Z;
+    std::vector<float>   V;
+
+    const int64_t nx = data.shape()[0], ny = data.shape()[1], nz = data.shape()[2];
+    for (int64_t x = 1; x < nx - 1; ++x)
+        for (int64_t y = 1; y < ny - 1; ++y)
+            for (int64_t z = 1; z < nz - 1; ++z)
+            {
+                std::vector<float> neighbors;
+                for (int64_t dx = -radius; dx <= radius; ++dx)
+                    for (int64_t dy = -radius; dy <= radius; ++dy)
+                        for (int64_t dz = -radius; dz <= radius; ++dz)
+                        {
+                            const int n_offsets = (dx != 0) + (dy != 0) + (dz != 0);
+                            if ((connectivity == 6 && n_offsets > 1) ||
+                                (connectivity == 18 && n_offsets > 2))
+                                continue;
+                            if (x + dx < 0 || x + dx >= nx || y + dy < 0 || y + dy >= ny ||
+                                z + dz < 0 || z + dz >= nz)
+                                continue;
+                            neighbors.push_back(data(x + dx, y + dy, z + dz));
+                        }
+
+                if (is_maximum_brute_force(data(x, y, z), neighbors, threshold, accept_nans))
+                {
+                    X.push_back(x);
+                    Y.push_back(y);
+                    Z.push_back(z);
+                    V.push_back(data(x, y, z));
+                }
+            }
+
+    return std::tuple(X, Y, Z, V);
+}
+
+auto find_local_maxima_radius_brute_force(const xt::xtensor<float, 2>& data,
+                                          const int                    radius,
+                                          const int                    connectivity,
+                                          const std::optional<float>   threshold,
+                                          const bool                   accept_nans)
+{
+    std::vector<int64_t> X, Y;
+    std::vector<float>   V;
+
+    const int64_t nx = data.shape()[0], ny = data.shape()[1];
+    for (int64_t x = 1; x < nx - 1; ++x)
+        for (int64_t y = 1; y < ny - 1; ++y)
+        {
+            std::vector<float> neighbors;
+            for (int64_t dx = -radius; dx <= radius; ++dx)
+                for (int64_t dy = -radius; dy <= radius; ++dy)
+                {
+                    if (connectivity == 4 && dx != 0 && dy != 0)
+                        continue;
+                    if (x + dx < 0 || x + dx >= nx || y + dy < 0 || y + dy >= ny)
+                        continue;
+                    neighbors.push_back(data(x + dx, y + dy));
+                }
+
+            if (is_maximum_brute_force(data(x, y), neighbors, threshold, accept_nans))
+            {
+                X.push_back(x);
+                Y.push_back(y);
+                V.push_back(data(x, y));
+            }
+        }
+
+    return std::tuple(X, Y, V);
+}
+
+// greedy reference for the minimum distance suppression (quadratic)
+std::vector<size_t> suppress_brute_force(const std::vector<int64_t>& X,
+                                         const std::vector<int64_t>& Y,
+                                         const std::vector<int64_t>& Z,
+                                         const std::vector<float>&   V,
+                                         const double                min_distance)
+{
+    std::vector<size_t> order(V.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(
+        order.begin(), order.end(), [&V](size_t a, size_t b) { return V[a] > V[b]; });
+
+    std::vector<size_t> kept;
+    for (const size_t i : order)
+    {
+        bool suppressed = false;
+        for (const size_t k : kept)
+        {
+            const double dx = double(X[i] - X[k]), dy = double(Y[i] - Y[k]),
+                         dz = double(Z[i] - Z[k]);
+            if (dx * dx + dy * dy + dz * dz < min_distance * min_distance)
+                suppressed = true;
+        }
+        if (!suppressed)
+            kept.push_back(i);
+    }
+
+    std::sort(kept.begin(), kept.end());
+    return kept;
+}
+} // namespace
+
+TEST_CASE("find_local_maxima_radius should match a brute force neighborhood search", TESTTAG)
+{
+    std::srand(123);
+
+    // integer values create plateaus, NaNs test the nan handling
+    auto random_value = []() {
+        if (std::rand() % 23 == 0)
+            return std::numeric_limits<float>::quiet_NaN();
+        return float(std::rand() % 12);
+    };
+
+    xt::xtensor<float, 3> data3 = xt::empty<float>({ size_t(17), size_t(13), size_t(11) });
+    xt::xtensor<float, 2> data2 = xt::empty<float>({ size_t(31), size_t(23) });
+    xt::xtensor<float, 1> data1 = xt::empty<float>({ size_t(67) });
+    std::generate(data3.begin(), data3.end(), random_value);
+    std::generate(data2.begin(), data2.end(), random_value);
+    std::generate(data1.begin(), data1.end(), random_value);
+
+    for (const bool accept_nans : { true, false })
+        for (const auto threshold : { std::optional<float>(), std::optional<float>(4.f) })
+            for (const int radius : { 1, 2, 3, 6 })
+            {
+                for (const int connectivity : { 6, 18, 26 })
+                {
+                    auto expected = find_local_maxima_radius_brute_force(
+                        data3, radius, connectivity, threshold, accept_nans);
+                    if (accept_nans) // large neighborhoods always contain a NaN otherwise
+                        REQUIRE(std::get<0>(expected).size() > 0);
+
+                    for (const int mp_cores : { 1, 3, 64 })
+                        CHECK(find_local_maxima_radius(data3,
+                                                       radius,
+                                                       connectivity,
+                                                       threshold,
+                                                       accept_nans,
+                                                       std::nullopt,
+                                                       mp_cores) == expected);
+                }
+
+                for (const int connectivity : { 4, 8 })
+                {
+                    auto expected = find_local_maxima_radius_brute_force(
+                        data2, radius, connectivity, threshold, accept_nans);
+                    if (accept_nans)
+                        REQUIRE(std::get<0>(expected).size() > 0);
+
+                    for (const int mp_cores : { 1, 3, 64 })
+                        CHECK(find_local_maxima_radius(data2,
+                                                       radius,
+                                                       connectivity,
+                                                       threshold,
+                                                       accept_nans,
+                                                       std::nullopt,
+                                                       mp_cores) == expected);
+                }
+
+                // 1D: the 2D line neighborhood along x with y fixed
+                xt::xtensor<float, 2> data1_as_2d =
+                    xt::empty<float>({ data1.size(), size_t(3) });
+                for (size_t x = 0; x < data1.size(); ++x)
+                {
+                    data1_as_2d(x, 0) = std::numeric_limits<float>::lowest();
+                    data1_as_2d(x, 1) = data1(x);
+                    data1_as_2d(x, 2) = std::numeric_limits<float>::lowest();
+                }
+                auto [X2, Y2, V2] =
+                    find_local_maxima_radius(data1_as_2d, radius, 4, threshold, accept_nans);
+                CHECK(find_local_maxima_radius(data1, radius, threshold, accept_nans) ==
+                      std::tuple(X2, V2));
+            }
+
+    // radius 1 with 26 (8) connectivity is the neighborhood of find_local_maxima
+    for (const bool accept_nans : { true, false })
+    {
+        CHECK(find_local_maxima_radius(data3, 1, 26, 2.f, accept_nans) ==
+              find_local_maxima(data3, 2.f, accept_nans));
+        CHECK(find_local_maxima_radius(data2, 1, 8, 2.f, accept_nans) ==
+              find_local_maxima(data2, 2.f, accept_nans));
+        CHECK(find_local_maxima_radius(data1, 1, 2.f, accept_nans) ==
+              find_local_maxima(data1, 2.f, accept_nans));
+    }
+
+    // radius larger than the tensor (the streamed planes / rows cover the whole x axis)
+    xt::xtensor<float, 3> small3 = xt::empty<float>({ size_t(5), size_t(6), size_t(7) });
+    xt::xtensor<float, 2> small2 = xt::empty<float>({ size_t(5), size_t(9) });
+    std::generate(small3.begin(), small3.end(), random_value);
+    std::generate(small2.begin(), small2.end(), random_value);
+    for (const int connectivity : { 6, 18, 26 })
+        for (const int mp_cores : { 1, 3 })
+            CHECK(find_local_maxima_radius(small3, 8, connectivity, {}, true, {}, mp_cores) ==
+                  find_local_maxima_radius_brute_force(small3, 8, connectivity, {}, true));
+    for (const int connectivity : { 4, 8 })
+        for (const int mp_cores : { 1, 3 })
+            CHECK(find_local_maxima_radius(small2, 8, connectivity, {}, true, {}, mp_cores) ==
+                  find_local_maxima_radius_brute_force(small2, 8, connectivity, {}, true));
+}
+
+TEST_CASE("find_local_maxima_radius should enforce the minimum distance between maxima", TESTTAG)
+{
+    std::srand(7);
+
+    xt::xtensor<float, 3> data = xt::empty<float>({ size_t(30), size_t(25), size_t(20) });
+    std::generate(data.begin(), data.end(), []() { return float(std::rand() % 100); });
+
+    for (const double min_distance : { 0.0, 1.0, 2.5, 4.0, 7.3 })
+    {
+        auto [X, Y, Z, V] = find_local_maxima_radius(data, 1, 26, std::optional<float>(50.f));
+        auto kept         = suppress_brute_force(X, Y, Z, V, min_distance);
+
+        std::vector<int64_t> X_kept, Y_kept, Z_kept;
+        std::vector<float>   V_kept;
+        for (const size_t k : kept)
+        {
+            X_kept.push_back(X[k]);
+            Y_kept.push_back(Y[k]);
+            Z_kept.push_back(Z[k]);
+            V_kept.push_back(V[k]);
+        }
+
+        for (const int mp_cores : { 1, 3 })
+        {
+            auto result = find_local_maxima_radius(
+                data, 1, 26, std::optional<float>(50.f), true, min_distance, mp_cores);
+            CHECK(result == std::tuple(X_kept, Y_kept, Z_kept, V_kept));
+        }
+
+        if (min_distance <= 1.0)
+            CHECK(X_kept.size() == X.size());
+        else
+            CHECK(X_kept.size() < X.size());
+    }
+}
+
+TEST_CASE("find_local_maxima_radius should reject invalid parameters", TESTTAG)
+{
+    xt::xtensor<float, 3> data3 = xt::zeros<float>({ size_t(5), size_t(5), size_t(5) });
+    xt::xtensor<float, 2> data2 = xt::zeros<float>({ size_t(5), size_t(5) });
+    xt::xtensor<float, 1> data1 = xt::zeros<float>({ size_t(5) });
+
+    CHECK_THROWS_AS(find_local_maxima_radius(data3, 0), std::invalid_argument);
+    CHECK_THROWS_AS(find_local_maxima_radius(data3, 2, 8), std::invalid_argument);
+    CHECK_THROWS_AS(find_local_maxima_radius(data2, 2, 6), std::invalid_argument);
+    CHECK_THROWS_AS(find_local_maxima_radius(data1, -1), std::invalid_argument);
+    CHECK_THROWS_AS(find_local_maxima_radius(data3, 2, 26, std::nullopt, true, -1.0),
+                    std::invalid_argument);
+
+    // images without interior cells
+    xt::xtensor<float, 3> flat = xt::zeros<float>({ size_t(5), size_t(2), size_t(5) });
+    CHECK(std::get<0>(find_local_maxima_radius(flat, 3)).empty());
+}
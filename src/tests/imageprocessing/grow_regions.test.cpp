@@ -299,3 +299,123 @@ TEST_CASE("grow_regions in 1D", TESTTAG)
         REQUIRE(region_sizes[i] > 1);
     }
 }
+
+TEST_CASE("grow_regions results should be independent of mp_cores", TESTTAG)
+{
+    std::srand(7);
+    xt::xtensor<float, 3> data = xt::empty<float>({ 30, 20, 10 });
+    std::generate(data.begin(), data.end(), []() {
+        return static_cast<float>(std::rand()) / (static_cast<float>(RAND_MAX / 1.99f));
+    });
+
+    xt::xtensor<int, 3> seeds = xt::zeros<int>({ 30, 20, 10 });
+    seeds(5, 5, 5)            = 1;
+    seeds(20, 10, 3)          = 2;
+    seeds(25, 15, 8)          = 3;
+
+    for (bool eat_neighbor_regions : { false, true })
+    {
+        // a fixed number of iterations (eating neighbor regions does not necessarily converge)
+        xt::xtensor<int, 3> reference = seeds;
+        for (int iteration = 0; iteration < 10; ++iteration)
+            grow_regions(reference, data, 0, 0.2f, false, eat_neighbor_regions, 1);
+
+        for (int mp_cores : { 2, 3, 64 })
+        {
+            xt::xtensor<int, 3> regions = seeds;
+            for (int iteration = 0; iteration < 10; ++iteration)
+                grow_regions(regions, data, 0, 0.2f, false, eat_neighbor_regions, mp_cores);
+
+            REQUIRE(regions == reference);
+        }
+    }
+}
+
+TEST_CASE("grow_regions_until_converged should reproduce iterating grow_regions", TESTTAG)
+{
+    std::srand(11);
+    xt::xtensor<float, 3> data = xt::empty<float>({ 30, 20, 10 });
+    std::generate(data.begin(), data.end(), []() {
+        return static_cast<float>(std::rand()) / (static_cast<float>(RAND_MAX / 1.99f));
+    });
+
+    xt::xtensor<int, 3> seeds = xt::zeros<int>({ 30, 20, 10 });
+    seeds(5, 5, 5)            = 1;
+    seeds(6, 5, 5)            = 4;
+    seeds(20, 10, 3)          = 2;
+    seeds(25, 15, 8)          = 3;
+
+    for (bool force_negative_gradient : { true, false })
+        for (bool eat_neighbor_regions : { false, true })
+            for (float threshold : { 0.2f, 1.0f })
+            {
+                // eating neighbor regions does not necessarily converge
+                const int64_t max_iterations = 25;
+
+                xt::xtensor<int, 3> reference  = seeds;
+                int64_t             iterations = 0;
+                while (iterations < max_iterations && grow_regions(reference,
+                                                                   data,
+                                                                   0,
+                                                                   threshold,
+                                                                   force_negative_gradient,
+                                                                   eat_neighbor_regions))
+                    ++iterations;
+
+                for (int mp_cores : { 1, 3, 64 })
+                {
+                    xt::xtensor<int, 3> regions = seeds;
+                    CHECK(grow_regions_until_converged(regions,
+                                                       data,
+                                                       0,
+                                                       threshold,
+                                                       force_negative_gradient,
+                                                       eat_neighbor_regions,
+                                                       max_iterations,
+                                                       mp_cores) == iterations);
+                    CHECK(regions == reference);
+                }
+
+                // 2D and 1D slices of the same data
+                xt::xtensor<float, 2> data_2d      = xt::view(data, xt::all(), xt::all(), 5);
+                xt::xtensor<int, 2>   seeds_2d     = xt::view(seeds, xt::all(), xt::all(), 5);
+                xt::xtensor<float, 1> data_1d      = xt::view(data, xt::all(), 5, 5);
+                xt::xtensor<int, 1>   seeds_1d     = xt::view(seeds, xt::all(), 5, 5);
+                xt::xtensor<int, 2>   reference_2d = seeds_2d;
+                xt::xtensor<int, 1>   reference_1d = seeds_1d;
+                for (int64_t iteration = 0; iteration < max_iterations; ++iteration)
+                {
+                    grow_regions(reference_2d,
+                                 data_2d,
+                                 0,
+                                 threshold,
+                                 force_negative_gradient,
+                                 eat_neighbor_regions);
+                    grow_regions(reference_1d,
+                                 data_1d,
+                                 0,
+                                 threshold,
+                                 force_negative_gradient,
+                                 eat_neighbor_regions);
+                }
+
+                grow_regions_until_converged(seeds_2d,
+                                             data_2d,
+                                             0,
+                                             threshold,
+                                             force_negative_gradient,
+                                             eat_neighbor_regions,
+                                             max_iterations,
+                                             3);
+                grow_regions_until_converged(seeds_1d,
+                                             data_1d,
+                                             0,
+                                             threshold,
+                                             force_negative_gradient,
+                                             eat_neighbor_regions,
+                                             max_iterations,
+                                             3);
+                CHECK(seeds_2d == reference_2d);
+                CHECK(seeds_1d == reference_1d);
+            }
+}
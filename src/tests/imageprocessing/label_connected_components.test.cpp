@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/algorithms/imageprocessing/functions/label_connected_components.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::imageprocessing::functions;
+
+#define TESTTAG "[imageprocessing]"
+
+namespace {
+// reference: breadth first flood fill started from the cells in scan order
+xt::xtensor<int64_t, 3> label_brute_force(const xt::xtensor<uint8_t, 3>& mask, int connectivity)
+{
+    const int64_t nx = mask.shape()[0], ny = mask.shape()[1], nz = mask.shape()[2];
+    auto          regions = xt::xtensor<int64_t, 3>::from_shape(mask.shape());
+    std::fill(regions.begin(), regions.end(), 0);
+
+    int64_t label = 0;
+    for (int64_t x = 0; x < nx; ++x)
+        for (int64_t y = 0; y < ny; ++y)
+            for (int64_t z = 0; z < nz; ++z)
+            {
+                if (!mask(x, y, z) || regions(x, y, z) != 0)
+                    continue;
+
+                regions(x, y, z) = ++label;
+                std::deque<std::array<int64_t, 3>> queue = { { x, y, z } };
+                while (!queue.empty())
+                {
+                    const auto c = queue.front();
+                    queue.pop_front();
+                    for (int64_t dx = -1; dx <= 1; ++dx)
+                        for (int64_t dy = -1; dy <= 1; ++dy)
+                            for (int64_t dz = -1; dz <= 1; ++dz)
+                            {
+                                const int n_offsets = (dx != 0) + (dy != 0) + (dz != 0);
+                                if (n_offsets == 0 || (connectivity == 6 && n_offsets > 1) ||
+                                    (connectivity == 18 && n_offsets > 2))
+                                    continue;
+
+                                const int64_t a = c[0] + dx, b = c[1] + dy, d = c[2] + dz;
+                                if (a < 0 || a >= nx || b < 0 || b >= ny || d < 0 || d >= nz)
+                                    continue;
+                                if (!mask(a, b, d) || regions(a, b, d) != 0)
+                                    continue;
+
+                                regions(a, b, d) = label;
+                                queue.push_back({ a, b, d });
+                            }
+                }
+            }
+
+    return regions;
+}
+} // namespace
+
+TEST_CASE("label_connected_components should match a flood fill", TESTTAG)
+{
+    std::srand(3);
+
+    xt::xtensor<uint8_t, 3> mask = xt::zeros<uint8_t>({ size_t(23), size_t(17), size_t(13) });
+    std::generate(mask.begin(), mask.end(), []() { return uint8_t(std::rand() % 100 < 30); });
+
+    for (const int connectivity : { 6, 18, 26 })
+    {
+        const auto expected = label_brute_force(mask, connectivity);
+
+        for (const int mp_cores : { 1, 3, 64 })
+        {
+            auto [regions, voxel_counts, bbox_min, bbox_max] =
+                label_connected_components(mask, connectivity, mp_cores);
+
+            CHECK(regions == expected);
+            const int64_t n_labels = *std::max_element(expected.begin(), expected.end());
+            REQUIRE(voxel_counts.size() == size_t(n_labels));
+            REQUIRE(bbox_min.shape()[0] == voxel_counts.size());
+            REQUIRE(bbox_max.shape()[1] == 3);
+
+            // statistics per label
+            std::vector<int64_t> counts(voxel_counts.size(), 0);
+            std::vector<std::array<int64_t, 3>> mins(voxel_counts.size(), { 1000, 1000, 1000 });
+            std::vector<std::array<int64_t, 3>> maxs(voxel_counts.size(), { -1, -1, -1 });
+            for (int64_t x = 0; x < int64_t(mask.shape()[0]); ++x)
+                for (int64_t y = 0; y < int64_t(mask.shape()[1]); ++y)
+                    for (int64_t z = 0; z < int64_t(mask.shape()[2]); ++z)
+                    {
+                        const int64_t label = expected(x, y, z);
+                        if (label == 0)
+                            continue;
+
+                        const std::array<int64_t, 3> c = { x, y, z };
+                        counts[label - 1] += 1;
+                        for (size_t d = 0; d < 3; ++d)
+                        {
+                            mins[label - 1][d] = std::min(mins[label - 1][d], c[d]);
+                            maxs[label - 1][d] = std::max(maxs[label - 1][d], c[d]);
+                        }
+                    }
+
+            CHECK(voxel_counts == counts);
+            for (size_t l = 0; l < counts.size(); ++l)
+                for (size_t d = 0; d < 3; ++d)
+                {
+                    CHECK(bbox_min(l, d) == mins[l][d]);
+                    CHECK(bbox_max(l, d) == maxs[l][d]);
+                }
+        }
+    }
+
+    // 2D masks are labeled like a 3D mask with a single z layer (4: 6, 8: 18 connectivity)
+    xt::xtensor<uint8_t, 2> mask_2d = xt::zeros<uint8_t>({ size_t(41), size_t(29) });
+    std::generate(mask_2d.begin(), mask_2d.end(), []() { return uint8_t(std::rand() % 100 < 45); });
+    auto mask_3d = xt::xtensor<uint8_t, 3>::from_shape({ size_t(41), size_t(29), size_t(1) });
+    std::copy(mask_2d.begin(), mask_2d.end(), mask_3d.begin());
+
+    for (const auto& [connectivity_2d, connectivity_3d] : { std::pair(4, 6), std::pair(8, 18) })
+    {
+        const auto expected = label_connected_components(mask_3d, connectivity_3d);
+        for (const int mp_cores : { 1, 4 })
+        {
+            const auto result = label_connected_components(mask_2d, connectivity_2d, mp_cores);
+            CHECK(std::equal(std::get<0>(result).begin(),
+                             std::get<0>(result).end(),
+                             std::get<0>(expected).begin()));
+            CHECK(std::get<1>(result) == std::get<1>(expected));
+        }
+    }
+
+    CHECK_THROWS_AS(label_connected_components(mask, 8), std::invalid_argument);
+    CHECK_THROWS_AS(label_connected_components(mask_2d, 26), std::invalid_argument);
+}
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/algorithms/imageprocessing/functions/region_statistics.hpp>
+
+// using namespace testing;
+using namespace std;
+using namespace themachinethatgoesping::algorithms::imageprocessing::functions;
+
+#define TESTTAG "[imageprocessing]"
+
+TEST_CASE("compute_region_statistics should match a per cell reference", TESTTAG)
+{
+    std::srand(5);
+
+    const size_t nx = 21, ny = 14, nz = 9;
+
+    xt::xtensor<int, 3>   regions = xt::zeros<int>({ nx, ny, nz });
+    xt::xtensor<float, 3> sv      = xt::zeros<float>({ nx, ny, nz });
+    xt::xtensor<float, 3> other   = xt::zeros<float>({ nx, ny, nz });
+    for (size_t i = 0; i < regions.size(); ++i)
+    {
+        // runs of equal labels along z, a few labels spread over the whole volume
+        regions.data()[i] = (std::rand() % 4 == 0) ? 0 : int(i / 5) % 7 + 1;
+        sv.data()[i]      = -90.f + float(std::rand() % 600) * 0.1f;
+        other.data()[i] =
+            (std::rand() % 9 == 0) ? std::numeric_limits<float>::quiet_NaN() : float(i % 13);
+    }
+
+    // reference
+    struct Reference
+    {
+        int64_t count        = 0;
+        double  index_sum[3] = {};
+        int64_t min[3]       = { 1000, 1000, 1000 };
+        int64_t max[3]       = { -1, -1, -1 };
+        int64_t valid[2]     = {};
+        double  sum[2]       = {};
+        double  peak[2]      = { -1e9, -1e9 };
+    };
+    std::map<int, Reference> reference;
+    for (int64_t x = 0; x < int64_t(nx); ++x)
+        for (int64_t y = 0; y < int64_t(ny); ++y)
+            for (int64_t z = 0; z < int64_t(nz); ++z)
+            {
+                if (regions(x, y, z) == 0)
+                    continue;
+
+                auto&         r    = reference[regions(x, y, z)];
+                const int64_t c[3] = { x, y, z };
+                const float   v[2] = { sv(x, y, z), other(x, y, z) };
+                r.count += 1;
+                for (int d = 0; d < 3; ++d)
+                {
+                    r.index_sum[d] += double(c[d]);
+                    r.min[d] = std::min(r.min[d], c[d]);
+                    r.max[d] = std::max(r.max[d], c[d]);
+                }
+                for (int k = 0; k < 2; ++k)
+                {
+                    if (std::isnan(v[k]))
+                        continue;
+                    r.valid[k] += 1;
+                    r.sum[k] += std::pow(10., double(v[k]) * 0.1);
+                    r.peak[k] = std::max(r.peak[k], double(v[k]));
+                }
+            }
+
+    for (const int mp_cores : { 1, 3, 64 })
+    {
+        const auto statistics =
+            compute_region_statistics(regions, std::vector{ sv, other }, 0, true, mp_cores);
+
+        REQUIRE(statistics.size() == reference.size());
+        size_t row = 0;
+        for (const auto& [region, r] : reference)
+        {
+            CHECK(statistics.regions[row] == region);
+            CHECK(statistics.voxel_counts[row] == r.count);
+            for (int d = 0; d < 3; ++d)
+            {
+                CHECK(statistics.centroids(row, d) == Catch::Approx(r.index_sum[d] / r.count));
+                CHECK(statistics.bbox_min(row, d) == r.min[d]);
+                CHECK(statistics.bbox_max(row, d) == r.max[d]);
+            }
+            for (int k = 0; k < 2; ++k)
+            {
+                CHECK(statistics.valid_counts(row, k) == r.valid[k]);
+                CHECK(statistics.sums(row, k) == Catch::Approx(r.sum[k]));
+                CHECK(statistics.means(row, k) == Catch::Approx(r.sum[k] / r.valid[k]));
+                CHECK(statistics.maxima(row, k) == Catch::Approx(r.peak[k]));
+            }
+            ++row;
+        }
+    }
+
+    // NaN as null region (float labels), no data volumes
+    xt::xtensor<double, 2> labels = xt::zeros<double>({ size_t(4), size_t(3) });
+    for (size_t i = 0; i < labels.size(); ++i)
+        labels.data()[i] = (i % 3 == 0) ? std::numeric_limits<double>::quiet_NaN() : double(i % 2);
+
+    const auto statistics = compute_region_statistics(
+        labels, std::vector<xt::xtensor<float, 2>>(), std::numeric_limits<double>::quiet_NaN());
+    REQUIRE(statistics.size() == 2);
+    CHECK(statistics.regions == std::vector<double>{ 0., 1. });
+    CHECK(statistics.voxel_counts[0] + statistics.voxel_counts[1] == 8);
+    CHECK(statistics.sums.shape()[1] == 0);
+
+    // NaN labels are null also if null_region is not NaN
+    const auto statistics_null_0 =
+        compute_region_statistics(labels, std::vector<xt::xtensor<float, 2>>(), 0., false, 2);
+    REQUIRE(statistics_null_0.size() == 1);
+    CHECK(statistics_null_0.regions == std::vector<double>{ 1. });
+    CHECK(statistics_null_0.voxel_counts[0] == statistics.voxel_counts[1]);
+
+    CHECK_THROWS_AS(compute_region_statistics(regions,
+                                              std::vector{ xt::xtensor<float, 3>(
+                                                  xt::zeros<float>({ nx, ny, size_t(1) })) },
+                                              0),
+                    std::invalid_argument);
+}
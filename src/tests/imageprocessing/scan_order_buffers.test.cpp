@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <numeric>
+#include <vector>
+
+#include <themachinethatgoesping/algorithms/imageprocessing/functions/scan_order_buffers.hpp>
+
+using namespace std;
+using namespace themachinethatgoesping::algorithms::imageprocessing::functions;
+
+#define TESTTAG "[imageprocessing]"
+
+TEST_CASE("split_range should create contiguous chunks", TESTTAG)
+{
+    CHECK(detail::split_range(1, 9, 3) == std::vector<int64_t>{ 1, 3, 6, 9 });
+    CHECK(detail::split_range(0, 2, 8) == std::vector<int64_t>{ 0, 1, 2 });
+
+    // empty ranges result in one empty chunk
+    CHECK(detail::split_range(1, 1, 4) == std::vector<int64_t>{ 1, 1 });
+    CHECK(detail::split_range(1, -1, 4) == std::vector<int64_t>{ 1, 1 });
+}
+
+TEST_CASE("ScanOrderBuffers should merge in scan order independent of mp_cores", TESTTAG)
+{
+    const int64_t n = 1000;
+
+    // reference: every 3rd value of the scan
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < n; ++i)
+        if (i % 3 == 0)
+            expected.push_back(i);
+
+    for (int mp_cores : { 1, 2, 7 })
+    {
+        const auto    chunk_begins = detail::split_range(0, n, mp_cores);
+        const int64_t n_chunks     = chunk_begins.size() - 1;
+        REQUIRE(n_chunks == mp_cores);
+
+        detail::ScanOrderBuffers<int64_t> buffers(n_chunks);
+        REQUIRE(buffers.get_number_of_chunks() == size_t(n_chunks));
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+        for (int64_t c = 0; c < n_chunks; ++c)
+            for (int64_t i = chunk_begins[c]; i < chunk_begins[c + 1]; ++i)
+                if (i % 3 == 0)
+                    buffers[c].push_back(i);
+
+        CHECK(buffers.size() == expected.size());
+        CHECK(buffers.merge(mp_cores) == expected);
+
+        // the chunk buffers are released
+        CHECK(buffers.size() == 0);
+    }
+}
@@ -0,0 +1,187 @@
+//sourcehash: be482356d98a0b4bf472e5eaa93164d0132a594998cced2c7457c9a0fa7be73d
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder =
+R"doc(Backward mapping (gather) counterpart of ForwardGridder2D /
+ForwardGridder3D.
+
+Instead of scattering the points into the grid cells, each grid cell
+looks up the nearest input point (within max_distance). The lookup
+uses a spatial index (the points bucketed into the grid cells, sorted
+by cell) that is built once in the constructor. The result is a table
+of nearest point indices (one per grid cell), so gridding a value
+array that shares the same geometry (e.g. several frequencies / beams
+/ time steps of the same echogram slice) is a plain gather: no atomics
+/ per thread images, trivially parallel and no holes within
+max_distance of the data.
+
+Only nearest neighbor lookup is implemented: each cell takes the value
+of its nearest point, values are not interpolated between bracketing
+points (use the weighted mean / block mean of ForwardGridder2D /
+ForwardGridder3D for that).
+
+The search for a cell visits the buckets in rings of increasing
+distance until the nearest point is found. The rings are limited by
+max_distance and by the bounding box of the occupied buckets, so the
+cost of an empty cell is at most O(min(max_distance / res, box
+extent)^Dim).
+
+The grid (coordinates, shape) is the same as the one of the
+ForwardGridder that is passed to the constructor, the images can thus
+be combined with forward gridded images.
+
+Template Args:
+    t_float: floating point type of the coordinates / values
+    Dim: number of dimensions (2 or 3))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_BackwardGridder =
+R"doc(Build the nearest point table for 2D points
+
+Args:
+    gridder: ForwardGridder2D that defines the grid
+    sx: x values of the points
+    sy: y values of the points
+    max_distance: maximum distance between a grid cell center and its
+                  nearest point. Cells without a point within
+                  max_distance stay empty (NaN).
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_BackwardGridder_2 =
+R"doc(Build the nearest point table for 3D points
+
+Args:
+    gridder: ForwardGridder3D that defines the grid
+    sx: x values of the points
+    sy: y values of the points
+    sz: z values of the points
+    max_distance: maximum distance between a grid cell center and its
+                  nearest point. Cells without a point within
+                  max_distance stay empty (NaN).
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_build =
+R"doc(Build the spatial index (points bucketed into the grid cells, sorted
+by cell) and use it to find the nearest point of each grid cell. The
+spatial index is not kept, only the resulting nearest point table. The
+ring search of each cell starts at the first ring that touches the
+bounding box of the occupied buckets and stops at the last one.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_grid_min = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_grid_res = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_grid_shape = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_gridder = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_max_distance = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_nearest_point_distances =
+R"doc(Distance between the grid cell center and the nearest point (NaN if
+there is no point within max_distance)
+
+Returns:
+    const t_image&)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_nearest_point_indices =
+R"doc(Index of the nearest point per grid cell (-1 if there is no point
+within max_distance)
+
+Returns:
+    const t_index_image&)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_number_of_filled_cells =
+R"doc(Number of grid cells that have a point within max_distance
+
+Returns:
+    size_t)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_get_number_of_points = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_interpolate_nearest =
+R"doc(Grid a value array (one value per point) using nearest neighbor lookup
+
+Args:
+    s_val: values (same order / size as the points passed to the
+           constructor)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    image with the value of the nearest point per grid cell (NaN if
+        there is no point within max_distance))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_interpolate_nearest_inplace =
+R"doc(Grid a value array (one value per point) using nearest neighbor lookup
+into an existing image. All cells of the image are overwritten.
+
+Args:
+    s_val: values (same order / size as the points passed to the
+           constructor)
+    image: image with the shape of the grid, will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_max_distance = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_nearest_point_distances = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_nearest_point_indices = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_BackwardGridder_number_of_points = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -1,4 +1,4 @@
-//sourcehash: 37cfae5853dbf5e4314b029c84ee5938c305a095a11e5f829db6b211570ff8c3
+//sourcehash: 8e8d7273d6d475b2870a3697e1325f9782fc3af146cfe042f1c8aa5543b790f7
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -61,6 +61,13 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGri
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_border_xmin = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_check_image_dimensions =
+R"doc(Throw if the first dimension of image does not fit the grid dimensions
+
+Args:
+    image: image to check
+    image_name: name of the image (used in the error message))doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_from_data =
 R"doc(Create gridder with resolution "res" xmin,xmax are determined to
 exactly contain the given data vector (sx)
@@ -134,8 +141,121 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGri
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_get_xres = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_grd_block_fold =
+R"doc(Fold the points into their nearest cell of image (block min / max /
+count, see functions::detail::grd_block_fold_nd))doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_group_blocks = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_group_blocks_csr =
+R"doc(Group the values into the grid cells using a counting sort (compressed
+layout without per cell allocations). The values of cell ix are
+values[cell_offsets[ix]:cell_offsets[ix+1]]
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<t_float, 1>>
+        cell_offsets (size nx + 1), values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_count =
+R"doc(Count the number of 1D points per 1d image cell
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    t_xtensor_1d image_count)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_count_inplace =
+R"doc(Count the number of 1D points per 1d image cell (inplace version)
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    image_count: Image with the number of values per cell will be
+                 edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_histogram =
+R"doc(Interpolate 1D points onto per cell histograms (sketches) with n_bins
+equally spaced bins between hist_min and hist_max. Values outside this
+range are counted in the first / last bin. Use
+functions::histogram_quantile to compute approximate block medians /
+quantiles from the histograms.
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    hist_min: lower border of the first histogram bin
+    hist_max: upper border of the last histogram bin
+    n_bins: number of histogram bins
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    t_xtensor_2d image_histogram (last axis: bins))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_histogram_inplace =
+R"doc(Interpolate 1D points onto per cell histograms (inplace version). The
+number of bins is given by the last axis of image_histogram.
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    hist_min: lower border of the first histogram bin
+    hist_max: upper border of the last histogram bin
+    image_histogram: Image with histogram counts (last axis: bins)
+                     will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_max =
+R"doc(Interpolate 1D points onto a 1d image using the block maximum
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    t_xtensor_1d image_max (NaN for empty cells))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_max_inplace =
+R"doc(Interpolate 1D points onto a 1d image using the block maximum (inplace
+version). The maximum of the new values is folded into image_max, NaN
+cells are treated as empty.
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    image_max: Image with maximum values will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_mean =
 R"doc(Interpolate 1D points onto 1d images using block mean interpolation
 
@@ -146,6 +266,7 @@ Args:
                   created.
     image_weights: Image with weights. If empty a new image will be
                    created.
+    mp_cores: Number of cores to use for parallelization
 
 Template Args:
     T_vector: 
@@ -163,6 +284,7 @@ Args:
     s_val: amplitudes / volume backscattering coefficients
     image_values: Image with values will be edited inplace
     image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use for parallelization
 
 Template Args:
     T_vector: 
@@ -171,12 +293,75 @@ Returns:
     std::tuple<xt::xtensor<t_float, 1>, xt::xtensor<t_float, 1>>
         image_values, image_weights)doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_min =
+R"doc(Interpolate 1D points onto a 1d image using the block minimum
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    t_xtensor_1d image_min (NaN for empty cells))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_min_inplace =
+R"doc(Interpolate 1D points onto a 1d image using the block minimum (inplace
+version). The minimum of the new values is folded into image_min, NaN
+cells are treated as empty.
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    image_min: Image with minimum values will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_variance =
+R"doc(Interpolate 1D points onto 1d images using a running (Welford) block
+mean / variance. The (population) variance is image_m2 / image_count.
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    std::tuple<t_xtensor_1d, t_xtensor_1d, t_xtensor_1d> image_count,
+        image_mean, image_m2)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_block_variance_inplace =
+R"doc(Interpolate 1D points onto 1d images using a running (Welford) block
+mean / variance (inplace version). The (population) variance is
+image_m2 / image_count.
+
+Args:
+    sx: x values
+    s_val: amplitudes / volume backscattering coefficients
+    image_count: Image with the number of values per cell will be
+                 edited inplace
+    image_mean: Image with the running mean will be edited inplace
+    image_m2: Image with the running sum of squared differences from
+              the mean will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder1D_interpolate_weighted_mean =
 R"doc(Interpolate 1D points onto 1d images using weighted mean interpolation
 
 Args:
     sx: x values
     s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
 
 Template Args:
     T_vector: 
@@ -195,6 +380,7 @@ Args:
                   created.
     image_weights: Image with weights. If empty a new image will be
                    created.
+    mp_cores: Number of cores to use for parallelization
 
 Template Args:
     T_vector: 
@@ -1,4 +1,4 @@
-//sourcehash: 336f43246b8546952607c368151dd63f394778eda365ec48325c158760df66f5
+//sourcehash: bf52e53ddc3aa84abbd4eb27640f1be43132831adc6f535f552609816a4c44bd
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -69,6 +69,58 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGri
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_border_ymin = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_check_image_dimensions =
+R"doc(Throw if the first 2 dimensions of image do not fit the grid
+dimensions
+
+Args:
+    image: image to check
+    image_name: name of the image (used in the error message))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_compute_pyramid =
+R"doc(Compute a multi resolution (mip style) pyramid from accumulated images
+(e.g. from interpolate_weighted_mean_inplace). Each level is computed
+from the previous level by summing blocks of 2x2 cells of the raw
+accumulators (functions::downsample_accumulators), such that
+image_values / image_weights of each level is the exact mean of all
+values within a block.
+
+Args:
+    image_values: accumulated values of this grid
+    image_weights: accumulated weights of this grid
+    n_levels: number of coarser levels to compute (level 1 to
+              n_levels)
+    mp_cores: Number of cores to use for parallelization (over output
+              tiles)
+
+Template Args:
+    t_xtensor_2d: 
+
+Returns:
+    std::vector<std::tuple<ForwardGridder2D, t_xtensor_2d,
+        t_xtensor_2d>> (gridder, image_values, image_weights) of the
+        levels 1 to n_levels)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_from_cells =
+R"doc(Create gridder from the center of the first grid cell and the number
+of cells per axis. Unlike the constructor, the number of cells is not
+derived from (max - min) / res and is thus not affected by rounding.
+
+Args:
+    xres: x resolution of the grid
+    yres: y resolution of the grid
+    xmin: x center of the first grid cell (should be aligned to xbase
+          + k * xres)
+    nx: number of grid cells in x
+    ymin: y center of the first grid cell (should be aligned to ybase
+          + k * yres)
+    ny: number of grid cells in y
+    xbase: x base position of the grid, by default 0.0
+    ybase: y base position of the grid, by default 0.0
+
+Returns:
+    ForwardGridder2D object)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_from_data =
 R"doc(Create gridder with resolution "res" xmin,xmax,ymin,ymax are
 determined to exactly contain the given data vectors (sx,sy)
@@ -137,6 +189,18 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGri
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_get_ny = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_get_pyramid_gridder =
+R"doc(Get the gridder of a coarser pyramid level (see compute_pyramid). The
+cells of level l are blocks of 2^l cells per axis of this grid,
+starting at the first cell. The block borders coincide with the cell
+borders of this grid, so the coordinates of all levels line up.
+
+Args:
+    level: pyramid level (0 returns a copy of this gridder)
+
+Returns:
+    ForwardGridder2D)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_get_x_coordinates = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_get_x_grd_value = R"doc()doc";
@@ -173,8 +237,128 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGri
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_get_yres = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_grd_block_fold =
+R"doc(Fold the points into their nearest cell of image (block min / max /
+count, see functions::detail::grd_block_fold_nd))doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_group_blocks = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_group_blocks_csr =
+R"doc(Group the values into the grid cells using a counting sort (compressed
+layout without per cell allocations). The values of cell (ix, iy) are
+values[cell_offsets[c]:cell_offsets[c+1]] with c = ix * ny + iy
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<t_float, 1>>
+        cell_offsets (size nx * ny + 1), values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_count =
+R"doc(Count the number of 2D points per 2d image cell
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    t_xtensor_2d image_count)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_count_inplace =
+R"doc(Count the number of 2D points per 2d image cell (inplace version)
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    image_count: Image with the number of values per cell will be
+                 edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_histogram =
+R"doc(Interpolate 2D points onto per cell histograms (sketches) with n_bins
+equally spaced bins between hist_min and hist_max. Values outside this
+range are counted in the first / last bin. Use
+functions::histogram_quantile to compute approximate block medians /
+quantiles from the histograms.
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    hist_min: lower border of the first histogram bin
+    hist_max: upper border of the last histogram bin
+    n_bins: number of histogram bins
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    t_xtensor_3d image_histogram (last axis: bins))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_histogram_inplace =
+R"doc(Interpolate 2D points onto per cell histograms (inplace version). The
+number of bins is given by the last axis of image_histogram.
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    hist_min: lower border of the first histogram bin
+    hist_max: upper border of the last histogram bin
+    image_histogram: Image with histogram counts (last axis: bins)
+                     will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_max =
+R"doc(Interpolate 2D points onto a 2d image using the block maximum
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    t_xtensor_2d image_max (NaN for empty cells))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_max_inplace =
+R"doc(Interpolate 2D points onto a 2d image using the block maximum (inplace
+version). The maximum of the new values is folded into image_max, NaN
+cells are treated as empty.
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    image_max: Image with maximum values will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_mean =
 R"doc(Interpolate 2D points onto 2d images using block mean interpolation
 
@@ -182,6 +366,7 @@ Args:
     sx: x values
     sy: y values
     s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
 
 Template Args:
     T_vector: 
@@ -200,6 +385,149 @@ Args:
     s_val: amplitudes / volume backscattering coefficients
     image_values: Image with values will be edited inplace
     image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_min =
+R"doc(Interpolate 2D points onto a 2d image using the block minimum
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    t_xtensor_2d image_min (NaN for empty cells))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_min_inplace =
+R"doc(Interpolate 2D points onto a 2d image using the block minimum (inplace
+version). The minimum of the new values is folded into image_min, NaN
+cells are treated as empty.
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    image_min: Image with minimum values will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_variance =
+R"doc(Interpolate 2D points onto 2d images using a running (Welford) block
+mean / variance. The (population) variance is image_m2 / image_count.
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    std::tuple<t_xtensor_2d, t_xtensor_2d, t_xtensor_2d> image_count,
+        image_mean, image_m2)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_block_variance_inplace =
+R"doc(Interpolate 2D points onto 2d images using a running (Welford) block
+mean / variance (inplace version). The (population) variance is
+image_m2 / image_count.
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    image_count: Image with the number of values per cell will be
+                 edited inplace
+    image_mean: Image with the running mean will be edited inplace
+    image_m2: Image with the running sum of squared differences from
+              the mean will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_gaussian_splat =
+R"doc(Interpolate 2D points onto 2d images using gaussian kernel splatting
+(each point is distributed onto all cells within radius, weighted by
+exp(-d² / (2 sigma²)))
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    radius: footprint radius (in coordinate units)
+    sigma: standard deviation of the gaussian kernel (in coordinate
+           units)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    std::tuple<xt::xtensor<t_float, 2>, xt::xtensor<t_float, 2>>
+        image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_gaussian_splat_inplace =
+R"doc(Interpolate 2D points onto 2d images using gaussian splatting (inplace
+version, see interpolate_gaussian_splat)
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    radius: footprint radius (in coordinate units)
+    sigma: standard deviation of the gaussian kernel (in coordinate
+           units)
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_inverse_distance_splat =
+R"doc(Interpolate 2D points onto 2d images using inverse distance weighted
+splatting (each point is distributed onto all cells within radius,
+weighted by 1 / d^power)
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    radius: footprint radius (in coordinate units)
+    power: power of the inverse distance weights
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+
+Returns:
+    std::tuple<xt::xtensor<t_float, 2>, xt::xtensor<t_float, 2>>
+        image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_inverse_distance_splat_inplace =
+R"doc(Interpolate 2D points onto 2d images using inverse distance splatting
+(inplace version, see interpolate_inverse_distance_splat)
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients
+    radius: footprint radius (in coordinate units)
+    power: power of the inverse distance weights
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use for parallelization
 
 Template Args:
     T_vector:)doc";
@@ -211,6 +539,7 @@ Args:
     sx: x values
     sy: y values
     s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
 
 Template Args:
     T_vector: 
@@ -229,10 +558,48 @@ Args:
     s_val: amplitudes / volume backscattering coefficients
     image_values: Image with values will be edited inplace
     image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use for parallelization
 
 Template Args:
     T_vector:)doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_weighted_mean_multichannel =
+R"doc(Interpolate 2D points with n_channels values each (e.g. several
+frequencies) onto 3D images (nx, ny, n_channels) using weighted mean
+interpolation. The index / weight computation is shared by all
+channels (see functions::grd_weighted_mean_multichannel).
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: 2D array of values (n_points x n_channels)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor_3d: 
+    T_vector: 
+    t_xtensor_2d: 
+
+Returns:
+    std::tuple<t_xtensor_3d, t_xtensor_3d> image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_interpolate_weighted_mean_multichannel_inplace =
+R"doc(Interpolate 2D points with n_channels values each onto 3D images (nx,
+ny, n_channels) using weighted mean interpolation (inplace version)
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: 2D array of values (n_points x n_channels)
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector: 
+    t_xtensor_2d: 
+    t_xtensor_3d:)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_nx = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder2D_ny = R"doc()doc";
@@ -0,0 +1,215 @@
+//sourcehash: f5314a443a823559c5f74db2901fdc06a68648ccc40be0be94ec716c3ae8a146
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D =
+R"doc(Space-time (x, y, z, t) version of ForwardGridder3D, e.g. for repeated
+surveys of the same area. The time axis is divided into time slices of
+width tres, slice k is centered at tbase + k * tres. Each time slice
+is a 3D grid (values / weights images) of the given ForwardGridder3D.
+Only time slices that received data are stored (ordered by slice
+index), so that new surveys / time slices can be added incrementally
+without allocating the (mostly empty) time range in between.
+
+Times are handled in double precision (e.g. unix time in seconds)
+independent of t_float.
+
+Template Args:
+    t_float: floating point type of the grid parameters and images)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_ForwardGridder4D =
+R"doc(Initialize space-time forward gridder
+
+Args:
+    gridder: ForwardGridder3D that defines the spatial grid of each
+             time slice
+    tres: width of the time slices (e.g. 3600 for hourly slices of
+          unix times)
+    tbase: center of time slice 0, by default 0.0)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_add_slice_images =
+R"doc(Add accumulated images (e.g. from
+ForwardGridder3D::interpolate_block_mean with the same grid) to time
+slice time_index. The slice is created if it does not exist.
+
+Args:
+    time_index: index of the time slice (see get_time_index)
+    image_values: accumulated values
+    image_weights: accumulated weights
+
+Template Args:
+    t_xtensor_3d:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_check_input_sizes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_clear =
+R"doc(Remove all time slices (and release the memory))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_gridder = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_images =
+R"doc(Stack the images of all stored time slices (in the order of
+get_time_indices) into 4D images with shape (n_slices, nx, ny, nz)
+
+Returns:
+    std::tuple<xt::xtensor<t_float, 4>, xt::xtensor<t_float, 4>>
+        image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_number_of_slices = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_or_create_slice = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_slice =
+R"doc(Get the accumulated images of time slice time_index
+
+Args:
+    time_index: index of the time slice
+
+Returns:
+    const std::tuple<t_image, t_image>& image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_tbase = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_time_extent =
+R"doc(Get the start and end time of time slice time_index)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_time_index =
+R"doc(Get the index of the time slice that contains time t)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_time_index_fraction =
+R"doc(Get the (fractional) time slice index of time t: (t - tbase) / tres)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_time_indices =
+R"doc(Get the indices of all stored (occupied) time slices in ascending
+order
+
+Returns:
+    std::vector<int64_t>)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_time_value =
+R"doc(Get the center time of time slice time_index)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_times =
+R"doc(Get the center times of all stored (occupied) time slices in ascending
+order
+
+Returns:
+    std::vector<double>)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_get_tres = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_has_slice = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_interpolate_block_mean_inplace =
+R"doc(Add space-time points using block mean interpolation (each point is
+added to the nearest grid cell of the nearest time slice). Time slices
+are created as needed.
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    st: time values
+    s_val: amplitudes / volume backscattering coefficients (points
+           with non-finite values or times are ignored)
+    mp_cores: Number of cores to use for parallelization (within each
+              time slice)
+
+Template Args:
+    T_vector: 
+    T_vector_time: type of the time values (use double for e.g. unix
+                   times))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_interpolate_inplace =
+R"doc(Add all points (sx: x values) to the time slices. for_each_slice(i,
+add_to_slice) calls add_to_slice(time_index, time_weight) for each
+time slice point i contributes to (only for points that contribute to
+at least one cell of the spatial grid). add_to_images(i, time_weight,
+values, weights) then adds point i to the images of one slice. The
+points are grouped per time slice with a counting sort (two passes
+over for_each_slice, ascending point order within each slice). Each
+slice is then filled with the parallel 3D scatter kernel
+(functions::detail::scatter_points, partitioned along x), so that
+mp_cores is used also if all points fall into a single time slice.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_interpolate_weighted_mean_inplace =
+R"doc(Add space-time points using weighted mean interpolation (each point is
+distributed onto the 8 surrounding grid cells of the 2 surrounding
+time slices, weighted by the distance to the cell centers / slice
+centers). Time slices are created as needed.
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    st: time values
+    s_val: amplitudes / volume backscattering coefficients (points
+           with non-finite values or times are ignored)
+    mp_cores: Number of cores to use for parallelization (within each
+              time slice)
+
+Template Args:
+    T_vector: 
+    T_vector_time: type of the time values (use double for e.g. unix
+                   times))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_remove_slice =
+R"doc(Remove a time slice (and release its memory), e.g. to keep a moving
+time window
+
+Args:
+    time_index: index of the time slice
+
+Returns:
+    true if the slice existed)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_slices = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_tbase = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridder4D_tres = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -0,0 +1,217 @@
+//sourcehash: fe3bcda5c684d829645879ab9172286e6a560244755e088f5ee44ab23a95b1a5
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN =
+R"doc(Dimension generic version of ForwardGridder1D / 2D / 3D. Generates N
+dimensional grids and interpolates N dimensional points onto the grid
+using simple forward mapping algorithms (block mean, weighted mean
+interpolation). The grid parameters are computed per axis exactly as
+in the dimension specific gridders, and all gridders share the same
+(dimension generic) gridding kernels (functions::grd_block_mean_nd,
+functions::grd_weighted_mean_nd). The points are passed as coordinate
+array with shape (N, n_points), e.g. (x, y, z, t) for N = 4.
+
+Template Args:
+    t_float: floating point type of the grid parameters
+    N: number of dimensions)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_ForwardGridderN =
+R"doc(Initialize forward gridder class using grid parameters.
+
+Args:
+    res: resolution of the grid per axis
+    min_values: smallest value per axis that must be contained within
+                the grid
+    max_values: largest value per axis that must be contained within
+                the grid
+    base: base position of the grid per axis, by default 0.0)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_base = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_border_max = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_border_min = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_from_data =
+R"doc(Create gridder with resolution "res" for all axes. The grid minimum /
+maximum is determined to exactly contain the given coordinates (non-
+finite coordinates are ignored).
+
+Args:
+    res: resolution of the grid (all axes)
+    s_coordinates: coordinates of the points, shape (N, n_points)
+
+Returns:
+    ForwardGridderN object)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_from_res =
+R"doc(Create gridder setting the resolution of all axes to "res"
+
+Args:
+    res: resolution of the grid (all axes)
+    min_values: smallest value per axis that must be contained within
+                the grid
+    max_values: largest value per axis that must be contained within
+                the grid
+
+Returns:
+    ForwardGridderN object)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_from_stream = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_base = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_border_max = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_border_min = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_coordinates = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_empty_grd_images =
+R"doc(Create empty grid images
+
+Returns:
+    std::tuple<t_xtensor, t_xtensor> image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_extent = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_grd_value = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_index = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_index_fraction = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_max = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_min = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_n = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_res = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_get_value = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_interpolate_block_mean =
+R"doc(Interpolate N dimensional points onto N dimensional images using block
+mean interpolation
+
+Args:
+    s_coordinates: coordinates of the points, shape (N, n_points)
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor: 
+    t_xtensor_2d: 
+    T_vector: 
+
+Returns:
+    std::tuple<t_xtensor, t_xtensor> image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_interpolate_block_mean_inplace =
+R"doc(Interpolate N dimensional points onto N dimensional images using block
+mean interpolation (inplace version)
+
+Args:
+    s_coordinates: coordinates of the points, shape (N, n_points)
+    s_val: amplitudes / volume backscattering coefficients
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor_2d: 
+    T_vector: 
+    t_xtensor:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_interpolate_weighted_mean =
+R"doc(Interpolate N dimensional points onto N dimensional images using
+weighted mean interpolation (each point is distributed onto the 2^N
+surrounding grid cells)
+
+Args:
+    s_coordinates: coordinates of the points, shape (N, n_points)
+    s_val: amplitudes / volume backscattering coefficients
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor: 
+    t_xtensor_2d: 
+    T_vector: 
+
+Returns:
+    std::tuple<t_xtensor, t_xtensor> image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_interpolate_weighted_mean_inplace =
+R"doc(Interpolate N dimensional points onto N dimensional images using
+weighted mean interpolation (inplace version)
+
+Args:
+    s_coordinates: coordinates of the points, shape (N, n_points)
+    s_val: amplitudes / volume backscattering coefficients
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor_2d: 
+    T_vector: 
+    t_xtensor:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_max = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_min = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_n = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_operator_eq = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_res = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_ForwardGridderN_to_stream = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -0,0 +1,240 @@
+//sourcehash: 872310073ee430db78c71e7d4b742ca8be128b3572235bd0715860df31eb618d
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession =
+R"doc(Stateful (streaming) gridding session that accumulates batches of
+pings into 2D or 3D images (block mean or weighted mean interpolation,
+see ForwardGridder2D / ForwardGridder3D).
+
+The grid is aligned to base + k * res (same as the ForwardGridders).
+The extent is not fixed: when a batch contains points outside the
+current extent, the images grow in steps of chunk_size cells (the
+image borders are always multiples of chunk_size cells). Growing
+copies the accumulated values / weights into the enlarged images,
+nothing is gridded twice. The batches are gridded by a
+ForwardGridder2D / ForwardGridder3D on the current extent.
+
+The number of image cells is limited to max_cells: a batch (or
+grow_to_cells call) that would grow the grid beyond it (e.g. because
+of outliers in the coordinates) throws and leaves the session
+unchanged.
+
+Template Args:
+    t_float: floating point type of the images
+    Dim: number of dimensions (2 or 3))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_GriddingSession =
+R"doc(Initialize an empty gridding session
+
+Args:
+    res: resolution of the grid per axis (x, y[, z])
+    chunk_size: number of cells per growth step (per axis)
+    base: base position of the grid per axis (x, y[, z]), by default 0
+    max_cells: maximum number of image cells (product over all axes),
+               by default 2^28)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_add_block_mean =
+R"doc(Add a batch of 2D points using block mean interpolation (the grid
+grows if necessary)
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients (non-finite
+           values are ignored)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_add_block_mean_2 =
+R"doc(Add a batch of 3D points using block mean interpolation (the grid
+grows if necessary)
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    s_val: amplitudes / volume backscattering coefficients (non-finite
+           values are ignored)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_add_weighted_mean =
+R"doc(Add a batch of 2D points using weighted mean interpolation (the grid
+grows if necessary)
+
+Args:
+    sx: x values
+    sy: y values
+    s_val: amplitudes / volume backscattering coefficients (non-finite
+           values are ignored)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_add_weighted_mean_2 =
+R"doc(Add a batch of 3D points using weighted mean interpolation (the grid
+grows if necessary)
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    s_val: amplitudes / volume backscattering coefficients (non-finite
+           values are ignored)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_base = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_chunk_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_clear =
+R"doc(Reset the session (remove all accumulated data))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_empty = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_first_cell = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_base = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_chunk_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_coordinates =
+R"doc(Center coordinates of the image cells along axis
+
+Args:
+    axis: 0 = x, 1 = y, 2 = z
+
+Returns:
+    xt::xtensor<t_float, 1>)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_first_cell =
+R"doc(Get the global cell index (cell center = base + index * res) of the
+first image cell
+
+Returns:
+    std::array<int64_t, Dim>)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_gridder =
+R"doc(ForwardGridder2D / ForwardGridder3D for the current extent of the
+images)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_image =
+R"doc(Get the normalized image (image_values / image_weights, NaN for empty
+cells). The image is computed into an internal buffer that is reused
+between calls (no allocation unless the grid grew). The reference is
+valid until the next call of get_image or any function that changes
+the session.
+
+Returns:
+    const xt::xtensor<t_float, Dim>&)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_image_values =
+R"doc(Get the accumulated values image (no copy)
+
+Returns:
+    const xt::xtensor<t_float, Dim>&)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_image_weights =
+R"doc(Get the accumulated weights image (no copy)
+
+Returns:
+    const xt::xtensor<t_float, Dim>&)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_max =
+R"doc(Center coordinate of the last image cell along axis
+
+Args:
+    axis: 0 = x, 1 = y, 2 = z
+
+Returns:
+    t_float)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_max_cells = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_min =
+R"doc(Center coordinate of the first image cell along axis
+
+Args:
+    axis: 0 = x, 1 = y, 2 = z
+
+Returns:
+    t_float)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_res = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_get_shape = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_grow_to_cells =
+R"doc(Grow the grid (in chunk_size steps) such that it contains the cells lo
+.. hi (global cell indices: cell center = base + index * res)
+
+Args:
+    lo: smallest cell index per axis
+    hi: largest cell index per axis)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_image = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_image_values = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_image_weights = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_res = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_res_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GriddingSession_shape =
+R"doc(< global cell index of the first image cell)doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
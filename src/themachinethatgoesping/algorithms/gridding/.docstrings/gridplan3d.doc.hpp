@@ -0,0 +1,193 @@
+//sourcehash: a7b74efddf36e057518a58c434234188ed6a836461f8837ae8b05892444d4bce
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D =
+R"doc(Precomputed gridding plan for value arrays that share the same xyz
+coordinates (e.g. Sv, TS, angles and masks of the same pings).
+
+The plan computes the grid cells and interpolation weights of each
+point once (block mean: the nearest cell, weighted mean: the up to 8
+surrounding cells within the grid) and stores them in a compact
+structure of arrays layout (per point offsets, linear cell indices,
+weights). Applying the plan to a value array is then a plain scatter
+without any index / weight computations. A 2D stack of value arrays is
+gridded in a single pass over the plan.
+
+The images are identical to ForwardGridder3D::interpolate_block_mean /
+interpolate_weighted_mean with the same coordinates and mp_cores.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_GridPlan3D = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_add_entry = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_apply =
+R"doc(Grid a value array (one value per point)
+
+Args:
+    s_val: values (non-finite values are ignored)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor_3d: 
+    T_vector: 
+
+Returns:
+    std::tuple<t_xtensor_3d, t_xtensor_3d> (image_values,
+        image_weights))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_apply_inplace =
+R"doc(Grid a value array (one value per point) into existing images
+
+Args:
+    s_val: values (non-finite values are ignored)
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint x slabs of the images, see
+              functions::detail::scatter_points)
+
+Template Args:
+    T_vector: 
+    t_xtensor_3d:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_apply_stack =
+R"doc(Grid a stack of value arrays (one row per value array, one column per
+point) in a single pass over the plan
+
+Args:
+    s_vals: 2D array of values (n_arrays x n_points)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor_4d: 
+    t_xtensor_2d: 
+
+Returns:
+    std::tuple<t_xtensor_4d, t_xtensor_4d> (image_values,
+        image_weights) with shape (n_arrays, nx, ny, nz))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_apply_stack_inplace =
+R"doc(Grid a stack of value arrays (one row per value array, one column per
+point) into existing 4D images (value array, x, y, z) in a single pass
+over the plan. Each value array has its own weights, as non-finite
+values are ignored per array.
+
+Args:
+    s_vals: 2D array of values (n_arrays x n_points)
+    image_values: 4D image (n_arrays x nx x ny x nz) with values will
+                  be edited inplace
+    image_weights: 4D image (n_arrays x nx x ny x nz) with weights
+                   will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint x slabs of the images, see
+              functions::detail::scatter_points)
+
+Template Args:
+    t_xtensor_2d: 
+    t_xtensor_4d:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_cells = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_check_image_shape = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_check_number_of_values = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_from_block_mean =
+R"doc(Create a plan for block mean interpolation (each point is added to the
+nearest grid cell)
+
+Args:
+    gridder: ForwardGridder3D that defines the grid
+    sx: x values
+    sy: y values
+    sz: z values
+
+Template Args:
+    T_vector: 
+
+Returns:
+    GridPlan3D)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_from_weighted_mean =
+R"doc(Create a plan for weighted mean interpolation (each point is
+distributed onto the 8 surrounding grid cells using trilinear weights)
+
+Args:
+    gridder: ForwardGridder3D that defines the grid
+    sx: x values
+    sy: y values
+    sz: z values
+
+Template Args:
+    T_vector: 
+
+Returns:
+    GridPlan3D)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_get_gridder = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_get_number_of_entries =
+R"doc(Number of stored (point, cell, weight) entries
+
+Returns:
+    size_t)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_get_number_of_points = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_get_rows =
+R"doc(First and last x index of the cells of point i (the cells of a point
+are ordered with x varying slowest). Used to partition the points for
+parallel scattering.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_number_of_points = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_point_offsets = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_GridPlan3D_weights =
+R"doc(< linear cell index (ix * ny * nz + iy * nz + iz))doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -0,0 +1,182 @@
+//sourcehash: 951ca881a9cd845195cb2bbfc9874ff92eb5decf4a8651c02a18bfc0b11acc65
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D =
+R"doc(Sparse (hash backed) version of ForwardGridder3D for very sparse data
+(e.g. bubble plumes or fish schools that fill only a small fraction of
+the grid). Only cells that received data are stored (open addressing
+hash map on the linear cell index), memory thus scales with the number
+of filled cells instead of nx * ny * nz. The dense images (get_images)
+or the list of filled cells (get_cells) are only created on request.
+
+The values / weights are the same as for ForwardGridder3D (up to
+floating point summation order for mp_cores > 1).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_SparseForwardGridder3D =
+R"doc(Initialize sparse forward gridder
+
+Args:
+    gridder: ForwardGridder3D that defines the grid parameters)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_cells = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_clear =
+R"doc(Remove all accumulated data (and release the memory))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_get_capacity =
+R"doc(Number of allocated hash map slots (memory: capacity * (8 + 2 *
+sizeof(t_float)) bytes)
+
+Returns:
+    size_t)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_get_cells =
+R"doc(Get the filled cells as coordinate lists (sorted by linear cell index,
+i.e. x major)
+
+Returns:
+    std::tuple<xt::xtensor<int, 1>, xt::xtensor<int, 1>,
+        xt::xtensor<int, 1>, xt::xtensor<t_float, 1>,
+        xt::xtensor<t_float, 1>> ix, iy, iz, values, weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_get_gridder = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_get_images =
+R"doc(Convert the sparse grid to dense values / weights images. This
+allocates nx * ny * nz cells and is thus only useful for grids that
+fit into memory.
+
+Returns:
+    std::tuple<xt::xtensor<t_float, 3>, xt::xtensor<t_float, 3>>
+        image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_get_number_of_cells =
+R"doc(Number of cells that received data
+
+Returns:
+    size_t)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_interpolate_block_mean_inplace =
+R"doc(Add 3D points to the sparse grid using block mean interpolation (each
+point is added to the nearest grid cell)
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    s_val: amplitudes / volume backscattering coefficients (non-finite
+           values are ignored)
+    mp_cores: Number of cores to use for parallelization (> 1: each
+              thread accumulates into a private hash map that is
+              merged at the end)
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_interpolate_inplace =
+R"doc(Add all points to the hash map. for_each_cell(i, add_to_cell) calls
+add_to_cell(index, value, weight) for each grid cell (index:
+std::array<int, 3>) point i contributes to.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_SparseForwardGridder3D_interpolate_weighted_mean_inplace =
+R"doc(Add 3D points to the sparse grid using weighted mean interpolation
+(each point is distributed onto the 8 surrounding grid cells, weighted
+by the distance to the cell centers)
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    s_val: amplitudes / volume backscattering coefficients (non-finite
+           values are ignored)
+    mp_cores: Number of cores to use for parallelization (> 1: each
+              thread accumulates into a private hash map that is
+              merged at the end)
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap =
+R"doc(Open addressing (linear probing) hash map from linear cell index to
+accumulated value / weight. Keys, values and weights are stored in
+separate arrays. The capacity is a power of two and is doubled when
+the map is half full.
+
+Template Args:
+    t_float: floating point type of the values / weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_add = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_capacity = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_clear = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_empty_key = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_find_slot =
+R"doc(< 64 - log2(capacity))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_for_each =
+R"doc(Call function(key, value, weight) for all cells (in unspecified order))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_keys = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_merge = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_rehash = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_shift = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_size_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_values = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_detail_SparseCellMap_weights = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -0,0 +1,234 @@
+//sourcehash: 24a950c69ba3fb5e1fe8e72d0ffec705719a38f0d736ee739bdfb4aa591eb4c3
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D =
+R"doc(Tiled (out-of-core) version of ForwardGridder3D. The grid is split
+into tiles of tile_nx * tile_ny * tile_nz cells. Only tiles that are
+touched by the interpolated points are allocated. Finished tiles can
+be flushed to a tile directory (one binary file per tile) to keep the
+memory bounded. Flushed tiles are reloaded automatically when they are
+touched again.
+
+A tile file exists while its tile is flushed: it is removed when the
+tile is reloaded and clear removes the files of all flushed tiles. The
+destructor does not remove tile files (copies of the gridder refer to
+the same files), call clear to clean up the tile directory.
+
+The results are identical to ForwardGridder3D (per cell the points are
+added in the same order).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_TiledForwardGridder3D =
+R"doc(Initialize tiled forward gridder
+
+Args:
+    gridder: ForwardGridder3D that defines the grid parameters
+    tile_nx: number of grid cells per tile in x
+    tile_ny: number of grid cells per tile in y
+    tile_nz: number of grid cells per tile in z
+    tile_directory: directory for flushed tiles (empty: flushing is
+                    not possible))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_check_tile_index = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_clear =
+R"doc(Release all loaded tiles and remove the files of all flushed tiles.
+The grid parameters and the tile directory are kept.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_empty_tile = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_flush_all_tiles =
+R"doc(Write all loaded tiles to the tile directory and release their memory)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_flush_tiles =
+R"doc(Write the given tiles to the tile directory and release their memory.
+Tiles that are not loaded are ignored.
+
+Args:
+    tile_indices: tiles to flush)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_flushed_tiles = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_flushed_tile_indices =
+R"doc(Get the indices of the tiles that are flushed to the tile directory
+(and not loaded)
+
+Returns:
+    std::vector<t_tile_index> sorted tile indices)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_gridder = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_images =
+R"doc(Assemble the full (dense) values / weights images from all tiles. This
+allocates nx * ny * nz cells and is thus only useful for grids that
+fit into memory.
+
+Returns:
+    std::tuple<xt::xtensor<t_float, 3>, xt::xtensor<t_float, 3>>
+        image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_loaded_tile_indices =
+R"doc(Get the indices of the tiles that are currently held in memory
+
+Returns:
+    std::vector<t_tile_index> sorted tile indices)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_number_of_tiles_x = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_number_of_tiles_y = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_number_of_tiles_z = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile_directory = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile_file =
+R"doc(Get the path of the file that stores a flushed tile
+
+Args:
+    tile_index: tile index (x, y, z)
+
+Returns:
+    std::string file path)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile_images =
+R"doc(Get the values / weights images of a single tile. Flushed tiles are
+read from the tile directory (without loading them), tiles without
+data return empty (zero) images.
+
+Args:
+    tile_index: tile index (x, y, z)
+
+Returns:
+    std::tuple<xt::xtensor<t_float, 3>, xt::xtensor<t_float, 3>>
+        image_values, image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile_indices =
+R"doc(Get the indices of all tiles that hold data (in memory or flushed)
+
+Returns:
+    std::vector<t_tile_index> sorted tile indices)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile_nx = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile_ny = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile_nz = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_get_tile_shape =
+R"doc(Get the shape of a tile (tiles at the upper grid borders may be
+smaller than tile_nx * tile_ny * tile_nz)
+
+Args:
+    tile_index: tile index (x, y, z)
+
+Returns:
+    std::array<size_t, 3> number of cells of the tile in x, y and z)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_interpolate_block_mean_inplace =
+R"doc(Add 3D points to the tiles using block mean interpolation (each point
+is added to the nearest grid cell). Call get_images or get_tile_images
+to get the values / weights.
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    s_val: amplitudes / volume backscattering coefficients (non-finite
+           values are ignored)
+    mp_cores: Number of cores to use for parallelization (over tiles)
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_interpolate_inplace =
+R"doc(Distribute the points onto the tiles and add them to the tile images.
+for_each_cell(i, add_to_cell) must call add_to_cell(index, value,
+weight) for each grid cell (index: std::array<int, 3>) the point i
+contributes to. The points are processed in blocks of
+max_block_points: for_each_cell is called once per point (in parallel
+over point chunks), the contributions are sorted into the touched
+tiles (stable counting sort, so per cell the points keep their order)
+and the tiles are processed in parallel.
+
+Args:
+    n_points: number of points
+    for_each_cell: callable (size_t i, auto&& add_to_cell)
+    mp_cores: Number of cores to use for parallelization)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_interpolate_weighted_mean_inplace =
+R"doc(Add 3D points to the tiles using weighted mean interpolation (each
+point is distributed onto the 8 surrounding grid cells, weighted by
+the distance to the cell centers). Call get_images or get_tile_images
+to get the values / weights.
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    s_val: amplitudes / volume backscattering coefficients (non-finite
+           values are ignored)
+    mp_cores: Number of cores to use for parallelization (over tiles)
+
+Template Args:
+    T_vector:)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_read_tile = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_tile_directory = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_tile_nx = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_tile_ny = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_tile_nz = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_tiles = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_TiledForwardGridder3D_write_tile = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -0,0 +1,514 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/backwardgridder.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/tools/classhelper/objectprinter.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "forwardgridder2d.hpp"
+#include "forwardgridder3d.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+
+/**
+ * @brief Backward mapping (gather) counterpart of ForwardGridder2D / ForwardGridder3D.
+ *
+ * Instead of scattering the points into the grid cells, each grid cell looks up the nearest
+ * input point (within max_distance). The lookup uses a spatial index (the points bucketed into
+ * the grid cells, sorted by cell) that is built once in the constructor. The result is a table
+ * of nearest point indices (one per grid cell), so gridding a value array that shares the same
+ * geometry (e.g. several frequencies / beams / time steps of the same echogram slice) is a
+ * plain gather: no atomics / per thread images, trivially parallel and no holes within
+ * max_distance of the data.
+ *
+ * Only nearest neighbor lookup is implemented: each cell takes the value of its nearest point,
+ * values are not interpolated between bracketing points (use the weighted mean / block mean of
+ * ForwardGridder2D / ForwardGridder3D for that).
+ *
+ * The search for a cell visits the buckets in rings of increasing distance until the nearest
+ * point is found. The rings are limited by max_distance and by the bounding box of the occupied
+ * buckets, so the cost of an empty cell is at most O(min(max_distance / res, box extent)^Dim).
+ *
+ * The grid (coordinates, shape) is the same as the one of the ForwardGridder that is passed to
+ * the constructor, the images can thus be combined with forward gridded images.
+ *
+ * @tparam t_float floating point type of the coordinates / values
+ * @tparam Dim number of dimensions (2 or 3)
+ */
+template<std::floating_point t_float, size_t Dim>
+class BackwardGridder
+{
+    static_assert(Dim == 2 || Dim == 3, "BackwardGridder: Dim must be 2 or 3");
+
+  public:
+    using t_gridder =
+        std::conditional_t<Dim == 2, ForwardGridder2D<t_float>, ForwardGridder3D<t_float>>;
+    using t_image       = xt::xtensor<t_float, Dim>;
+    using t_index_image = xt::xtensor<int64_t, Dim>;
+
+    /**
+     * @brief Build the nearest point table for 2D points
+     *
+     * @tparam T_vector
+     * @param gridder ForwardGridder2D that defines the grid
+     * @param sx x values of the points
+     * @param sy y values of the points
+     * @param max_distance maximum distance between a grid cell center and its nearest point.
+     * Cells without a point within max_distance stay empty (NaN).
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename T_vector>
+    BackwardGridder(t_gridder       gridder,
+                    const T_vector& sx,
+                    const T_vector& sy,
+                    const t_float   max_distance,
+                    const int       mp_cores = 1)
+        requires(Dim == 2)
+        : _gridder(std::move(gridder))
+        , _max_distance(max_distance)
+    {
+        _build(std::array{ &sx, &sy }, mp_cores);
+    }
+
+    /**
+     * @brief Build the nearest point table for 3D points
+     *
+     * @tparam T_vector
+     * @param gridder ForwardGridder3D that defines the grid
+     * @param sx x values of the points
+     * @param sy y values of the points
+     * @param sz z values of the points
+     * @param max_distance maximum distance between a grid cell center and its nearest point.
+     * Cells without a point within max_distance stay empty (NaN).
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename T_vector>
+    BackwardGridder(t_gridder       gridder,
+                    const T_vector& sx,
+                    const T_vector& sy,
+                    const T_vector& sz,
+                    const t_float   max_distance,
+                    const int       mp_cores = 1)
+        requires(Dim == 3)
+        : _gridder(std::move(gridder))
+        , _max_distance(max_distance)
+    {
+        _build(std::array{ &sx, &sy, &sz }, mp_cores);
+    }
+
+    // ----- interpolation -----
+    /**
+     * @brief Grid a value array (one value per point) using nearest neighbor lookup
+     *
+     * @tparam T_vector
+     * @param s_val values (same order / size as the points passed to the constructor)
+     * @param mp_cores Number of cores to use for parallelization
+     * @return image with the value of the nearest point per grid cell (NaN if there is no point
+     * within max_distance)
+     */
+    template<typename T_vector>
+    t_image interpolate_nearest(const T_vector& s_val, const int mp_cores = 1) const
+    {
+        auto image = t_image::from_shape(_nearest_point_indices.shape());
+        interpolate_nearest_inplace(s_val, image, mp_cores);
+        return image;
+    }
+
+    /**
+     * @brief Grid a value array (one value per point) using nearest neighbor lookup into an
+     * existing image. All cells of the image are overwritten.
+     *
+     * @tparam T_vector
+     * @param s_val values (same order / size as the points passed to the constructor)
+     * @param image image with the shape of the grid, will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename T_vector>
+    void interpolate_nearest_inplace(const T_vector& s_val,
+                                     t_image&        image,
+                                     const int       mp_cores = 1) const
+    {
+        if (size_t(s_val.size()) != _number_of_points)
+            throw std::runtime_error(
+                fmt::format("ERROR[BackwardGridder::interpolate_nearest]: Expected {} values "
+                            "(one per point), got {}",
+                            _number_of_points,
+                            s_val.size()));
+
+        for (size_t d = 0; d < Dim; ++d)
+            if (image.shape()[d] != _nearest_point_indices.shape()[d])
+                throw std::runtime_error(
+                    fmt::format("ERROR[BackwardGridder::interpolate_nearest]: Image shape does "
+                                "not match the grid shape in dimension {} ({} != {})",
+                                d,
+                                image.shape()[d],
+                                _nearest_point_indices.shape()[d]));
+
+        const int64_t* nearest = _nearest_point_indices.data();
+        t_float*       values  = image.data();
+
+#pragma omp parallel for num_threads(mp_cores)
+        for (int64_t c = 0; c < int64_t(image.size()); ++c)
+            values[c] = nearest[c] < 0 ? std::numeric_limits<t_float>::quiet_NaN()
+                                       : t_float(s_val[size_t(nearest[c])]);
+    }
+
+    // ----- getters -----
+    /**
+     * @brief Index of the nearest point per grid cell (-1 if there is no point within
+     * max_distance)
+     *
+     * @return const t_index_image&
+     */
+    const t_index_image& get_nearest_point_indices() const { return _nearest_point_indices; }
+
+    /**
+     * @brief Distance between the grid cell center and the nearest point (NaN if there is no
+     * point within max_distance)
+     *
+     * @return const t_image&
+     */
+    const t_image& get_nearest_point_distances() const { return _nearest_point_distances; }
+
+    const t_gridder& get_gridder() const { return _gridder; }
+    t_float          get_max_distance() const { return _max_distance; }
+    size_t           get_number_of_points() const { return _number_of_points; }
+
+    /**
+     * @brief Number of grid cells that have a point within max_distance
+     *
+     * @return size_t
+     */
+    size_t get_number_of_filled_cells() const
+    {
+        return size_t(std::count_if(_nearest_point_indices.begin(),
+                                    _nearest_point_indices.end(),
+                                    [](int64_t index) { return index >= 0; }));
+    }
+
+    // ----- objectprinter -----
+    tools::classhelper::ObjectPrinter __printer__(unsigned int float_precision,
+                                                  bool         superscript_exponents) const
+    {
+        tools::classhelper::ObjectPrinter printer(
+            fmt::format("BackwardGridder{}D", Dim), float_precision, superscript_exponents);
+
+        printer.register_section("nearest point table");
+        printer.register_value("max_distance", _max_distance);
+        printer.register_value("number_of_points", _number_of_points);
+        printer.register_value("number_of_filled_cells", get_number_of_filled_cells());
+
+        printer.register_section("grid");
+        printer.append(_gridder.__printer__(float_precision, superscript_exponents));
+
+        return printer;
+    }
+
+    // ----- class helper macros -----
+    __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
+
+  private:
+    t_gridder     _gridder;
+    t_float       _max_distance;
+    size_t        _number_of_points = 0;
+    t_index_image _nearest_point_indices;
+    t_image       _nearest_point_distances;
+
+    std::array<t_float, Dim> _get_grid_min() const
+    {
+        if constexpr (Dim == 2)
+            return { _gridder.get_xmin(), _gridder.get_ymin() };
+        else
+            return { _gridder.get_xmin(), _gridder.get_ymin(), _gridder.get_zmin() };
+    }
+
+    std::array<t_float, Dim> _get_grid_res() const
+    {
+        if constexpr (Dim == 2)
+            return { _gridder.get_xres(), _gridder.get_yres() };
+        else
+            return { _gridder.get_xres(), _gridder.get_yres(), _gridder.get_zres() };
+    }
+
+    std::array<int64_t, Dim> _get_grid_shape() const
+    {
+        if constexpr (Dim == 2)
+            return { _gridder.get_nx(), _gridder.get_ny() };
+        else
+            return { _gridder.get_nx(), _gridder.get_ny(), _gridder.get_nz() };
+    }
+
+    /**
+     * @brief Build the spatial index (points bucketed into the grid cells, sorted by cell) and
+     * use it to find the nearest point of each grid cell. The spatial index is not kept, only
+     * the resulting nearest point table. The ring search of each cell starts at the first ring
+     * that touches the bounding box of the occupied buckets and stops at the last one.
+     */
+    template<typename T_vector>
+    void _build(const std::array<const T_vector*, Dim>& points, const int mp_cores)
+    {
+        if (!(_max_distance > 0))
+            throw std::runtime_error(fmt::format(
+                "ERROR[BackwardGridder]: max_distance must be > 0 (is {})", _max_distance));
+
+        _number_of_points = points[0]->size();
+        for (size_t d = 1; d < Dim; ++d)
+            if (size_t(points[d]->size()) != _number_of_points)
+                throw std::runtime_error(
+                    fmt::format("ERROR[BackwardGridder]: Expected equal array lengths ({} != {})",
+                                points[d]->size(),
+                                _number_of_points));
+
+        const auto grid_min   = _get_grid_min();
+        const auto grid_res   = _get_grid_res();
+        const auto grid_shape = _get_grid_shape();
+
+        std::array<size_t, Dim>  shape;
+        std::array<int64_t, Dim> stride, radius;
+        int64_t                  n_cells = 1;
+        for (int d = int(Dim) - 1; d >= 0; --d)
+        {
+            shape[d]  = size_t(grid_shape[d]);
+            stride[d] = n_cells;
+            n_cells *= grid_shape[d];
+
+            // bucket offsets beyond radius can not contain a point within max_distance
+            radius[d] = std::min<int64_t>(
+                grid_shape[d],
+                std::isfinite(_max_distance)
+                    ? int64_t(std::ceil(_max_distance / grid_res[d]))
+                    : grid_shape[d]);
+        }
+        const t_float min_res = *std::min_element(grid_res.begin(), grid_res.end());
+        const int64_t max_ring = *std::max_element(radius.begin(), radius.end());
+
+        // --- spatial index: counting sort of the points by grid cell ---
+        // points outside of the grid are assigned to the closest border cell (this only
+        // underestimates their bucket distance, so the ring search below stays exact)
+        std::vector<int64_t> point_cells(_number_of_points, -1);
+        std::vector<size_t>  cell_offsets(size_t(n_cells) + 1, 0);
+
+        // bounding box of the occupied buckets (empty if occupied_lo > occupied_hi)
+        std::array<int64_t, Dim> occupied_lo, occupied_hi, indices;
+        occupied_lo.fill(std::numeric_limits<int64_t>::max());
+        occupied_hi.fill(-1);
+
+        for (size_t i = 0; i < _number_of_points; ++i)
+        {
+            int64_t cell = 0;
+            bool    skip = false;
+            for (size_t d = 0; d < Dim && !skip; ++d)
+            {
+                const t_float v = t_float((*points[d])[i]);
+                if (!std::isfinite(v))
+                {
+                    skip = true;
+                    break;
+                }
+
+                const int64_t index = std::clamp<int64_t>(
+                    std::llround((v - grid_min[d]) / grid_res[d]), 0, grid_shape[d] - 1);
+
+                // farther than max_distance from all grid cells
+                if (std::abs(v - (grid_min[d] + t_float(index) * grid_res[d])) > _max_distance)
+                    skip = true;
+
+                indices[d] = index;
+                cell += index * stride[d];
+            }
+            if (skip)
+                continue;
+
+            for (size_t d = 0; d < Dim; ++d)
+            {
+                occupied_lo[d] = std::min(occupied_lo[d], indices[d]);
+                occupied_hi[d] = std::max(occupied_hi[d], indices[d]);
+            }
+            point_cells[i] = cell;
+            ++cell_offsets[size_t(cell) + 1];
+        }
+
+        for (size_t c = 0; c < size_t(n_cells); ++c)
+            cell_offsets[c + 1] += cell_offsets[c];
+
+        // sorted point indices and coordinates (SoA), stable: ascending index within a cell
+        std::vector<size_t>                   sorted_indices(cell_offsets.back());
+        std::array<std::vector<t_float>, Dim> sorted_coordinates;
+        for (auto& coordinates : sorted_coordinates)
+            coordinates.resize(cell_offsets.back());
+        {
+            std::vector<size_t> cursor(cell_offsets.begin(), cell_offsets.end() - 1);
+            for (size_t i = 0; i < _number_of_points; ++i)
+            {
+                if (point_cells[i] < 0)
+                    continue;
+
+                const size_t pos    = cursor[size_t(point_cells[i])]++;
+                sorted_indices[pos] = i;
+                for (size_t d = 0; d < Dim; ++d)
+                    sorted_coordinates[d][pos] = t_float((*points[d])[i]);
+            }
+        }
+
+        // --- nearest point per grid cell (gather, one cell per iteration) ---
+        _nearest_point_indices   = t_index_image::from_shape(shape);
+        _nearest_point_distances = t_image::from_shape(shape);
+
+        int64_t* nearest_indices   = _nearest_point_indices.data();
+        t_float* nearest_distances = _nearest_point_distances.data();
+
+        const t_float max_distance_2 = _max_distance * _max_distance;
+
+#pragma omp parallel for num_threads(mp_cores) schedule(dynamic, 256)
+        for (int64_t c = 0; c < n_cells; ++c)
+        {
+            std::array<int64_t, Dim> cell_index;
+            std::array<t_float, Dim> center;
+
+            // rings closer than first_ring do not touch the occupied buckets, rings farther
+            // than last_ring are beyond all of them
+            int64_t first_ring = 0, last_ring = cell_offsets.back() > 0 ? 0 : -1;
+            for (size_t d = 0; d < Dim; ++d)
+            {
+                cell_index[d] = (c / stride[d]) % grid_shape[d];
+                center[d]     = grid_min[d] + t_float(cell_index[d]) * grid_res[d];
+
+                first_ring = std::max({ first_ring,
+                                        occupied_lo[d] - cell_index[d],
+                                        cell_index[d] - occupied_hi[d] });
+                last_ring  = std::max({ last_ring,
+                                        cell_index[d] - occupied_lo[d],
+                                        occupied_hi[d] - cell_index[d] });
+            }
+            last_ring = std::min(last_ring, max_ring);
+
+            t_float best_distance_2 = std::numeric_limits<t_float>::infinity();
+            int64_t best_index      = -1;
+
+            auto search_bucket = [&](int64_t bucket) {
+                for (size_t pos = cell_offsets[size_t(bucket)];
+                     pos < cell_offsets[size_t(bucket) + 1];
+                     ++pos)
+                {
+                    t_float distance_2 = 0;
+                    for (size_t d = 0; d < Dim; ++d)
+                    {
+                        const t_float delta = sorted_coordinates[d][pos] - center[d];
+                        distance_2 += delta * delta;
+                    }
+
+                    // ties: smallest point index (independent of the bucket order)
+                    if (distance_2 < best_distance_2 ||
+                        (distance_2 == best_distance_2 &&
+                         int64_t(sorted_indices[pos]) < best_index))
+                    {
+                        best_distance_2 = distance_2;
+                        best_index      = int64_t(sorted_indices[pos]);
+                    }
+                }
+            };
+
+            // search rings of buckets with increasing chebyshev distance. Points in ring k are
+            // at least (k - 0.5) * min_res away from the cell center.
+            for (int64_t ring = first_ring; ring <= last_ring; ++ring)
+            {
+                const t_float ring_distance = (t_float(ring) - t_float(0.5)) * min_res;
+                if (ring > 0 && ring_distance * ring_distance > best_distance_2)
+                    break;
+                if (ring > 0 && ring_distance > _max_distance)
+                    break;
+
+                std::array<int64_t, Dim> lo, hi;
+                for (size_t d = 0; d < Dim; ++d)
+                {
+                    const int64_t r = std::min(ring, radius[d]);
+                    lo[d]           = std::max(cell_index[d] - r, occupied_lo[d]);
+                    hi[d]           = std::min(cell_index[d] + r, occupied_hi[d]);
+                }
+
+                // calls function(b) for all bucket indices b in [lo, hi] of axis d that are
+                // ring buckets away from the cell (if full: for all b in [lo, hi])
+                auto for_each_index = [&](size_t d, bool full, const auto& function) {
+                    if (full)
+                    {
+                        for (int64_t b = lo[d]; b <= hi[d]; ++b)
+                            function(b);
+                        return;
+                    }
+                    if (cell_index[d] - ring >= lo[d])
+                        function(cell_index[d] - ring);
+                    if (ring > 0 && cell_index[d] + ring <= hi[d])
+                        function(cell_index[d] + ring);
+                };
+
+                // only visit the buckets on the ring (at least one axis at distance ring)
+                for (int64_t b0 = lo[0]; b0 <= hi[0]; ++b0)
+                {
+                    const bool on_ring_0 = std::abs(b0 - cell_index[0]) == ring;
+
+                    if constexpr (Dim == 2)
+                    {
+                        for_each_index(1, on_ring_0, [&](int64_t b1) {
+                            search_bucket(b0 * stride[0] + b1);
+                        });
+                    }
+                    else
+                    {
+                        for (int64_t b1 = lo[1]; b1 <= hi[1]; ++b1)
+                        {
+                            const bool on_ring_01 =
+                                on_ring_0 || std::abs(b1 - cell_index[1]) == ring;
+
+                            for_each_index(2, on_ring_01, [&](int64_t b2) {
+                                search_bucket(b0 * stride[0] + b1 * stride[1] + b2);
+                            });
+                        }
+                    }
+                }
+            }
+
+            if (best_index >= 0 && best_distance_2 <= max_distance_2)
+            {
+                nearest_indices[c]   = best_index;
+                nearest_distances[c] = std::sqrt(best_distance_2);
+            }
+            else
+            {
+                nearest_indices[c]   = -1;
+                nearest_distances[c] = std::numeric_limits<t_float>::quiet_NaN();
+            }
+        }
+    }
+};
+
+template<std::floating_point t_float>
+using BackwardGridder2D = BackwardGridder<t_float, 2>;
+
+template<std::floating_point t_float>
+using BackwardGridder3D = BackwardGridder<t_float, 3>;
+
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
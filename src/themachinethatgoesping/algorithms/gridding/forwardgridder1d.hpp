@@ -8,6 +8,7 @@
 /* generated doc strings */
 #include ".docstrings/forwardgridder1d.doc.hpp"
 
+#include <array>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
@@ -15,6 +16,8 @@
 #include <tuple>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include <xtensor/containers/xtensor.hpp>
 #include <xtensor/views/xview.hpp>
 
@@ -22,6 +25,7 @@
 
 #include <themachinethatgoesping/tools/helper/xtensor.hpp>
 
+#include "functions/blockstatistics.hpp"
 #include "functions/gridfunctions.hpp"
 
 namespace themachinethatgoesping {
@@ -112,6 +116,24 @@ class ForwardGridder1D
         return functions::group_blocks(sx, s_val, _xmin, _xres, _nx);
     }
 
+    /**
+     * @brief Group the values into the grid cells using a counting sort (compressed layout
+     * without per cell allocations). The values of cell ix are
+     * values[cell_offsets[ix]:cell_offsets[ix+1]]
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<t_float, 1>> cell_offsets
+     * (size nx + 1), values
+     */
+    template<typename T_vector>
+    auto group_blocks_csr(const T_vector& sx, const T_vector& s_val, const int mp_cores = 1) const
+    {
+        return functions::group_blocks_csr(sx, s_val, _xmin, _xres, _nx, mp_cores);
+    }
+
     /**
      * @brief Interpolate 1D points onto 1d images using block mean interpolation
      *
@@ -120,17 +142,23 @@ class ForwardGridder1D
      * @param s_val amplitudes / volume backscattering coefficients
      * @param image_values Image with values. If empty a new image will be created.
      * @param image_weights Image with weights. If empty a new image will be created.
+     * @param mp_cores Number of cores to use for parallelization
      * @return std::tuple<xt::xtensor<t_float, 1>, xt::xtensor<t_float, 1>> image_values,
      * image_weights
      */
     template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
-    std::tuple<t_xtensor_1d, t_xtensor_1d> interpolate_block_mean(const T_vector& sx,
-                                                                  const T_vector& s_val) const
+    std::tuple<t_xtensor_1d, t_xtensor_1d> interpolate_block_mean(
+        const T_vector& sx,
+        const T_vector& s_val,
+        const int       mp_cores = 1) const
     {
         auto image_values_weights = get_empty_grd_images<t_xtensor_1d>();
 
-        interpolate_block_mean_inplace(
-            sx, s_val, std::get<0>(image_values_weights), std::get<1>(image_values_weights));
+        interpolate_block_mean_inplace(sx,
+                                       s_val,
+                                       std::get<0>(image_values_weights),
+                                       std::get<1>(image_values_weights),
+                                       mp_cores);
 
         return image_values_weights;
     }
@@ -143,6 +171,7 @@ class ForwardGridder1D
      * @param s_val amplitudes / volume backscattering coefficients
      * @param image_values Image with values will be edited inplace
      * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
      * @return std::tuple<xt::xtensor<t_float, 1>, xt::xtensor<t_float, 1>> image_values,
      * image_weights
      */
@@ -150,7 +179,8 @@ class ForwardGridder1D
     void interpolate_block_mean_inplace(const T_vector& sx,
                                         const T_vector& s_val,
                                         t_xtensor_1d&   image_values,
-                                        t_xtensor_1d&   image_weights) const
+                                        t_xtensor_1d&   image_weights,
+                                        const int       mp_cores = 1) const
     {
         if (static_cast<size_t>(image_values.shape()[0]) != static_cast<size_t>(_nx))
             throw std::runtime_error(
@@ -159,7 +189,8 @@ class ForwardGridder1D
             throw std::runtime_error(
                 "ERROR: image_weight dimensions do not fit ForwardGridder1D dimensions!");
 
-        functions::grd_block_mean(sx, s_val, _xmin, _xres, _nx, image_values, image_weights);
+        functions::grd_block_mean(
+            sx, s_val, _xmin, _xres, _nx, image_values, image_weights, mp_cores);
     }
 
     /**
@@ -168,17 +199,23 @@ class ForwardGridder1D
      * @tparam T_vector
      * @param sx x values
      * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
      * @return std::tuple<xt::xtensor<t_float, 1>, xt::xtensor<t_float, 1>> image_values,
      * image_weights
      */
     template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
-    std::tuple<t_xtensor_1d, t_xtensor_1d> interpolate_weighted_mean(const T_vector& sx,
-                                                                     const T_vector& s_val) const
+    std::tuple<t_xtensor_1d, t_xtensor_1d> interpolate_weighted_mean(
+        const T_vector& sx,
+        const T_vector& s_val,
+        const int       mp_cores = 1) const
     {
         auto image_values_weights = get_empty_grd_images<t_xtensor_1d>();
 
-        interpolate_weighted_mean_inplace(
-            sx, s_val, std::get<0>(image_values_weights), std::get<1>(image_values_weights));
+        interpolate_weighted_mean_inplace(sx,
+                                          s_val,
+                                          std::get<0>(image_values_weights),
+                                          std::get<1>(image_values_weights),
+                                          mp_cores);
 
         return image_values_weights;
     }
@@ -191,6 +228,7 @@ class ForwardGridder1D
      * @param s_val amplitudes / volume backscattering coefficients
      * @param image_values Image with values. If empty a new image will be created.
      * @param image_weights Image with weights. If empty a new image will be created.
+     * @param mp_cores Number of cores to use for parallelization
      * @return std::tuple<xt::xtensor<t_float, 1>, xt::xtensor<t_float, 1>> image_values,
      * image_weights
      */
@@ -198,7 +236,8 @@ class ForwardGridder1D
     void interpolate_weighted_mean_inplace(const T_vector& sx,
                                            const T_vector& s_val,
                                            t_xtensor_1d&   image_values,
-                                           t_xtensor_1d&   image_weights) const
+                                           t_xtensor_1d&   image_weights,
+                                           const int       mp_cores = 1) const
     {
         if (static_cast<size_t>(image_values.shape()[0]) != static_cast<size_t>(_nx))
             throw std::runtime_error(
@@ -207,7 +246,249 @@ class ForwardGridder1D
             throw std::runtime_error(
                 "ERROR: image_weight dimensions do not fit ForwardGridder1D dimensions!");
 
-        functions::grd_weighted_mean(sx, s_val, _xmin, _xres, _nx, image_values, image_weights);
+        functions::grd_weighted_mean(
+            sx, s_val, _xmin, _xres, _nx, image_values, image_weights, mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 1D points onto a 1d image using the block minimum
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return t_xtensor_1d image_min (NaN for empty cells)
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
+    t_xtensor_1d interpolate_block_min(const T_vector& sx,
+                                       const T_vector& s_val,
+                                       const int       mp_cores = 1) const
+    {
+        t_xtensor_1d image_min = xt::empty<t_float>({ static_cast<size_t>(_nx) });
+        image_min.fill(std::numeric_limits<t_float>::quiet_NaN());
+
+        interpolate_block_min_inplace(sx, s_val, image_min, mp_cores);
+
+        return image_min;
+    }
+
+    /**
+     * @brief Interpolate 1D points onto a 1d image using the block minimum (inplace version).
+     * The minimum of the new values is folded into image_min, NaN cells are treated as empty.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_min Image with minimum values will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
+    void interpolate_block_min_inplace(const T_vector& sx,
+                                       const T_vector& s_val,
+                                       t_xtensor_1d&   image_min,
+                                       const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_min, "image_min");
+
+        _grd_block_fold(sx, s_val, image_min, functions::detail::FoldMin(), mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 1D points onto a 1d image using the block maximum
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return t_xtensor_1d image_max (NaN for empty cells)
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
+    t_xtensor_1d interpolate_block_max(const T_vector& sx,
+                                       const T_vector& s_val,
+                                       const int       mp_cores = 1) const
+    {
+        t_xtensor_1d image_max = xt::empty<t_float>({ static_cast<size_t>(_nx) });
+        image_max.fill(std::numeric_limits<t_float>::quiet_NaN());
+
+        interpolate_block_max_inplace(sx, s_val, image_max, mp_cores);
+
+        return image_max;
+    }
+
+    /**
+     * @brief Interpolate 1D points onto a 1d image using the block maximum (inplace version).
+     * The maximum of the new values is folded into image_max, NaN cells are treated as empty.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_max Image with maximum values will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
+    void interpolate_block_max_inplace(const T_vector& sx,
+                                       const T_vector& s_val,
+                                       t_xtensor_1d&   image_max,
+                                       const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_max, "image_max");
+
+        _grd_block_fold(sx, s_val, image_max, functions::detail::FoldMax(), mp_cores);
+    }
+
+    /**
+     * @brief Count the number of 1D points per 1d image cell
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return t_xtensor_1d image_count
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
+    t_xtensor_1d interpolate_block_count(const T_vector& sx,
+                                         const T_vector& s_val,
+                                         const int       mp_cores = 1) const
+    {
+        t_xtensor_1d image_count = xt::zeros<t_float>({ static_cast<size_t>(_nx) });
+
+        interpolate_block_count_inplace(sx, s_val, image_count, mp_cores);
+
+        return image_count;
+    }
+
+    /**
+     * @brief Count the number of 1D points per 1d image cell (inplace version)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_count Image with the number of values per cell will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
+    void interpolate_block_count_inplace(const T_vector& sx,
+                                         const T_vector& s_val,
+                                         t_xtensor_1d&   image_count,
+                                         const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_count, "image_count");
+
+        _grd_block_fold(sx, s_val, image_count, functions::detail::FoldCount(), mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 1D points onto 1d images using a running (Welford) block mean /
+     * variance. The (population) variance is image_m2 / image_count.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<t_xtensor_1d, t_xtensor_1d, t_xtensor_1d> image_count, image_mean,
+     * image_m2
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
+    std::tuple<t_xtensor_1d, t_xtensor_1d, t_xtensor_1d> interpolate_block_variance(
+        const T_vector& sx,
+        const T_vector& s_val,
+        const int       mp_cores = 1) const
+    {
+        t_xtensor_1d image_count = xt::zeros<t_float>({ static_cast<size_t>(_nx) });
+        t_xtensor_1d image_mean = xt::zeros_like(image_count);
+        t_xtensor_1d image_m2   = xt::zeros_like(image_count);
+
+        interpolate_block_variance_inplace(sx, s_val, image_count, image_mean, image_m2, mp_cores);
+
+        return std::make_tuple(image_count, image_mean, image_m2);
+    }
+
+    /**
+     * @brief Interpolate 1D points onto 1d images using a running (Welford) block mean /
+     * variance (inplace version). The (population) variance is image_m2 / image_count.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_count Image with the number of values per cell will be edited inplace
+     * @param image_mean Image with the running mean will be edited inplace
+     * @param image_m2 Image with the running sum of squared differences from the mean will be
+     * edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_1d, typename T_vector>
+    void interpolate_block_variance_inplace(const T_vector& sx,
+                                            const T_vector& s_val,
+                                            t_xtensor_1d&   image_count,
+                                            t_xtensor_1d&   image_mean,
+                                            t_xtensor_1d&   image_m2,
+                                            const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_count, "image_count");
+        _check_image_dimensions(image_mean, "image_mean");
+        _check_image_dimensions(image_m2, "image_m2");
+
+        auto [cell_offsets, values] = group_blocks_csr(sx, s_val, mp_cores);
+        functions::grd_block_variance(
+            cell_offsets, values, image_count, image_mean, image_m2, mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 1D points onto per cell histograms (sketches) with n_bins equally
+     * spaced bins between hist_min and hist_max. Values outside this range are counted in the
+     * first / last bin. Use functions::histogram_quantile to compute approximate block medians /
+     * quantiles from the histograms.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param hist_min lower border of the first histogram bin
+     * @param hist_max upper border of the last histogram bin
+     * @param n_bins number of histogram bins
+     * @param mp_cores Number of cores to use for parallelization
+     * @return t_xtensor_2d image_histogram (last axis: bins)
+     */
+    template<tools::helper::c_xtensor t_xtensor_2d, typename T_vector>
+    t_xtensor_2d interpolate_block_histogram(const T_vector& sx,
+                                             const T_vector& s_val,
+                                             const t_float   hist_min,
+                                             const t_float   hist_max,
+                                             const size_t    n_bins,
+                                             const int       mp_cores = 1) const
+    {
+        t_xtensor_2d image_histogram = xt::zeros<t_float>({ static_cast<size_t>(_nx), n_bins });
+
+        interpolate_block_histogram_inplace(
+            sx, s_val, hist_min, hist_max, image_histogram, mp_cores);
+
+        return image_histogram;
+    }
+
+    /**
+     * @brief Interpolate 1D points onto per cell histograms (inplace version). The number of
+     * bins is given by the last axis of image_histogram.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param hist_min lower border of the first histogram bin
+     * @param hist_max upper border of the last histogram bin
+     * @param image_histogram Image with histogram counts (last axis: bins) will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor t_xtensor_2d, typename T_vector>
+    void interpolate_block_histogram_inplace(const T_vector& sx,
+                                             const T_vector& s_val,
+                                             const t_float   hist_min,
+                                             const t_float   hist_max,
+                                             t_xtensor_2d&   image_histogram,
+                                             const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_histogram, "image_histogram");
+
+        auto [cell_offsets, values] = group_blocks_csr(sx, s_val, mp_cores);
+        functions::grd_block_histogram(
+            cell_offsets, values, hist_min, hist_max, image_histogram, mp_cores);
     }
 
     /**
@@ -336,6 +617,43 @@ class ForwardGridder1D
     {
         return std::make_tuple(_xmin, _xres, _nx);
     }
+
+    /**
+     * @brief Throw if the first dimension of image does not fit the grid dimensions
+     *
+     * @param image image to check
+     * @param image_name name of the image (used in the error message)
+     */
+    template<typename t_xtensor>
+    void _check_image_dimensions(const t_xtensor& image, const std::string& image_name) const
+    {
+        if (static_cast<size_t>(image.shape()[0]) != static_cast<size_t>(_nx))
+            throw std::runtime_error(fmt::format(
+                "ERROR: {} dimensions do not fit ForwardGridder1D dimensions!", image_name));
+    }
+
+    /**
+     * @brief Fold the points into their nearest cell of image (block min / max / count, see
+     * functions::detail::grd_block_fold_nd)
+     */
+    template<typename T_vector, typename t_xtensor, typename t_fold>
+    void _grd_block_fold(const T_vector& sx,
+                         const T_vector& s_val,
+                         t_xtensor&      image,
+                         const t_fold&   fold,
+                         const int       mp_cores) const
+    {
+        functions::detail::grd_block_fold_nd<1>(
+            s_val.size(),
+            [&](size_t i) { return std::array{ sx[i] }; },
+            [&](size_t i) { return s_val[i]; },
+            std::array<t_float, 1>{ _xmin },
+            std::array<t_float, 1>{ _xres },
+            std::array<int, 1>{ _nx },
+            image,
+            fold,
+            mp_cores);
+    }
 };
 
 } // namespace gridding
@@ -8,13 +8,18 @@
 /* generated doc strings */
 #include ".docstrings/forwardgridder2d.doc.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include <xtensor/containers/xtensor.hpp>
 #include <xtensor/views/xview.hpp>
 
@@ -22,7 +27,9 @@
 
 #include <themachinethatgoesping/tools/helper/xtensor.hpp>
 
+#include "functions/blockstatistics.hpp"
 #include "functions/gridfunctions.hpp"
+#include "functions/pyramidfunctions.hpp"
 
 namespace themachinethatgoesping {
 namespace algorithms {
@@ -73,6 +80,50 @@ class ForwardGridder2D
         return ForwardGridder2D(res, res, min_x, max_x, min_y, max_y);
     }
 
+    /**
+     * @brief Create gridder from the center of the first grid cell and the number of cells per
+     * axis. Unlike the constructor, the number of cells is not derived from (max - min) / res
+     * and is thus not affected by rounding.
+     *
+     * @param xres x resolution of the grid
+     * @param yres y resolution of the grid
+     * @param xmin x center of the first grid cell (should be aligned to xbase + k * xres)
+     * @param nx number of grid cells in x
+     * @param ymin y center of the first grid cell (should be aligned to ybase + k * yres)
+     * @param ny number of grid cells in y
+     * @param xbase x base position of the grid, by default 0.0
+     * @param ybase y base position of the grid, by default 0.0
+     * @return ForwardGridder2D object
+     */
+    static ForwardGridder2D from_cells(t_float xres,
+                                       t_float yres,
+                                       t_float xmin,
+                                       int     nx,
+                                       t_float ymin,
+                                       int     ny,
+                                       t_float xbase = 0,
+                                       t_float ybase = 0)
+    {
+        ForwardGridder2D gridder;
+        gridder._xres  = xres;
+        gridder._yres  = yres;
+        gridder._xbase = xbase;
+        gridder._ybase = ybase;
+        gridder._xmin  = xmin;
+        gridder._ymin  = ymin;
+        gridder._xmax  = xmin + t_float(nx - 1) * xres;
+        gridder._ymax  = ymin + t_float(ny - 1) * yres;
+        gridder._nx    = nx;
+        gridder._ny    = ny;
+
+        gridder._border_xmin = gridder._xmin - xres / 2;
+        gridder._border_xmax = gridder._xmax + xres / 2;
+        gridder._border_ymin = gridder._ymin - yres / 2;
+        gridder._border_ymax = gridder._ymax + yres / 2;
+
+        return gridder;
+    }
+
     /**
      * @brief Initialize forward gridder class using grid parameters.
      *
@@ -140,6 +191,29 @@ class ForwardGridder2D
         return functions::group_blocks(sx, sy, s_val, _xmin, _xres, _nx, _ymin, _yres, _ny);
     }
 
+    /**
+     * @brief Group the values into the grid cells using a counting sort (compressed layout
+     * without per cell allocations). The values of cell (ix, iy) are
+     * values[cell_offsets[c]:cell_offsets[c+1]] with c = ix * ny + iy
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<t_float, 1>> cell_offsets
+     * (size nx * ny + 1), values
+     */
+    template<typename T_vector>
+    auto group_blocks_csr(const T_vector& sx,
+                          const T_vector& sy,
+                          const T_vector& s_val,
+                          const int       mp_cores = 1) const
+    {
+        return functions::group_blocks_csr(
+            sx, sy, s_val, _xmin, _xres, _nx, _ymin, _yres, _ny, mp_cores);
+    }
+
     /**
      * @brief Interpolate 2D points onto 2d images using block mean interpolation
      *
@@ -147,18 +221,25 @@ class ForwardGridder2D
      * @param sx x values
      * @param sy y values
      * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
      * @return std::tuple<xt::xtensor<t_float, 2>, xt::xtensor<t_float, 2>> image_values,
      * image_weights
      */
     template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
-    std::tuple<t_xtensor_2d, t_xtensor_2d> interpolate_block_mean(const T_vector& sx,
-                                                                  const T_vector& sy,
-                                                                  const T_vector& s_val) const
+    std::tuple<t_xtensor_2d, t_xtensor_2d> interpolate_block_mean(
+        const T_vector& sx,
+        const T_vector& sy,
+        const T_vector& s_val,
+        const int       mp_cores = 1) const
     {
         auto image_values_weights = get_empty_grd_images<t_xtensor_2d>();
 
-        interpolate_block_mean_inplace(
-            sx, sy, s_val, std::get<0>(image_values_weights), std::get<1>(image_values_weights));
+        interpolate_block_mean_inplace(sx,
+                                       sy,
+                                       s_val,
+                                       std::get<0>(image_values_weights),
+                                       std::get<1>(image_values_weights),
+                                       mp_cores);
 
         return image_values_weights;
     }
@@ -172,13 +253,15 @@ class ForwardGridder2D
      * @param s_val amplitudes / volume backscattering coefficients
      * @param image_values Image with values will be edited inplace
      * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
      */
     template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
     void interpolate_block_mean_inplace(const T_vector& sx,
                                         const T_vector& sy,
                                         const T_vector& s_val,
                                         t_xtensor_2d&   image_values,
-                                        t_xtensor_2d&   image_weights) const
+                                        t_xtensor_2d&   image_weights,
+                                        const int       mp_cores = 1) const
     {
         if (static_cast<size_t>(image_values.shape()[0]) != static_cast<size_t>(_nx) ||
             static_cast<size_t>(image_values.shape()[1]) != static_cast<size_t>(_ny))
@@ -189,8 +272,18 @@ class ForwardGridder2D
             throw std::runtime_error(
                 "ERROR: image_weight dimensions do not fit ForwardGridder2D dimensions!");
 
-        functions::grd_block_mean(
-            sx, sy, s_val, _xmin, _xres, _nx, _ymin, _yres, _ny, image_values, image_weights);
+        functions::grd_block_mean(sx,
+                                  sy,
+                                  s_val,
+                                  _xmin,
+                                  _xres,
+                                  _nx,
+                                  _ymin,
+                                  _yres,
+                                  _ny,
+                                  image_values,
+                                  image_weights,
+                                  mp_cores);
     }
 
     /**
@@ -200,18 +293,25 @@ class ForwardGridder2D
      * @param sx x values
      * @param sy y values
      * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
      * @return std::tuple<xt::xtensor<t_float, 2>, xt::xtensor<t_float, 2>> image_values,
      * image_weights
      */
     template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
-    std::tuple<t_xtensor_2d, t_xtensor_2d> interpolate_weighted_mean(const T_vector& sx,
-                                                                     const T_vector& sy,
-                                                                     const T_vector& s_val) const
+    std::tuple<t_xtensor_2d, t_xtensor_2d> interpolate_weighted_mean(
+        const T_vector& sx,
+        const T_vector& sy,
+        const T_vector& s_val,
+        const int       mp_cores = 1) const
     {
         auto image_values_weights = get_empty_grd_images<t_xtensor_2d>();
 
-        interpolate_weighted_mean_inplace(
-            sx, sy, s_val, std::get<0>(image_values_weights), std::get<1>(image_values_weights));
+        interpolate_weighted_mean_inplace(sx,
+                                          sy,
+                                          s_val,
+                                          std::get<0>(image_values_weights),
+                                          std::get<1>(image_values_weights),
+                                          mp_cores);
 
         return image_values_weights;
     }
@@ -226,13 +326,15 @@ class ForwardGridder2D
      * @param s_val amplitudes / volume backscattering coefficients
      * @param image_values Image with values will be edited inplace
      * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
      */
     template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
     void interpolate_weighted_mean_inplace(const T_vector& sx,
                                            const T_vector& sy,
                                            const T_vector& s_val,
                                            t_xtensor_2d&   image_values,
-                                           t_xtensor_2d&   image_weights) const
+                                           t_xtensor_2d&   image_weights,
+                                           const int       mp_cores = 1) const
     {
         if (static_cast<size_t>(image_values.shape()[0]) != static_cast<size_t>(_nx) ||
             static_cast<size_t>(image_values.shape()[1]) != static_cast<size_t>(_ny))
@@ -243,8 +345,600 @@ class ForwardGridder2D
             throw std::runtime_error(
                 "ERROR: image_weight dimensions do not fit ForwardGridder2D dimensions!");
 
-        functions::grd_weighted_mean(
-            sx, sy, s_val, _xmin, _xres, _nx, _ymin, _yres, _ny, image_values, image_weights);
+        functions::grd_weighted_mean(sx,
+                                     sy,
+                                     s_val,
+                                     _xmin,
+                                     _xres,
+                                     _nx,
+                                     _ymin,
+                                     _yres,
+                                     _ny,
+                                     image_values,
+                                     image_weights,
+                                     mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 2D points with n_channels values each (e.g. several frequencies) onto 3D
+     * images (nx, ny, n_channels) using weighted mean interpolation. The index / weight
+     * computation is shared by all channels (see functions::grd_weighted_mean_multichannel).
+     *
+     * @tparam t_xtensor_3d
+     * @tparam T_vector
+     * @tparam t_xtensor_2d
+     * @param sx x values
+     * @param sy y values
+     * @param s_val 2D array of values (n_points x n_channels)
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<t_xtensor_3d, t_xtensor_3d> image_values, image_weights
+     */
+    template<tools::helper::c_xtensor_3d t_xtensor_3d,
+             typename                    T_vector,
+             tools::helper::c_xtensor_2d t_xtensor_2d>
+    std::tuple<t_xtensor_3d, t_xtensor_3d> interpolate_weighted_mean_multichannel(
+        const T_vector&     sx,
+        const T_vector&     sy,
+        const t_xtensor_2d& s_val,
+        const int           mp_cores = 1) const
+    {
+        const std::array<size_t, 3> shape = { size_t(_nx), size_t(_ny), size_t(s_val.shape()[1]) };
+
+        t_xtensor_3d image_values  = xt::zeros<typename t_xtensor_3d::value_type>(shape);
+        t_xtensor_3d image_weights = xt::zeros<typename t_xtensor_3d::value_type>(shape);
+
+        interpolate_weighted_mean_multichannel_inplace(
+            sx, sy, s_val, image_values, image_weights, mp_cores);
+
+        return std::make_tuple(std::move(image_values), std::move(image_weights));
+    }
+
+    /**
+     * @brief Interpolate 2D points with n_channels values each onto 3D images (nx, ny,
+     * n_channels) using weighted mean interpolation (inplace version)
+     *
+     * @tparam T_vector
+     * @tparam t_xtensor_2d
+     * @tparam t_xtensor_3d
+     * @param sx x values
+     * @param sy y values
+     * @param s_val 2D array of values (n_points x n_channels)
+     * @param image_values Image with values will be edited inplace
+     * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename                    T_vector,
+             tools::helper::c_xtensor_2d t_xtensor_2d,
+             tools::helper::c_xtensor_3d t_xtensor_3d>
+    void interpolate_weighted_mean_multichannel_inplace(const T_vector&     sx,
+                                                        const T_vector&     sy,
+                                                        const t_xtensor_2d& s_val,
+                                                        t_xtensor_3d&       image_values,
+                                                        t_xtensor_3d&       image_weights,
+                                                        const int           mp_cores = 1) const
+    {
+        functions::grd_weighted_mean_multichannel(sx,
+                                                  sy,
+                                                  s_val,
+                                                  _xmin,
+                                                  _xres,
+                                                  _nx,
+                                                  _ymin,
+                                                  _yres,
+                                                  _ny,
+                                                  image_values,
+                                                  image_weights,
+                                                  mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 2D points onto 2d images using gaussian kernel splatting (each point is
+     * distributed onto all cells within radius, weighted by exp(-d² / (2 sigma²)))
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param radius footprint radius (in coordinate units)
+     * @param sigma standard deviation of the gaussian kernel (in coordinate units)
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<xt::xtensor<t_float, 2>, xt::xtensor<t_float, 2>> image_values,
+     * image_weights
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    std::tuple<t_xtensor_2d, t_xtensor_2d> interpolate_gaussian_splat(
+        const T_vector& sx,
+        const T_vector& sy,
+        const T_vector& s_val,
+        const t_float   radius,
+        const t_float   sigma,
+        const int       mp_cores = 1) const
+    {
+        auto image_values_weights = get_empty_grd_images<t_xtensor_2d>();
+
+        interpolate_gaussian_splat_inplace(sx,
+                                           sy,
+                                           s_val,
+                                           radius,
+                                           sigma,
+                                           std::get<0>(image_values_weights),
+                                           std::get<1>(image_values_weights),
+                                           mp_cores);
+
+        return image_values_weights;
+    }
+
+    /**
+     * @brief Interpolate 2D points onto 2d images using gaussian splatting (inplace
+     * version, see interpolate_gaussian_splat)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param radius footprint radius (in coordinate units)
+     * @param sigma standard deviation of the gaussian kernel (in coordinate units)
+     * @param image_values Image with values will be edited inplace
+     * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    void interpolate_gaussian_splat_inplace(const T_vector& sx,
+                                            const T_vector& sy,
+                                            const T_vector& s_val,
+                                            const t_float   radius,
+                                            const t_float   sigma,
+                                            t_xtensor_2d&   image_values,
+                                            t_xtensor_2d&   image_weights,
+                                            const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_values, "image_values");
+        _check_image_dimensions(image_weights, "image_weights");
+
+        functions::grd_gaussian_splat(sx,
+                                      sy,
+                                      s_val,
+                                      _xmin,
+                                      _xres,
+                                      _nx,
+                                      _ymin,
+                                      _yres,
+                                      _ny,
+                                      radius,
+                                      sigma,
+                                      image_values,
+                                      image_weights,
+                                      mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 2D points onto 2d images using inverse distance weighted splatting (each
+     * point is distributed onto all cells within radius, weighted by 1 / d^power)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param radius footprint radius (in coordinate units)
+     * @param power power of the inverse distance weights
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<xt::xtensor<t_float, 2>, xt::xtensor<t_float, 2>> image_values,
+     * image_weights
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    std::tuple<t_xtensor_2d, t_xtensor_2d> interpolate_inverse_distance_splat(
+        const T_vector& sx,
+        const T_vector& sy,
+        const T_vector& s_val,
+        const t_float   radius,
+        const t_float   power = 2,
+        const int       mp_cores = 1) const
+    {
+        auto image_values_weights = get_empty_grd_images<t_xtensor_2d>();
+
+        interpolate_inverse_distance_splat_inplace(sx,
+                                                   sy,
+                                                   s_val,
+                                                   radius,
+                                                   power,
+                                                   std::get<0>(image_values_weights),
+                                                   std::get<1>(image_values_weights),
+                                                   mp_cores);
+
+        return image_values_weights;
+    }
+
+    /**
+     * @brief Interpolate 2D points onto 2d images using inverse distance splatting (inplace
+     * version, see interpolate_inverse_distance_splat)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param radius footprint radius (in coordinate units)
+     * @param power power of the inverse distance weights
+     * @param image_values Image with values will be edited inplace
+     * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    void interpolate_inverse_distance_splat_inplace(const T_vector& sx,
+                                                    const T_vector& sy,
+                                                    const T_vector& s_val,
+                                                    const t_float   radius,
+                                                    const t_float   power,
+                                                    t_xtensor_2d&   image_values,
+                                                    t_xtensor_2d&   image_weights,
+                                                    const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_values, "image_values");
+        _check_image_dimensions(image_weights, "image_weights");
+
+        functions::grd_inverse_distance_splat(sx,
+                                              sy,
+                                              s_val,
+                                              _xmin,
+                                              _xres,
+                                              _nx,
+                                              _ymin,
+                                              _yres,
+                                              _ny,
+                                              radius,
+                                              power,
+                                              image_values,
+                                              image_weights,
+                                              mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 2D points onto a 2d image using the block minimum
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return t_xtensor_2d image_min (NaN for empty cells)
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    t_xtensor_2d interpolate_block_min(const T_vector& sx,
+                                       const T_vector& sy,
+                                       const T_vector& s_val,
+                                       const int       mp_cores = 1) const
+    {
+        t_xtensor_2d image_min = xt::empty<t_float>(
+            { static_cast<size_t>(_nx), static_cast<size_t>(_ny) });
+        image_min.fill(std::numeric_limits<t_float>::quiet_NaN());
+
+        interpolate_block_min_inplace(sx, sy, s_val, image_min, mp_cores);
+
+        return image_min;
+    }
+
+    /**
+     * @brief Interpolate 2D points onto a 2d image using the block minimum (inplace version).
+     * The minimum of the new values is folded into image_min, NaN cells are treated as empty.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_min Image with minimum values will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    void interpolate_block_min_inplace(const T_vector& sx,
+                                       const T_vector& sy,
+                                       const T_vector& s_val,
+                                       t_xtensor_2d&   image_min,
+                                       const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_min, "image_min");
+
+        _grd_block_fold(sx, sy, s_val, image_min, functions::detail::FoldMin(), mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 2D points onto a 2d image using the block maximum
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return t_xtensor_2d image_max (NaN for empty cells)
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    t_xtensor_2d interpolate_block_max(const T_vector& sx,
+                                       const T_vector& sy,
+                                       const T_vector& s_val,
+                                       const int       mp_cores = 1) const
+    {
+        t_xtensor_2d image_max = xt::empty<t_float>(
+            { static_cast<size_t>(_nx), static_cast<size_t>(_ny) });
+        image_max.fill(std::numeric_limits<t_float>::quiet_NaN());
+
+        interpolate_block_max_inplace(sx, sy, s_val, image_max, mp_cores);
+
+        return image_max;
+    }
+
+    /**
+     * @brief Interpolate 2D points onto a 2d image using the block maximum (inplace version).
+     * The maximum of the new values is folded into image_max, NaN cells are treated as empty.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_max Image with maximum values will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    void interpolate_block_max_inplace(const T_vector& sx,
+                                       const T_vector& sy,
+                                       const T_vector& s_val,
+                                       t_xtensor_2d&   image_max,
+                                       const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_max, "image_max");
+
+        _grd_block_fold(sx, sy, s_val, image_max, functions::detail::FoldMax(), mp_cores);
+    }
+
+    /**
+     * @brief Count the number of 2D points per 2d image cell
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return t_xtensor_2d image_count
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    t_xtensor_2d interpolate_block_count(const T_vector& sx,
+                                         const T_vector& sy,
+                                         const T_vector& s_val,
+                                         const int       mp_cores = 1) const
+    {
+        t_xtensor_2d image_count = xt::zeros<t_float>(
+            { static_cast<size_t>(_nx), static_cast<size_t>(_ny) });
+
+        interpolate_block_count_inplace(sx, sy, s_val, image_count, mp_cores);
+
+        return image_count;
+    }
+
+    /**
+     * @brief Count the number of 2D points per 2d image cell (inplace version)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_count Image with the number of values per cell will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    void interpolate_block_count_inplace(const T_vector& sx,
+                                         const T_vector& sy,
+                                         const T_vector& s_val,
+                                         t_xtensor_2d&   image_count,
+                                         const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_count, "image_count");
+
+        _grd_block_fold(sx, sy, s_val, image_count, functions::detail::FoldCount(), mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 2D points onto 2d images using a running (Welford) block mean /
+     * variance. The (population) variance is image_m2 / image_count.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<t_xtensor_2d, t_xtensor_2d, t_xtensor_2d> image_count, image_mean,
+     * image_m2
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    std::tuple<t_xtensor_2d, t_xtensor_2d, t_xtensor_2d> interpolate_block_variance(
+        const T_vector& sx,
+        const T_vector& sy,
+        const T_vector& s_val,
+        const int       mp_cores = 1) const
+    {
+        t_xtensor_2d image_count = xt::zeros<t_float>(
+            { static_cast<size_t>(_nx), static_cast<size_t>(_ny) });
+        t_xtensor_2d image_mean = xt::zeros_like(image_count);
+        t_xtensor_2d image_m2   = xt::zeros_like(image_count);
+
+        interpolate_block_variance_inplace(
+            sx, sy, s_val, image_count, image_mean, image_m2, mp_cores);
+
+        return std::make_tuple(image_count, image_mean, image_m2);
+    }
+
+    /**
+     * @brief Interpolate 2D points onto 2d images using a running (Welford) block mean /
+     * variance (inplace version). The (population) variance is image_m2 / image_count.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_count Image with the number of values per cell will be edited inplace
+     * @param image_mean Image with the running mean will be edited inplace
+     * @param image_m2 Image with the running sum of squared differences from the mean will be
+     * edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename T_vector>
+    void interpolate_block_variance_inplace(const T_vector& sx,
+                                            const T_vector& sy,
+                                            const T_vector& s_val,
+                                            t_xtensor_2d&   image_count,
+                                            t_xtensor_2d&   image_mean,
+                                            t_xtensor_2d&   image_m2,
+                                            const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_count, "image_count");
+        _check_image_dimensions(image_mean, "image_mean");
+        _check_image_dimensions(image_m2, "image_m2");
+
+        auto [cell_offsets, values] = group_blocks_csr(sx, sy, s_val, mp_cores);
+        functions::grd_block_variance(
+            cell_offsets, values, image_count, image_mean, image_m2, mp_cores);
+    }
+
+    /**
+     * @brief Interpolate 2D points onto per cell histograms (sketches) with n_bins equally
+     * spaced bins between hist_min and hist_max. Values outside this range are counted in the
+     * first / last bin. Use functions::histogram_quantile to compute approximate block medians /
+     * quantiles from the histograms.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param hist_min lower border of the first histogram bin
+     * @param hist_max upper border of the last histogram bin
+     * @param n_bins number of histogram bins
+     * @param mp_cores Number of cores to use for parallelization
+     * @return t_xtensor_3d image_histogram (last axis: bins)
+     */
+    template<tools::helper::c_xtensor t_xtensor_3d, typename T_vector>
+    t_xtensor_3d interpolate_block_histogram(const T_vector& sx,
+                                             const T_vector& sy,
+                                             const T_vector& s_val,
+                                             const t_float   hist_min,
+                                             const t_float   hist_max,
+                                             const size_t    n_bins,
+                                             const int       mp_cores = 1) const
+    {
+        t_xtensor_3d image_histogram = xt::zeros<t_float>(
+            { static_cast<size_t>(_nx), static_cast<size_t>(_ny), n_bins });
+
+        interpolate_block_histogram_inplace(
+            sx, sy, s_val, hist_min, hist_max, image_histogram, mp_cores);
+
+        return image_histogram;
+    }
+
+    /**
+     * @brief Interpolate 2D points onto per cell histograms (inplace version). The number of
+     * bins is given by the last axis of image_histogram.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param hist_min lower border of the first histogram bin
+     * @param hist_max upper border of the last histogram bin
+     * @param image_histogram Image with histogram counts (last axis: bins) will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor t_xtensor_3d, typename T_vector>
+    void interpolate_block_histogram_inplace(const T_vector& sx,
+                                             const T_vector& sy,
+                                             const T_vector& s_val,
+                                             const t_float   hist_min,
+                                             const t_float   hist_max,
+                                             t_xtensor_3d&   image_histogram,
+                                             const int       mp_cores = 1) const
+    {
+        _check_image_dimensions(image_histogram, "image_histogram");
+
+        auto [cell_offsets, values] = group_blocks_csr(sx, sy, s_val, mp_cores);
+        functions::grd_block_histogram(
+            cell_offsets, values, hist_min, hist_max, image_histogram, mp_cores);
+    }
+
+    /**
+     * @brief Get the gridder of a coarser pyramid level (see compute_pyramid). The cells of level l
+     * are blocks of 2^l cells per axis of this grid, starting at the first cell. The block borders
+     * coincide with the cell borders of this grid, so the coordinates of all levels line up.
+     *
+     * @param level pyramid level (0 returns a copy of this gridder)
+     * @return ForwardGridder2D
+     */
+    ForwardGridder2D get_pyramid_gridder(int level) const
+    {
+        if (level < 0 || level > 30)
+            throw std::runtime_error(fmt::format(
+                "ERROR[ForwardGridder2D::get_pyramid_gridder]: level must be in [0, 30] (got {})",
+                level));
+        if (level == 0)
+            return *this;
+
+        const t_float factor = static_cast<t_float>(int64_t(1) << level);
+
+        ForwardGridder2D gridder = *this;
+
+        gridder._xres        = _xres * factor;
+        gridder._xmin        = _xmin + _xres * (factor - 1) / 2;
+        gridder._xbase       = gridder._xmin;
+        gridder._nx          = int((int64_t(_nx) + int64_t(factor) - 1) / int64_t(factor));
+        gridder._xmax        = gridder._xmin + gridder._xres * (gridder._nx - 1);
+        gridder._border_xmin = gridder._xmin - gridder._xres / 2;
+        gridder._border_xmax = gridder._xmax + gridder._xres / 2;
+
+        gridder._yres        = _yres * factor;
+        gridder._ymin        = _ymin + _yres * (factor - 1) / 2;
+        gridder._ybase       = gridder._ymin;
+        gridder._ny          = int((int64_t(_ny) + int64_t(factor) - 1) / int64_t(factor));
+        gridder._ymax        = gridder._ymin + gridder._yres * (gridder._ny - 1);
+        gridder._border_ymin = gridder._ymin - gridder._yres / 2;
+        gridder._border_ymax = gridder._ymax + gridder._yres / 2;
+
+        return gridder;
+    }
+
+    /**
+     * @brief Compute a multi resolution (mip style) pyramid from accumulated images (e.g. from
+     * interpolate_weighted_mean_inplace). Each level is computed from the previous level by summing
+     * blocks of 2x2 cells of the raw accumulators (functions::downsample_accumulators), such that
+     * image_values / image_weights of each level is the exact mean of all values within a block.
+     *
+     * @tparam t_xtensor_2d
+     * @param image_values accumulated values of this grid
+     * @param image_weights accumulated weights of this grid
+     * @param n_levels number of coarser levels to compute (level 1 to n_levels)
+     * @param mp_cores Number of cores to use for parallelization (over output tiles)
+     * @return std::vector<std::tuple<ForwardGridder2D, t_xtensor_2d, t_xtensor_2d>>
+     * (gridder, image_values, image_weights) of the levels 1 to n_levels
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d>
+    std::vector<std::tuple<ForwardGridder2D, t_xtensor_2d, t_xtensor_2d>> compute_pyramid(
+        const t_xtensor_2d& image_values,
+        const t_xtensor_2d& image_weights,
+        const int           n_levels,
+        const int           mp_cores = 1) const
+    {
+        _check_image_dimensions(image_values, "image_values");
+        _check_image_dimensions(image_weights, "image_weights");
+
+        std::vector<std::tuple<ForwardGridder2D, t_xtensor_2d, t_xtensor_2d>> levels;
+        levels.reserve(std::max(n_levels, 0));
+
+        for (int level = 1; level <= n_levels; ++level)
+        {
+            const t_xtensor_2d& previous_values =
+                levels.empty() ? image_values : std::get<1>(levels.back());
+            const t_xtensor_2d& previous_weights =
+                levels.empty() ? image_weights : std::get<2>(levels.back());
+
+            auto [values, weights] =
+                functions::downsample_accumulators(previous_values, previous_weights, mp_cores);
+
+            levels.emplace_back(get_pyramid_gridder(level), std::move(values), std::move(weights));
+        }
+
+        return levels;
     }
 
     /**
@@ -423,6 +1117,45 @@ class ForwardGridder2D
     {
         return std::make_tuple(_xmin, _xres, _nx, _ymin, _yres, _ny);
     }
+
+    /**
+     * @brief Throw if the first 2 dimensions of image do not fit the grid dimensions
+     *
+     * @param image image to check
+     * @param image_name name of the image (used in the error message)
+     */
+    template<typename t_xtensor>
+    void _check_image_dimensions(const t_xtensor& image, const std::string& image_name) const
+    {
+        if (static_cast<size_t>(image.shape()[0]) != static_cast<size_t>(_nx) ||
+            static_cast<size_t>(image.shape()[1]) != static_cast<size_t>(_ny))
+            throw std::runtime_error(fmt::format(
+                "ERROR: {} dimensions do not fit ForwardGridder2D dimensions!", image_name));
+    }
+
+    /**
+     * @brief Fold the points into their nearest cell of image (block min / max / count, see
+     * functions::detail::grd_block_fold_nd)
+     */
+    template<typename T_vector, typename t_xtensor, typename t_fold>
+    void _grd_block_fold(const T_vector& sx,
+                         const T_vector& sy,
+                         const T_vector& s_val,
+                         t_xtensor&      image,
+                         const t_fold&   fold,
+                         const int       mp_cores) const
+    {
+        functions::detail::grd_block_fold_nd<2>(
+            s_val.size(),
+            [&](size_t i) { return std::array{ sx[i], sy[i] }; },
+            [&](size_t i) { return s_val[i]; },
+            std::array<t_float, 2>{ _xmin, _ymin },
+            std::array<t_float, 2>{ _xres, _yres },
+            std::array<int, 2>{ _nx, _ny },
+            image,
+            fold,
+            mp_cores);
+    }
 };
 
 } // namespace gridding
@@ -0,0 +1,520 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/forwardgridder4d.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <themachinethatgoesping/tools/classhelper/objectprinter.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "forwardgridder3d.hpp"
+#include "functions/gridfunctions.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+
+/**
+ * @brief Space-time (x, y, z, t) version of ForwardGridder3D, e.g. for repeated surveys of the
+ * same area. The time axis is divided into time slices of width tres, slice k is centered at
+ * tbase + k * tres. Each time slice is a 3D grid (values / weights images) of the given
+ * ForwardGridder3D. Only time slices that received data are stored (ordered by slice index), so
+ * that new surveys / time slices can be added incrementally without allocating the (mostly
+ * empty) time range in between.
+ *
+ * Times are handled in double precision (e.g. unix time in seconds) independent of t_float.
+ *
+ * @tparam t_float floating point type of the grid parameters and images
+ */
+template<std::floating_point t_float>
+class ForwardGridder4D
+{
+  public:
+    using t_image = xt::xtensor<t_float, 3>;
+
+    /**
+     * @brief Initialize space-time forward gridder
+     *
+     * @param gridder ForwardGridder3D that defines the spatial grid of each time slice
+     * @param tres width of the time slices (e.g. 3600 for hourly slices of unix times)
+     * @param tbase center of time slice 0, by default 0.0
+     */
+    ForwardGridder4D(ForwardGridder3D<t_float> gridder, double tres, double tbase = 0.0)
+        : _gridder(std::move(gridder))
+        , _tres(tres)
+        , _tbase(tbase)
+    {
+        if (!(_tres > 0) || !std::isfinite(_tres) || !std::isfinite(_tbase))
+            throw std::runtime_error(fmt::format(
+                "ERROR[ForwardGridder4D]: tres must be > 0 and finite and tbase must be finite "
+                "(tres: {}, tbase: {})",
+                _tres,
+                _tbase));
+    }
+
+    // ----- interpolation -----
+    /**
+     * @brief Add space-time points using block mean interpolation (each point is added to the
+     * nearest grid cell of the nearest time slice). Time slices are created as needed.
+     *
+     * @tparam T_vector
+     * @tparam T_vector_time type of the time values (use double for e.g. unix times)
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @param st time values
+     * @param s_val amplitudes / volume backscattering coefficients (points with non-finite
+     * values or times are ignored)
+     * @param mp_cores Number of cores to use for parallelization (within each time slice)
+     */
+    template<typename T_vector, typename T_vector_time = T_vector>
+    void interpolate_block_mean_inplace(const T_vector&      sx,
+                                        const T_vector&      sy,
+                                        const T_vector&      sz,
+                                        const T_vector_time& st,
+                                        const T_vector&      s_val,
+                                        const int            mp_cores = 1)
+    {
+        _check_input_sizes(sx, sy, sz, st, s_val, "interpolate_block_mean_inplace");
+
+        const std::array<t_float, 3> mins = { _gridder.get_xmin(),
+                                              _gridder.get_ymin(),
+                                              _gridder.get_zmin() };
+        const std::array<t_float, 3> ress = { _gridder.get_xres(),
+                                              _gridder.get_yres(),
+                                              _gridder.get_zres() };
+        const std::array<int, 3>     ns   = { _gridder.get_nx(),
+                                              _gridder.get_ny(),
+                                              _gridder.get_nz() };
+
+        _interpolate_inplace(
+            sx,
+            [&](size_t i, auto&& add_to_slice) {
+                if (!std::isfinite(s_val[i]) || !std::isfinite(double(st[i])))
+                    return;
+
+                bool inside = false;
+                functions::detail::for_each_block_mean_cell(
+                    std::array{ sx[i], sy[i], sz[i] }, mins, ress, ns, [&](const auto&, t_float) {
+                        inside = true;
+                    });
+                if (!inside)
+                    return;
+
+                add_to_slice(std::llround(get_time_index_fraction(double(st[i]))), t_float(1));
+            },
+            [&](size_t i, t_float time_weight, auto& values, auto& weights) {
+                const t_float value = t_float(s_val[i]) * time_weight;
+                functions::detail::for_each_block_mean_cell(
+                    std::array{ sx[i], sy[i], sz[i] },
+                    mins,
+                    ress,
+                    ns,
+                    [&](const auto& index, t_float) {
+                        functions::detail::grid_cell(values, index) += value;
+                        functions::detail::grid_cell(weights, index) += time_weight;
+                    });
+            },
+            mp_cores);
+    }
+
+    /**
+     * @brief Add space-time points using weighted mean interpolation (each point is distributed
+     * onto the 8 surrounding grid cells of the 2 surrounding time slices, weighted by the
+     * distance to the cell centers / slice centers). Time slices are created as needed.
+     *
+     * @tparam T_vector
+     * @tparam T_vector_time type of the time values (use double for e.g. unix times)
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @param st time values
+     * @param s_val amplitudes / volume backscattering coefficients (points with non-finite
+     * values or times are ignored)
+     * @param mp_cores Number of cores to use for parallelization (within each time slice)
+     */
+    template<typename T_vector, typename T_vector_time = T_vector>
+    void interpolate_weighted_mean_inplace(const T_vector&      sx,
+                                           const T_vector&      sy,
+                                           const T_vector&      sz,
+                                           const T_vector_time& st,
+                                           const T_vector&      s_val,
+                                           const int            mp_cores = 1)
+    {
+        _check_input_sizes(sx, sy, sz, st, s_val, "interpolate_weighted_mean_inplace");
+
+        const std::array<t_float, 3> mins = { _gridder.get_xmin(),
+                                              _gridder.get_ymin(),
+                                              _gridder.get_zmin() };
+        const std::array<t_float, 3> ress = { _gridder.get_xres(),
+                                              _gridder.get_yres(),
+                                              _gridder.get_zres() };
+        const std::array<int, 3>     ns   = { _gridder.get_nx(),
+                                              _gridder.get_ny(),
+                                              _gridder.get_nz() };
+
+        _interpolate_inplace(
+            sx,
+            [&](size_t i, auto&& add_to_slice) {
+                if (!std::isfinite(s_val[i]) || !std::isfinite(double(st[i])))
+                    return;
+
+                // at least one of the 8 surrounding cells must be within the grid
+                bool inside = false;
+                functions::detail::for_each_weighted_mean_cell(
+                    std::array{ sx[i], sy[i], sz[i] }, mins, ress, ns, [&](const auto&, t_float) {
+                        inside = true;
+                    });
+                if (!inside)
+                    return;
+
+                const double  ft          = get_time_index_fraction(double(st[i]));
+                const double  it          = std::floor(ft);
+                const t_float upper_share = t_float(ft - it);
+
+                add_to_slice(int64_t(it), t_float(1) - upper_share);
+                add_to_slice(int64_t(it) + 1, upper_share);
+            },
+            [&](size_t i, t_float time_weight, auto& values, auto& weights) {
+                functions::detail::for_each_weighted_mean_cell(
+                    std::array{ sx[i], sy[i], sz[i] },
+                    mins,
+                    ress,
+                    ns,
+                    [&](const auto& index, t_float w) {
+                        const t_float weight = w * time_weight;
+                        functions::detail::grid_cell(values, index) += t_float(s_val[i]) * weight;
+                        functions::detail::grid_cell(weights, index) += weight;
+                    });
+            },
+            mp_cores);
+    }
+
+    /**
+     * @brief Add accumulated images (e.g. from ForwardGridder3D::interpolate_block_mean with the
+     * same grid) to time slice time_index. The slice is created if it does not exist.
+     *
+     * @tparam t_xtensor_3d
+     * @param time_index index of the time slice (see get_time_index)
+     * @param image_values accumulated values
+     * @param image_weights accumulated weights
+     */
+    template<tools::helper::c_xtensor_3d t_xtensor_3d>
+    void add_slice_images(int64_t             time_index,
+                          const t_xtensor_3d& image_values,
+                          const t_xtensor_3d& image_weights)
+    {
+        const std::array<size_t, 3> shape = { size_t(_gridder.get_nx()),
+                                              size_t(_gridder.get_ny()),
+                                              size_t(_gridder.get_nz()) };
+
+        if (!std::equal(shape.begin(), shape.end(), image_values.shape().begin()) ||
+            !std::equal(shape.begin(), shape.end(), image_weights.shape().begin()))
+            throw std::runtime_error(
+                fmt::format("ERROR[ForwardGridder4D::add_slice_images]: image shapes must match "
+                            "the grid ({}, {}, {})",
+                            shape[0],
+                            shape[1],
+                            shape[2]));
+
+        auto& [values, weights] = _get_or_create_slice(time_index);
+        values += image_values;
+        weights += image_weights;
+    }
+
+    /**
+     * @brief Remove a time slice (and release its memory), e.g. to keep a moving time window
+     *
+     * @param time_index index of the time slice
+     * @return true if the slice existed
+     */
+    bool remove_slice(int64_t time_index) { return _slices.erase(time_index) > 0; }
+
+    /**
+     * @brief Remove all time slices (and release the memory)
+     */
+    void clear() { _slices.clear(); }
+
+    // ----- time axis -----
+    /**
+     * @brief Get the (fractional) time slice index of time t: (t - tbase) / tres
+     */
+    double get_time_index_fraction(double t) const { return (t - _tbase) / _tres; }
+
+    /**
+     * @brief Get the index of the time slice that contains time t
+     */
+    int64_t get_time_index(double t) const { return std::llround(get_time_index_fraction(t)); }
+
+    /**
+     * @brief Get the center time of time slice time_index
+     */
+    double get_time_value(int64_t time_index) const { return _tbase + _tres * double(time_index); }
+
+    /**
+     * @brief Get the start and end time of time slice time_index
+     */
+    std::vector<double> get_time_extent(int64_t time_index) const
+    {
+        return { get_time_value(time_index) - _tres / 2, get_time_value(time_index) + _tres / 2 };
+    }
+
+    // ----- slice access -----
+    bool has_slice(int64_t time_index) const { return _slices.contains(time_index); }
+
+    size_t get_number_of_slices() const { return _slices.size(); }
+
+    /**
+     * @brief Get the indices of all stored (occupied) time slices in ascending order
+     *
+     * @return std::vector<int64_t>
+     */
+    std::vector<int64_t> get_time_indices() const
+    {
+        std::vector<int64_t> time_indices;
+        time_indices.reserve(_slices.size());
+        for (const auto& [time_index, images] : _slices)
+            time_indices.push_back(time_index);
+
+        return time_indices;
+    }
+
+    /**
+     * @brief Get the center times of all stored (occupied) time slices in ascending order
+     *
+     * @return std::vector<double>
+     */
+    std::vector<double> get_times() const
+    {
+        std::vector<double> times;
+        times.reserve(_slices.size());
+        for (const auto& [time_index, images] : _slices)
+            times.push_back(get_time_value(time_index));
+
+        return times;
+    }
+
+    /**
+     * @brief Get the accumulated images of time slice time_index
+     *
+     * @param time_index index of the time slice
+     * @return const std::tuple<t_image, t_image>& image_values, image_weights
+     */
+    const std::tuple<t_image, t_image>& get_slice(int64_t time_index) const
+    {
+        auto it = _slices.find(time_index);
+        if (it == _slices.end())
+            throw std::runtime_error(fmt::format(
+                "ERROR[ForwardGridder4D::get_slice]: time slice {} does not exist", time_index));
+
+        return it->second;
+    }
+
+    /**
+     * @brief Stack the images of all stored time slices (in the order of get_time_indices) into
+     * 4D images with shape (n_slices, nx, ny, nz)
+     *
+     * @return std::tuple<xt::xtensor<t_float, 4>, xt::xtensor<t_float, 4>> image_values,
+     * image_weights
+     */
+    std::tuple<xt::xtensor<t_float, 4>, xt::xtensor<t_float, 4>> get_images() const
+    {
+        const std::array<size_t, 4> shape = { _slices.size(),
+                                              size_t(_gridder.get_nx()),
+                                              size_t(_gridder.get_ny()),
+                                              size_t(_gridder.get_nz()) };
+
+        xt::xtensor<t_float, 4> image_values  = xt::xtensor<t_float, 4>::from_shape(shape);
+        xt::xtensor<t_float, 4> image_weights = xt::xtensor<t_float, 4>::from_shape(shape);
+
+        const size_t slice_size = shape[1] * shape[2] * shape[3];
+        size_t       offset     = 0;
+        for (const auto& [time_index, images] : _slices)
+        {
+            std::copy_n(std::get<0>(images).data(), slice_size, image_values.data() + offset);
+            std::copy_n(std::get<1>(images).data(), slice_size, image_weights.data() + offset);
+            offset += slice_size;
+        }
+
+        return std::make_tuple(std::move(image_values), std::move(image_weights));
+    }
+
+    // ----- getters -----
+    const ForwardGridder3D<t_float>& get_gridder() const { return _gridder; }
+    double                           get_tres() const { return _tres; }
+    double                           get_tbase() const { return _tbase; }
+
+    // ----- objectprinter -----
+    tools::classhelper::ObjectPrinter __printer__(unsigned int float_precision,
+                                                  bool         superscript_exponents) const
+    {
+        tools::classhelper::ObjectPrinter printer(
+            "ForwardGridder4D", float_precision, superscript_exponents);
+
+        printer.register_section("time slices");
+        printer.register_value("tres", _tres);
+        printer.register_value("tbase", _tbase);
+        printer.register_value("number_of_slices", get_number_of_slices());
+        if (!_slices.empty())
+        {
+            printer.register_value("first_time_index", _slices.begin()->first);
+            printer.register_value("last_time_index", _slices.rbegin()->first);
+        }
+
+        printer.register_section("grid");
+        printer.append(_gridder.__printer__(float_precision, superscript_exponents));
+
+        return printer;
+    }
+
+    // ----- class helper macros -----
+    __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
+
+  private:
+    ForwardGridder3D<t_float>                        _gridder;
+    double                                           _tres;
+    double                                           _tbase;
+    std::map<int64_t, std::tuple<t_image, t_image>> _slices;
+
+    template<typename T_vector, typename T_vector_time>
+    static void _check_input_sizes(const T_vector&      sx,
+                                   const T_vector&      sy,
+                                   const T_vector&      sz,
+                                   const T_vector_time& st,
+                                   const T_vector&      s_val,
+                                   const std::string&   function_name)
+    {
+        if (sx.size() != sy.size() || sx.size() != sz.size() || sx.size() != st.size() ||
+            sx.size() != s_val.size())
+            throw std::runtime_error(
+                fmt::format("ERROR[ForwardGridder4D::{}]: sx, sy, sz, st and s_val must have the "
+                            "same size",
+                            function_name));
+    }
+
+    std::tuple<t_image, t_image>& _get_or_create_slice(int64_t time_index)
+    {
+        auto it = _slices.find(time_index);
+        if (it == _slices.end())
+            it = _slices.emplace(time_index, _gridder.template get_empty_grd_images<t_image>())
+                     .first;
+
+        return it->second;
+    }
+
+    /**
+     * @brief Add all points (sx: x values) to the time slices. for_each_slice(i, add_to_slice)
+     * calls add_to_slice(time_index, time_weight) for each time slice point i contributes to
+     * (only for points that contribute to at least one cell of the spatial grid).
+     * add_to_images(i, time_weight, values, weights) then adds point i to the images of one
+     * slice. The points are grouped per time slice with a counting sort (two passes over
+     * for_each_slice, ascending point order within each slice). Each slice is then filled with
+     * the parallel 3D scatter kernel (functions::detail::scatter_points, partitioned along x),
+     * so that mp_cores is used also if all points fall into a single time slice.
+     */
+    template<typename T_vector, typename t_for_each_slice, typename t_add_to_images>
+    void _interpolate_inplace(const T_vector&         sx,
+                              const t_for_each_slice& for_each_slice,
+                              const t_add_to_images&  add_to_images,
+                              const int               mp_cores)
+    {
+        const size_t  n_points = sx.size();
+        const t_float xmin     = _gridder.get_xmin();
+        const t_float xres     = _gridder.get_xres();
+        const int     nx       = _gridder.get_nx();
+
+        // slot per touched time slice (consecutive points usually share their time slice)
+        std::unordered_map<int64_t, size_t> slot_of_slice;
+        std::vector<int64_t>                slot_time_index;
+        std::vector<size_t>                 slot_begin;
+        int64_t                             last_time_index = 0;
+        size_t                              last_slot       = std::numeric_limits<size_t>::max();
+
+        auto get_slot = [&](int64_t time_index) {
+            if (last_slot != std::numeric_limits<size_t>::max() && time_index == last_time_index)
+                return last_slot;
+
+            const auto [it, inserted] =
+                slot_of_slice.try_emplace(time_index, slot_time_index.size());
+            if (inserted)
+            {
+                slot_time_index.push_back(time_index);
+                slot_begin.push_back(0);
+            }
+            last_time_index = time_index;
+            last_slot       = it->second;
+            return last_slot;
+        };
+
+        // pass 1: count the contributions per time slice
+        for (size_t i = 0; i < n_points; ++i)
+            for_each_slice(i, [&](int64_t time_index, t_float time_weight) {
+                if (time_weight == t_float(0.0))
+                    return;
+
+                ++slot_begin[get_slot(time_index)];
+            });
+
+        size_t n_contributions = 0;
+        for (auto& begin : slot_begin)
+            n_contributions += std::exchange(begin, n_contributions);
+
+        // pass 2: fill the contributions (slot_end[s] ends at slot_begin[s + 1])
+        std::vector<std::pair<size_t, t_float>> contributions(n_contributions);
+        std::vector<size_t>                     slot_end = slot_begin;
+        for (size_t i = 0; i < n_points; ++i)
+            for_each_slice(i, [&](int64_t time_index, t_float time_weight) {
+                if (time_weight == t_float(0.0))
+                    return;
+
+                contributions[slot_end[get_slot(time_index)]++] = { i, time_weight };
+            });
+
+        for (size_t s = 0; s < slot_time_index.size(); ++s)
+        {
+            auto& [values, weights] = _get_or_create_slice(slot_time_index[s]);
+            const auto* slice_contributions = contributions.data() + slot_begin[s];
+
+            functions::detail::scatter_points(
+                slot_end[s] - slot_begin[s],
+                values,
+                weights,
+                [&](size_t j, auto& slice_values, auto& slice_weights) {
+                    const auto& [i, time_weight] = slice_contributions[j];
+                    add_to_images(i, time_weight, slice_values, slice_weights);
+                },
+                size_t(nx),
+                [&](size_t j) {
+                    const t_float f = functions::get_index_fraction(
+                        t_float(sx[slice_contributions[j].first]), xmin, xres);
+                    return functions::detail::get_row_range(f, f, nx);
+                },
+                mp_cores);
+        }
+    }
+};
+
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
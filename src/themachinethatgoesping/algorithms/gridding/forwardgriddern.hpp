@@ -0,0 +1,382 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/forwardgriddern.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <themachinethatgoesping/tools/classhelper/objectprinter.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "functions/gridfunctions.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+
+/**
+ * @brief Dimension generic version of ForwardGridder1D / 2D / 3D. Generates N dimensional grids
+ * and interpolates N dimensional points onto the grid using simple forward mapping algorithms
+ * (block mean, weighted mean interpolation). The grid parameters are computed per axis exactly as
+ * in the dimension specific gridders, and all gridders share the same (dimension generic)
+ * gridding kernels (functions::grd_block_mean_nd, functions::grd_weighted_mean_nd). The points
+ * are passed as coordinate array with shape (N, n_points), e.g. (x, y, z, t) for N = 4.
+ *
+ * @tparam t_float floating point type of the grid parameters
+ * @tparam N number of dimensions
+ */
+template<std::floating_point t_float, size_t N>
+class ForwardGridderN
+{
+    static_assert(N >= 1, "ForwardGridderN: N must be >= 1");
+
+  public:
+    // -- factory methods --
+    /**
+     * @brief Create gridder with resolution "res" for all axes. The grid minimum / maximum is
+     * determined to exactly contain the given coordinates (non-finite coordinates are ignored).
+     *
+     * @param res resolution of the grid (all axes)
+     * @param s_coordinates coordinates of the points, shape (N, n_points)
+     * @return ForwardGridderN object
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d>
+    static ForwardGridderN from_data(t_float res, const t_xtensor_2d& s_coordinates)
+    {
+        if (s_coordinates.shape()[0] != N)
+            throw std::runtime_error(
+                fmt::format("ERROR[ForwardGridderN::from_data]: s_coordinates must have {} rows "
+                            "(one per axis) but has {}",
+                            N,
+                            s_coordinates.shape()[0]));
+
+        std::array<t_float, N> min_values, max_values, resolutions;
+        for (size_t d = 0; d < N; ++d)
+        {
+            min_values[d]  = std::numeric_limits<t_float>::max();
+            max_values[d]  = std::numeric_limits<t_float>::lowest();
+            resolutions[d] = res;
+
+            for (size_t i = 0; i < s_coordinates.shape()[1]; ++i)
+            {
+                const t_float value = s_coordinates.unchecked(d, i);
+                if (!std::isfinite(value))
+                    continue;
+
+                min_values[d] = std::min(min_values[d], value);
+                max_values[d] = std::max(max_values[d], value);
+            }
+
+            if (min_values[d] > max_values[d])
+                throw std::runtime_error(
+                    fmt::format("ERROR[ForwardGridderN::from_data]: no finite coordinates for "
+                                "axis {}",
+                                d));
+        }
+
+        return ForwardGridderN(resolutions, min_values, max_values);
+    }
+
+    /**
+     * @brief Create gridder setting the resolution of all axes to "res"
+     *
+     * @param res resolution of the grid (all axes)
+     * @param min_values smallest value per axis that must be contained within the grid
+     * @param max_values largest value per axis that must be contained within the grid
+     * @return ForwardGridderN object
+     */
+    static ForwardGridderN from_res(t_float                       res,
+                                    const std::array<t_float, N>& min_values,
+                                    const std::array<t_float, N>& max_values)
+    {
+        std::array<t_float, N> resolutions;
+        resolutions.fill(res);
+        return ForwardGridderN(resolutions, min_values, max_values);
+    }
+
+    /**
+     * @brief Initialize forward gridder class using grid parameters.
+     *
+     * @param res resolution of the grid per axis
+     * @param min_values smallest value per axis that must be contained within the grid
+     * @param max_values largest value per axis that must be contained within the grid
+     * @param base base position of the grid per axis, by default 0.0
+     */
+    ForwardGridderN(const std::array<t_float, N>& res,
+                    const std::array<t_float, N>& min_values,
+                    const std::array<t_float, N>& max_values,
+                    const std::array<t_float, N>& base = {})
+        : _res(res)
+        , _base(base)
+    {
+        for (size_t d = 0; d < N; ++d)
+        {
+            if (!(_res[d] > 0))
+                throw std::runtime_error(fmt::format(
+                    "ERROR[ForwardGridderN]: resolution must be > 0 (axis {}: {})", d, _res[d]));
+
+            // Compute center values of the grid cells that contain min_values and max_values
+            _min[d] = functions::get_grd_value(min_values[d], _base[d], _res[d]);
+            _max[d] = functions::get_grd_value(max_values[d], _base[d], _res[d]);
+
+            // Compute the number of elements from (including) min to max
+            _n[d] = static_cast<int>((_max[d] - _min[d]) / _res[d]) + 1;
+
+            // Compute borders (extent of the outermost grid cells)
+            _border_min[d] = _min[d] - _res[d] / 2;
+            _border_max[d] = _max[d] + _res[d] / 2;
+        }
+    }
+
+    bool operator==(const ForwardGridderN& other) const = default;
+
+    /**
+     * @brief Create empty grid images
+     *
+     * @return std::tuple<t_xtensor, t_xtensor> image_values, image_weights
+     */
+    template<tools::helper::c_xtensor t_xtensor>
+        requires(std::tuple_size_v<typename t_xtensor::shape_type> == N)
+    std::tuple<t_xtensor, t_xtensor> get_empty_grd_images() const
+    {
+        std::array<size_t, N> shape;
+        for (size_t d = 0; d < N; ++d)
+            shape[d] = static_cast<size_t>(_n[d]);
+
+        t_xtensor image_values  = xt::zeros<t_float>(shape);
+        t_xtensor image_weights = xt::zeros<t_float>(shape);
+
+        return std::make_tuple(image_values, image_weights);
+    }
+
+    /**
+     * @brief Interpolate N dimensional points onto N dimensional images using block mean
+     * interpolation
+     *
+     * @tparam t_xtensor
+     * @tparam t_xtensor_2d
+     * @tparam T_vector
+     * @param s_coordinates coordinates of the points, shape (N, n_points)
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<t_xtensor, t_xtensor> image_values, image_weights
+     */
+    template<tools::helper::c_xtensor    t_xtensor,
+             tools::helper::c_xtensor_2d t_xtensor_2d,
+             typename                    T_vector>
+    std::tuple<t_xtensor, t_xtensor> interpolate_block_mean(const t_xtensor_2d& s_coordinates,
+                                                            const T_vector&     s_val,
+                                                            const int           mp_cores = 1) const
+    {
+        auto image_values_weights = get_empty_grd_images<t_xtensor>();
+
+        interpolate_block_mean_inplace(s_coordinates,
+                                       s_val,
+                                       std::get<0>(image_values_weights),
+                                       std::get<1>(image_values_weights),
+                                       mp_cores);
+
+        return image_values_weights;
+    }
+
+    /**
+     * @brief Interpolate N dimensional points onto N dimensional images using block mean
+     * interpolation (inplace version)
+     *
+     * @tparam t_xtensor_2d
+     * @tparam T_vector
+     * @tparam t_xtensor
+     * @param s_coordinates coordinates of the points, shape (N, n_points)
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_values Image with values will be edited inplace
+     * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d,
+             typename                    T_vector,
+             tools::helper::c_xtensor    t_xtensor>
+    void interpolate_block_mean_inplace(const t_xtensor_2d& s_coordinates,
+                                        const T_vector&     s_val,
+                                        t_xtensor&          image_values,
+                                        t_xtensor&          image_weights,
+                                        const int           mp_cores = 1) const
+    {
+        functions::grd_block_mean_nd(
+            s_coordinates, s_val, _min, _res, _n, image_values, image_weights, mp_cores);
+    }
+
+    /**
+     * @brief Interpolate N dimensional points onto N dimensional images using weighted mean
+     * interpolation (each point is distributed onto the 2^N surrounding grid cells)
+     *
+     * @tparam t_xtensor
+     * @tparam t_xtensor_2d
+     * @tparam T_vector
+     * @param s_coordinates coordinates of the points, shape (N, n_points)
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<t_xtensor, t_xtensor> image_values, image_weights
+     */
+    template<tools::helper::c_xtensor    t_xtensor,
+             tools::helper::c_xtensor_2d t_xtensor_2d,
+             typename                    T_vector>
+    std::tuple<t_xtensor, t_xtensor> interpolate_weighted_mean(
+        const t_xtensor_2d& s_coordinates,
+        const T_vector&     s_val,
+        const int           mp_cores = 1) const
+    {
+        auto image_values_weights = get_empty_grd_images<t_xtensor>();
+
+        interpolate_weighted_mean_inplace(s_coordinates,
+                                          s_val,
+                                          std::get<0>(image_values_weights),
+                                          std::get<1>(image_values_weights),
+                                          mp_cores);
+
+        return image_values_weights;
+    }
+
+    /**
+     * @brief Interpolate N dimensional points onto N dimensional images using weighted mean
+     * interpolation (inplace version)
+     *
+     * @tparam t_xtensor_2d
+     * @tparam T_vector
+     * @tparam t_xtensor
+     * @param s_coordinates coordinates of the points, shape (N, n_points)
+     * @param s_val amplitudes / volume backscattering coefficients
+     * @param image_values Image with values will be edited inplace
+     * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d,
+             typename                    T_vector,
+             tools::helper::c_xtensor    t_xtensor>
+    void interpolate_weighted_mean_inplace(const t_xtensor_2d& s_coordinates,
+                                           const T_vector&     s_val,
+                                           t_xtensor&          image_values,
+                                           t_xtensor&          image_weights,
+                                           const int           mp_cores = 1) const
+    {
+        functions::grd_weighted_mean_nd(
+            s_coordinates, s_val, _min, _res, _n, image_values, image_weights, mp_cores);
+    }
+
+    // Various utility methods
+    const auto& get_res() const { return _res; }
+    const auto& get_base() const { return _base; }
+    const auto& get_min() const { return _min; }
+    const auto& get_max() const { return _max; }
+    const auto& get_n() const { return _n; }
+    const auto& get_border_min() const { return _border_min; }
+    const auto& get_border_max() const { return _border_max; }
+
+    int get_index(size_t axis, t_float value) const
+    {
+        return functions::get_index(value, _min.at(axis), _res[axis]);
+    }
+
+    t_float get_index_fraction(size_t axis, t_float value) const
+    {
+        return functions::get_index_fraction(value, _min.at(axis), _res[axis]);
+    }
+
+    t_float get_value(size_t axis, int index) const
+    {
+        return functions::get_value(t_float(index), _min.at(axis), _res[axis]);
+    }
+
+    t_float get_grd_value(size_t axis, t_float value) const
+    {
+        return functions::get_grd_value(value, _min.at(axis), _res[axis]);
+    }
+
+    std::vector<t_float> get_extent(size_t axis) const
+    {
+        return { _border_min.at(axis), _border_max[axis] };
+    }
+
+    std::vector<t_float> get_coordinates(size_t axis) const
+    {
+        std::vector<t_float> coordinates;
+        coordinates.reserve(_n.at(axis));
+
+        for (int i = 0; i < _n[axis]; ++i)
+        {
+            coordinates.push_back(get_value(axis, i));
+        }
+
+        return coordinates;
+    }
+
+    // ----- objectprinter -----
+    tools::classhelper::ObjectPrinter __printer__(unsigned int float_precision,
+                                                  bool         superscript_exponents) const
+    {
+        tools::classhelper::ObjectPrinter printer(
+            fmt::format("ForwardGridderN (N={})", N), float_precision, superscript_exponents);
+
+        printer.register_section("grid parameters");
+        for (size_t d = 0; d < N; ++d)
+        {
+            printer.register_value(fmt::format("res[{}]", d), _res[d]);
+            printer.register_value(fmt::format("base[{}]", d), _base[d]);
+            printer.register_value(fmt::format("min[{}]", d), _min[d]);
+            printer.register_value(fmt::format("max[{}]", d), _max[d]);
+            printer.register_value(fmt::format("n[{}]", d), _n[d]);
+        }
+
+        printer.register_section("grid borders");
+        for (size_t d = 0; d < N; ++d)
+        {
+            printer.register_value(fmt::format("border_min[{}]", d), _border_min[d]);
+            printer.register_value(fmt::format("border_max[{}]", d), _border_max[d]);
+        }
+
+        return printer;
+    }
+
+    // ----- serialization -----
+    void to_stream(std::ostream& os) const
+    {
+        os.write(reinterpret_cast<const char*>(&_res), sizeof(t_float) * N * 6 + sizeof(int) * N);
+    }
+
+    static ForwardGridderN from_stream(std::istream& is)
+    {
+        ForwardGridderN gridder;
+        is.read(reinterpret_cast<char*>(&gridder._res), sizeof(t_float) * N * 6 + sizeof(int) * N);
+        return gridder;
+    }
+
+    // ----- class helper macros -----
+    __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
+    __STREAM_DEFAULT_TOFROM_BINARY_FUNCTIONS__(ForwardGridderN)
+
+  private:
+    ForwardGridderN() = default;
+
+    // Grid parameters (per axis)
+    std::array<t_float, N> _res, _base, _min, _max, _border_min, _border_max;
+    std::array<int, N>     _n;
+};
+
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -0,0 +1,208 @@
+//sourcehash: 4dbcbb8670a553c50895622ee038449d6254596f34e6e24138018f8b13068475
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_FoldCount =
+R"doc(Fold cell += 1)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_FoldCount_operator_call = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_FoldMax =
+R"doc(Fold cell = max(cell, value), NaN cells are treated as empty)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_FoldMax_operator_call = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_FoldMin =
+R"doc(Fold cell = min(cell, value), NaN cells are treated as empty)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_FoldMin_operator_call = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_at =
+R"doc(Access an image element using an index array (unchecked))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_check_number_of_cells =
+R"doc(Throw if the number of cells of the (first N dimensions of the) image
+does not fit the number of cells described by cell_offsets)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_for_each_filled_cell =
+R"doc(Call per_cell(cell, begin, end) for each cell that contains values (in
+parallel))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_grd_block_fold_nd =
+R"doc(Fold each point with a finite value into its nearest grid cell (block
+min / max / count without grouping the points with group_blocks_csr
+first). The points are scattered in parallel into disjoint x slabs of
+the image (see scatter_points), so each cell is folded by a single
+thread. The result equals the group_blocks_csr based reducers.
+
+Args:
+    n_points: number of points
+    get_coordinates: callable (size_t i) -> std::array<coordinate, N>
+                     of point i
+    get_value: callable (size_t i) -> value of point i (non-finite
+               values are ignored)
+    mins: coordinate of the first grid cell per dimension
+    ress: grid resolution per dimension
+    ns: number of grid cells per dimension
+    image: image that will be edited inplace
+    fold: callable (cell&, value) that folds a value into a cell (e.g.
+          FoldMin)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    N: number of dimensions)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_unravel_cell_index =
+R"doc(Convert a flat (row major) cell index into an N dimensional image
+index
+
+Args:
+    cell: flat cell index
+    shape: shape of the image (only the first N dimensions are used)
+
+Returns:
+    std::array<size_t, N>)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_count =
+R"doc(Add the number of values of each cell to image_count
+
+Args:
+    cell_offsets: cell offsets as returned by group_blocks_csr
+    image_count: Image with the number of values per cell (will be
+                 edited inplace)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor: image type (1D, 2D or 3D))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_histogram =
+R"doc(Add the values of each cell to a per cell histogram (sketch) with
+equally spaced bins between hist_min and hist_max. Values outside this
+range are counted in the first / last bin. The histograms can be used
+to compute approximate block quantiles / medians (see
+histogram_quantile).
+
+Args:
+    cell_offsets: cell offsets as returned by group_blocks_csr
+    values: values as returned by group_blocks_csr
+    hist_min: lower border of the first histogram bin
+    hist_max: upper border of the last histogram bin
+    image_histogram: Image with histogram counts (last axis: bins)
+                     (will be edited inplace)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor: histogram image type (grid dimensions + 1 axis for the
+               bins))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_max =
+R"doc(Fold the maximum of each cell into image_max. Cells of image_max that
+are NaN are treated as empty (use a NaN initialized image for the
+first call).
+
+Args:
+    cell_offsets: cell offsets as returned by group_blocks_csr
+    values: values as returned by group_blocks_csr
+    image_max: Image with maximum values (will be edited inplace)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor: image type (1D, 2D or 3D))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_min =
+R"doc(Fold the minimum of each cell into image_min. Cells of image_min that
+are NaN are treated as empty (use a NaN initialized image for the
+first call).
+
+Args:
+    cell_offsets: cell offsets as returned by group_blocks_csr
+    values: values as returned by group_blocks_csr
+    image_min: Image with minimum values (will be edited inplace)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor: image type (1D, 2D or 3D))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_variance =
+R"doc(Fold the values of each cell into running mean / variance images using
+Welford's algorithm. The (population) variance is image_m2 /
+image_count, the sample variance image_m2 / (image_count - 1).
+
+Args:
+    cell_offsets: cell offsets as returned by group_blocks_csr
+    values: values as returned by group_blocks_csr
+    image_count: Image with the number of values per cell (will be
+                 edited inplace)
+    image_mean: Image with the running mean per cell (will be edited
+                inplace)
+    image_m2: Image with the running sum of squared differences from
+              the mean (will be edited inplace)
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor: image type (1D, 2D or 3D))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_histogram_quantile =
+R"doc(Compute approximate block quantiles (e.g. the median) from per cell
+histograms created with grd_block_histogram. The quantile is linearly
+interpolated within the histogram bin. Cells without values are set to
+NaN.
+
+Args:
+    image_histogram: Image with histogram counts (last axis: bins)
+    hist_min: lower border of the first histogram bin
+    hist_max: upper border of the last histogram bin
+    quantile: quantile to compute (0 - 1), 0.5 = median
+    mp_cores: Number of cores to use for parallelization
+
+Template Args:
+    t_xtensor_out: output image type (histogram dimensions - 1)
+    t_xtensor_hist: histogram image type
+
+Returns:
+    t_xtensor_out image with the quantile value per cell)doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
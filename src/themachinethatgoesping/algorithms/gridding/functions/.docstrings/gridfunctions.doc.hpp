@@ -1,4 +1,4 @@
-//sourcehash: 798c105cb251d17bad12eebf582c9420542558ca2abb4999921133974db46caa
+//sourcehash: 5c9478644c6c639925fcb215386f7574a9dc92c00f83cba0939bf928c1a921b0
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,6 +41,335 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_RowTile =
+R"doc(Image proxy used by scatter_points for the t_accumulator path: the
+rows [first_row, first_row + n) of a row major image, stored in a
+(reused) buffer of partial sums. Cells are accessed via unchecked (or
+grid_cell) with image (not tile) indices.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_RowTile_data = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_RowTile_first_row = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_RowTile_strides = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_RowTile_unchecked = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_add_channels =
+R"doc(Add the n_channels values of one point (weighted with w) to the
+n_channels values / weights of one grid cell. Non-finite values are
+ignored per channel. The channels are processed in xsimd batches
+(scalar tail) if the values and the images share the same floating
+point type.
+
+Args:
+    v: pointer to the channel values of the point (contiguous)
+    n_channels: number of channels
+    w: interpolation weight of the grid cell
+    values: pointer to the channel values of the grid cell
+            (contiguous)
+    weights: pointer to the channel weights of the grid cell
+             (contiguous))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_axis_index_weights =
+R"doc(Compute the lower grid index (floor) and the upper / lower
+interpolation weights for one axis of a batch of points. This is the
+vectorized equivalent of get_index_fraction and the floor / fraction
+part of get_index_weights.
+
+Args:
+    lanes: coordinates of the batch
+    grd_val_min: value of the first grid cell
+    grd_res: grid resolution
+    index: lower grid index (floor) per lane (output)
+    w0: weight of the lower grid cell (1 - fraction)
+    w1: weight of the upper grid cell (fraction))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_check_nd_input =
+R"doc(Throw if the coordinates / values / images do not fit each other)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_for_each_block_mean_cell =
+R"doc(Call add_to_cell(index, 1) for the grid cell nearest to a point (block
+mean interpolation), if it lies inside the grid. See
+for_each_weighted_mean_cell.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_for_each_corner_cell =
+R"doc(Call add_to_cell(cell, weight) for each of the 2^N corner cells of a
+weighted mean interpolation that lies inside the grid and has a non
+zero weight. This is the corner / bounds logic shared by
+for_each_weighted_mean_cell and the xsimd kernel
+(grd_weighted_mean_xsimd_nd). If all corners lie inside the grid, the
+per corner bounds checks are skipped.
+
+Args:
+    lower: lower corner cell (floor of the fractional grid indices)
+    get_weight: callable (size_t corner) -> weight of the corner
+                (corners ordered as in get_index_weights_nd)
+    ns: number of grid cells per dimension
+    add_to_cell: callable (const std::array<int, N>& index, t_float
+                 weight))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_for_each_weighted_mean_cell =
+R"doc(Call add_to_cell(index, weight) for each grid cell that a point
+contributes to using weighted mean interpolation: the 2^N surrounding
+cells (see get_index_weights_nd) that lie inside the grid and have a
+non zero weight. This is the single implementation of the weighted
+mean index / weight logic that is shared by all gridders.
+
+Args:
+    coordinates: coordinates of the point
+    mins: coordinate of the first grid cell per dimension
+    ress: grid resolution per dimension
+    ns: number of grid cells per dimension
+    add_to_cell: callable (const std::array<int, N>& index, t_float
+                 weight))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_gaussian_kernel = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_get_nd_coordinates =
+R"doc(Return the N coordinates of point i from a coordinate array with shape
+(N, n_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_get_row_range =
+R"doc(Range of rows (indices along the partition axis, usually the first
+image axis) that a point with the fractional indices frac_first ...
+frac_last along that axis may write to (see scatter_points). The range
+is clipped to [0, n - 1]. Points outside the grid (or with non-finite
+fractions) return {0, 0}, as they do not write to the images.
+
+Args:
+    frac_first: smallest fractional index of the point footprint
+    frac_last: largest fractional index of the point footprint
+    n: number of rows
+
+Returns:
+    std::pair<size_t, size_t> first and last row (inclusive))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_grd_block_mean_nd =
+R"doc(Dimension generic block mean kernel used by all grd_block_mean
+overloads. Each point is added to the nearest grid cell. See
+grd_weighted_mean_nd for the parameters.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_grd_weighted_mean_multichannel_nd =
+R"doc(Dimension generic multi-channel weighted mean kernel used by all
+grd_weighted_mean_multichannel overloads. The cells / weights of each
+point are computed once (see for_each_weighted_mean_cell) and shared
+by all channels (see add_channels).
+
+Args:
+    coordinates: coordinate vectors (one per spatial dimension)
+    sv: 2D array of values (n_points x n_channels)
+    mins: coordinate of the first grid cell per dimension
+    ress: grid resolution per dimension
+    ns: number of grid cells per dimension
+    image_values: image with values will be edited inplace
+    image_weights: image with weights will be edited inplace
+    mp_cores: Number of cores to use (see scatter_points)
+
+Template Args:
+    N: number of spatial dimensions (the images have N + 1 dimensions,
+       channels last))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_grd_weighted_mean_nd =
+R"doc(Dimension generic weighted mean kernel used by all grd_weighted_mean
+overloads. Each point is distributed onto the 2^N surrounding grid
+cells (see get_index_weights_nd).
+
+Args:
+    n_points: number of points
+    get_coordinates: callable (size_t i) -> std::array<coordinate, N>
+                     of point i
+    get_value: callable (size_t i) -> value of point i (non-finite
+               values are ignored)
+    mins: coordinate of the first grid cell per dimension
+    ress: grid resolution per dimension
+    ns: number of grid cells per dimension
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (see scatter_points)
+
+Template Args:
+    N: number of dimensions
+    t_accumulator: value type used for accumulation (see
+                   scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_grd_weighted_mean_xsimd_nd =
+R"doc(Dimension generic xsimd kernel used by all grd_weighted_mean_xsimd
+overloads. The fractions, lower corner indices and the 2^N corner
+weights are computed for a batch of xsimd::batch<t_float>::size points
+at once, only the scatter into the images is scalar. The corner cells
+are visited with the same helper as the scalar kernel (see
+for_each_corner_cell).
+
+Args:
+    coordinates: coordinate vectors (one per dimension)
+    sv: values (non-finite values are ignored)
+    mins: coordinate of the first grid cell per dimension
+    ress: grid resolution per dimension
+    ns: number of grid cells per dimension
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (see scatter_points)
+
+Template Args:
+    N: number of dimensions)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_grid_cell =
+R"doc(Access the cell "index" of an N dimensional image (unchecked))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_group_blocks_csr =
+R"doc(Group the values sv into grid cells using a counting sort. The result
+is stored in a compressed (CSR) layout: the values of cell c are
+values[cell_offsets[c]:cell_offsets[c+1]]. The cell indices are
+computed in parallel, the values are then scattered in input order
+(stable), i.e. the result does not depend on mp_cores.
+
+Args:
+    sv: values
+    n_cells: total number of grid cells
+    get_cell_index: callable that computes the flat cell index of a
+                    point
+    mp_cores: number of cores to use for parallelization
+
+Template Args:
+    t_vector: type of the value vector
+    t_cell_index: callable (size_t index) -> int64_t that returns the
+                  flat cell index of point "index" or -1 if the point
+                  should be ignored
+
+Returns:
+    std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<value_type, 1>>
+        cell_offsets (size n_cells + 1), values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_inverse_distance_kernel = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_is_inside_grid =
+R"doc(Return true if all indices are within [0, n))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_load_lanes =
+R"doc(Copy the values i0 ... i0 + lanes.size() of s into lanes. Lanes beyond
+the end of s are set to fill_value.
+
+Args:
+    s: input vector
+    i0: index of the first value
+    lanes: output array (one element per simd lane)
+    fill_value: value for lanes beyond the end of s)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_minmax_finite =
+R"doc(Fused min/max kernel for N arrays of equal size. All arrays are read
+in a single memory pass. Floating point arrays are processed in xsimd
+batches. Non-finite values (NaN, +-inf) are skipped and counted
+explicitly.
+
+Args:
+    arrays: pointers to the input arrays (equal size)
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<min, max, finite_count> one array element per input
+        array. min and max are NaN if an array contains no finite
+        value.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_scatter_points =
+R"doc(Scatter n_points into image_values / image_weights using mp_cores
+threads.
+
+For mp_cores > 1 the rows (see get_rows) are split into a few slabs
+per thread and the points are sorted into buckets (stable counting
+sort, one size_t per point): points within one slab, points that
+straddle two neighbouring slabs and (rare) points that span more
+slabs. The slab buckets are scattered in parallel directly into the
+images, followed by the straddling buckets (even and odd slab pairs in
+two parallel rounds) and the remaining points (serial). Concurrently
+scattered buckets never share a row, so no private image copies and no
+reduction are needed. The result is deterministic for a given mp_cores
+and only differs from the serial path by the floating point summation
+order.
+
+For mp_cores <= 1 (and no t_accumulator) the points are scattered
+directly into the images.
+
+Args:
+    n_points: number of points
+    image_values: image with values (will be edited inplace)
+    image_weights: image with weights (will be edited inplace)
+    scatter_point: callable that scatters a single point
+    n_rows: number of rows of the partition axis. Points with disjoint
+            row ranges must write to disjoint cells (e.g. rows =
+            indices along the first image axis)
+    get_rows: callable that returns the row range of a single point
+    mp_cores: number of cores to use for parallelization
+
+Template Args:
+    t_accumulator: void or a value type used to bound the accumulation
+                   error if it differs from the image value type (e.g.
+                   double for float images). scatter_point must then
+                   access the images via unchecked (or grid_cell) and
+                   the images must be row major with the rows as first
+                   axis. The points are then always bucketed as
+                   described above (also for mp_cores <= 1) and the
+                   slabs are made small enough that a slab covers at
+                   most about max_tile_cells cells per image (at least
+                   one row). Each bucket is accumulated into
+                   t_accumulator buffers that cover only the rows of
+                   the bucket and are added to the images with a
+                   single rounding per cell. The buffers are allocated
+                   once per thread and reused, so the extra memory is
+                   about 2 * 2 * max_tile_cells *
+                   sizeof(t_accumulator) per thread (2 MB for double),
+                   independent of the image size. Only the (rare)
+                   points that span more than two slabs are
+                   accumulated into a buffer that covers all their
+                   rows; this never happens for the weighted and block
+                   mean kernels, whose points write to at most two
+                   neighbouring rows.
+    t_xtensor: tensor type of the images
+    t_scatter: callable (size_t index, auto& values, auto& weights)
+               that adds the point "index" to the given images
+    t_get_rows: callable (size_t index) -> std::pair<size_t, size_t>
+                first and last row (inclusive) that the point "index"
+                may write to (see get_row_range))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_splat_footprint =
+R"doc(Compute the cells of one axis that lie within radius of a point
+(clipped to the grid) and their squared distances to the point.
+
+Args:
+    frac: fractional index of the point (see get_index_fraction)
+    res: grid resolution
+    radius: footprint radius (in coordinate units)
+    n: number of grid cells
+    d2: output: squared distances of the cells i0 ... i0 + d2.size() -
+        1 (empty if the footprint does not overlap the grid)
+
+Returns:
+    int i0: index of the first cell of the footprint)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_splat_points_nd =
+R"doc(Dimension generic splatting kernel used by all grd_*_splat overloads.
+Each point is splatted onto all cells within radius. The weight of a
+cell is kernel(squared distance between point and cell center). For
+each row of the footprint along the contiguous last axis, the range of
+cells within radius is determined once, the kernel weights of that
+range are computed into a buffer and then added through row pointers
+in a branch free loop.
+
+Args:
+    coordinates: coordinate vectors (one per dimension)
+    sv: values (non-finite values are ignored)
+    mins: coordinate of the first grid cell per dimension
+    ress: grid resolution per dimension
+    ns: number of grid cells per dimension
+    radius: footprint radius (in coordinate units)
+    kernel: callable (t_float squared distance) -> t_float weight
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (see scatter_points)
+
+Template Args:
+    N: number of dimensions)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_grd_value = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_index = R"doc()doc";
@@ -49,29 +378,563 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_index_weights = R"doc()doc";
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_index_weights_2 = R"doc()doc";
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_index_weights_2 =
+R"doc(Compute the 2^N surrounding grid cells and their interpolation weights
+for a point with the given (fractional) grid indices. The cells are
+ordered with the first dimension varying slowest (same order as the
+1D, 2D and 3D overloads).
+
+Args:
+    fractions: fractional grid indices (see get_index_fraction) of the
+               point
+
+Template Args:
+    N: number of dimensions
+
+Returns:
+    std::tuple<std::array<std::array<int, N>, 2^N>,
+        std::array<t_float, 2^N>> cell indices, weights)doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_index_weights_3 = R"doc()doc";
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax = R"doc()doc";
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_index_weights_nd =
+R"doc(Compute the 2^N surrounding grid cells and their interpolation weights
+for a point with the given (fractional) grid indices. The cells are
+ordered with the first dimension varying slowest (same order as the
+1D, 2D and 3D versions of get_index_weights).
+
+Args:
+    fractions: fractional grid indices (see get_index_fraction) of the
+               point
+
+Template Args:
+    N: number of dimensions
+
+Returns:
+    std::tuple<std::array<std::array<int, N>, 2^N>,
+        std::array<t_float, 2^N>> cell indices, weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax =
+R"doc(Returns the min/max value of a list. Non-finite values are ignored.
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax_2 = R"doc()doc";
+Args:
+    sv: 1D array with values
+    mp_cores: Number of cores to use for parallelization
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax_3 = R"doc()doc";
+Returns:
+    std::tuple<t_val, t_val> (min, max), NaN if sv contains no finite
+        value)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax_2 =
+R"doc(Returns the min/max value of two lists (same size) in a single pass.
+Non-finite values are ignored.
+
+Args:
+    sx: 1D array with x positions
+    sy: 1D array with y positions
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<t_val, t_val, t_val, t_val> (xmin, xmax, ymin, ymax))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax_3 =
+R"doc(Returns the min/max value of three lists (same size) in a single pass.
+Non-finite values are ignored.
+
+Args:
+    sx: 1D array with x positions
+    sy: 1D array with y positions
+    sz: 1D array with z positions
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<t_val, t_val, t_val, t_val, t_val, t_val> (xmin, xmax,
+        ymin, ymax, zmin, zmax))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax_count =
+R"doc(Returns the min/max value and the number of finite values of a list.
+
+Args:
+    sv: 1D array with values
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<t_val, t_val, size_t> (min, max, finite_count))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax_count_2 =
+R"doc(Returns the min/max values and the number of finite values of two
+lists (same size) in a single pass.
+
+Args:
+    sx: 1D array with x positions
+    sy: 1D array with y positions
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<t_val, t_val, t_val, t_val, size_t, size_t> (xmin,
+        xmax, ymin, ymax, x_finite_count, y_finite_count))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_minmax_count_3 =
+R"doc(Returns the min/max values and the number of finite values of three
+lists (same size) in a single pass.
+
+Args:
+    sx: 1D array with x positions
+    sy: 1D array with y positions
+    sz: 1D array with z positions
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<t_val, t_val, t_val, t_val, t_val, t_val, size_t,
+        size_t, size_t> (xmin, xmax, ymin, ymax, zmin, zmax,
+        x_finite_count, y_finite_count, z_finite_count))doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_get_value = R"doc()doc";
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_mean = R"doc()doc";
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_mean =
+R"doc(Add xyz points to 3D images using block mean interpolation (each point
+is added to the nearest grid cell)
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    zmin: z value of the first grid cell
+    zres: grid resolution in z
+    nz: number of grid cells in z
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points)
+
+Template Args:
+    t_accumulator: value type used for accumulation. If it differs
+                   from the image value type (e.g. double for float
+                   images), the points are accumulated into small
+                   reused row tiles of this type that are added to the
+                   images with a single rounding (see
+                   detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_mean_2 =
+R"doc(Add xy points to 2D images using block mean interpolation (each point
+is added to the nearest grid cell)
+
+Args:
+    sx: x values
+    sy: y values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points)
+
+Template Args:
+    t_accumulator: value type used for accumulation. If it differs
+                   from the image value type (e.g. double for float
+                   images), the points are accumulated into small
+                   reused row tiles of this type that are added to the
+                   images with a single rounding (see
+                   detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_mean_3 =
+R"doc(Add x points to a 1D image using block mean interpolation (each point
+is added to the nearest grid cell)
+
+Args:
+    sx: x values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points)
+
+Template Args:
+    t_accumulator: value type used for accumulation. If it differs
+                   from the image value type (e.g. double for float
+                   images), the points are accumulated into small
+                   reused row tiles of this type that are added to the
+                   images with a single rounding (see
+                   detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_mean_nd =
+R"doc(Add N dimensional points to N dimensional images using block mean
+interpolation (each point is added to the nearest grid cell). Equals
+the 1D, 2D and 3D overloads of grd_block_mean for N = 1, 2, 3.
+
+Args:
+    s_coordinates: coordinates of the points, shape (N, n_points)
+    sv: values (non-finite values are ignored)
+    mins: coordinate of the first grid cell per dimension
+    ress: grid resolution per dimension
+    ns: number of grid cells per dimension
+    image_values: N dimensional image with values will be edited
+                  inplace
+    image_weights: N dimensional image with weights will be edited
+                   inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points)
+
+Template Args:
+    t_accumulator: value type used for accumulation (see
+                   detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_gaussian_splat =
+R"doc(Add xyz points to 3D images using gaussian kernel splatting. Each
+point is distributed onto all grid cells whose centers lie within
+radius of the point, weighted by exp(-d² / (2 sigma²)) (d: distance
+between point and cell center). This fills holes between sparse
+footprints without a separate interpolation pass.
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    zmin: z value of the first grid cell
+    zres: grid resolution in z
+    nz: number of grid cells in z
+    radius: footprint radius (in coordinate units)
+    sigma: standard deviation of the gaussian kernel (in coordinate
+           units)
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_gaussian_splat_2 =
+R"doc(Add xy points to 2D images using gaussian kernel splatting. Each point
+is distributed onto all grid cells whose centers lie within radius of
+the point, weighted by exp(-d² / (2 sigma²)) (d: distance between
+point and cell center).
+
+Args:
+    sx: x values
+    sy: y values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    radius: footprint radius (in coordinate units)
+    sigma: standard deviation of the gaussian kernel (in coordinate
+           units)
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_mean_2 = R"doc()doc";
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_inverse_distance_splat =
+R"doc(Add xyz points to 3D images using inverse distance weighted splatting.
+Each point is distributed onto all grid cells whose centers lie within
+radius of the point, weighted by 1 / d^power (d: distance between
+point and cell center). To avoid the singularity at d = 0, d is
+clamped to half of the smallest grid resolution.
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_block_mean_3 = R"doc()doc";
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    zmin: z value of the first grid cell
+    zres: grid resolution in z
+    nz: number of grid cells in z
+    radius: footprint radius (in coordinate units)
+    power: power of the inverse distance weights
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean = R"doc()doc";
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_inverse_distance_splat_2 =
+R"doc(Add xy points to 2D images using inverse distance weighted splatting.
+Each point is distributed onto all grid cells whose centers lie within
+radius of the point, weighted by 1 / d^power (d: distance between
+point and cell center). To avoid the singularity at d = 0, d is
+clamped to half of the smallest grid resolution.
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_2 = R"doc()doc";
+Args:
+    sx: x values
+    sy: y values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    radius: footprint radius (in coordinate units)
+    power: power of the inverse distance weights
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
 
-static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_3 = R"doc()doc";
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean =
+R"doc(Add xyz points to 3D images using weighted mean interpolation (each
+point is distributed onto the 8 surrounding grid cells, weighted by
+the distance to the cell centers)
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    zmin: z value of the first grid cell
+    zres: grid resolution in z
+    nz: number of grid cells in z
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points)
+
+Template Args:
+    t_accumulator: value type used for accumulation. If it differs
+                   from the image value type (e.g. double for float
+                   images), the points are accumulated into small
+                   reused row tiles of this type that are added to the
+                   images with a single rounding (see
+                   detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_2 =
+R"doc(Add xy points to 2D images using weighted mean interpolation (each
+point is distributed onto the 4 surrounding grid cells, weighted by
+the distance to the cell centers)
+
+Args:
+    sx: x values
+    sy: y values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points)
+
+Template Args:
+    t_accumulator: value type used for accumulation. If it differs
+                   from the image value type (e.g. double for float
+                   images), the points are accumulated into small
+                   reused row tiles of this type that are added to the
+                   images with a single rounding (see
+                   detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_3 =
+R"doc(Add x points to a 1D image using weighted mean interpolation (each
+point is distributed onto the 2 surrounding grid cells, weighted by
+the distance to the cell centers)
+
+Args:
+    sx: x values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points)
+
+Template Args:
+    t_accumulator: value type used for accumulation. If it differs
+                   from the image value type (e.g. double for float
+                   images), the points are accumulated into small
+                   reused row tiles of this type that are added to the
+                   images with a single rounding (see
+                   detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_multichannel =
+R"doc(Add xyz points with n_channels values each (e.g. several frequencies)
+to 4D images (nx, ny, nz, n_channels) using weighted mean
+interpolation. The index / weight computation is shared by all
+channels, the channels (innermost dimension) are added in xsimd
+batches. Each channel equals grd_weighted_mean with the values of that
+channel (non-finite values are ignored per channel).
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    sv: 2D array of values (n_points x n_channels)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    zmin: z value of the first grid cell
+    zres: grid resolution in z
+    nz: number of grid cells in z
+    image_values: 4D image (nx, ny, nz, n_channels) with values will
+                  be edited inplace
+    image_weights: 4D image (nx, ny, nz, n_channels) with weights will
+                   be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_multichannel_2 =
+R"doc(Add xy points with n_channels values each to 3D images (nx, ny,
+n_channels) using weighted mean interpolation. See the 3D version for
+details.
+
+Args:
+    sx: x values
+    sy: y values
+    sv: 2D array of values (n_points x n_channels)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    image_values: 3D image (nx, ny, n_channels) with values will be
+                  edited inplace
+    image_weights: 3D image (nx, ny, n_channels) with weights will be
+                   edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_nd =
+R"doc(Add N dimensional points to N dimensional images using weighted mean
+interpolation (each point is distributed onto the 2^N surrounding grid
+cells, weighted by the distance to the cell centers). Equals the 1D,
+2D and 3D overloads of grd_weighted_mean for N = 1, 2, 3.
+
+Args:
+    s_coordinates: coordinates of the points, shape (N, n_points)
+    sv: values (non-finite values are ignored)
+    mins: coordinate of the first grid cell per dimension
+    ress: grid resolution per dimension
+    ns: number of grid cells per dimension
+    image_values: N dimensional image with values will be edited
+                  inplace
+    image_weights: N dimensional image with weights will be edited
+                   inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points)
+
+Template Args:
+    t_accumulator: value type used for accumulation (see
+                   detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_xsimd =
+R"doc(Vectorized (xsimd) backend for grd_weighted_mean (3D). The fractions,
+corner indices and trilinear weights are computed for a batch of
+xsimd::batch<t_float>::size points at once, only the scatter into the
+images is scalar. The corner cells are visited with the same helper as
+grd_weighted_mean (see detail::for_each_corner_cell), so for mp_cores
+= 1 the result equals grd_weighted_mean. All overloads share the
+dimension generic detail::grd_weighted_mean_xsimd_nd.
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    zmin: z value of the first grid cell
+    zres: grid resolution in z
+    nz: number of grid cells in z
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_xsimd_2 =
+R"doc(Vectorized (xsimd) backend for grd_weighted_mean (2D). See the 3D
+version for details.
+
+Args:
+    sx: x values
+    sy: y values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_grd_weighted_mean_xsimd_3 =
+R"doc(Vectorized (xsimd) backend for grd_weighted_mean (1D). See the 3D
+version for details.
+
+Args:
+    sx: x values
+    sv: values (non-finite values are ignored)
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    image_values: Image with values will be edited inplace
+    image_weights: Image with weights will be edited inplace
+    mp_cores: Number of cores to use (> 1: the points are scattered in
+              parallel into disjoint slabs of the images, see
+              detail::scatter_points))doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_group_blocks = R"doc()doc";
 
@@ -79,6 +942,75 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_group_blocks_3 = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_group_blocks_csr =
+R"doc(Group the values sv into the cells of a 3D grid using a counting sort.
+In contrast to group_blocks, the result is stored in a compressed
+(CSR) layout without per cell allocations: the values of cell c are
+values[cell_offsets[c]:cell_offsets[c+1]] where c is the row major
+(flat) index of the cell in the grid images: c = (ix * ny + iy) * nz +
+iz. Within a cell the values keep their input order. Non-finite values
+and values outside the grid are ignored.
+
+Args:
+    sx: x values
+    sy: y values
+    sz: z values
+    sv: values
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    zmin: z value of the first grid cell
+    zres: grid resolution in z
+    nz: number of grid cells in z
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<value_type, 1>>
+        cell_offsets (size nx * ny * nz + 1), values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_group_blocks_csr_2 =
+R"doc(Group the values sv into the cells of a 2D grid using a counting sort
+(CSR layout). The values of cell c = ix * ny + iy are
+values[cell_offsets[c]:cell_offsets[c+1]]. See the 3D overload for
+details.
+
+Args:
+    sx: x values
+    sy: y values
+    sv: values
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    ymin: y value of the first grid cell
+    yres: grid resolution in y
+    ny: number of grid cells in y
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<value_type, 1>>
+        cell_offsets (size nx * ny + 1), values)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_group_blocks_csr_3 =
+R"doc(Group the values sv into the cells of a 1D grid using a counting sort
+(CSR layout). The values of cell ix are
+values[cell_offsets[ix]:cell_offsets[ix+1]]. See the 3D overload for
+details.
+
+Args:
+    sx: x values
+    sv: values
+    xmin: x value of the first grid cell
+    xres: grid resolution in x
+    nx: number of grid cells in x
+    mp_cores: Number of cores to use for parallelization
+
+Returns:
+    std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<value_type, 1>>
+        cell_offsets (size nx + 1), values)doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
@@ -0,0 +1,99 @@
+//sourcehash: d314a3bed1cb48f7f77c1e91ea361a4436d4900191417ddea7c8d25764d19397
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_check_accumulator_shapes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_sum_blocks =
+R"doc(Sum blocks of 2 x 2 x fz cells of the (row major) images values_in /
+weights_in with shape (nx, ny, nz) into values_out / weights_out with
+shape ((nx+1)/2, (ny+1)/2, (nz+fz-1)/fz). The output is processed in
+tiles of tile_size x tile_size (x, y) cells that are distributed over
+the threads.
+
+Args:
+    fz: block size in z (1 or 2)
+    mp_cores: Number of cores to use for parallelization (over tiles))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_downsample_accumulators =
+R"doc(Compute the next coarser pyramid level of accumulated 3D grid images
+by summing blocks of 2x2x2 cells. The resulting images have the shape
+((nx+1)/2, (ny+1)/2, (nz+1)/2). Cell (i, j, k) of the coarse level
+contains the cells (2i:2i+2, 2j:2j+2, 2k:2k+2) of the input.
+
+Args:
+    image_values: accumulated values (e.g. from grd_weighted_mean)
+    image_weights: accumulated weights
+    mp_cores: Number of cores to use for parallelization (over output
+              tiles)
+
+Template Args:
+    t_xtensor_3d: 
+
+Returns:
+    std::tuple<t_xtensor_3d, t_xtensor_3d> coarse image_values,
+        image_weights)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_downsample_accumulators_2 =
+R"doc(Compute the next coarser pyramid level of accumulated 2D grid images
+by summing blocks of 2x2 cells. The resulting images have the shape
+((nx+1)/2, (ny+1)/2). Cell (i, j) of the coarse level contains the
+cells (2i:2i+2, 2j:2j+2) of the input.
+
+Args:
+    image_values: accumulated values (e.g. from grd_weighted_mean)
+    image_weights: accumulated weights
+    mp_cores: Number of cores to use for parallelization (over output
+              tiles)
+
+Template Args:
+    t_xtensor_2d: 
+
+Returns:
+    std::tuple<t_xtensor_2d, t_xtensor_2d> coarse image_values,
+        image_weights)doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -1,4 +1,4 @@
-//sourcehash: e2424571fea0286a7bfe394f560dd2d58675126fc9389473c98b022fdbfd7eb7
+//sourcehash: 34714e9bda877663c2312941e7bc0ba475e45c8e8335d9b4004e6d8f5a0b7607
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -49,7 +49,10 @@ This function generates a uniform grid of coordinates based on input
 data ranges and resolutions. It uses statistical analysis (quantiles
 and IQR) to determine appropriate grid bounds and resolution when
 explicit limits are not provided or when heuristic bounds are more
-suitable.
+suitable. The quantiles are computed by selection (no sorting) on
+thread local scratch buffers, so repeated calls (e.g. per echogram) do
+not allocate temporaries. Scratch buffers of more than 2^18 values are
+released after the call.
 
 Args:
     values_min: Array of minimum values for each data point (e.g.,
@@ -64,6 +67,70 @@ Args:
 Returns:
     coordinates: xtensor array of uniformly spaced grid coordinates)doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_compute_resampled_coordinates_2 =
+R"doc(Compute resampled coordinates for several axes at once (batched
+version of compute_resampled_coordinates). Row a of values_min /
+values_max / values_res holds the per element values of axis a (e.g.
+one row for depth and one for range, one column per ping). The axes
+are evaluated in parallel.
+
+Args:
+    values_min: 2D array (axes x elements) of minimum values
+    values_max: 2D array (axes x elements) of maximum values
+    values_res: 2D array (axes x elements) of resolution values
+    grid_min: Explicit minimum grid bound per axis (NaN: use
+              heuristic)
+    grid_max: Explicit maximum grid bound per axis (NaN: use
+              heuristic)
+    max_steps: Maximum number of grid points per axis. If exceeded,
+               switches to linear spacing
+    mp_cores: Number of cores to use for parallelization (over axes)
+
+Returns:
+    coordinates: one xtensor array of uniformly spaced grid
+        coordinates per axis)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_ResamplingScratch =
+R"doc(Scratch buffers for compute_resampled_coordinates. One instance per
+thread is reused between calls (see resampling_scratch), so repeated
+calls do not allocate once the buffers reached their working size.
+Buffers that grew beyond max_kept_capacity are released after each
+call, so a single large call does not pin its memory for the lifetime
+of the thread.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_ResamplingScratch_max_kept_capacity = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_ResamplingScratch_release =
+R"doc(Clear the buffers and release the ones with a capacity above
+max_kept_capacity)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_ResamplingScratch_values_max = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_ResamplingScratch_values_min = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_ResamplingScratch_values_res = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_compute_resampled_coordinates =
+R"doc(Implementation of compute_resampled_coordinates for n elements that
+are accessed through get_min(i), get_max(i) and get_res(i). All
+statistics are computed from a single pass over the values (collected
+into the thread local scratch buffers) and selection based quantiles.
+Oversized scratch buffers are released before returning.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_resampling_scratch = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_gridding_functions_detail_select_quantiles =
+R"doc(Compute quantiles (linear interpolation, same as xt::quantile / numpy
+default) using selection (std::nth_element) instead of sorting. The
+values are reordered.
+
+Args:
+    values: values (will be partially reordered), must not be empty
+    probabilities: ascending probabilities (0 ... 1)
+
+Returns:
+    std::array<t_value, N> quantiles)doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
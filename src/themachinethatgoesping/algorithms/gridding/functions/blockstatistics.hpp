@@ -0,0 +1,493 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/blockstatistics.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include <fmt/format.h>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "gridfunctions.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+namespace functions {
+
+/*
+ * Block statistics (min, max, count, variance, histogram) computed from the compressed layout
+ * returned by group_blocks_csr (cell_offsets, values). The values of the flat (row major) cell c
+ * are values[cell_offsets[c]:cell_offsets[c+1]].
+ * All reducers fold the new values into the given images, such that many pings can be
+ * accumulated into the same images. The cells are processed in parallel (no write conflicts).
+ * Min, max and count do not need the grouping: detail::grd_block_fold_nd folds the points
+ * directly into the images (used by the forward gridders).
+ */
+
+namespace detail {
+/**
+ * @brief Convert a flat (row major) cell index into an N dimensional image index
+ *
+ * @param cell flat cell index
+ * @param shape shape of the image (only the first N dimensions are used)
+ * @return std::array<size_t, N>
+ */
+template<size_t N, typename t_shape>
+inline std::array<size_t, N> unravel_cell_index(size_t cell, const t_shape& shape)
+{
+    std::array<size_t, N> index;
+    for (size_t d = N; d-- > 0;)
+    {
+        index[d] = cell % shape[d];
+        cell /= shape[d];
+    }
+    return index;
+}
+
+/**
+ * @brief Access an image element using an index array (unchecked)
+ */
+template<typename t_xtensor, size_t N>
+inline decltype(auto) at(t_xtensor& image, const std::array<size_t, N>& index)
+{
+    return std::apply([&image](auto... i) -> decltype(auto) { return image.unchecked(i...); },
+                      index);
+}
+
+/**
+ * @brief Throw if the number of cells of the (first N dimensions of the) image does not fit the
+ * number of cells described by cell_offsets
+ */
+template<size_t N, typename t_xtensor, typename t_offsets>
+inline void check_number_of_cells(const t_xtensor&   image,
+                                  const t_offsets&   cell_offsets,
+                                  const std::string& image_name)
+{
+    size_t n_cells = 1;
+    for (size_t d = 0; d < N; ++d)
+        n_cells *= image.shape()[d];
+
+    if (cell_offsets.size() != n_cells + 1)
+        throw std::runtime_error(
+            fmt::format("ERROR[block statistics]: {} has {} cells but cell_offsets describes {} "
+                        "cells!",
+                        image_name,
+                        n_cells,
+                        cell_offsets.size() == 0 ? 0 : cell_offsets.size() - 1));
+}
+
+/**
+ * @brief Call per_cell(cell, begin, end) for each cell that contains values (in parallel)
+ */
+template<typename t_offsets, typename t_per_cell>
+inline void for_each_filled_cell(const t_offsets&  cell_offsets,
+                                 const t_per_cell& per_cell,
+                                 const int         mp_cores)
+{
+    const int64_t n_cells = static_cast<int64_t>(cell_offsets.size()) - 1;
+
+#pragma omp parallel for num_threads(mp_cores) schedule(guided)
+    for (int64_t c = 0; c < n_cells; ++c)
+    {
+        const size_t begin = cell_offsets[c];
+        const size_t end   = cell_offsets[c + 1];
+
+        if (begin != end)
+            per_cell(static_cast<size_t>(c), begin, end);
+    }
+}
+
+/**
+ * @brief Fold cell = min(cell, value), NaN cells are treated as empty
+ */
+struct FoldMin
+{
+    template<typename t_cell, typename t_value>
+    void operator()(t_cell& cell, const t_value value) const
+    {
+        if (std::isnan(cell) || value < cell)
+            cell = value;
+    }
+};
+
+/**
+ * @brief Fold cell = max(cell, value), NaN cells are treated as empty
+ */
+struct FoldMax
+{
+    template<typename t_cell, typename t_value>
+    void operator()(t_cell& cell, const t_value value) const
+    {
+        if (std::isnan(cell) || value > cell)
+            cell = value;
+    }
+};
+
+/**
+ * @brief Fold cell += 1
+ */
+struct FoldCount
+{
+    template<typename t_cell, typename t_value>
+    void operator()(t_cell& cell, const t_value) const
+    {
+        cell += t_cell(1);
+    }
+};
+
+/**
+ * @brief Fold each point with a finite value into its nearest grid cell (block min / max /
+ * count without grouping the points with group_blocks_csr first). The points are scattered in
+ * parallel into disjoint x slabs of the image (see scatter_points), so each cell is folded by a
+ * single thread. The result equals the group_blocks_csr based reducers.
+ *
+ * @tparam N number of dimensions
+ * @param n_points number of points
+ * @param get_coordinates callable (size_t i) -> std::array<coordinate, N> of point i
+ * @param get_value callable (size_t i) -> value of point i (non-finite values are ignored)
+ * @param mins coordinate of the first grid cell per dimension
+ * @param ress grid resolution per dimension
+ * @param ns number of grid cells per dimension
+ * @param image image that will be edited inplace
+ * @param fold callable (cell&, value) that folds a value into a cell (e.g. FoldMin)
+ * @param mp_cores Number of cores to use for parallelization
+ */
+template<size_t N,
+         typename t_xtensor,
+         typename t_get_coordinates,
+         typename t_get_value,
+         std::floating_point t_float,
+         std::integral       t_int,
+         typename t_fold>
+inline void grd_block_fold_nd(const size_t                  n_points,
+                              const t_get_coordinates&      get_coordinates,
+                              const t_get_value&            get_value,
+                              const std::array<t_float, N>& mins,
+                              const std::array<t_float, N>& ress,
+                              const std::array<t_int, N>&   ns,
+                              t_xtensor&                    image,
+                              const t_fold&                 fold,
+                              const int                     mp_cores)
+{
+    // the image is passed as both scatter images, only the first one is used
+    auto scatter_point = [&](size_t i, auto& cells, auto&) {
+        const auto v = get_value(i);
+        if (!std::isfinite(v))
+            return;
+
+        for_each_block_mean_cell(
+            get_coordinates(i), mins, ress, ns, [&](const auto& index, t_float) {
+                fold(grid_cell(cells, index), v);
+            });
+    };
+
+    auto get_rows = [&](size_t i) {
+        const t_float f = get_index_fraction(t_float(get_coordinates(i)[0]), mins[0], ress[0]);
+        return get_row_range(f, f, ns[0]);
+    };
+
+    scatter_points(n_points, image, image, scatter_point, size_t(ns[0]), get_rows, mp_cores);
+}
+} // namespace detail
+
+/**
+ * @brief Fold the minimum of each cell into image_min. Cells of image_min that are NaN are
+ * treated as empty (use a NaN initialized image for the first call).
+ *
+ * @tparam t_xtensor image type (1D, 2D or 3D)
+ * @param cell_offsets cell offsets as returned by group_blocks_csr
+ * @param values values as returned by group_blocks_csr
+ * @param image_min Image with minimum values (will be edited inplace)
+ * @param mp_cores Number of cores to use for parallelization
+ */
+template<tools::helper::c_xtensor t_xtensor, typename t_offsets, typename t_values>
+inline void grd_block_min(const t_offsets& cell_offsets,
+                          const t_values&  values,
+                          t_xtensor&       image_min,
+                          const int        mp_cores = 1)
+{
+    static constexpr size_t N = std::tuple_size_v<typename t_xtensor::shape_type>;
+    detail::check_number_of_cells<N>(image_min, cell_offsets, "image_min");
+
+    detail::for_each_filled_cell(
+        cell_offsets,
+        [&](size_t cell, size_t begin, size_t end) {
+            const auto index  = detail::unravel_cell_index<N>(cell, image_min.shape());
+            auto&      result = detail::at(image_min, index);
+            for (size_t i = begin; i < end; ++i)
+                if (std::isnan(result) || values[i] < result)
+                    result = values[i];
+        },
+        mp_cores);
+}
+
+/**
+ * @brief Fold the maximum of each cell into image_max. Cells of image_max that are NaN are
+ * treated as empty (use a NaN initialized image for the first call).
+ *
+ * @tparam t_xtensor image type (1D, 2D or 3D)
+ * @param cell_offsets cell offsets as returned by group_blocks_csr
+ * @param values values as returned by group_blocks_csr
+ * @param image_max Image with maximum values (will be edited inplace)
+ * @param mp_cores Number of cores to use for parallelization
+ */
+template<tools::helper::c_xtensor t_xtensor, typename t_offsets, typename t_values>
+inline void grd_block_max(const t_offsets& cell_offsets,
+                          const t_values&  values,
+                          t_xtensor&       image_max,
+                          const int        mp_cores = 1)
+{
+    static constexpr size_t N = std::tuple_size_v<typename t_xtensor::shape_type>;
+    detail::check_number_of_cells<N>(image_max, cell_offsets, "image_max");
+
+    detail::for_each_filled_cell(
+        cell_offsets,
+        [&](size_t cell, size_t begin, size_t end) {
+            const auto index  = detail::unravel_cell_index<N>(cell, image_max.shape());
+            auto&      result = detail::at(image_max, index);
+            for (size_t i = begin; i < end; ++i)
+                if (std::isnan(result) || values[i] > result)
+                    result = values[i];
+        },
+        mp_cores);
+}
+
+/**
+ * @brief Add the number of values of each cell to image_count
+ *
+ * @tparam t_xtensor image type (1D, 2D or 3D)
+ * @param cell_offsets cell offsets as returned by group_blocks_csr
+ * @param image_count Image with the number of values per cell (will be edited inplace)
+ * @param mp_cores Number of cores to use for parallelization
+ */
+template<tools::helper::c_xtensor t_xtensor, typename t_offsets>
+inline void grd_block_count(const t_offsets& cell_offsets,
+                            t_xtensor&       image_count,
+                            const int        mp_cores = 1)
+{
+    static constexpr size_t N = std::tuple_size_v<typename t_xtensor::shape_type>;
+    detail::check_number_of_cells<N>(image_count, cell_offsets, "image_count");
+
+    detail::for_each_filled_cell(
+        cell_offsets,
+        [&](size_t cell, size_t begin, size_t end) {
+            using t_value    = typename t_xtensor::value_type;
+            const auto index = detail::unravel_cell_index<N>(cell, image_count.shape());
+            detail::at(image_count, index) += static_cast<t_value>(end - begin);
+        },
+        mp_cores);
+}
+
+/**
+ * @brief Fold the values of each cell into running mean / variance images using Welford's
+ * algorithm. The (population) variance is image_m2 / image_count, the sample variance
+ * image_m2 / (image_count - 1).
+ *
+ * @tparam t_xtensor image type (1D, 2D or 3D)
+ * @param cell_offsets cell offsets as returned by group_blocks_csr
+ * @param values values as returned by group_blocks_csr
+ * @param image_count Image with the number of values per cell (will be edited inplace)
+ * @param image_mean Image with the running mean per cell (will be edited inplace)
+ * @param image_m2 Image with the running sum of squared differences from the mean (will be
+ * edited inplace)
+ * @param mp_cores Number of cores to use for parallelization
+ */
+template<tools::helper::c_xtensor t_xtensor, typename t_offsets, typename t_values>
+inline void grd_block_variance(const t_offsets& cell_offsets,
+                               const t_values&  values,
+                               t_xtensor&       image_count,
+                               t_xtensor&       image_mean,
+                               t_xtensor&       image_m2,
+                               const int        mp_cores = 1)
+{
+    static constexpr size_t N = std::tuple_size_v<typename t_xtensor::shape_type>;
+    detail::check_number_of_cells<N>(image_count, cell_offsets, "image_count");
+    detail::check_number_of_cells<N>(image_mean, cell_offsets, "image_mean");
+    detail::check_number_of_cells<N>(image_m2, cell_offsets, "image_m2");
+
+    detail::for_each_filled_cell(
+        cell_offsets,
+        [&](size_t cell, size_t begin, size_t end) {
+            const auto index = detail::unravel_cell_index<N>(cell, image_count.shape());
+            auto&      count = detail::at(image_count, index);
+            auto&      mean  = detail::at(image_mean, index);
+            auto&      m2    = detail::at(image_m2, index);
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                count += 1;
+                const auto delta = values[i] - mean;
+                mean += delta / count;
+                m2 += delta * (values[i] - mean);
+            }
+        },
+        mp_cores);
+}
+
+/**
+ * @brief Add the values of each cell to a per cell histogram (sketch) with equally spaced bins
+ * between hist_min and hist_max. Values outside this range are counted in the first / last bin.
+ * The histograms can be used to compute approximate block quantiles / medians (see
+ * histogram_quantile).
+ *
+ * @tparam t_xtensor histogram image type (grid dimensions + 1 axis for the bins)
+ * @param cell_offsets cell offsets as returned by group_blocks_csr
+ * @param values values as returned by group_blocks_csr
+ * @param hist_min lower border of the first histogram bin
+ * @param hist_max upper border of the last histogram bin
+ * @param image_histogram Image with histogram counts (last axis: bins) (will be edited inplace)
+ * @param mp_cores Number of cores to use for parallelization
+ */
+template<tools::helper::c_xtensor t_xtensor,
+         typename t_offsets,
+         typename t_values,
+         std::floating_point t_float>
+inline void grd_block_histogram(const t_offsets& cell_offsets,
+                                const t_values&  values,
+                                const t_float    hist_min,
+                                const t_float    hist_max,
+                                t_xtensor&       image_histogram,
+                                const int        mp_cores = 1)
+{
+    static constexpr size_t N = std::tuple_size_v<typename t_xtensor::shape_type> - 1;
+    detail::check_number_of_cells<N>(image_histogram, cell_offsets, "image_histogram");
+
+    const int64_t n_bins = static_cast<int64_t>(image_histogram.shape()[N]);
+    if (n_bins < 1)
+        throw std::runtime_error("ERROR[grd_block_histogram]: image_histogram has no bins!");
+    if (!(hist_max > hist_min))
+        throw std::runtime_error(fmt::format(
+            "ERROR[grd_block_histogram]: hist_max ({}) must be larger than hist_min ({})!",
+            hist_max,
+            hist_min));
+
+    const t_float bin_scale = t_float(n_bins) / (hist_max - hist_min);
+
+    detail::for_each_filled_cell(
+        cell_offsets,
+        [&](size_t cell, size_t begin, size_t end) {
+            const auto index = detail::unravel_cell_index<N>(cell, image_histogram.shape());
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                const auto bin = std::clamp<int64_t>(
+                    static_cast<int64_t>(std::floor((values[i] - hist_min) * bin_scale)),
+                    0,
+                    n_bins - 1);
+
+                std::array<size_t, N + 1> hist_index;
+                std::copy(index.begin(), index.end(), hist_index.begin());
+                hist_index[N] = static_cast<size_t>(bin);
+
+                detail::at(image_histogram, hist_index) += 1;
+            }
+        },
+        mp_cores);
+}
+
+/**
+ * @brief Compute approximate block quantiles (e.g. the median) from per cell histograms created
+ * with grd_block_histogram. The quantile is linearly interpolated within the histogram bin.
+ * Cells without values are set to NaN.
+ *
+ * @tparam t_xtensor_out output image type (histogram dimensions - 1)
+ * @tparam t_xtensor_hist histogram image type
+ * @param image_histogram Image with histogram counts (last axis: bins)
+ * @param hist_min lower border of the first histogram bin
+ * @param hist_max upper border of the last histogram bin
+ * @param quantile quantile to compute (0 - 1), 0.5 = median
+ * @param mp_cores Number of cores to use for parallelization
+ * @return t_xtensor_out image with the quantile value per cell
+ */
+template<tools::helper::c_xtensor t_xtensor_out,
+         tools::helper::c_xtensor t_xtensor_hist,
+         std::floating_point      t_float>
+inline t_xtensor_out histogram_quantile(const t_xtensor_hist& image_histogram,
+                                        const t_float         hist_min,
+                                        const t_float         hist_max,
+                                        const t_float         quantile,
+                                        const int             mp_cores = 1)
+{
+    static constexpr size_t N = std::tuple_size_v<typename t_xtensor_hist::shape_type> - 1;
+    static_assert(std::tuple_size_v<typename t_xtensor_out::shape_type> == N,
+                  "histogram_quantile: output image must have one dimension less than the "
+                  "histogram image");
+
+    if (quantile < 0 || quantile > 1)
+        throw std::runtime_error(fmt::format(
+            "ERROR[histogram_quantile]: quantile ({}) must be between 0 and 1!", quantile));
+
+    using t_value = typename t_xtensor_out::value_type;
+
+    typename t_xtensor_out::shape_type shape;
+    std::copy(image_histogram.shape().begin(), image_histogram.shape().begin() + N, shape.begin());
+
+    t_xtensor_out image = t_xtensor_out::from_shape(shape);
+
+    size_t n_cells = 1;
+    for (size_t d = 0; d < N; ++d)
+        n_cells *= shape[d];
+
+    const size_t  n_bins    = image_histogram.shape()[N];
+    const t_float bin_width = (hist_max - hist_min) / t_float(n_bins);
+
+#pragma omp parallel for num_threads(mp_cores)
+    for (int64_t c = 0; c < static_cast<int64_t>(n_cells); ++c)
+    {
+        const auto index = detail::unravel_cell_index<N>(size_t(c), shape);
+
+        std::array<size_t, N + 1> hist_index;
+        std::copy(index.begin(), index.end(), hist_index.begin());
+
+        double total = 0;
+        for (size_t b = 0; b < n_bins; ++b)
+        {
+            hist_index[N] = b;
+            total += detail::at(image_histogram, hist_index);
+        }
+
+        if (!(total > 0))
+        {
+            detail::at(image, index) = std::numeric_limits<t_value>::quiet_NaN();
+            continue;
+        }
+
+        // find the bin that contains the quantile and interpolate within this bin
+        const double target     = quantile * total;
+        double       cumulative = 0;
+        t_value      result     = t_value(hist_max);
+        for (size_t b = 0; b < n_bins; ++b)
+        {
+            hist_index[N]      = b;
+            const double count = detail::at(image_histogram, hist_index);
+            if (count > 0 && cumulative + count >= target)
+            {
+                const auto bin_fraction = t_float((target - cumulative) / count);
+                result = t_value(hist_min + bin_width * (t_float(b) + bin_fraction));
+                break;
+            }
+            cumulative += count;
+        }
+        detail::at(image, index) = result;
+    }
+
+    return image;
+}
+
+} // namespace functions
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
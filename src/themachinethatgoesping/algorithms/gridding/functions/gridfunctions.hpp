@@ -3,99 +3,187 @@
 /* generated doc strings */
 #include ".docstrings/gridfunctions.doc.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
+#include <string>
 
 #include <fmt/format.h>
 #include <map>
 #include <themachinethatgoesping/tools/helper/xtensor.hpp>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include <xsimd/xsimd.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
 namespace themachinethatgoesping {
 namespace algorithms {
 namespace gridding {
 namespace functions {
 
-template<typename T_vector>
-inline auto get_minmax(const T_vector& sv, const int mp_cores = 1)
+namespace detail {
+/**
+ * @brief Fused min/max kernel for N arrays of equal size. All arrays are read in a single memory
+ * pass. Floating point arrays are processed in xsimd batches. Non-finite values (NaN, +-inf) are
+ * skipped and counted explicitly.
+ *
+ * @param arrays pointers to the input arrays (equal size)
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<min, max, finite_count> one array element per input array. min and max are
+ * NaN if an array contains no finite value.
+ */
+template<size_t N, typename T_vector>
+inline auto minmax_finite(const std::array<const T_vector*, N>& arrays, const int mp_cores)
 {
     using t_val = typename T_vector::value_type;
-    if (sv.size() == 0)
-        throw std::runtime_error("Expected non-empty array.");
 
-    t_val minv = std::numeric_limits<t_val>::max();
-    t_val maxv = std::numeric_limits<t_val>::lowest();
+    const size_t n = arrays[0]->size();
+
+    std::array<t_val, N>  minv, maxv;
+    std::array<size_t, N> count{};
+    minv.fill(std::numeric_limits<t_val>::max());
+    maxv.fill(std::numeric_limits<t_val>::lowest());
 
-#pragma omp parallel for num_threads(mp_cores) reduction(min : minv) reduction(max : maxv)
-    for (const auto v : sv)
+    if constexpr (std::is_floating_point_v<t_val>)
     {
-        if (v < minv)
-            minv = v;
-        if (v > maxv)
-            maxv = v;
+        using t_batch                     = xsimd::batch<t_val>;
+        static constexpr size_t simd_size = t_batch::size;
+
+        const size_t  n_batches = (n + simd_size - 1) / simd_size;
+        const t_batch highest(std::numeric_limits<t_val>::max());
+        const t_batch lowest(std::numeric_limits<t_val>::lowest());
+
+#pragma omp parallel num_threads(mp_cores)
+        {
+            std::array<t_batch, N> batch_min, batch_max;
+            std::array<size_t, N>  batch_count{};
+            batch_min.fill(highest);
+            batch_max.fill(lowest);
+
+#pragma omp for schedule(static)
+            for (int64_t b = 0; b < int64_t(n_batches); ++b)
+            {
+                const size_t i0 = size_t(b) * simd_size;
+
+                for (size_t a = 0; a < N; ++a)
+                {
+                    t_batch values;
+                    if (i0 + simd_size <= n)
+                        values = t_batch::load_unaligned(arrays[a]->data() + i0);
+                    else // last (partial) batch: pad with NaN
+                    {
+                        std::array<t_val, simd_size> lanes;
+                        lanes.fill(std::numeric_limits<t_val>::quiet_NaN());
+                        for (size_t k = 0; i0 + k < n; ++k)
+                            lanes[k] = (*arrays[a])[i0 + k];
+                        values = t_batch::load_unaligned(lanes.data());
+                    }
+
+                    const auto finite = xsimd::isfinite(values);
+                    batch_min[a] = xsimd::min(batch_min[a], xsimd::select(finite, values, highest));
+                    batch_max[a] = xsimd::max(batch_max[a], xsimd::select(finite, values, lowest));
+                    batch_count[a] += xsimd::count(finite);
+                }
+            }
+
+#pragma omp critical
+            for (size_t a = 0; a < N; ++a)
+            {
+                minv[a] = std::min(minv[a], xsimd::reduce_min(batch_min[a]));
+                maxv[a] = std::max(maxv[a], xsimd::reduce_max(batch_max[a]));
+                count[a] += batch_count[a];
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < n; ++i)
+            for (size_t a = 0; a < N; ++a)
+            {
+                const t_val v = (*arrays[a])[i];
+                minv[a]       = std::min(minv[a], v);
+                maxv[a]       = std::max(maxv[a], v);
+            }
+        count.fill(n);
     }
 
-    if (minv == std::numeric_limits<t_val>::max())
-        minv = std::numeric_limits<t_val>::quiet_NaN();
-    if (maxv == std::numeric_limits<t_val>::min())
-        maxv = std::numeric_limits<t_val>::quiet_NaN();
+    for (size_t a = 0; a < N; ++a)
+        if (count[a] == 0)
+        {
+            minv[a] = std::numeric_limits<t_val>::quiet_NaN();
+            maxv[a] = std::numeric_limits<t_val>::quiet_NaN();
+        }
 
-    return std::make_tuple(minv, maxv);
+    return std::make_tuple(minv, maxv, count);
+}
+} // namespace detail
+
+/**
+ * @brief Returns the min/max value of a list. Non-finite values are ignored.
+ *
+ * @param sv 1D array with values
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<t_val, t_val> (min, max), NaN if sv contains no finite value
+ */
+template<typename T_vector>
+inline auto get_minmax(const T_vector& sv, const int mp_cores = 1)
+{
+    if (sv.size() == 0)
+        throw std::runtime_error("Expected non-empty array.");
+
+    auto [minv, maxv, count] = detail::minmax_finite<1>(std::array{ &sv }, mp_cores);
+
+    return std::make_tuple(minv[0], maxv[0]);
 }
 
+/**
+ * @brief Returns the min/max value of two lists (same size) in a single pass. Non-finite values
+ * are ignored.
+ *
+ * @param sx 1D array with x positions
+ * @param sy 1D array with y positions
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<t_val, t_val, t_val, t_val> (xmin, xmax, ymin, ymax)
+ */
 template<typename T_vector>
 inline auto get_minmax(const T_vector& sx, const T_vector& sy, const int mp_cores = 1)
 {
-    using t_val = typename T_vector::value_type;
     if (sx.size() != sy.size())
         throw std::runtime_error(fmt::format("Expected equal array lengths. "
                                              "sx.size() = {}, sy.size() = {}",
                                              sx.size(),
                                              sy.size()));
 
-    using t_val = typename T_vector::value_type;
-
-    t_val minx = std::numeric_limits<t_val>::max();
-    t_val maxx = std::numeric_limits<t_val>::lowest();
-    t_val miny = std::numeric_limits<t_val>::max();
-    t_val maxy = std::numeric_limits<t_val>::lowest();
+    auto [minv, maxv, count] = detail::minmax_finite<2>(std::array{ &sx, &sy }, mp_cores);
 
-#pragma omp parallel for num_threads(mp_cores) reduction(min : minx, miny)                         \
-    reduction(max : maxx, maxy)
-    for (size_t i = 0; i < sx.size(); ++i)
-    {
-        const auto x = sx[i], y = sy[i];
-        if (x < minx)
-            minx = x;
-        if (x > maxx)
-            maxx = x;
-        if (y < miny)
-            miny = y;
-        if (y > maxy)
-            maxy = y;
-    }
-    if (minx == std::numeric_limits<t_val>::max())
-        minx = std::numeric_limits<t_val>::quiet_NaN();
-    if (maxx == std::numeric_limits<t_val>::min())
-        maxx = std::numeric_limits<t_val>::quiet_NaN();
-    if (miny == std::numeric_limits<t_val>::max())
-        miny = std::numeric_limits<t_val>::quiet_NaN();
-    if (maxy == std::numeric_limits<t_val>::min())
-        maxy = std::numeric_limits<t_val>::quiet_NaN();
-
-    return std::make_tuple(minx, maxx, miny, maxy);
+    return std::make_tuple(minv[0], maxv[0], minv[1], maxv[1]);
 }
 
+/**
+ * @brief Returns the min/max value of three lists (same size) in a single pass. Non-finite
+ * values are ignored.
+ *
+ * @param sx 1D array with x positions
+ * @param sy 1D array with y positions
+ * @param sz 1D array with z positions
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<t_val, t_val, t_val, t_val, t_val, t_val> (xmin, xmax, ymin, ymax, zmin,
+ * zmax)
+ */
 template<typename T_vector>
 inline auto get_minmax(const T_vector& sx,
                        const T_vector& sy,
                        const T_vector& sz,
                        const int       mp_cores = 1)
 {
-    using t_val = typename T_vector::value_type;
     if (sx.size() != sy.size() || sy.size() != sz.size())
         throw std::runtime_error(fmt::format("Expected equal array lengths. "
                                              "sx.size() = {}, sy.size() = {}, sz.size() = {}",
@@ -103,47 +191,78 @@ inline auto get_minmax(const T_vector& sx,
                                              sy.size(),
                                              sz.size()));
 
-    using t_val = typename T_vector::value_type;
+    auto [minv, maxv, count] = detail::minmax_finite<3>(std::array{ &sx, &sy, &sz }, mp_cores);
 
-    t_val minx = std::numeric_limits<t_val>::max();
-    t_val maxx = std::numeric_limits<t_val>::lowest();
-    t_val miny = std::numeric_limits<t_val>::max();
-    t_val maxy = std::numeric_limits<t_val>::lowest();
-    t_val minz = std::numeric_limits<t_val>::max();
-    t_val maxz = std::numeric_limits<t_val>::lowest();
+    return std::make_tuple(minv[0], maxv[0], minv[1], maxv[1], minv[2], maxv[2]);
+}
 
-#pragma omp parallel for num_threads(mp_cores) reduction(min : minx, miny, minz)                   \
-    reduction(max : maxx, maxy, maxz)
-    for (size_t i = 0; i < sx.size(); ++i)
-    {
-        const auto x = sx[i], y = sy[i], z = sz[i];
-        if (x < minx)
-            minx = x;
-        if (x > maxx)
-            maxx = x;
-        if (y < miny)
-            miny = y;
-        if (y > maxy)
-            maxy = y;
-        if (z < minz)
-            minz = z;
-        if (z > maxz)
-            maxz = z;
-    }
-    if (minx == std::numeric_limits<t_val>::max())
-        minx = std::numeric_limits<t_val>::quiet_NaN();
-    if (maxx == std::numeric_limits<t_val>::min())
-        maxx = std::numeric_limits<t_val>::quiet_NaN();
-    if (miny == std::numeric_limits<t_val>::max())
-        miny = std::numeric_limits<t_val>::quiet_NaN();
-    if (maxy == std::numeric_limits<t_val>::min())
-        maxy = std::numeric_limits<t_val>::quiet_NaN();
-    if (minz == std::numeric_limits<t_val>::max())
-        minz = std::numeric_limits<t_val>::quiet_NaN();
-    if (maxz == std::numeric_limits<t_val>::min())
-        maxz = std::numeric_limits<t_val>::quiet_NaN();
-
-    return std::make_tuple(minx, maxx, miny, maxy, minz, maxz);
+/**
+ * @brief Returns the min/max value and the number of finite values of a list.
+ *
+ * @param sv 1D array with values
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<t_val, t_val, size_t> (min, max, finite_count)
+ */
+template<typename T_vector>
+inline auto get_minmax_count(const T_vector& sv, const int mp_cores = 1)
+{
+    auto [minv, maxv, count] = detail::minmax_finite<1>(std::array{ &sv }, mp_cores);
+
+    return std::make_tuple(minv[0], maxv[0], count[0]);
+}
+
+/**
+ * @brief Returns the min/max values and the number of finite values of two lists (same size)
+ * in a single pass.
+ *
+ * @param sx 1D array with x positions
+ * @param sy 1D array with y positions
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<t_val, t_val, t_val, t_val, size_t, size_t> (xmin, xmax, ymin, ymax,
+ * x_finite_count, y_finite_count)
+ */
+template<typename T_vector>
+inline auto get_minmax_count(const T_vector& sx, const T_vector& sy, const int mp_cores = 1)
+{
+    if (sx.size() != sy.size())
+        throw std::runtime_error(fmt::format("Expected equal array lengths. "
+                                             "sx.size() = {}, sy.size() = {}",
+                                             sx.size(),
+                                             sy.size()));
+
+    auto [minv, maxv, count] = detail::minmax_finite<2>(std::array{ &sx, &sy }, mp_cores);
+
+    return std::make_tuple(minv[0], maxv[0], minv[1], maxv[1], count[0], count[1]);
+}
+
+/**
+ * @brief Returns the min/max values and the number of finite values of three lists (same size)
+ * in a single pass.
+ *
+ * @param sx 1D array with x positions
+ * @param sy 1D array with y positions
+ * @param sz 1D array with z positions
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<t_val, t_val, t_val, t_val, t_val, t_val, size_t, size_t, size_t> (xmin,
+ * xmax, ymin, ymax, zmin, zmax, x_finite_count, y_finite_count, z_finite_count)
+ */
+template<typename T_vector>
+inline auto get_minmax_count(const T_vector& sx,
+                             const T_vector& sy,
+                             const T_vector& sz,
+                             const int       mp_cores = 1)
+{
+    if (sx.size() != sy.size() || sy.size() != sz.size())
+        throw std::runtime_error(fmt::format("Expected equal array lengths. "
+                                             "sx.size() = {}, sy.size() = {}, sz.size() = {}",
+                                             sx.size(),
+                                             sy.size(),
+                                             sz.size()));
+
+    auto [minv, maxv, count] = detail::minmax_finite<3>(std::array{ &sx, &sy, &sz }, mp_cores);
+
+    return std::make_tuple(
+        minv[0], maxv[0], minv[1], maxv[1], minv[2], maxv[2], count[0], count[1], count[2]);
 }
 
 template<std::floating_point T>
@@ -277,6 +396,221 @@ inline auto group_blocks(const t_vector& sx,
     return blocks;
 }
 
+namespace detail {
+/**
+ * @brief Group the values sv into grid cells using a counting sort. The result is stored in a
+ * compressed (CSR) layout: the values of cell c are values[cell_offsets[c]:cell_offsets[c+1]].
+ * The cell indices are computed in parallel, the values are then scattered in input order
+ * (stable), i.e. the result does not depend on mp_cores.
+ *
+ * @tparam t_vector type of the value vector
+ * @tparam t_cell_index callable (size_t index) -> int64_t that returns the flat cell index of
+ * point "index" or -1 if the point should be ignored
+ * @param sv values
+ * @param n_cells total number of grid cells
+ * @param get_cell_index callable that computes the flat cell index of a point
+ * @param mp_cores number of cores to use for parallelization
+ * @return std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<value_type, 1>> cell_offsets (size
+ * n_cells + 1), values
+ */
+template<typename t_vector, typename t_cell_index>
+inline auto group_blocks_csr(const t_vector&     sv,
+                             const size_t        n_cells,
+                             const t_cell_index& get_cell_index,
+                             const int           mp_cores)
+    -> std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<typename t_vector::value_type, 1>>
+{
+    using t_value = typename t_vector::value_type;
+
+    const int64_t n_points = static_cast<int64_t>(sv.size());
+
+    std::vector<int64_t>   cell_indices(n_points);
+    xt::xtensor<size_t, 1> cell_offsets = xt::zeros<size_t>({ n_cells + 1 });
+    size_t*                cell_counts  = cell_offsets.data() + 1;
+
+    // compute cell index and count the number of values per cell
+#pragma omp parallel for num_threads(mp_cores)
+    for (int64_t i = 0; i < n_points; ++i)
+    {
+        const int64_t cell = get_cell_index(size_t(i));
+        cell_indices[i]    = cell;
+
+        if (cell >= 0)
+        {
+#pragma omp atomic
+            cell_counts[cell] += 1;
+        }
+    }
+
+    // cumulative sum: cell_offsets[c] is the position of the first value of cell c
+    for (size_t c = 0; c < n_cells; ++c)
+        cell_offsets.unchecked(c + 1) += cell_offsets.unchecked(c);
+
+    // scatter values (stable)
+    xt::xtensor<t_value, 1> values = xt::empty<t_value>({ cell_offsets.unchecked(n_cells) });
+    std::vector<size_t>     write_pos(cell_offsets.begin(), cell_offsets.end() - 1);
+
+    for (int64_t i = 0; i < n_points; ++i)
+    {
+        const int64_t cell = cell_indices[i];
+        if (cell >= 0)
+            values.unchecked(write_pos[cell]++) = sv[i];
+    }
+
+    return { std::move(cell_offsets), std::move(values) };
+}
+} // namespace detail
+
+/**
+ * @brief Group the values sv into the cells of a 3D grid using a counting sort. In contrast to
+ * group_blocks, the result is stored in a compressed (CSR) layout without per cell
+ * allocations: the values of cell c are values[cell_offsets[c]:cell_offsets[c+1]] where c is
+ * the row major (flat) index of the cell in the grid images: c = (ix * ny + iy) * nz + iz.
+ * Within a cell the values keep their input order. Non-finite values and values outside the
+ * grid are ignored.
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sz z values
+ * @param sv values
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param zmin z value of the first grid cell
+ * @param zres grid resolution in z
+ * @param nz number of grid cells in z
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<value_type, 1>> cell_offsets (size
+ * nx * ny * nz + 1), values
+ */
+template<typename t_vector, std::floating_point t_float, std::integral t_int>
+inline auto group_blocks_csr(const t_vector& sx,
+                             const t_vector& sy,
+                             const t_vector& sz,
+                             const t_vector& sv,
+                             const t_float   xmin,
+                             const t_float   xres,
+                             const t_int     nx,
+                             const t_float   ymin,
+                             const t_float   yres,
+                             const t_int     ny,
+                             const t_float   zmin,
+                             const t_float   zres,
+                             const t_int     nz,
+                             const int       mp_cores = 1)
+{
+    auto get_cell_index = [&](size_t i) -> int64_t {
+        if (!std::isfinite(sv[i]))
+            return -1;
+
+        const int ix = get_index(sx[i], xmin, xres);
+        const int iy = get_index(sy[i], ymin, yres);
+        const int iz = get_index(sz[i], zmin, zres);
+
+        if (ix < 0 || iy < 0 || iz < 0)
+            return -1;
+        if (ix >= nx || iy >= ny || iz >= nz)
+            return -1;
+
+        return (int64_t(ix) * ny + iy) * nz + iz;
+    };
+
+    const size_t n_cells =
+        static_cast<size_t>(nx) * static_cast<size_t>(ny) * static_cast<size_t>(nz);
+
+    return detail::group_blocks_csr(sv, n_cells, get_cell_index, mp_cores);
+}
+
+/**
+ * @brief Group the values sv into the cells of a 2D grid using a counting sort (CSR layout).
+ * The values of cell c = ix * ny + iy are values[cell_offsets[c]:cell_offsets[c+1]].
+ * See the 3D overload for details.
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sv values
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<value_type, 1>> cell_offsets (size
+ * nx * ny + 1), values
+ */
+template<typename t_vector, std::floating_point t_float, std::integral t_int>
+inline auto group_blocks_csr(const t_vector& sx,
+                             const t_vector& sy,
+                             const t_vector& sv,
+                             const t_float   xmin,
+                             const t_float   xres,
+                             const t_int     nx,
+                             const t_float   ymin,
+                             const t_float   yres,
+                             const t_int     ny,
+                             const int       mp_cores = 1)
+{
+    auto get_cell_index = [&](size_t i) -> int64_t {
+        if (!std::isfinite(sv[i]))
+            return -1;
+
+        const int ix = get_index(sx[i], xmin, xres);
+        const int iy = get_index(sy[i], ymin, yres);
+
+        if (ix < 0 || iy < 0)
+            return -1;
+        if (ix >= nx || iy >= ny)
+            return -1;
+
+        return int64_t(ix) * ny + iy;
+    };
+
+    const size_t n_cells = static_cast<size_t>(nx) * static_cast<size_t>(ny);
+
+    return detail::group_blocks_csr(sv, n_cells, get_cell_index, mp_cores);
+}
+
+/**
+ * @brief Group the values sv into the cells of a 1D grid using a counting sort (CSR layout).
+ * The values of cell ix are values[cell_offsets[ix]:cell_offsets[ix+1]].
+ * See the 3D overload for details.
+ *
+ * @param sx x values
+ * @param sv values
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param mp_cores Number of cores to use for parallelization
+ * @return std::tuple<xt::xtensor<size_t, 1>, xt::xtensor<value_type, 1>> cell_offsets (size
+ * nx + 1), values
+ */
+template<typename t_vector, std::floating_point t_float, std::integral t_int>
+inline auto group_blocks_csr(const t_vector& sx,
+                             const t_vector& sv,
+                             const t_float   xmin,
+                             const t_float   xres,
+                             const t_int     nx,
+                             const int       mp_cores = 1)
+{
+    auto get_cell_index = [&](size_t i) -> int64_t {
+        if (!std::isfinite(sv[i]))
+            return -1;
+
+        const int ix = get_index(sx[i], xmin, xres);
+
+        if (ix < 0 || ix >= nx)
+            return -1;
+
+        return ix;
+    };
+
+    return detail::group_blocks_csr(sv, static_cast<size_t>(nx), get_cell_index, mp_cores);
+}
+
 template<std::floating_point t_float>
 inline auto get_index_weights(const t_float frac_x, const t_float frac_y, const t_float frac_z)
     -> std::
@@ -315,10 +649,723 @@ inline auto get_index_weights(const t_float frac_x, const t_float frac_y, const
     return { X, Y, Z, WEIGHT };
 }
 
+namespace detail {
+/**
+ * @brief Range of rows (indices along the partition axis, usually the first image axis) that a
+ * point with the fractional indices frac_first ... frac_last along that axis may write to (see
+ * scatter_points). The range is clipped to [0, n - 1]. Points outside the grid (or with
+ * non-finite fractions) return {0, 0}, as they do not write to the images.
+ *
+ * @param frac_first smallest fractional index of the point footprint
+ * @param frac_last largest fractional index of the point footprint
+ * @param n number of rows
+ * @return std::pair<size_t, size_t> first and last row (inclusive)
+ */
+template<std::floating_point t_float, std::integral t_int>
+inline std::pair<size_t, size_t> get_row_range(const t_float frac_first,
+                                               const t_float frac_last,
+                                               const t_int   n)
+{
+    // clamp in floating point before converting (also catches non-finite fractions)
+    const t_float first = std::floor(frac_first);
+    const t_float last  = std::ceil(frac_last);
+    if (!(first <= t_float(n - 1)) || !(last >= t_float(0)))
+        return { 0, 0 };
+
+    return { size_t(std::max(first, t_float(0))), size_t(std::min(last, t_float(n - 1))) };
+}
+
+/**
+ * @brief Image proxy used by scatter_points for the t_accumulator path: the rows
+ * [first_row, first_row + n) of a row major image, stored in a (reused) buffer of partial sums.
+ * Cells are accessed via unchecked (or grid_cell) with image (not tile) indices.
+ */
+template<typename t_partial, size_t N>
+struct RowTile
+{
+    t_partial*                  data;
+    const size_t                first_row;
+    const std::array<size_t, N> strides;
+
+    template<typename... t_index>
+    t_partial& unchecked(const t_index... index) const
+    {
+        static_assert(sizeof...(t_index) == N, "RowTile: wrong number of indices");
+
+        const std::array<size_t, N> i{ size_t(index)... };
+        size_t                      offset = (i[0] - first_row) * strides[0];
+        for (size_t d = 1; d < N; ++d)
+            offset += i[d] * strides[d];
+        return data[offset];
+    }
+};
+
+/**
+ * @brief Scatter n_points into image_values / image_weights using mp_cores threads.
+ *
+ * For mp_cores > 1 the rows (see get_rows) are split into a few slabs per thread and the points
+ * are sorted into buckets (stable counting sort, one size_t per point): points within one slab,
+ * points that straddle two neighbouring slabs and (rare) points that span more slabs. The slab
+ * buckets are scattered in parallel directly into the images, followed by the straddling
+ * buckets (even and odd slab pairs in two parallel rounds) and the remaining points (serial).
+ * Concurrently scattered buckets never share a row, so no private image copies and no
+ * reduction are needed. The result is deterministic for a given mp_cores and only differs from
+ * the serial path by the floating point summation order.
+ *
+ * For mp_cores <= 1 (and no t_accumulator) the points are scattered directly into the images.
+ *
+ * @tparam t_accumulator void or a value type used to bound the accumulation error if it differs
+ * from the image value type (e.g. double for float images). scatter_point must then access the
+ * images via unchecked (or grid_cell) and the images must be row major with the rows as first
+ * axis. The points are then always bucketed as described above (also for mp_cores <= 1) and the
+ * slabs are made small enough that a slab covers at most about max_tile_cells cells per image
+ * (at least one row). Each bucket is accumulated into t_accumulator buffers that cover only the
+ * rows of the bucket and are added to the images with a single rounding per cell. The buffers
+ * are allocated once per thread and reused, so the extra memory is about
+ * 2 * 2 * max_tile_cells * sizeof(t_accumulator) per thread (2 MB for double), independent of
+ * the image size. Only the (rare) points that span more than two slabs are accumulated into a
+ * buffer that covers all their rows; this never happens for the weighted and block mean
+ * kernels, whose points write to at most two neighbouring rows.
+ * @tparam t_xtensor tensor type of the images
+ * @tparam t_scatter callable (size_t index, auto& values, auto& weights) that adds the point
+ * "index" to the given images
+ * @tparam t_get_rows callable (size_t index) -> std::pair<size_t, size_t> first and last row
+ * (inclusive) that the point "index" may write to (see get_row_range)
+ * @param n_points number of points
+ * @param image_values image with values (will be edited inplace)
+ * @param image_weights image with weights (will be edited inplace)
+ * @param scatter_point callable that scatters a single point
+ * @param n_rows number of rows of the partition axis. Points with disjoint row ranges must
+ * write to disjoint cells (e.g. rows = indices along the first image axis)
+ * @param get_rows callable that returns the row range of a single point
+ * @param mp_cores number of cores to use for parallelization
+ */
+template<typename t_accumulator = void,
+         typename t_xtensor,
+         typename t_scatter,
+         typename t_get_rows>
+inline void scatter_points(const size_t      n_points,
+                           t_xtensor&        image_values,
+                           t_xtensor&        image_weights,
+                           const t_scatter&  scatter_point,
+                           const size_t      n_rows,
+                           const t_get_rows& get_rows,
+                           const int         mp_cores)
+{
+    using t_value   = typename t_xtensor::value_type;
+    using t_partial = std::conditional_t<std::is_void_v<t_accumulator>, t_value, t_accumulator>;
+
+    static constexpr size_t N            = std::tuple_size_v<typename t_xtensor::shape_type>;
+    static constexpr bool   use_partials = !std::is_same_v<t_partial, t_value>;
+
+    // t_accumulator path: maximum number of cells per image of a slab (at least one row)
+    static constexpr size_t max_tile_cells = size_t(1) << 16;
+
+    if (n_points == 0)
+        return;
+
+    if constexpr (use_partials)
+    {
+        if (n_rows != size_t(image_values.shape()[0]))
+            throw std::runtime_error(
+                fmt::format("ERROR[scatter_points]: t_accumulator requires the rows to be the "
+                            "first image axis (n_rows: {}, image rows: {})",
+                            n_rows,
+                            image_values.shape()[0]));
+
+        if (image_values.size() == 0)
+            return;
+    }
+    else if (mp_cores <= 1 || n_points < 2 || n_rows < 2)
+    {
+        for (size_t i = 0; i < n_points; ++i)
+            scatter_point(i, image_values, image_weights);
+        return;
+    }
+
+    const int threads =
+        static_cast<int>(std::min({ size_t(std::max(mp_cores, 1)), n_points, n_rows }));
+
+    // slab s covers the rows [slab_begin[s], slab_begin[s + 1])
+    size_t n_slabs = threads > 1 ? std::min(n_rows, size_t(threads) * 4) : 1;
+    if constexpr (use_partials)
+        n_slabs = std::min(n_rows,
+                           std::max(n_slabs,
+                                    (image_values.size() + max_tile_cells - 1) / max_tile_cells));
+
+    std::vector<size_t> slab_begin(n_slabs + 1);
+    for (size_t s = 0; s <= n_slabs; ++s)
+        slab_begin[s] = n_rows * s / n_slabs;
+
+    auto get_slab = [&](size_t row) {
+        return size_t(std::upper_bound(slab_begin.begin() + 1, slab_begin.end(), row) -
+                      slab_begin.begin() - 1);
+    };
+
+    // buckets: [0, n_slabs) single slab, [n_slabs, 2 * n_slabs - 1) slab s and s + 1,
+    // 2 * n_slabs - 1: more than two slabs
+    const size_t n_buckets  = 2 * n_slabs;
+    auto         get_bucket = [&](size_t i) {
+        const auto [first_row, last_row] = get_rows(i);
+        const size_t first = get_slab(std::min(first_row, n_rows - 1));
+        const size_t last  = get_slab(std::min(std::max(first_row, last_row), n_rows - 1));
+
+        if (first == last)
+            return first;
+        if (last == first + 1)
+            return n_slabs + first;
+        return n_buckets - 1;
+    };
+
+    // stable counting sort of the points into the buckets (point chunks per thread)
+    std::vector<size_t> bucket_offsets(n_buckets * threads + 1, 0);
+
+#pragma omp parallel for num_threads(threads) schedule(static, 1)
+    for (int t = 0; t < threads; ++t)
+    {
+        const size_t i_begin = n_points * size_t(t) / size_t(threads);
+        const size_t i_end   = n_points * size_t(t + 1) / size_t(threads);
+
+        for (size_t i = i_begin; i < i_end; ++i)
+            ++bucket_offsets[get_bucket(i) * threads + t + 1];
+    }
+    for (size_t k = 1; k < bucket_offsets.size(); ++k)
+        bucket_offsets[k] += bucket_offsets[k - 1];
+
+    std::vector<size_t> bucket_points(n_points);
+
+#pragma omp parallel for num_threads(threads) schedule(static, 1)
+    for (int t = 0; t < threads; ++t)
+    {
+        const size_t i_begin = n_points * size_t(t) / size_t(threads);
+        const size_t i_end   = n_points * size_t(t + 1) / size_t(threads);
+
+        std::vector<size_t> fill(n_buckets);
+        for (size_t b = 0; b < n_buckets; ++b)
+            fill[b] = bucket_offsets[b * threads + t];
+
+        for (size_t i = i_begin; i < i_end; ++i)
+            bucket_points[fill[get_bucket(i)]++] = i;
+    }
+
+    // row major strides of the images (t_accumulator path)
+    std::array<size_t, N> strides;
+    strides[N - 1] = 1;
+    for (size_t d = N - 1; d > 0; --d)
+        strides[d - 1] = strides[d] * size_t(image_values.shape()[d]);
+
+#pragma omp parallel num_threads(threads)
+    {
+        // partial sums of the current bucket (t_accumulator path), reused by this thread
+        std::vector<t_partial> tile_values, tile_weights;
+
+        // scatter bucket b, whose points write to the rows [first_row, end_row)
+        auto scatter_bucket = [&](size_t b, size_t first_row, size_t end_row) {
+            const size_t k_begin = bucket_offsets[b * threads];
+            const size_t k_end   = bucket_offsets[(b + 1) * threads];
+            if (k_begin == k_end)
+                return;
+
+            if constexpr (use_partials)
+            {
+                const size_t n_cells = (end_row - first_row) * strides[0];
+                if (tile_values.size() < n_cells)
+                {
+                    tile_values.resize(n_cells);
+                    tile_weights.resize(n_cells);
+                }
+                std::fill_n(tile_values.begin(), n_cells, t_partial(0));
+                std::fill_n(tile_weights.begin(), n_cells, t_partial(0));
+
+                const RowTile<t_partial, N> values{ tile_values.data(), first_row, strides };
+                const RowTile<t_partial, N> weights{ tile_weights.data(), first_row, strides };
+                for (size_t k = k_begin; k < k_end; ++k)
+                    scatter_point(bucket_points[k], values, weights);
+
+                // add the tile to the image rows (single rounding per cell)
+                auto* image_values_data  = image_values.data() + first_row * strides[0];
+                auto* image_weights_data = image_weights.data() + first_row * strides[0];
+                for (size_t j = 0; j < n_cells; ++j)
+                {
+                    image_values_data[j] =
+                        t_value(t_partial(image_values_data[j]) + tile_values[j]);
+                    image_weights_data[j] =
+                        t_value(t_partial(image_weights_data[j]) + tile_weights[j]);
+                }
+            }
+            else
+            {
+                for (size_t k = k_begin; k < k_end; ++k)
+                    scatter_point(bucket_points[k], image_values, image_weights);
+            }
+        };
+
+#pragma omp for schedule(dynamic)
+        for (int64_t s = 0; s < int64_t(n_slabs); ++s)
+            scatter_bucket(size_t(s), slab_begin[s], slab_begin[s + 1]);
+
+        // straddling points: slab pairs (s, s + 1) with even s, then odd s
+        for (size_t parity = 0; parity < 2; ++parity)
+        {
+            const int64_t n_pairs = int64_t(n_slabs - parity) / 2;
+
+#pragma omp for schedule(dynamic)
+            for (int64_t k = 0; k < n_pairs; ++k)
+            {
+                const size_t s = parity + 2 * size_t(k);
+                scatter_bucket(n_slabs + s, slab_begin[s], slab_begin[s + 2]);
+            }
+        }
+
+        // remaining points: rows of all points in the bucket
+#pragma omp single
+        {
+            size_t first_row = n_rows, last_row = 0;
+            for (size_t k = bucket_offsets[(n_buckets - 1) * threads]; k < n_points; ++k)
+            {
+                const auto [first, last] = get_rows(bucket_points[k]);
+                first_row                = std::min(first_row, std::min(first, n_rows - 1));
+                last_row = std::max(last_row, std::min(std::max(first, last), n_rows - 1));
+            }
+            scatter_bucket(n_buckets - 1, first_row, last_row + 1);
+        }
+    }
+}
+} // namespace detail
+
+// --- dimension generic (N-D) kernels ---
+
+/**
+ * @brief Compute the 2^N surrounding grid cells and their interpolation weights for a point with
+ * the given (fractional) grid indices. The cells are ordered with the first dimension varying
+ * slowest (same order as the 1D, 2D and 3D versions of get_index_weights).
+ *
+ * @tparam N number of dimensions
+ * @param fractions fractional grid indices (see get_index_fraction) of the point
+ * @return std::tuple<std::array<std::array<int, N>, 2^N>, std::array<t_float, 2^N>> cell
+ * indices, weights
+ */
+template<size_t N, std::floating_point t_float>
+inline auto get_index_weights_nd(const std::array<t_float, N>& fractions)
+    -> std::tuple<std::array<std::array<int, N>, (size_t(1) << N)>,
+                  std::array<t_float, (size_t(1) << N)>>
+{
+    static constexpr size_t n_corners = size_t(1) << N;
+
+    std::array<t_float, N> lower_weights, upper_weights;
+    std::array<int, N>     lower_indices, upper_indices;
+    for (size_t d = 0; d < N; ++d)
+    {
+        upper_weights[d] = fractions[d] - std::floor(fractions[d]);
+        lower_weights[d] = 1.0 - upper_weights[d];
+        lower_indices[d] = static_cast<int>(std::floor(fractions[d]));
+        upper_indices[d] = static_cast<int>(std::ceil(fractions[d]));
+    }
+
+    std::array<std::array<int, N>, n_corners> INDEX;
+    std::array<t_float, n_corners>            WEIGHT;
+    for (size_t corner = 0; corner < n_corners; ++corner)
+    {
+        // bit N-1-d of corner selects the upper cell of dimension d
+        for (size_t d = 0; d < N; ++d)
+        {
+            const bool    upper = (corner >> (N - 1 - d)) & 1;
+            const t_float w     = upper ? upper_weights[d] : lower_weights[d];
+
+            INDEX[corner][d] = upper ? upper_indices[d] : lower_indices[d];
+            WEIGHT[corner]   = d == 0 ? w : WEIGHT[corner] * w;
+        }
+    }
+
+    return { INDEX, WEIGHT };
+}
+
+namespace detail {
+/**
+ * @brief Return the N coordinates of point i from a coordinate array with shape (N, n_points)
+ */
+template<size_t N, typename t_xtensor_2d>
+inline auto get_nd_coordinates(const t_xtensor_2d& s_coordinates, const size_t i)
+{
+    std::array<typename t_xtensor_2d::value_type, N> coordinates;
+    for (size_t d = 0; d < N; ++d)
+        coordinates[d] = s_coordinates.unchecked(d, i);
+    return coordinates;
+}
+
+/**
+ * @brief Throw if the coordinates / values / images do not fit each other
+ */
+template<size_t N, typename t_xtensor_2d, typename t_vector, typename t_int, typename t_xtensor>
+inline void check_nd_input(const t_xtensor_2d&         s_coordinates,
+                           const t_vector&             sv,
+                           const std::array<t_int, N>& ns,
+                           const t_xtensor&            image_values,
+                           const t_xtensor&            image_weights,
+                           const std::string&          function_name)
+{
+    if (s_coordinates.shape()[0] != N || s_coordinates.shape()[1] != sv.size())
+        throw std::runtime_error(
+            fmt::format("ERROR[{}]: s_coordinates must have the shape ({}, {}) but has ({}, {})",
+                        function_name,
+                        N,
+                        sv.size(),
+                        s_coordinates.shape()[0],
+                        s_coordinates.shape()[1]));
+
+    for (size_t d = 0; d < N; ++d)
+        if (image_values.shape()[d] != size_t(ns[d]) || image_weights.shape()[d] != size_t(ns[d]))
+            throw std::runtime_error(fmt::format(
+                "ERROR[{}]: image dimension {} does not fit the number of grid cells ({})",
+                function_name,
+                d,
+                ns[d]));
+}
+
+/**
+ * @brief Return true if all indices are within [0, n)
+ */
+template<size_t N, std::integral t_int>
+inline bool is_inside_grid(const std::array<int, N>& index, const std::array<t_int, N>& n)
+{
+    for (size_t d = 0; d < N; ++d)
+        if (index[d] < 0 || index[d] >= n[d])
+            return false;
+    return true;
+}
+
+/**
+ * @brief Access the cell "index" of an N dimensional image (unchecked)
+ */
+template<size_t N, typename t_xtensor>
+inline decltype(auto) grid_cell(t_xtensor& image, const std::array<int, N>& index)
+{
+    return std::apply([&](auto... i) -> decltype(auto) { return image.unchecked(i...); }, index);
+}
+
+/**
+ * @brief Call add_to_cell(cell, weight) for each of the 2^N corner cells of a weighted mean
+ * interpolation that lies inside the grid and has a non zero weight. This is the corner / bounds
+ * logic shared by for_each_weighted_mean_cell and the xsimd kernel (grd_weighted_mean_xsimd_nd).
+ * If all corners lie inside the grid, the per corner bounds checks are skipped.
+ *
+ * @param lower lower corner cell (floor of the fractional grid indices)
+ * @param get_weight callable (size_t corner) -> weight of the corner (corners ordered as in
+ * get_index_weights_nd)
+ * @param ns number of grid cells per dimension
+ * @param add_to_cell callable (const std::array<int, N>& index, t_float weight)
+ */
+template<size_t N, std::integral t_int, typename t_get_weight, typename t_add_to_cell>
+inline void for_each_corner_cell(const std::array<int, N>&   lower,
+                                 const t_get_weight&         get_weight,
+                                 const std::array<t_int, N>& ns,
+                                 const t_add_to_cell&        add_to_cell)
+{
+    static constexpr size_t n_corners = size_t(1) << N;
+
+    bool interior = true;
+    for (size_t d = 0; d < N; ++d)
+        interior = interior && lower[d] >= 0 && int64_t(lower[d]) + 1 < int64_t(ns[d]);
+
+    for (size_t corner = 0; corner < n_corners; ++corner)
+    {
+        const auto w = get_weight(corner);
+        if (w == 0)
+            continue;
+
+        std::array<int, N> cell;
+        for (size_t d = 0; d < N; ++d)
+            cell[d] = lower[d] + int((corner >> (N - 1 - d)) & 1);
+
+        if (!interior && !is_inside_grid(cell, ns))
+            continue;
+
+        add_to_cell(cell, w);
+    }
+}
+
+/**
+ * @brief Call add_to_cell(index, weight) for each grid cell that a point contributes to using
+ * weighted mean interpolation: the 2^N surrounding cells (see get_index_weights_nd) that lie
+ * inside the grid and have a non zero weight. This is the single implementation of the weighted
+ * mean index / weight logic that is shared by all gridders.
+ *
+ * @param coordinates coordinates of the point
+ * @param mins coordinate of the first grid cell per dimension
+ * @param ress grid resolution per dimension
+ * @param ns number of grid cells per dimension
+ * @param add_to_cell callable (const std::array<int, N>& index, t_float weight)
+ */
+template<size_t N,
+         typename t_coordinate,
+         std::floating_point t_float,
+         std::integral       t_int,
+         typename t_add_to_cell>
+inline void for_each_weighted_mean_cell(const std::array<t_coordinate, N>& coordinates,
+                                        const std::array<t_float, N>&      mins,
+                                        const std::array<t_float, N>&      ress,
+                                        const std::array<t_int, N>&        ns,
+                                        const t_add_to_cell&               add_to_cell)
+{
+    std::array<t_float, N> fractions;
+    for (size_t d = 0; d < N; ++d)
+        fractions[d] = get_index_fraction(t_float(coordinates[d]), mins[d], ress[d]);
+
+    // corner 0 is the lower corner (the upper index equals the lower index + 1 wherever the
+    // upper weight is non zero)
+    const auto [INDEX, WEIGHT] = get_index_weights_nd(fractions);
+    for_each_corner_cell(
+        INDEX[0], [&](size_t corner) { return WEIGHT[corner]; }, ns, add_to_cell);
+}
+
+/**
+ * @brief Call add_to_cell(index, 1) for the grid cell nearest to a point (block mean
+ * interpolation), if it lies inside the grid. See for_each_weighted_mean_cell.
+ */
+template<size_t N,
+         typename t_coordinate,
+         std::floating_point t_float,
+         std::integral       t_int,
+         typename t_add_to_cell>
+inline void for_each_block_mean_cell(const std::array<t_coordinate, N>& coordinates,
+                                     const std::array<t_float, N>&      mins,
+                                     const std::array<t_float, N>&      ress,
+                                     const std::array<t_int, N>&        ns,
+                                     const t_add_to_cell&               add_to_cell)
+{
+    std::array<int, N> index;
+    for (size_t d = 0; d < N; ++d)
+        index[d] = get_index(t_float(coordinates[d]), mins[d], ress[d]);
+
+    if (!is_inside_grid(index, ns))
+        return;
+
+    add_to_cell(index, t_float(1.0));
+}
+
+/**
+ * @brief Dimension generic weighted mean kernel used by all grd_weighted_mean overloads. Each
+ * point is distributed onto the 2^N surrounding grid cells (see get_index_weights_nd).
+ *
+ * @tparam N number of dimensions
+ * @tparam t_accumulator value type used for accumulation (see scatter_points)
+ * @param n_points number of points
+ * @param get_coordinates callable (size_t i) -> std::array<coordinate, N> of point i
+ * @param get_value callable (size_t i) -> value of point i (non-finite values are ignored)
+ * @param mins coordinate of the first grid cell per dimension
+ * @param ress grid resolution per dimension
+ * @param ns number of grid cells per dimension
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (see scatter_points)
+ */
+template<size_t N,
+         typename t_accumulator,
+         typename t_xtensor,
+         typename t_get_coordinates,
+         typename t_get_value,
+         std::floating_point t_float,
+         std::integral       t_int>
+inline void grd_weighted_mean_nd(const size_t                  n_points,
+                                 const t_get_coordinates&      get_coordinates,
+                                 const t_get_value&            get_value,
+                                 const std::array<t_float, N>& mins,
+                                 const std::array<t_float, N>& ress,
+                                 const std::array<t_int, N>&   ns,
+                                 t_xtensor&                    image_values,
+                                 t_xtensor&                    image_weights,
+                                 const int                     mp_cores)
+{
+    auto scatter_point = [&](size_t i, auto& values, auto& weights) {
+        const auto v = get_value(i);
+        if (!std::isfinite(v))
+            return;
+
+        for_each_weighted_mean_cell(
+            get_coordinates(i), mins, ress, ns, [&](const auto& index, const t_float w) {
+                grid_cell(values, index) += v * w;
+                grid_cell(weights, index) += w;
+            });
+    };
+
+    auto get_rows = [&](size_t i) {
+        const t_float f = get_index_fraction(t_float(get_coordinates(i)[0]), mins[0], ress[0]);
+        return get_row_range(f, f, ns[0]);
+    };
+
+    scatter_points<t_accumulator>(
+        n_points, image_values, image_weights, scatter_point, size_t(ns[0]), get_rows, mp_cores);
+}
+
+/**
+ * @brief Dimension generic block mean kernel used by all grd_block_mean overloads. Each point is
+ * added to the nearest grid cell. See grd_weighted_mean_nd for the parameters.
+ */
+template<size_t N,
+         typename t_accumulator,
+         typename t_xtensor,
+         typename t_get_coordinates,
+         typename t_get_value,
+         std::floating_point t_float,
+         std::integral       t_int>
+inline void grd_block_mean_nd(const size_t                  n_points,
+                              const t_get_coordinates&      get_coordinates,
+                              const t_get_value&            get_value,
+                              const std::array<t_float, N>& mins,
+                              const std::array<t_float, N>& ress,
+                              const std::array<t_int, N>&   ns,
+                              t_xtensor&                    image_values,
+                              t_xtensor&                    image_weights,
+                              const int                     mp_cores)
+{
+    auto scatter_point = [&](size_t i, auto& values, auto& weights) {
+        const auto v = get_value(i);
+        if (!std::isfinite(v))
+            return;
+
+        for_each_block_mean_cell(
+            get_coordinates(i), mins, ress, ns, [&](const auto& index, t_float) {
+                grid_cell(values, index) += v;
+                grid_cell(weights, index) += 1.0;
+            });
+    };
+
+    auto get_rows = [&](size_t i) {
+        const t_float f = get_index_fraction(t_float(get_coordinates(i)[0]), mins[0], ress[0]);
+        return get_row_range(f, f, ns[0]);
+    };
+
+    scatter_points<t_accumulator>(
+        n_points, image_values, image_weights, scatter_point, size_t(ns[0]), get_rows, mp_cores);
+}
+} // namespace detail
+
+/**
+ * @brief Add N dimensional points to N dimensional images using weighted mean interpolation
+ * (each point is distributed onto the 2^N surrounding grid cells, weighted by the distance to the
+ * cell centers). Equals the 1D, 2D and 3D overloads of grd_weighted_mean for N = 1, 2, 3.
+ *
+ * @tparam t_accumulator value type used for accumulation (see detail::scatter_points)
+ * @param s_coordinates coordinates of the points, shape (N, n_points)
+ * @param sv values (non-finite values are ignored)
+ * @param mins coordinate of the first grid cell per dimension
+ * @param ress grid resolution per dimension
+ * @param ns number of grid cells per dimension
+ * @param image_values N dimensional image with values will be edited inplace
+ * @param image_weights N dimensional image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<tools::helper::c_xtensor_2d t_xtensor_2d,
+         typename                    t_vector,
+         tools::helper::c_xtensor    t_xtensor,
+         size_t                      N,
+         std::floating_point         t_float,
+         std::integral               t_int,
+         typename                    t_accumulator = typename t_xtensor::value_type>
+    requires(std::tuple_size_v<typename t_xtensor::shape_type> == N)
+inline void grd_weighted_mean_nd(const t_xtensor_2d&           s_coordinates,
+                                 const t_vector&               sv,
+                                 const std::array<t_float, N>& mins,
+                                 const std::array<t_float, N>& ress,
+                                 const std::array<t_int, N>&   ns,
+                                 t_xtensor&                    image_values,
+                                 t_xtensor&                    image_weights,
+                                 const int                     mp_cores = 1)
+{
+    detail::check_nd_input(
+        s_coordinates, sv, ns, image_values, image_weights, "grd_weighted_mean_nd");
+
+    detail::grd_weighted_mean_nd<N, t_accumulator>(
+        sv.size(),
+        [&](size_t i) { return detail::get_nd_coordinates<N>(s_coordinates, i); },
+        [&](size_t i) { return sv[i]; },
+        mins,
+        ress,
+        ns,
+        image_values,
+        image_weights,
+        mp_cores);
+}
+
+/**
+ * @brief Add N dimensional points to N dimensional images using block mean interpolation (each
+ * point is added to the nearest grid cell). Equals the 1D, 2D and 3D overloads of
+ * grd_block_mean for N = 1, 2, 3.
+ *
+ * @tparam t_accumulator value type used for accumulation (see detail::scatter_points)
+ * @param s_coordinates coordinates of the points, shape (N, n_points)
+ * @param sv values (non-finite values are ignored)
+ * @param mins coordinate of the first grid cell per dimension
+ * @param ress grid resolution per dimension
+ * @param ns number of grid cells per dimension
+ * @param image_values N dimensional image with values will be edited inplace
+ * @param image_weights N dimensional image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<tools::helper::c_xtensor_2d t_xtensor_2d,
+         typename                    t_vector,
+         tools::helper::c_xtensor    t_xtensor,
+         size_t                      N,
+         std::floating_point         t_float,
+         std::integral               t_int,
+         typename                    t_accumulator = typename t_xtensor::value_type>
+    requires(std::tuple_size_v<typename t_xtensor::shape_type> == N)
+inline void grd_block_mean_nd(const t_xtensor_2d&           s_coordinates,
+                              const t_vector&               sv,
+                              const std::array<t_float, N>& mins,
+                              const std::array<t_float, N>& ress,
+                              const std::array<t_int, N>&   ns,
+                              t_xtensor&                    image_values,
+                              t_xtensor&                    image_weights,
+                              const int                     mp_cores = 1)
+{
+    detail::check_nd_input(
+        s_coordinates, sv, ns, image_values, image_weights, "grd_block_mean_nd");
+
+    detail::grd_block_mean_nd<N, t_accumulator>(
+        sv.size(),
+        [&](size_t i) { return detail::get_nd_coordinates<N>(s_coordinates, i); },
+        [&](size_t i) { return sv[i]; },
+        mins,
+        ress,
+        ns,
+        image_values,
+        image_weights,
+        mp_cores);
+}
+
+/**
+ * @brief Add xyz points to 3D images using weighted mean interpolation (each point is
+ * distributed onto the 8 surrounding grid cells, weighted by the distance to the cell centers)
+ *
+ * @tparam t_accumulator value type used for accumulation. If it differs from the image value
+ * type (e.g. double for float images), the points are accumulated into small reused row tiles
+ * of this type that are added to the images with a single rounding (see detail::scatter_points)
+ * @param sx x values
+ * @param sy y values
+ * @param sz z values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param zmin z value of the first grid cell
+ * @param zres grid resolution in z
+ * @param nz number of grid cells in z
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
 template<typename t_vector,
          tools::helper::c_xtensor_3d t_xtensor_3d,
          std::floating_point         t_float,
-         std::integral               t_int>
+         std::integral               t_int,
+         typename                    t_accumulator = typename t_xtensor_3d::value_type>
 inline void grd_weighted_mean(const t_vector& sx,
                               const t_vector& sy,
                               const t_vector& sz,
@@ -333,42 +1380,51 @@ inline void grd_weighted_mean(const t_vector& sx,
                               const t_float   zres,
                               const t_int     nz,
                               t_xtensor_3d&   image_values,
-                              t_xtensor_3d&   image_weights)
+                              t_xtensor_3d&   image_weights,
+                              const int       mp_cores = 1)
 {
-    for (size_t i = 0; i < sx.size(); ++i)
-    {
-        const auto x = sx[i], y = sy[i], z = sz[i], v = sv[i];
-        if (std::isfinite(v))
-        {
-            const auto [X, Y, Z, WEIGHT] = get_index_weights(get_index_fraction(x, xmin, xres),
-                                                             get_index_fraction(y, ymin, yres),
-                                                             get_index_fraction(z, zmin, zres));
-
-            for (size_t idx = 0; idx < 8; ++idx)
-            {
-                const auto ix = X[idx];
-                const auto iy = Y[idx];
-                const auto iz = Z[idx];
-                const auto w  = WEIGHT[idx];
-                if (w == t_float(0.0))
-                    continue;
-
-                if (ix < 0 || iy < 0 || iz < 0)
-                    continue;
-                if (ix >= nx || iy >= ny || iz >= nz)
-                    continue;
-
-                image_values.unchecked(ix, iy, iz) += v * w;
-                image_weights.unchecked(ix, iy, iz) += w;
-            }
-        }
-    }
+    detail::grd_weighted_mean_nd<3, t_accumulator>(
+        sx.size(),
+        [&](size_t i) { return std::array{ sx[i], sy[i], sz[i] }; },
+        [&](size_t i) { return sv[i]; },
+        std::array{ xmin, ymin, zmin },
+        std::array{ xres, yres, zres },
+        std::array{ nx, ny, nz },
+        image_values,
+        image_weights,
+        mp_cores);
 }
 
+/**
+ * @brief Add xyz points to 3D images using block mean interpolation (each point is added to
+ * the nearest grid cell)
+ *
+ * @tparam t_accumulator value type used for accumulation. If it differs from the image value
+ * type (e.g. double for float images), the points are accumulated into small reused row tiles
+ * of this type that are added to the images with a single rounding (see detail::scatter_points)
+ * @param sx x values
+ * @param sy y values
+ * @param sz z values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param zmin z value of the first grid cell
+ * @param zres grid resolution in z
+ * @param nz number of grid cells in z
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
 template<typename t_vector,
          tools::helper::c_xtensor_3d t_xtensor_3d,
          std::floating_point         t_float,
-         std::integral               t_int>
+         std::integral               t_int,
+         typename                    t_accumulator = typename t_xtensor_3d::value_type>
 inline void grd_block_mean(const t_vector& sx,
                            const t_vector& sy,
                            const t_vector& sz,
@@ -383,27 +1439,19 @@ inline void grd_block_mean(const t_vector& sx,
                            const t_float   zres,
                            const t_int     nz,
                            t_xtensor_3d&   image_values,
-                           t_xtensor_3d&   image_weights)
+                           t_xtensor_3d&   image_weights,
+                           const int       mp_cores = 1)
 {
-    for (size_t i = 0; i < sx.size(); ++i)
-    {
-        const auto x = sx[i], y = sy[i], z = sz[i], v = sv[i];
-
-        if (std::isfinite(v))
-        {
-            const int ix = get_index(x, xmin, xres);
-            const int iy = get_index(y, ymin, yres);
-            const int iz = get_index(z, zmin, zres);
-
-            if (ix < 0 || iy < 0 || iz < 0)
-                continue;
-            if (ix >= nx || iy >= ny || iz >= nz)
-                continue;
-
-            image_values.unchecked(ix, iy, iz) += v;
-            image_weights.unchecked(ix, iy, iz) += 1.0;
-        }
-    }
+    detail::grd_block_mean_nd<3, t_accumulator>(
+        sx.size(),
+        [&](size_t i) { return std::array{ sx[i], sy[i], sz[i] }; },
+        [&](size_t i) { return sv[i]; },
+        std::array{ xmin, ymin, zmin },
+        std::array{ xres, yres, zres },
+        std::array{ nx, ny, nz },
+        image_values,
+        image_weights,
+        mp_cores);
 }
 
 /* 2D overloads */
@@ -432,10 +1480,32 @@ inline auto get_index_weights(const t_float frac_x, const t_float frac_y)
     return { X, Y, W };
 }
 
+/**
+ * @brief Add xy points to 2D images using weighted mean interpolation (each point is
+ * distributed onto the 4 surrounding grid cells, weighted by the distance to the cell centers)
+ *
+ * @tparam t_accumulator value type used for accumulation. If it differs from the image value
+ * type (e.g. double for float images), the points are accumulated into small reused row tiles
+ * of this type that are added to the images with a single rounding (see detail::scatter_points)
+ * @param sx x values
+ * @param sy y values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
 template<typename t_vector,
          tools::helper::c_xtensor_2d t_xtensor_2d,
          std::floating_point         t_float,
-         std::integral               t_int>
+         std::integral               t_int,
+         typename                    t_accumulator = typename t_xtensor_2d::value_type>
 inline void grd_weighted_mean(const t_vector& sx,
                               const t_vector& sy,
                               const t_vector& sv,
@@ -446,36 +1516,47 @@ inline void grd_weighted_mean(const t_vector& sx,
                               const t_float   yres,
                               const t_int     ny,
                               t_xtensor_2d&   image_values,
-                              t_xtensor_2d&   image_weights)
+                              t_xtensor_2d&   image_weights,
+                              const int       mp_cores = 1)
 {
-    for (size_t i = 0; i < sx.size(); ++i)
-    {
-        const auto x = sx[i], y = sy[i], v = sv[i];
-        if (std::isfinite(v))
-        {
-            const auto [X, Y, W] = get_index_weights(get_index_fraction(x, xmin, xres),
-                                                     get_index_fraction(y, ymin, yres));
-            for (size_t idx = 0; idx < 4; ++idx)
-            {
-                const auto ix = X[idx];
-                const auto iy = Y[idx];
-                const auto w  = W[idx];
-                if (w == t_float(0.0))
-                    continue;
-                if (ix < 0 || iy < 0 || ix >= nx || iy >= ny)
-                    continue;
-
-                image_values.unchecked(ix, iy) += v * w;
-                image_weights.unchecked(ix, iy) += w;
-            }
-        }
-    }
+    detail::grd_weighted_mean_nd<2, t_accumulator>(
+        sx.size(),
+        [&](size_t i) { return std::array{ sx[i], sy[i] }; },
+        [&](size_t i) { return sv[i]; },
+        std::array{ xmin, ymin },
+        std::array{ xres, yres },
+        std::array{ nx, ny },
+        image_values,
+        image_weights,
+        mp_cores);
 }
 
+/**
+ * @brief Add xy points to 2D images using block mean interpolation (each point is added to the
+ * nearest grid cell)
+ *
+ * @tparam t_accumulator value type used for accumulation. If it differs from the image value
+ * type (e.g. double for float images), the points are accumulated into small reused row tiles
+ * of this type that are added to the images with a single rounding (see detail::scatter_points)
+ * @param sx x values
+ * @param sy y values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
 template<typename t_vector,
          tools::helper::c_xtensor_2d t_xtensor_2d,
          std::floating_point         t_float,
-         std::integral               t_int>
+         std::integral               t_int,
+         typename                    t_accumulator = typename t_xtensor_2d::value_type>
 inline void grd_block_mean(const t_vector& sx,
                            const t_vector& sy,
                            const t_vector& sv,
@@ -486,22 +1567,19 @@ inline void grd_block_mean(const t_vector& sx,
                            const t_float   yres,
                            const t_int     ny,
                            t_xtensor_2d&   image_values,
-                           t_xtensor_2d&   image_weights)
+                           t_xtensor_2d&   image_weights,
+                           const int       mp_cores = 1)
 {
-    for (size_t i = 0; i < sx.size(); ++i)
-    {
-        const auto x = sx[i], y = sy[i], v = sv[i];
-        if (std::isfinite(v))
-        {
-            const int ix = get_index(x, xmin, xres);
-            const int iy = get_index(y, ymin, yres);
-            if (ix < 0 || iy < 0 || ix >= nx || iy >= ny)
-                continue;
-
-            image_values.unchecked(ix, iy) += v;
-            image_weights.unchecked(ix, iy) += 1.0;
-        }
-    }
+    detail::grd_block_mean_nd<2, t_accumulator>(
+        sx.size(),
+        [&](size_t i) { return std::array{ sx[i], sy[i] }; },
+        [&](size_t i) { return sv[i]; },
+        std::array{ xmin, ymin },
+        std::array{ xres, yres },
+        std::array{ nx, ny },
+        image_values,
+        image_weights,
+        mp_cores);
 }
 
 /* 1D overloads */
@@ -521,65 +1599,1093 @@ inline auto get_index_weights(const t_float frac_x)
     return { X, W };
 }
 
+/**
+ * @brief Add x points to a 1D image using weighted mean interpolation (each point is
+ * distributed onto the 2 surrounding grid cells, weighted by the distance to the cell centers)
+ *
+ * @tparam t_accumulator value type used for accumulation. If it differs from the image value
+ * type (e.g. double for float images), the points are accumulated into small reused row tiles
+ * of this type that are added to the images with a single rounding (see detail::scatter_points)
+ * @param sx x values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
 template<typename t_vector,
          tools::helper::c_xtensor_1d t_xtensor_1d,
          std::floating_point         t_float,
-         std::integral               t_int>
+         std::integral               t_int,
+         typename                    t_accumulator = typename t_xtensor_1d::value_type>
 inline void grd_weighted_mean(const t_vector& sx,
                               const t_vector& sv,
                               const t_float   xmin,
                               const t_float   xres,
                               const t_int     nx,
                               t_xtensor_1d&   image_values,
-                              t_xtensor_1d&   image_weights)
+                              t_xtensor_1d&   image_weights,
+                              const int       mp_cores = 1)
 {
-    for (size_t i = 0; i < sx.size(); ++i)
-    {
-        const auto x = sx[i], v = sv[i];
-        if (std::isfinite(v))
-        {
-            const auto [X, W] = get_index_weights(get_index_fraction(x, xmin, xres));
-            for (size_t idx = 0; idx < 2; ++idx)
-            {
-                const auto ix = X[idx];
-                const auto w  = W[idx];
-                if (w == t_float(0.0))
-                    continue;
-                if (ix < 0 || ix >= nx)
-                    continue;
-
-                image_values.unchecked(ix) += v * w;
-                image_weights.unchecked(ix) += w;
-            }
-        }
-    }
+    detail::grd_weighted_mean_nd<1, t_accumulator>(
+        sx.size(),
+        [&](size_t i) { return std::array{ sx[i] }; },
+        [&](size_t i) { return sv[i]; },
+        std::array{ xmin },
+        std::array{ xres },
+        std::array{ nx },
+        image_values,
+        image_weights,
+        mp_cores);
 }
 
+/**
+ * @brief Add x points to a 1D image using block mean interpolation (each point is added to the
+ * nearest grid cell)
+ *
+ * @tparam t_accumulator value type used for accumulation. If it differs from the image value
+ * type (e.g. double for float images), the points are accumulated into small reused row tiles
+ * of this type that are added to the images with a single rounding (see detail::scatter_points)
+ * @param sx x values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
 template<typename t_vector,
          tools::helper::c_xtensor_1d t_xtensor_1d,
          std::floating_point         t_float,
-         std::integral               t_int>
+         std::integral               t_int,
+         typename                    t_accumulator = typename t_xtensor_1d::value_type>
 inline void grd_block_mean(const t_vector& sx,
                            const t_vector& sv,
                            const t_float   xmin,
                            const t_float   xres,
                            const t_int     nx,
                            t_xtensor_1d&   image_values,
-                           t_xtensor_1d&   image_weights)
+                           t_xtensor_1d&   image_weights,
+                           const int       mp_cores = 1)
 {
-    for (size_t i = 0; i < sx.size(); ++i)
-    {
-        const auto x = sx[i], v = sv[i];
-        if (std::isfinite(v))
+    detail::grd_block_mean_nd<1, t_accumulator>(
+        sx.size(),
+        [&](size_t i) { return std::array{ sx[i] }; },
+        [&](size_t i) { return sv[i]; },
+        std::array{ xmin },
+        std::array{ xres },
+        std::array{ nx },
+        image_values,
+        image_weights,
+        mp_cores);
+}
+
+// --- xsimd backend for grd_weighted_mean ---
+
+namespace detail {
+/**
+ * @brief Copy the values i0 ... i0 + lanes.size() of s into lanes. Lanes beyond the end of s are
+ * set to fill_value.
+ *
+ * @param s input vector
+ * @param i0 index of the first value
+ * @param lanes output array (one element per simd lane)
+ * @param fill_value value for lanes beyond the end of s
+ */
+template<typename t_vector, typename t_float, size_t simd_size>
+inline void load_lanes(const t_vector&                 s,
+                       const size_t                    i0,
+                       std::array<t_float, simd_size>& lanes,
+                       const t_float                   fill_value)
+{
+    const size_t n = std::min(simd_size, size_t(s.size()) - i0);
+
+    for (size_t k = 0; k < n; ++k)
+        lanes[k] = static_cast<t_float>(s[i0 + k]);
+    for (size_t k = n; k < simd_size; ++k)
+        lanes[k] = fill_value;
+}
+
+/**
+ * @brief Compute the lower grid index (floor) and the upper / lower interpolation weights for
+ * one axis of a batch of points. This is the vectorized equivalent of get_index_fraction and
+ * the floor / fraction part of get_index_weights.
+ *
+ * @param lanes coordinates of the batch
+ * @param grd_val_min value of the first grid cell
+ * @param grd_res grid resolution
+ * @param index lower grid index (floor) per lane (output)
+ * @param w0 weight of the lower grid cell (1 - fraction)
+ * @param w1 weight of the upper grid cell (fraction)
+ */
+template<typename t_float, size_t simd_size>
+inline void axis_index_weights(const std::array<t_float, simd_size>& lanes,
+                               const t_float                          grd_val_min,
+                               const t_float                          grd_res,
+                               std::array<t_float, simd_size>&        index,
+                               xsimd::batch<t_float>&                 w0,
+                               xsimd::batch<t_float>&                 w1)
+{
+    using t_batch = xsimd::batch<t_float>;
+
+    const t_batch frac  = (t_batch::load_unaligned(lanes.data()) - grd_val_min) / grd_res;
+    const t_batch floor = xsimd::floor(frac);
+
+    w1 = frac - floor;
+    w0 = t_float(1.0) - w1;
+    floor.store_unaligned(index.data());
+}
+
+/**
+ * @brief Dimension generic xsimd kernel used by all grd_weighted_mean_xsimd overloads. The
+ * fractions, lower corner indices and the 2^N corner weights are computed for a batch of
+ * xsimd::batch<t_float>::size points at once, only the scatter into the images is scalar. The
+ * corner cells are visited with the same helper as the scalar kernel (see for_each_corner_cell).
+ *
+ * @tparam N number of dimensions
+ * @param coordinates coordinate vectors (one per dimension)
+ * @param sv values (non-finite values are ignored)
+ * @param mins coordinate of the first grid cell per dimension
+ * @param ress grid resolution per dimension
+ * @param ns number of grid cells per dimension
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (see scatter_points)
+ */
+template<size_t N,
+         typename t_vector,
+         typename t_xtensor,
+         std::floating_point t_float,
+         std::integral       t_int>
+inline void grd_weighted_mean_xsimd_nd(const std::array<const t_vector*, N>& coordinates,
+                                       const t_vector&                       sv,
+                                       const std::array<t_float, N>&         mins,
+                                       const std::array<t_float, N>&         ress,
+                                       const std::array<t_int, N>&           ns,
+                                       t_xtensor&                            image_values,
+                                       t_xtensor&                            image_weights,
+                                       const int                             mp_cores)
+{
+    using t_batch                     = xsimd::batch<t_float>;
+    static constexpr size_t simd_size = t_batch::size;
+    static constexpr size_t n_corners = size_t(1) << N;
+
+    for (size_t d = 0; d < N; ++d)
+        if (coordinates[d]->size() != sv.size())
+            throw std::runtime_error(
+                fmt::format("ERROR[grd_weighted_mean_xsimd]: Expected equal array lengths. "
+                            "coordinate {} has {} values, sv has {} values",
+                            d,
+                            coordinates[d]->size(),
+                            sv.size()));
+
+    const size_t n_batches = (sv.size() + simd_size - 1) / simd_size;
+
+    auto scatter_batch = [&](size_t b, auto& values, auto& weights) {
+        const size_t i0 = b * simd_size;
+
+        std::array<t_float, simd_size> v;
+        load_lanes(sv, i0, v, std::numeric_limits<t_float>::quiet_NaN());
+
+        // lower corner index and lower / upper weight per dimension
+        std::array<std::array<t_float, simd_size>, N> lower;
+        std::array<std::array<t_batch, 2>, N>         axis_weights;
+        for (size_t d = 0; d < N; ++d)
         {
-            const int ix = get_index(x, xmin, xres);
-            if (ix < 0 || ix >= nx)
+            std::array<t_float, simd_size> lanes;
+            load_lanes(*coordinates[d], i0, lanes, t_float(0));
+            axis_index_weights(
+                lanes, mins[d], ress[d], lower[d], axis_weights[d][0], axis_weights[d][1]);
+        }
+
+        // same corner order as get_index_weights_nd
+        std::array<std::array<t_float, simd_size>, n_corners> W;
+        for (size_t corner = 0; corner < n_corners; ++corner)
+        {
+            t_batch w = axis_weights[0][(corner >> (N - 1)) & 1];
+            for (size_t d = 1; d < N; ++d)
+                w *= axis_weights[d][(corner >> (N - 1 - d)) & 1];
+            w.store_unaligned(W[corner].data());
+        }
+
+        for (size_t k = 0; k < simd_size; ++k)
+        {
+            if (!std::isfinite(v[k]))
+                continue;
+
+            std::array<int, N> index;
+            for (size_t d = 0; d < N; ++d)
+                index[d] = static_cast<int>(lower[d][k]);
+
+            for_each_corner_cell(
+                index,
+                [&](size_t corner) { return W[corner][k]; },
+                ns,
+                [&](const auto& cell, const t_float w) {
+                    grid_cell(values, cell) += v[k] * w;
+                    grid_cell(weights, cell) += w;
+                });
+        }
+    };
+
+    auto get_rows = [&](size_t b) {
+        const size_t i0 = b * simd_size;
+        const size_t i1 = std::min(i0 + simd_size, sv.size());
+
+        t_float first = std::numeric_limits<t_float>::infinity();
+        t_float last  = -std::numeric_limits<t_float>::infinity();
+        for (size_t i = i0; i < i1; ++i)
+        {
+            const t_float f = get_index_fraction(t_float((*coordinates[0])[i]), mins[0], ress[0]);
+            if (!std::isfinite(f))
                 continue;
+            first = std::min(first, f);
+            last  = std::max(last, f);
+        }
+        return get_row_range(first, last, ns[0]);
+    };
+
+    scatter_points(
+        n_batches, image_values, image_weights, scatter_batch, size_t(ns[0]), get_rows, mp_cores);
+}
+} // namespace detail
+
+/**
+ * @brief Vectorized (xsimd) backend for grd_weighted_mean (3D). The fractions, corner indices
+ * and trilinear weights are computed for a batch of xsimd::batch<t_float>::size points at once,
+ * only the scatter into the images is scalar. The corner cells are visited with the same helper
+ * as grd_weighted_mean (see detail::for_each_corner_cell), so for mp_cores = 1 the result equals
+ * grd_weighted_mean. All overloads share the dimension generic detail::grd_weighted_mean_xsimd_nd.
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sz z values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param zmin z value of the first grid cell
+ * @param zres grid resolution in z
+ * @param nz number of grid cells in z
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_3d t_xtensor_3d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+inline void grd_weighted_mean_xsimd(const t_vector& sx,
+                                    const t_vector& sy,
+                                    const t_vector& sz,
+                                    const t_vector& sv,
+                                    const t_float   xmin,
+                                    const t_float   xres,
+                                    const t_int     nx,
+                                    const t_float   ymin,
+                                    const t_float   yres,
+                                    const t_int     ny,
+                                    const t_float   zmin,
+                                    const t_float   zres,
+                                    const t_int     nz,
+                                    t_xtensor_3d&   image_values,
+                                    t_xtensor_3d&   image_weights,
+                                    const int       mp_cores = 1)
+{
+    detail::grd_weighted_mean_xsimd_nd<3>(std::array{ &sx, &sy, &sz },
+                                          sv,
+                                          std::array{ xmin, ymin, zmin },
+                                          std::array{ xres, yres, zres },
+                                          std::array{ nx, ny, nz },
+                                          image_values,
+                                          image_weights,
+                                          mp_cores);
+}
+
+/**
+ * @brief Vectorized (xsimd) backend for grd_weighted_mean (2D). See the 3D version for details.
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_2d t_xtensor_2d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+inline void grd_weighted_mean_xsimd(const t_vector& sx,
+                                    const t_vector& sy,
+                                    const t_vector& sv,
+                                    const t_float   xmin,
+                                    const t_float   xres,
+                                    const t_int     nx,
+                                    const t_float   ymin,
+                                    const t_float   yres,
+                                    const t_int     ny,
+                                    t_xtensor_2d&   image_values,
+                                    t_xtensor_2d&   image_weights,
+                                    const int       mp_cores = 1)
+{
+    detail::grd_weighted_mean_xsimd_nd<2>(std::array{ &sx, &sy },
+                                          sv,
+                                          std::array{ xmin, ymin },
+                                          std::array{ xres, yres },
+                                          std::array{ nx, ny },
+                                          image_values,
+                                          image_weights,
+                                          mp_cores);
+}
+
+/**
+ * @brief Vectorized (xsimd) backend for grd_weighted_mean (1D). See the 3D version for details.
+ *
+ * @param sx x values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_1d t_xtensor_1d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+inline void grd_weighted_mean_xsimd(const t_vector& sx,
+                                    const t_vector& sv,
+                                    const t_float   xmin,
+                                    const t_float   xres,
+                                    const t_int     nx,
+                                    t_xtensor_1d&   image_values,
+                                    t_xtensor_1d&   image_weights,
+                                    const int       mp_cores = 1)
+{
+    detail::grd_weighted_mean_xsimd_nd<1>(std::array{ &sx },
+                                          sv,
+                                          std::array{ xmin },
+                                          std::array{ xres },
+                                          std::array{ nx },
+                                          image_values,
+                                          image_weights,
+                                          mp_cores);
+}
+
+// --- kernel splatting (gaussian / inverse distance weighting) ---
+
+namespace detail {
+/**
+ * @brief Compute the cells of one axis that lie within radius of a point (clipped to the grid)
+ * and their squared distances to the point.
+ *
+ * @param frac fractional index of the point (see get_index_fraction)
+ * @param res grid resolution
+ * @param radius footprint radius (in coordinate units)
+ * @param n number of grid cells
+ * @param d2 output: squared distances of the cells i0 ... i0 + d2.size() - 1 (empty if the
+ * footprint does not overlap the grid)
+ * @return int i0: index of the first cell of the footprint
+ */
+template<std::floating_point t_float, std::integral t_int>
+inline int splat_footprint(const t_float         frac,
+                           const t_float         res,
+                           const t_float         radius,
+                           const t_int           n,
+                           std::vector<t_float>& d2)
+{
+    d2.clear();
+
+    const t_float r = radius / res;
+    if (!std::isfinite(frac) || frac + r < 0 || frac - r > t_float(n - 1))
+        return 0;
+
+    const int i0 = std::max(0, static_cast<int>(std::ceil(frac - r)));
+    const int i1 = std::min(static_cast<int>(n) - 1, static_cast<int>(std::floor(frac + r)));
+
+    for (int i = i0; i <= i1; ++i)
+    {
+        const t_float d = (t_float(i) - frac) * res;
+        d2.push_back(d * d);
+    }
+
+    return i0;
+}
+
+/**
+ * @brief Dimension generic splatting kernel used by all grd_*_splat overloads. Each point is
+ * splatted onto all cells within radius. The weight of a cell is kernel(squared distance
+ * between point and cell center). For each row of the footprint along the contiguous last
+ * axis, the range of cells within radius is determined once, the kernel weights of that range
+ * are computed into a buffer and then added through row pointers in a branch free loop.
+ *
+ * @tparam N number of dimensions
+ * @param coordinates coordinate vectors (one per dimension)
+ * @param sv values (non-finite values are ignored)
+ * @param mins coordinate of the first grid cell per dimension
+ * @param ress grid resolution per dimension
+ * @param ns number of grid cells per dimension
+ * @param radius footprint radius (in coordinate units)
+ * @param kernel callable (t_float squared distance) -> t_float weight
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (see scatter_points)
+ */
+template<size_t N,
+         typename t_vector,
+         typename t_xtensor,
+         std::floating_point t_float,
+         std::integral       t_int,
+         typename t_kernel>
+inline void splat_points_nd(const std::array<const t_vector*, N>& coordinates,
+                            const t_vector&                       sv,
+                            const std::array<t_float, N>&         mins,
+                            const std::array<t_float, N>&         ress,
+                            const std::array<t_int, N>&           ns,
+                            const t_float                         radius,
+                            const t_kernel&                       kernel,
+                            t_xtensor&                            image_values,
+                            t_xtensor&                            image_weights,
+                            const int                             mp_cores)
+{
+    const t_float r2 = radius * radius;
+
+    auto scatter_point = [&](size_t i, auto& values, auto& weights) {
+        const t_float v = sv[i];
+        if (!std::isfinite(v))
+            return;
+
+        // cells within radius per axis (clipped to the grid) and their squared distances
+        thread_local std::array<std::vector<t_float>, N> d2_axis;
+        thread_local std::vector<t_float>                w_row;
+        std::array<int, N>                               first;
+        for (size_t d = 0; d < N; ++d)
+        {
+            first[d] = splat_footprint(
+                get_index_fraction(t_float((*coordinates[d])[i]), mins[d], ress[d]),
+                ress[d],
+                radius,
+                ns[d],
+                d2_axis[d]);
+            if (d2_axis[d].empty())
+                return;
+        }
+        w_row.resize(d2_axis[N - 1].size());
+
+        // loop over the outer axes of the footprint (odometer), the last axis is innermost
+        std::array<size_t, N> offset{};
+        std::array<int, N>    cell;
+        while (true)
+        {
+            t_float outer_d2 = 0;
+            for (size_t d = 0; d + 1 < N; ++d)
+            {
+                outer_d2 += d2_axis[d][offset[d]];
+                cell[d] = first[d] + int(offset[d]);
+            }
+
+            if (outer_d2 <= r2)
+            {
+                // cells of the row within radius (contiguous, d2 is convex along the row)
+                const auto&   d2_row  = d2_axis[N - 1];
+                const t_float d2_max  = r2 - outer_d2;
+                size_t        c_begin = 0, c_end = d2_row.size();
+                while (c_begin < c_end && d2_row[c_begin] > d2_max)
+                    ++c_begin;
+                while (c_end > c_begin && d2_row[c_end - 1] > d2_max)
+                    --c_end;
+
+                for (size_t c = c_begin; c < c_end; ++c)
+                    w_row[c] = kernel(outer_d2 + d2_row[c]);
+
+                // the last axis is contiguous: scatter through row pointers
+                cell[N - 1]       = first[N - 1];
+                auto* values_row  = &grid_cell(values, cell);
+                auto* weights_row = &grid_cell(weights, cell);
+                for (size_t c = c_begin; c < c_end; ++c)
+                {
+                    values_row[c] += v * w_row[c];
+                    weights_row[c] += w_row[c];
+                }
+            }
+
+            // advance the outer axes
+            size_t d = N - 1;
+            while (true)
+            {
+                if (d == 0)
+                    return;
+                --d;
+                if (++offset[d] < d2_axis[d].size())
+                    break;
+                offset[d] = 0;
+            }
+        }
+    };
+
+    auto get_rows = [&](size_t i) {
+        const t_float f = get_index_fraction(t_float((*coordinates[0])[i]), mins[0], ress[0]);
+        return get_row_range(f - radius / ress[0], f + radius / ress[0], ns[0]);
+    };
+
+    scatter_points(
+        sv.size(), image_values, image_weights, scatter_point, size_t(ns[0]), get_rows, mp_cores);
+}
+
+template<std::floating_point t_float>
+inline auto gaussian_kernel(const t_float radius, const t_float sigma)
+{
+    if (!(radius > 0) || !(sigma > 0))
+        throw std::runtime_error(
+            fmt::format("ERROR[gaussian_kernel]: radius ({}) and sigma ({}) must be > 0",
+                        radius,
+                        sigma));
+
+    const t_float factor = t_float(-0.5) / (sigma * sigma);
+    return [factor](t_float d2) { return std::exp(d2 * factor); };
+}
+
+template<std::floating_point t_float>
+inline auto inverse_distance_kernel(const t_float radius,
+                                    const t_float power,
+                                    const t_float min_distance)
+{
+    if (!(radius > 0) || !(power > 0))
+        throw std::runtime_error(
+            fmt::format("ERROR[inverse_distance_kernel]: radius ({}) and power ({}) must be > 0",
+                        radius,
+                        power));
+
+    const t_float min_d2   = min_distance * min_distance;
+    const t_float exponent = -power / 2;
+    return [min_d2, exponent](t_float d2) { return std::pow(std::max(d2, min_d2), exponent); };
+}
+} // namespace detail
+
+/**
+ * @brief Add xyz points to 3D images using gaussian kernel splatting. Each point is
+ * distributed onto all grid cells whose centers lie within radius of the point, weighted by
+ * exp(-d² / (2 sigma²)) (d: distance between point and cell center). This fills holes between
+ * sparse footprints without a separate interpolation pass.
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sz z values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param zmin z value of the first grid cell
+ * @param zres grid resolution in z
+ * @param nz number of grid cells in z
+ * @param radius footprint radius (in coordinate units)
+ * @param sigma standard deviation of the gaussian kernel (in coordinate units)
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_3d t_xtensor_3d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+inline void grd_gaussian_splat(const t_vector& sx,
+                               const t_vector& sy,
+                               const t_vector& sz,
+                               const t_vector& sv,
+                               const t_float   xmin,
+                               const t_float   xres,
+                               const t_int     nx,
+                               const t_float   ymin,
+                               const t_float   yres,
+                               const t_int     ny,
+                               const t_float   zmin,
+                               const t_float   zres,
+                               const t_int     nz,
+                               const t_float   radius,
+                               const t_float   sigma,
+                               t_xtensor_3d&   image_values,
+                               t_xtensor_3d&   image_weights,
+                               const int       mp_cores = 1)
+{
+    detail::splat_points_nd<3>(std::array{ &sx, &sy, &sz },
+                               sv,
+                               std::array{ xmin, ymin, zmin },
+                               std::array{ xres, yres, zres },
+                               std::array{ nx, ny, nz },
+                               radius,
+                               detail::gaussian_kernel(radius, sigma),
+                               image_values,
+                               image_weights,
+                               mp_cores);
+}
+
+/**
+ * @brief Add xy points to 2D images using gaussian kernel splatting. Each point is distributed
+ * onto all grid cells whose centers lie within radius of the point, weighted by
+ * exp(-d² / (2 sigma²)) (d: distance between point and cell center).
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param radius footprint radius (in coordinate units)
+ * @param sigma standard deviation of the gaussian kernel (in coordinate units)
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_2d t_xtensor_2d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+inline void grd_gaussian_splat(const t_vector& sx,
+                               const t_vector& sy,
+                               const t_vector& sv,
+                               const t_float   xmin,
+                               const t_float   xres,
+                               const t_int     nx,
+                               const t_float   ymin,
+                               const t_float   yres,
+                               const t_int     ny,
+                               const t_float   radius,
+                               const t_float   sigma,
+                               t_xtensor_2d&   image_values,
+                               t_xtensor_2d&   image_weights,
+                               const int       mp_cores = 1)
+{
+    detail::splat_points_nd<2>(std::array{ &sx, &sy },
+                               sv,
+                               std::array{ xmin, ymin },
+                               std::array{ xres, yres },
+                               std::array{ nx, ny },
+                               radius,
+                               detail::gaussian_kernel(radius, sigma),
+                               image_values,
+                               image_weights,
+                               mp_cores);
+}
 
-            image_values.unchecked(ix) += v;
-            image_weights.unchecked(ix) += 1.0;
+/**
+ * @brief Add xyz points to 3D images using inverse distance weighted splatting. Each point is
+ * distributed onto all grid cells whose centers lie within radius of the point, weighted by
+ * 1 / d^power (d: distance between point and cell center). To avoid the singularity at d = 0,
+ * d is clamped to half of the smallest grid resolution.
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sz z values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param zmin z value of the first grid cell
+ * @param zres grid resolution in z
+ * @param nz number of grid cells in z
+ * @param radius footprint radius (in coordinate units)
+ * @param power power of the inverse distance weights
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_3d t_xtensor_3d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+inline void grd_inverse_distance_splat(const t_vector& sx,
+                                       const t_vector& sy,
+                                       const t_vector& sz,
+                                       const t_vector& sv,
+                                       const t_float   xmin,
+                                       const t_float   xres,
+                                       const t_int     nx,
+                                       const t_float   ymin,
+                                       const t_float   yres,
+                                       const t_int     ny,
+                                       const t_float   zmin,
+                                       const t_float   zres,
+                                       const t_int     nz,
+                                       const t_float   radius,
+                                       const t_float   power,
+                                       t_xtensor_3d&   image_values,
+                                       t_xtensor_3d&   image_weights,
+                                       const int       mp_cores = 1)
+{
+    detail::splat_points_nd<3>(
+        std::array{ &sx, &sy, &sz },
+        sv,
+        std::array{ xmin, ymin, zmin },
+        std::array{ xres, yres, zres },
+        std::array{ nx, ny, nz },
+        radius,
+        detail::inverse_distance_kernel(radius, power, std::min({ xres, yres, zres }) / 2),
+        image_values,
+        image_weights,
+        mp_cores);
+}
+
+/**
+ * @brief Add xy points to 2D images using inverse distance weighted splatting. Each point is
+ * distributed onto all grid cells whose centers lie within radius of the point, weighted by
+ * 1 / d^power (d: distance between point and cell center). To avoid the singularity at d = 0,
+ * d is clamped to half of the smallest grid resolution.
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sv values (non-finite values are ignored)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param radius footprint radius (in coordinate units)
+ * @param power power of the inverse distance weights
+ * @param image_values Image with values will be edited inplace
+ * @param image_weights Image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_2d t_xtensor_2d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+inline void grd_inverse_distance_splat(const t_vector& sx,
+                                       const t_vector& sy,
+                                       const t_vector& sv,
+                                       const t_float   xmin,
+                                       const t_float   xres,
+                                       const t_int     nx,
+                                       const t_float   ymin,
+                                       const t_float   yres,
+                                       const t_int     ny,
+                                       const t_float   radius,
+                                       const t_float   power,
+                                       t_xtensor_2d&   image_values,
+                                       t_xtensor_2d&   image_weights,
+                                       const int       mp_cores = 1)
+{
+    detail::splat_points_nd<2>(
+        std::array{ &sx, &sy },
+        sv,
+        std::array{ xmin, ymin },
+        std::array{ xres, yres },
+        std::array{ nx, ny },
+        radius,
+        detail::inverse_distance_kernel(radius, power, std::min(xres, yres) / 2),
+        image_values,
+        image_weights,
+        mp_cores);
+}
+
+// --- multi-channel gridding ---
+
+namespace detail {
+/**
+ * @brief Add the n_channels values of one point (weighted with w) to the n_channels values /
+ * weights of one grid cell. Non-finite values are ignored per channel. The channels are
+ * processed in xsimd batches (scalar tail) if the values and the images share the same floating
+ * point type.
+ *
+ * @param v pointer to the channel values of the point (contiguous)
+ * @param n_channels number of channels
+ * @param w interpolation weight of the grid cell
+ * @param values pointer to the channel values of the grid cell (contiguous)
+ * @param weights pointer to the channel weights of the grid cell (contiguous)
+ */
+template<typename t_value, typename t_image_value, std::floating_point t_float>
+inline void add_channels(const t_value* v,
+                         const size_t   n_channels,
+                         const t_float  w,
+                         t_image_value* values,
+                         t_image_value* weights)
+{
+    size_t c = 0;
+
+    if constexpr (std::is_same_v<t_value, t_image_value> && std::is_floating_point_v<t_value>)
+    {
+        using t_batch                     = xsimd::batch<t_value>;
+        static constexpr size_t simd_size = t_batch::size;
+
+        const t_batch zero(t_value(0));
+        const t_batch weight(static_cast<t_value>(w));
+
+        for (; c + simd_size <= n_channels; c += simd_size)
+        {
+            const t_batch channel_values = t_batch::load_unaligned(v + c);
+            const auto    finite         = xsimd::isfinite(channel_values);
+
+            // select before multiplying: NaN * 0 would still be NaN
+            const t_batch w_finite = xsimd::select(finite, weight, zero);
+            const t_batch v_finite = xsimd::select(finite, channel_values, zero);
+
+            (t_batch::load_unaligned(values + c) + v_finite * w_finite).store_unaligned(values + c);
+            (t_batch::load_unaligned(weights + c) + w_finite).store_unaligned(weights + c);
         }
     }
+
+    for (; c < n_channels; ++c)
+    {
+        if (!std::isfinite(v[c]))
+            continue;
+
+        values[c] += v[c] * w;
+        weights[c] += w;
+    }
+}
+
+/**
+ * @brief Dimension generic multi-channel weighted mean kernel used by all
+ * grd_weighted_mean_multichannel overloads. The cells / weights of each point are computed once
+ * (see for_each_weighted_mean_cell) and shared by all channels (see add_channels).
+ *
+ * @tparam N number of spatial dimensions (the images have N + 1 dimensions, channels last)
+ * @param coordinates coordinate vectors (one per spatial dimension)
+ * @param sv 2D array of values (n_points x n_channels)
+ * @param mins coordinate of the first grid cell per dimension
+ * @param ress grid resolution per dimension
+ * @param ns number of grid cells per dimension
+ * @param image_values image with values will be edited inplace
+ * @param image_weights image with weights will be edited inplace
+ * @param mp_cores Number of cores to use (see scatter_points)
+ */
+template<size_t N,
+         typename t_vector,
+         typename t_xtensor_2d,
+         typename t_xtensor,
+         std::floating_point t_float,
+         std::integral       t_int>
+inline void grd_weighted_mean_multichannel_nd(const std::array<const t_vector*, N>& coordinates,
+                                              const t_xtensor_2d&                   sv,
+                                              const std::array<t_float, N>&         mins,
+                                              const std::array<t_float, N>&         ress,
+                                              const std::array<t_int, N>&           ns,
+                                              t_xtensor&                            image_values,
+                                              t_xtensor&                            image_weights,
+                                              const int                             mp_cores)
+{
+    const size_t n_channels = sv.shape()[1];
+    const auto*  sv_data    = sv.data();
+
+    auto scatter_point = [&](size_t i, auto& values, auto& weights) {
+        auto* values_data  = values.data();
+        auto* weights_data = weights.data();
+
+        std::array<t_float, N> point;
+        for (size_t d = 0; d < N; ++d)
+            point[d] = t_float((*coordinates[d])[i]);
+
+        for_each_weighted_mean_cell(
+            point, mins, ress, ns, [&](const std::array<int, N>& index, const t_float w) {
+                size_t cell = 0;
+                for (size_t d = 0; d < N; ++d)
+                    cell = cell * size_t(ns[d]) + size_t(index[d]);
+                cell *= n_channels;
+
+                add_channels(sv_data + i * n_channels,
+                             n_channels,
+                             w,
+                             values_data + cell,
+                             weights_data + cell);
+            });
+    };
+
+    auto get_rows = [&](size_t i) {
+        const t_float f = get_index_fraction(t_float((*coordinates[0])[i]), mins[0], ress[0]);
+        return get_row_range(f, f, ns[0]);
+    };
+
+    scatter_points(sv.shape()[0],
+                   image_values,
+                   image_weights,
+                   scatter_point,
+                   size_t(ns[0]),
+                   get_rows,
+                   mp_cores);
+}
+} // namespace detail
+
+/**
+ * @brief Add xyz points with n_channels values each (e.g. several frequencies) to 4D images
+ * (nx, ny, nz, n_channels) using weighted mean interpolation. The index / weight computation
+ * is shared by all channels, the channels (innermost dimension) are added in xsimd batches.
+ * Each channel equals grd_weighted_mean with the values of that channel (non-finite values are
+ * ignored per channel).
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sz z values
+ * @param sv 2D array of values (n_points x n_channels)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param zmin z value of the first grid cell
+ * @param zres grid resolution in z
+ * @param nz number of grid cells in z
+ * @param image_values 4D image (nx, ny, nz, n_channels) with values will be edited inplace
+ * @param image_weights 4D image (nx, ny, nz, n_channels) with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_2d t_xtensor_2d,
+         tools::helper::c_xtensor    t_xtensor_4d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+    requires(std::tuple_size_v<typename t_xtensor_4d::shape_type> == 4)
+inline void grd_weighted_mean_multichannel(const t_vector&     sx,
+                                           const t_vector&     sy,
+                                           const t_vector&     sz,
+                                           const t_xtensor_2d& sv,
+                                           const t_float       xmin,
+                                           const t_float       xres,
+                                           const t_int         nx,
+                                           const t_float       ymin,
+                                           const t_float       yres,
+                                           const t_int         ny,
+                                           const t_float       zmin,
+                                           const t_float       zres,
+                                           const t_int         nz,
+                                           t_xtensor_4d&       image_values,
+                                           t_xtensor_4d&       image_weights,
+                                           const int           mp_cores = 1)
+{
+    const size_t n_channels = sv.shape()[1];
+
+    if (sx.size() != sy.size() || sx.size() != sz.size() || size_t(sx.size()) != sv.shape()[0])
+        throw std::runtime_error(fmt::format(
+            "ERROR[grd_weighted_mean_multichannel]: Expected equal number of points. "
+            "sx.size() = {}, sy.size() = {}, sz.size() = {}, sv.shape()[0] = {}",
+            sx.size(),
+            sy.size(),
+            sz.size(),
+            sv.shape()[0]));
+    for (auto* image : { &image_values, &image_weights })
+        if (image->shape()[0] != size_t(nx) || image->shape()[1] != size_t(ny) ||
+            image->shape()[2] != size_t(nz) || image->shape()[3] != n_channels)
+            throw std::runtime_error(
+                fmt::format("ERROR[grd_weighted_mean_multichannel]: Expected image shape ({}, "
+                            "{}, {}, {}), got ({}, {}, {}, {})",
+                            nx,
+                            ny,
+                            nz,
+                            n_channels,
+                            image->shape()[0],
+                            image->shape()[1],
+                            image->shape()[2],
+                            image->shape()[3]));
+
+    detail::grd_weighted_mean_multichannel_nd<3>(std::array{ &sx, &sy, &sz },
+                                                 sv,
+                                                 std::array{ xmin, ymin, zmin },
+                                                 std::array{ xres, yres, zres },
+                                                 std::array{ nx, ny, nz },
+                                                 image_values,
+                                                 image_weights,
+                                                 mp_cores);
+}
+
+/**
+ * @brief Add xy points with n_channels values each to 3D images (nx, ny, n_channels) using
+ * weighted mean interpolation. See the 3D version for details.
+ *
+ * @param sx x values
+ * @param sy y values
+ * @param sv 2D array of values (n_points x n_channels)
+ * @param xmin x value of the first grid cell
+ * @param xres grid resolution in x
+ * @param nx number of grid cells in x
+ * @param ymin y value of the first grid cell
+ * @param yres grid resolution in y
+ * @param ny number of grid cells in y
+ * @param image_values 3D image (nx, ny, n_channels) with values will be edited inplace
+ * @param image_weights 3D image (nx, ny, n_channels) with weights will be edited inplace
+ * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+ * disjoint slabs of the images, see detail::scatter_points)
+ */
+template<typename t_vector,
+         tools::helper::c_xtensor_2d t_xtensor_2d,
+         tools::helper::c_xtensor_3d t_xtensor_3d,
+         std::floating_point         t_float,
+         std::integral               t_int>
+inline void grd_weighted_mean_multichannel(const t_vector&     sx,
+                                           const t_vector&     sy,
+                                           const t_xtensor_2d& sv,
+                                           const t_float       xmin,
+                                           const t_float       xres,
+                                           const t_int         nx,
+                                           const t_float       ymin,
+                                           const t_float       yres,
+                                           const t_int         ny,
+                                           t_xtensor_3d&       image_values,
+                                           t_xtensor_3d&       image_weights,
+                                           const int           mp_cores = 1)
+{
+    const size_t n_channels = sv.shape()[1];
+
+    if (sx.size() != sy.size() || size_t(sx.size()) != sv.shape()[0])
+        throw std::runtime_error(
+            fmt::format("ERROR[grd_weighted_mean_multichannel]: Expected equal number of points. "
+                        "sx.size() = {}, sy.size() = {}, sv.shape()[0] = {}",
+                        sx.size(),
+                        sy.size(),
+                        sv.shape()[0]));
+    for (auto* image : { &image_values, &image_weights })
+        if (image->shape()[0] != size_t(nx) || image->shape()[1] != size_t(ny) ||
+            image->shape()[2] != n_channels)
+            throw std::runtime_error(
+                fmt::format("ERROR[grd_weighted_mean_multichannel]: Expected image shape ({}, "
+                            "{}, {}), got ({}, {}, {})",
+                            nx,
+                            ny,
+                            n_channels,
+                            image->shape()[0],
+                            image->shape()[1],
+                            image->shape()[2]));
+
+    detail::grd_weighted_mean_multichannel_nd<2>(std::array{ &sx, &sy },
+                                                 sv,
+                                                 std::array{ xmin, ymin },
+                                                 std::array{ xres, yres },
+                                                 std::array{ nx, ny },
+                                                 image_values,
+                                                 image_weights,
+                                                 mp_cores);
 }
 
 } // namespace functions
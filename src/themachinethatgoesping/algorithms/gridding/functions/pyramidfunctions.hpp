@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/pyramidfunctions.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include <fmt/format.h>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+namespace functions {
+
+/*
+ * Grid pyramids (multi resolution images) derived from accumulated grid images (image_values,
+ * image_weights as produced by grd_block_mean / grd_weighted_mean). A coarser level is computed by
+ * summing blocks of 2x2 (2D) or 2x2x2 (3D) cells of the raw accumulators. The block means
+ * (image_values / image_weights) are therefore exactly the means of all values that were added to
+ * the cells of the block. The blocks start at cell 0; the last block of an odd dimension contains
+ * only one cell.
+ */
+
+namespace detail {
+/**
+ * @brief Sum blocks of 2 x 2 x fz cells of the (row major) images values_in / weights_in with
+ * shape (nx, ny, nz) into values_out / weights_out with shape ((nx+1)/2, (ny+1)/2, (nz+fz-1)/fz).
+ * The output is processed in tiles of tile_size x tile_size (x, y) cells that are distributed over
+ * the threads.
+ *
+ * @param fz block size in z (1 or 2)
+ * @param mp_cores Number of cores to use for parallelization (over tiles)
+ */
+template<typename t_value>
+inline void sum_blocks(const t_value* values_in,
+                       const t_value* weights_in,
+                       t_value*       values_out,
+                       t_value*       weights_out,
+                       const size_t   nx,
+                       const size_t   ny,
+                       const size_t   nz,
+                       const size_t   fz,
+                       const int      mp_cores)
+{
+    static constexpr size_t tile_size = 32;
+
+    const size_t out_nx   = (nx + 1) / 2;
+    const size_t out_ny   = (ny + 1) / 2;
+    const size_t out_nz   = (nz + fz - 1) / fz;
+    const size_t tiles_x  = (out_nx + tile_size - 1) / tile_size;
+    const size_t tiles_y  = (out_ny + tile_size - 1) / tile_size;
+    const auto   n_tiles  = static_cast<int64_t>(tiles_x * tiles_y);
+    const size_t stride_x = ny * nz;
+
+#pragma omp parallel for num_threads(mp_cores) schedule(dynamic)
+    for (int64_t tile = 0; tile < n_tiles; ++tile)
+    {
+        const size_t ox_begin = (size_t(tile) / tiles_y) * tile_size;
+        const size_t oy_begin = (size_t(tile) % tiles_y) * tile_size;
+        const size_t ox_end   = std::min(ox_begin + tile_size, out_nx);
+        const size_t oy_end   = std::min(oy_begin + tile_size, out_ny);
+
+        for (size_t ox = ox_begin; ox < ox_end; ++ox)
+        {
+            const size_t n_dx = std::min<size_t>(2, nx - 2 * ox);
+
+            for (size_t oy = oy_begin; oy < oy_end; ++oy)
+            {
+                const size_t n_dy = std::min<size_t>(2, ny - 2 * oy);
+                const size_t out  = (ox * out_ny + oy) * out_nz;
+
+                for (size_t oz = 0; oz < out_nz; ++oz)
+                {
+                    const size_t n_dz  = std::min(fz, nz - fz * oz);
+                    t_value      value = 0;
+                    t_value      wght  = 0;
+
+                    for (size_t dx = 0; dx < n_dx; ++dx)
+                        for (size_t dy = 0; dy < n_dy; ++dy)
+                        {
+                            const size_t in =
+                                (2 * ox + dx) * stride_x + (2 * oy + dy) * nz + fz * oz;
+                            for (size_t dz = 0; dz < n_dz; ++dz)
+                            {
+                                value += values_in[in + dz];
+                                wght += weights_in[in + dz];
+                            }
+                        }
+
+                    values_out[out + oz]  = value;
+                    weights_out[out + oz] = wght;
+                }
+            }
+        }
+    }
+}
+
+template<typename t_xtensor>
+inline void check_accumulator_shapes(const t_xtensor&   image_values,
+                                     const t_xtensor&   image_weights,
+                                     const std::string& function_name)
+{
+    if (image_values.shape() != image_weights.shape())
+        throw std::runtime_error(
+            fmt::format("ERROR[{}]: image_values and image_weights must have the same shape",
+                        function_name));
+}
+} // namespace detail
+
+/**
+ * @brief Compute the next coarser pyramid level of accumulated 3D grid images by summing blocks of
+ * 2x2x2 cells. The resulting images have the shape ((nx+1)/2, (ny+1)/2, (nz+1)/2).
+ * Cell (i, j, k) of the coarse level contains the cells (2i:2i+2, 2j:2j+2, 2k:2k+2) of the input.
+ *
+ * @tparam t_xtensor_3d
+ * @param image_values accumulated values (e.g. from grd_weighted_mean)
+ * @param image_weights accumulated weights
+ * @param mp_cores Number of cores to use for parallelization (over output tiles)
+ * @return std::tuple<t_xtensor_3d, t_xtensor_3d> coarse image_values, image_weights
+ */
+template<tools::helper::c_xtensor_3d t_xtensor_3d>
+inline std::tuple<t_xtensor_3d, t_xtensor_3d> downsample_accumulators(
+    const t_xtensor_3d& image_values,
+    const t_xtensor_3d& image_weights,
+    const int           mp_cores = 1)
+{
+    detail::check_accumulator_shapes(image_values, image_weights, "downsample_accumulators");
+
+    const size_t nx = image_values.shape()[0];
+    const size_t ny = image_values.shape()[1];
+    const size_t nz = image_values.shape()[2];
+
+    const std::array<size_t, 3> shape = { (nx + 1) / 2, (ny + 1) / 2, (nz + 1) / 2 };
+
+    t_xtensor_3d coarse_values  = t_xtensor_3d::from_shape(shape);
+    t_xtensor_3d coarse_weights = t_xtensor_3d::from_shape(shape);
+
+    detail::sum_blocks(image_values.data(),
+                       image_weights.data(),
+                       coarse_values.data(),
+                       coarse_weights.data(),
+                       nx,
+                       ny,
+                       nz,
+                       2,
+                       mp_cores);
+
+    return std::make_tuple(std::move(coarse_values), std::move(coarse_weights));
+}
+
+/**
+ * @brief Compute the next coarser pyramid level of accumulated 2D grid images by summing blocks of
+ * 2x2 cells. The resulting images have the shape ((nx+1)/2, (ny+1)/2).
+ * Cell (i, j) of the coarse level contains the cells (2i:2i+2, 2j:2j+2) of the input.
+ *
+ * @tparam t_xtensor_2d
+ * @param image_values accumulated values (e.g. from grd_weighted_mean)
+ * @param image_weights accumulated weights
+ * @param mp_cores Number of cores to use for parallelization (over output tiles)
+ * @return std::tuple<t_xtensor_2d, t_xtensor_2d> coarse image_values, image_weights
+ */
+template<tools::helper::c_xtensor_2d t_xtensor_2d>
+inline std::tuple<t_xtensor_2d, t_xtensor_2d> downsample_accumulators(
+    const t_xtensor_2d& image_values,
+    const t_xtensor_2d& image_weights,
+    const int           mp_cores = 1)
+{
+    detail::check_accumulator_shapes(image_values, image_weights, "downsample_accumulators");
+
+    const size_t nx = image_values.shape()[0];
+    const size_t ny = image_values.shape()[1];
+
+    const std::array<size_t, 2> shape = { (nx + 1) / 2, (ny + 1) / 2 };
+
+    t_xtensor_2d coarse_values  = t_xtensor_2d::from_shape(shape);
+    t_xtensor_2d coarse_weights = t_xtensor_2d::from_shape(shape);
+
+    detail::sum_blocks(image_values.data(),
+                       image_weights.data(),
+                       coarse_values.data(),
+                       coarse_weights.data(),
+                       nx,
+                       ny,
+                       1,
+                       1,
+                       mp_cores);
+
+    return std::make_tuple(std::move(coarse_values), std::move(coarse_weights));
+}
+
+} // namespace functions
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -3,16 +3,15 @@
 /* generated doc strings */
 #include ".docstrings/resamplingfunctions.doc.hpp"
 
-/* generated doc strings */
-#include ".docstrings/gridfunctions.doc.hpp"
-
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <exception>
 #include <limits>
 #include <stdexcept>
 
-#include <xtensor/misc/xsort.hpp>
-#include <xtensor/views/xindex_view.hpp>
+#include <xtensor/generators/xbuilder.hpp>
 
 #include <fmt/format.h>
 #include <map>
@@ -25,51 +24,149 @@ namespace algorithms {
 namespace gridding {
 namespace functions {
 
+namespace detail {
 /**
- * @brief Compute resampled coordinates for gridding operations using statistical heuristics
- *
- * This function generates a uniform grid of coordinates based on input data ranges and resolutions.
- * It uses statistical analysis (quantiles and IQR) to determine appropriate grid bounds and
- * resolution when explicit limits are not provided or when heuristic bounds are more suitable.
- *
- * @param values_min Array of minimum values for each data point (e.g., depth ranges)
- * @param values_max Array of maximum values for each data point
- * @param values_res Array of resolution values for each data point
- * @param grid_min Explicit minimum grid bound (optional)
- * @param grid_max Explicit maximum grid bound (optional)
- * @param max_steps Maximum number of grid points. If exceeded, switches to linear spacing
+ * @brief Scratch buffers for compute_resampled_coordinates. One instance per thread is reused
+ * between calls (see resampling_scratch), so repeated calls do not allocate once the buffers
+ * reached their working size. Buffers that grew beyond max_kept_capacity are released after
+ * each call, so a single large call does not pin its memory for the lifetime of the thread.
+ */
+template<std::floating_point t_value>
+struct ResamplingScratch
+{
+    static constexpr size_t max_kept_capacity = size_t(1) << 18;
+
+    std::vector<t_value> values_min;
+    std::vector<t_value> values_max;
+    std::vector<t_value> values_res;
+
+    /**
+     * @brief Clear the buffers and release the ones with a capacity above max_kept_capacity
+     */
+    void release()
+    {
+        for (auto* values : { &values_min, &values_max, &values_res })
+        {
+            if (values->capacity() > max_kept_capacity)
+                std::vector<t_value>().swap(*values);
+            else
+                values->clear();
+        }
+    }
+};
+
+template<std::floating_point t_value>
+inline ResamplingScratch<t_value>& resampling_scratch()
+{
+    thread_local ResamplingScratch<t_value> scratch;
+    return scratch;
+}
+
+/**
+ * @brief Compute quantiles (linear interpolation, same as xt::quantile / numpy default) using
+ * selection (std::nth_element) instead of sorting. The values are reordered.
  *
- * @return coordinates: xtensor array of uniformly spaced grid coordinates
- **/
-template<tools::helper::c_xtensor_1d t_xtensor_1d>
-inline t_xtensor_1d compute_resampled_coordinates(
-    const t_xtensor_1d&                     values_min,
-    const t_xtensor_1d&                     values_max,
-    const t_xtensor_1d&                     values_res,
-    const typename t_xtensor_1d::value_type grid_min =
-        std::numeric_limits<typename t_xtensor_1d::value_type>::quiet_NaN(),
-    const typename t_xtensor_1d::value_type grid_max =
-        std::numeric_limits<typename t_xtensor_1d::value_type>::quiet_NaN(),
-    const size_t max_steps = 1024)
+ * @param values values (will be partially reordered), must not be empty
+ * @param probabilities ascending probabilities (0 ... 1)
+ * @return std::array<t_value, N> quantiles
+ */
+template<std::floating_point t_value, size_t N>
+inline std::array<t_value, N> select_quantiles(std::vector<t_value>&         values,
+                                               const std::array<t_value, N>& probabilities)
+{
+    std::array<t_value, N> quantiles;
+
+    const size_t n     = values.size();
+    size_t       first = 0; // values [0, first) are selected (sorted and <= all other values)
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        const t_value h        = t_value(n - 1) * probabilities[i];
+        const size_t  k        = static_cast<size_t>(std::floor(h));
+        const t_value fraction = h - t_value(k);
+
+        if (k >= first)
+        {
+            std::nth_element(values.begin() + first, values.begin() + k, values.end());
+            first = k + 1;
+        }
+
+        quantiles[i] = values[k];
+        if (fraction > 0 && k + 1 < n)
+        {
+            const t_value next = *std::min_element(values.begin() + k + 1, values.end());
+            quantiles[i] += fraction * (next - values[k]);
+        }
+    }
+
+    return quantiles;
+}
+
+/**
+ * @brief Implementation of compute_resampled_coordinates for n elements that are accessed
+ * through get_min(i), get_max(i) and get_res(i). All statistics are computed from a single pass
+ * over the values (collected into the thread local scratch buffers) and selection based
+ * quantiles. Oversized scratch buffers are released before returning.
+ */
+template<tools::helper::c_xtensor_1d t_xtensor_1d,
+         typename t_get_min,
+         typename t_get_max,
+         typename t_get_res>
+inline t_xtensor_1d compute_resampled_coordinates(const size_t                            n,
+                                                  const t_get_min&                        get_min,
+                                                  const t_get_max&                        get_max,
+                                                  const t_get_res&                        get_res,
+                                                  const typename t_xtensor_1d::value_type grid_min,
+                                                  const typename t_xtensor_1d::value_type grid_max,
+                                                  const size_t max_steps)
 {
-    using namespace xt;
     using t_value = typename t_xtensor_1d::value_type;
 
-    // Filter to finite extent values. Min/max define the grid span.
-    const auto values_min_filtered = xt::filter(values_min, xt::isfinite(values_min));
-    const auto values_max_filtered = xt::filter(values_max, xt::isfinite(values_max));
+    static constexpr std::array<t_value, 3> extent_probabilities     = { 0.10, 0.50, 0.90 };
+    static constexpr std::array<t_value, 3> resolution_probabilities = { 0.25, 0.50, 0.75 };
+
+    // the buffers are empty here, they are released when leaving this function (also if an
+    // exception is thrown)
+    auto& scratch = resampling_scratch<t_value>();
+    struct ReleaseOnExit
+    {
+        ResamplingScratch<t_value>& scratch;
+        ~ReleaseOnExit() { scratch.release(); }
+    } release_on_exit{ scratch };
+
+    // Collect finite extent values (min/max define the grid span) and strictly positive, finite
+    // resolutions. A per-element resolution of zero (or negative) represents a degenerate input
+    // - e.g. a ping whose min/max extent collapsed onto a single sample - and must not be
+    // allowed to drive the global grid resolution to zero.
+    t_value values_min_min = std::numeric_limits<t_value>::max();
+    t_value values_max_max = std::numeric_limits<t_value>::lowest();
+    t_value values_res_min = std::numeric_limits<t_value>::max();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const t_value v_min = get_min(i);
+        const t_value v_max = get_max(i);
+        const t_value v_res = get_res(i);
 
-    // Filter resolutions to strictly positive, finite values only. A per-element
-    // resolution of zero (or negative) represents a degenerate input - e.g. a
-    // ping whose min/max extent collapsed onto a single sample - and must not be
-    // allowed to drive the global grid resolution to zero. Including such values
-    // previously produced a zero step size and therefore an empty coordinate
-    // array (and a downstream IndexError in the consumers).
-    const auto res_valid_mask    = xt::eval(xt::isfinite(values_res) && (values_res > t_value(0)));
-    const auto values_res_filtered = xt::filter(values_res, res_valid_mask);
+        if (std::isfinite(v_min))
+        {
+            scratch.values_min.push_back(v_min);
+            values_min_min = std::min(values_min_min, v_min);
+        }
+        if (std::isfinite(v_max))
+        {
+            scratch.values_max.push_back(v_max);
+            values_max_max = std::max(values_max_max, v_max);
+        }
+        if (std::isfinite(v_res) && v_res > t_value(0))
+        {
+            scratch.values_res.push_back(v_res);
+            values_res_min = std::min(values_res_min, v_res);
+        }
+    }
 
     // Without any finite extent we cannot build a meaningful grid.
-    if (values_min_filtered.size() == 0 || values_max_filtered.size() == 0)
+    if (scratch.values_min.empty() || scratch.values_max.empty())
         throw std::invalid_argument(
             "compute_resampled_coordinates: values_min/values_max contain no finite values");
 
@@ -78,40 +175,37 @@ inline t_xtensor_1d compute_resampled_coordinates(
 
     if (!std::isfinite(grid_min))
     {
-        const auto quantiles =
-            xt::quantile(values_min_filtered, { t_value(0.10), t_value(0.50), t_value(0.90) });
-        const auto iqr = quantiles.unchecked(2) - quantiles.unchecked(0);
-        heuristic_min  = quantiles.unchecked(1) - iqr * t_value(1.5);
+        const auto quantiles = select_quantiles(scratch.values_min, extent_probabilities);
+        const auto iqr = quantiles[2] - quantiles[0];
+        heuristic_min  = quantiles[1] - iqr * t_value(1.5);
     }
     else
         heuristic_min = grid_min;
 
     if (!std::isfinite(grid_max))
     {
-        const auto quantiles =
-            xt::quantile(values_max_filtered, { t_value(0.10), t_value(0.50), t_value(0.90) });
-        const auto iqr = quantiles.unchecked(2) - quantiles.unchecked(0);
-        heuristic_max  = quantiles.unchecked(1) + iqr * t_value(1.5);
+        const auto quantiles = select_quantiles(scratch.values_max, extent_probabilities);
+        const auto iqr = quantiles[2] - quantiles[0];
+        heuristic_max  = quantiles[1] + iqr * t_value(1.5);
     }
     else
         heuristic_max = grid_max;
 
     // select real or heuristic min/max
-    t_value y_min = std::max(t_value(xt::amin(values_min_filtered)()), heuristic_min);
-    t_value y_max = std::min(t_value(xt::amax(values_max_filtered)()), heuristic_max);
+    t_value y_min = std::max(values_min_min, heuristic_min);
+    t_value y_max = std::min(values_max_max, heuristic_max);
 
     // Calculate the grid resolution from the (positive) per-element resolutions
     // using 75%-25% quantile heuristics. The heuristic clamps away tiny outlier
     // resolutions while the global minimum keeps the grid fine enough to not
     // lose data.
     t_value res = std::numeric_limits<t_value>::quiet_NaN();
-    if (values_res_filtered.size() > 0)
+    if (!scratch.values_res.empty())
     {
-        const auto quantiles =
-            xt::quantile(values_res_filtered, { t_value(0.25), t_value(0.50), t_value(0.75) });
-        const auto    iqr_res = quantiles.unchecked(2) - quantiles.unchecked(0);
-        const t_value heuristic_min_resolution = quantiles.unchecked(1) - iqr_res * t_value(1.5);
-        res = std::max(t_value(xt::amin(values_res_filtered)()), heuristic_min_resolution);
+        const auto quantiles = select_quantiles(scratch.values_res, resolution_probabilities);
+        const auto    iqr_res                  = quantiles[2] - quantiles[0];
+        const t_value heuristic_min_resolution = quantiles[1] - iqr_res * t_value(1.5);
+        res = std::max(values_res_min, heuristic_min_resolution);
     }
 
     // Guarantee a finite, strictly positive resolution. When no usable resolution
@@ -139,6 +233,124 @@ inline t_xtensor_1d compute_resampled_coordinates(
 
     return xt::arange(y_min, y_max + res, res);
 }
+} // namespace detail
+
+/**
+ * @brief Compute resampled coordinates for gridding operations using statistical heuristics
+ *
+ * This function generates a uniform grid of coordinates based on input data ranges and resolutions.
+ * It uses statistical analysis (quantiles and IQR) to determine appropriate grid bounds and
+ * resolution when explicit limits are not provided or when heuristic bounds are more suitable.
+ * The quantiles are computed by selection (no sorting) on thread local scratch buffers, so
+ * repeated calls (e.g. per echogram) do not allocate temporaries. Scratch buffers of more than
+ * 2^18 values are released after the call.
+ *
+ * @param values_min Array of minimum values for each data point (e.g., depth ranges)
+ * @param values_max Array of maximum values for each data point
+ * @param values_res Array of resolution values for each data point
+ * @param grid_min Explicit minimum grid bound (optional)
+ * @param grid_max Explicit maximum grid bound (optional)
+ * @param max_steps Maximum number of grid points. If exceeded, switches to linear spacing
+ *
+ * @return coordinates: xtensor array of uniformly spaced grid coordinates
+ **/
+template<tools::helper::c_xtensor_1d t_xtensor_1d>
+inline t_xtensor_1d compute_resampled_coordinates(
+    const t_xtensor_1d&                     values_min,
+    const t_xtensor_1d&                     values_max,
+    const t_xtensor_1d&                     values_res,
+    const typename t_xtensor_1d::value_type grid_min =
+        std::numeric_limits<typename t_xtensor_1d::value_type>::quiet_NaN(),
+    const typename t_xtensor_1d::value_type grid_max =
+        std::numeric_limits<typename t_xtensor_1d::value_type>::quiet_NaN(),
+    const size_t max_steps = 1024)
+{
+    if (values_max.size() != values_min.size() || values_res.size() != values_min.size())
+        throw std::invalid_argument(fmt::format(
+            "compute_resampled_coordinates: values_min/values_max/values_res size mismatch "
+            "({}/{}/{})",
+            values_min.size(),
+            values_max.size(),
+            values_res.size()));
+
+    return detail::compute_resampled_coordinates<t_xtensor_1d>(
+        values_min.size(),
+        [&values_min](size_t i) { return values_min.unchecked(i); },
+        [&values_max](size_t i) { return values_max.unchecked(i); },
+        [&values_res](size_t i) { return values_res.unchecked(i); },
+        grid_min,
+        grid_max,
+        max_steps);
+}
+
+/**
+ * @brief Compute resampled coordinates for several axes at once (batched version of
+ * compute_resampled_coordinates). Row a of values_min / values_max / values_res holds the
+ * per element values of axis a (e.g. one row for depth and one for range, one column per ping).
+ * The axes are evaluated in parallel.
+ *
+ * @param values_min 2D array (axes x elements) of minimum values
+ * @param values_max 2D array (axes x elements) of maximum values
+ * @param values_res 2D array (axes x elements) of resolution values
+ * @param grid_min Explicit minimum grid bound per axis (NaN: use heuristic)
+ * @param grid_max Explicit maximum grid bound per axis (NaN: use heuristic)
+ * @param max_steps Maximum number of grid points per axis. If exceeded, switches to linear
+ * spacing
+ * @param mp_cores Number of cores to use for parallelization (over axes)
+ *
+ * @return coordinates: one xtensor array of uniformly spaced grid coordinates per axis
+ **/
+template<tools::helper::c_xtensor_1d t_xtensor_1d, tools::helper::c_xtensor_2d t_xtensor_2d>
+inline std::vector<t_xtensor_1d> compute_resampled_coordinates(const t_xtensor_2d& values_min,
+                                                               const t_xtensor_2d& values_max,
+                                                               const t_xtensor_2d& values_res,
+                                                               const t_xtensor_1d& grid_min,
+                                                               const t_xtensor_1d& grid_max,
+                                                               const size_t max_steps = 1024,
+                                                               const int    mp_cores  = 1)
+{
+    const size_t n_axes = values_min.shape()[0];
+    const size_t n      = values_min.shape()[1];
+
+    if (values_max.shape()[0] != n_axes || values_max.shape()[1] != n ||
+        values_res.shape()[0] != n_axes || values_res.shape()[1] != n)
+        throw std::invalid_argument(
+            "compute_resampled_coordinates: values_min/values_max/values_res shape mismatch");
+    if (grid_min.size() != n_axes || grid_max.size() != n_axes)
+        throw std::invalid_argument(fmt::format(
+            "compute_resampled_coordinates: grid_min/grid_max must have one value per axis ({})",
+            n_axes));
+
+    std::vector<t_xtensor_1d> coordinates(n_axes);
+    std::exception_ptr        exception;
+
+#pragma omp parallel for num_threads(mp_cores) schedule(dynamic)
+    for (int64_t a = 0; a < int64_t(n_axes); ++a)
+    {
+        try
+        {
+            coordinates[a] = detail::compute_resampled_coordinates<t_xtensor_1d>(
+                n,
+                [&values_min, a](size_t i) { return values_min.unchecked(a, i); },
+                [&values_max, a](size_t i) { return values_max.unchecked(a, i); },
+                [&values_res, a](size_t i) { return values_res.unchecked(a, i); },
+                grid_min.unchecked(a),
+                grid_max.unchecked(a),
+                max_steps);
+        }
+        catch (...)
+        {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+
+    return coordinates;
+}
 
 } // namespace functions
 } // namespace gridding
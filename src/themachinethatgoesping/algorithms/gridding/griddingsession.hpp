@@ -0,0 +1,527 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/griddingsession.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/tools/classhelper/objectprinter.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "forwardgridder2d.hpp"
+#include "forwardgridder3d.hpp"
+#include "functions/gridfunctions.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+
+/**
+ * @brief Stateful (streaming) gridding session that accumulates batches of pings into 2D or 3D
+ * images (block mean or weighted mean interpolation, see ForwardGridder2D / ForwardGridder3D).
+ *
+ * The grid is aligned to base + k * res (same as the ForwardGridders). The extent is not fixed:
+ * when a batch contains points outside the current extent, the images grow in steps of
+ * chunk_size cells (the image borders are always multiples of chunk_size cells). Growing copies
+ * the accumulated values / weights into the enlarged images, nothing is gridded twice. The
+ * batches are gridded by a ForwardGridder2D / ForwardGridder3D on the current extent.
+ *
+ * The number of image cells is limited to max_cells: a batch (or grow_to_cells call) that would
+ * grow the grid beyond it (e.g. because of outliers in the coordinates) throws and leaves the
+ * session unchanged.
+ *
+ * @tparam t_float floating point type of the images
+ * @tparam Dim number of dimensions (2 or 3)
+ */
+template<std::floating_point t_float, size_t Dim>
+class GriddingSession
+{
+    static_assert(Dim == 2 || Dim == 3, "GriddingSession: Dim must be 2 or 3");
+
+  public:
+    using t_image = xt::xtensor<t_float, Dim>;
+
+    /**
+     * @brief Initialize an empty gridding session
+     *
+     * @param res resolution of the grid per axis (x, y[, z])
+     * @param chunk_size number of cells per growth step (per axis)
+     * @param base base position of the grid per axis (x, y[, z]), by default 0
+     * @param max_cells maximum number of image cells (product over all axes), by default 2^28
+     */
+    GriddingSession(const std::array<t_float, Dim>& res,
+                    const size_t                    chunk_size = 64,
+                    const std::array<t_float, Dim>& base       = {},
+                    const size_t                    max_cells  = size_t(1) << 28)
+        : _res(res)
+        , _base(base)
+        , _chunk_size(chunk_size)
+        , _max_cells(max_cells)
+    {
+        if (_chunk_size < 1)
+            throw std::runtime_error("ERROR[GriddingSession]: chunk_size must be >= 1");
+
+        for (size_t d = 0; d < Dim; ++d)
+            if (!(_res[d] > 0))
+                throw std::runtime_error(fmt::format(
+                    "ERROR[GriddingSession]: resolution must be > 0 (axis {}: {})", d, _res[d]));
+
+        _first_cell.fill(0);
+        _shape.fill(0);
+        _image_values  = xt::zeros<t_float>(_shape);
+        _image_weights = xt::zeros<t_float>(_shape);
+    }
+
+    // ----- accumulation -----
+    /**
+     * @brief Add a batch of 2D points using block mean interpolation (the grid grows if necessary)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients (non-finite values are
+     * ignored)
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename T_vector>
+    void add_block_mean(const T_vector& sx,
+                        const T_vector& sy,
+                        const T_vector& s_val,
+                        const int       mp_cores = 1)
+        requires(Dim == 2)
+    {
+        _grow_to_fit({ &sx, &sy }, s_val);
+        _get_gridder().interpolate_block_mean_inplace(
+            sx, sy, s_val, _image_values, _image_weights, mp_cores);
+    }
+
+    /**
+     * @brief Add a batch of 3D points using block mean interpolation (the grid grows if necessary)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @param s_val amplitudes / volume backscattering coefficients (non-finite values are
+     * ignored)
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename T_vector>
+    void add_block_mean(const T_vector& sx,
+                        const T_vector& sy,
+                        const T_vector& sz,
+                        const T_vector& s_val,
+                        const int       mp_cores = 1)
+        requires(Dim == 3)
+    {
+        _grow_to_fit({ &sx, &sy, &sz }, s_val);
+        _get_gridder().interpolate_block_mean_inplace(
+            sx, sy, sz, s_val, _image_values, _image_weights, mp_cores);
+    }
+
+    /**
+     * @brief Add a batch of 2D points using weighted mean interpolation (the grid grows if
+     * necessary)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param s_val amplitudes / volume backscattering coefficients (non-finite values are
+     * ignored)
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename T_vector>
+    void add_weighted_mean(const T_vector& sx,
+                           const T_vector& sy,
+                           const T_vector& s_val,
+                           const int       mp_cores = 1)
+        requires(Dim == 2)
+    {
+        _grow_to_fit({ &sx, &sy }, s_val);
+        _get_gridder().interpolate_weighted_mean_inplace(
+            sx, sy, s_val, _image_values, _image_weights, mp_cores);
+    }
+
+    /**
+     * @brief Add a batch of 3D points using weighted mean interpolation (the grid grows if
+     * necessary)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @param s_val amplitudes / volume backscattering coefficients (non-finite values are
+     * ignored)
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename T_vector>
+    void add_weighted_mean(const T_vector& sx,
+                           const T_vector& sy,
+                           const T_vector& sz,
+                           const T_vector& s_val,
+                           const int       mp_cores = 1)
+        requires(Dim == 3)
+    {
+        _grow_to_fit({ &sx, &sy, &sz }, s_val);
+        _get_gridder().interpolate_weighted_mean_inplace(
+            sx, sy, sz, s_val, _image_values, _image_weights, mp_cores);
+    }
+
+    /**
+     * @brief Grow the grid (in chunk_size steps) such that it contains the cells lo .. hi
+     * (global cell indices: cell center = base + index * res)
+     *
+     * @param lo smallest cell index per axis
+     * @param hi largest cell index per axis
+     */
+    void grow_to_cells(std::array<int64_t, Dim> lo, std::array<int64_t, Dim> hi)
+    {
+        const int64_t chunk = int64_t(_chunk_size);
+
+        // floor division (cell indices may be negative)
+        auto chunk_index = [chunk](int64_t cell) {
+            return cell >= 0 ? cell / chunk : -((-cell + chunk - 1) / chunk);
+        };
+
+        std::array<int64_t, Dim> new_first_cell;
+        std::array<size_t, Dim>  new_shape;
+        for (size_t d = 0; d < Dim; ++d)
+        {
+            if (!empty())
+            {
+                lo[d] = std::min(lo[d], _first_cell[d]);
+                hi[d] = std::max(hi[d], _first_cell[d] + int64_t(_shape[d]) - 1);
+            }
+
+            // align to chunk borders
+            const int64_t first_chunk = chunk_index(lo[d]);
+            const int64_t last_chunk  = chunk_index(hi[d]);
+
+            new_first_cell[d] = first_chunk * chunk;
+            new_shape[d]      = size_t((last_chunk - first_chunk + 1) * chunk);
+        }
+
+        if (new_first_cell == _first_cell && new_shape == _shape)
+            return;
+
+        // guard against runaway extents (e.g. outliers), checked before anything is modified
+        double n_cells  = 1;
+        bool   too_long = false;
+        for (size_t d = 0; d < Dim; ++d)
+        {
+            n_cells *= double(new_shape[d]);
+            too_long = too_long || new_shape[d] > size_t(std::numeric_limits<int>::max());
+        }
+        if (too_long || n_cells > double(_max_cells))
+            throw std::runtime_error(fmt::format(
+                "ERROR[GriddingSession]: growing the grid to {} cells exceeds max_cells ({}) or "
+                "{} cells per axis",
+                n_cells,
+                _max_cells,
+                std::numeric_limits<int>::max()));
+
+        t_image new_values  = xt::zeros<t_float>(new_shape);
+        t_image new_weights = xt::zeros<t_float>(new_shape);
+
+        // copy the accumulated images into the enlarged images
+        if (!empty())
+        {
+            std::array<size_t, Dim> offset;
+            for (size_t d = 0; d < Dim; ++d)
+                offset[d] = size_t(_first_cell[d] - new_first_cell[d]);
+
+            if constexpr (Dim == 2)
+            {
+                for (size_t ix = 0; ix < _shape[0]; ++ix)
+                    for (size_t iy = 0; iy < _shape[1]; ++iy)
+                    {
+                        new_values.unchecked(ix + offset[0], iy + offset[1]) =
+                            _image_values.unchecked(ix, iy);
+                        new_weights.unchecked(ix + offset[0], iy + offset[1]) =
+                            _image_weights.unchecked(ix, iy);
+                    }
+            }
+            else
+            {
+                for (size_t ix = 0; ix < _shape[0]; ++ix)
+                    for (size_t iy = 0; iy < _shape[1]; ++iy)
+                        for (size_t iz = 0; iz < _shape[2]; ++iz)
+                        {
+                            new_values.unchecked(ix + offset[0], iy + offset[1], iz + offset[2]) =
+                                _image_values.unchecked(ix, iy, iz);
+                            new_weights.unchecked(ix + offset[0], iy + offset[1], iz + offset[2]) =
+                                _image_weights.unchecked(ix, iy, iz);
+                        }
+            }
+        }
+
+        _image_values  = std::move(new_values);
+        _image_weights = std::move(new_weights);
+        _first_cell    = new_first_cell;
+        _shape         = new_shape;
+    }
+
+    /**
+     * @brief Reset the session (remove all accumulated data)
+     */
+    void clear()
+    {
+        _first_cell.fill(0);
+        _shape.fill(0);
+        _image_values  = xt::zeros<t_float>(_shape);
+        _image_weights = xt::zeros<t_float>(_shape);
+        _image         = t_image();
+    }
+
+    // ----- images -----
+    /**
+     * @brief Get the accumulated values image (no copy)
+     *
+     * @return const xt::xtensor<t_float, Dim>&
+     */
+    const t_image& get_image_values() const { return _image_values; }
+
+    /**
+     * @brief Get the accumulated weights image (no copy)
+     *
+     * @return const xt::xtensor<t_float, Dim>&
+     */
+    const t_image& get_image_weights() const { return _image_weights; }
+
+    /**
+     * @brief Get the normalized image (image_values / image_weights, NaN for empty cells). The
+     * image is computed into an internal buffer that is reused between calls (no allocation
+     * unless the grid grew). The reference is valid until the next call of get_image or any
+     * function that changes the session.
+     *
+     * @return const xt::xtensor<t_float, Dim>&
+     */
+    const t_image& get_image()
+    {
+        if (_image.shape() != _image_values.shape())
+            _image = xt::empty<t_float>(_shape);
+
+        const auto* values  = _image_values.data();
+        const auto* weights = _image_weights.data();
+        auto*       image   = _image.data();
+
+        for (size_t i = 0; i < _image_values.size(); ++i)
+            image[i] = weights[i] > 0 ? values[i] / weights[i]
+                                      : std::numeric_limits<t_float>::quiet_NaN();
+
+        return _image;
+    }
+
+    // ----- grid parameters -----
+    bool                            empty() const { return _image_values.size() == 0; }
+    size_t                          get_chunk_size() const { return _chunk_size; }
+    size_t                          get_max_cells() const { return _max_cells; }
+    const std::array<t_float, Dim>& get_res() const { return _res; }
+    const std::array<t_float, Dim>& get_base() const { return _base; }
+    const std::array<size_t, Dim>&  get_shape() const { return _shape; }
+
+    /**
+     * @brief Get the global cell index (cell center = base + index * res) of the first image
+     * cell
+     *
+     * @return std::array<int64_t, Dim>
+     */
+    const std::array<int64_t, Dim>& get_first_cell() const { return _first_cell; }
+
+    /**
+     * @brief Center coordinate of the first image cell along axis
+     *
+     * @param axis 0 = x, 1 = y, 2 = z
+     * @return t_float
+     */
+    t_float get_min(size_t axis) const
+    {
+        return _base[axis] + t_float(_first_cell[axis]) * _res[axis];
+    }
+
+    /**
+     * @brief Center coordinate of the last image cell along axis
+     *
+     * @param axis 0 = x, 1 = y, 2 = z
+     * @return t_float
+     */
+    t_float get_max(size_t axis) const
+    {
+        return _base[axis] + t_float(_first_cell[axis] + int64_t(_shape[axis]) - 1) * _res[axis];
+    }
+
+    /**
+     * @brief Center coordinates of the image cells along axis
+     *
+     * @param axis 0 = x, 1 = y, 2 = z
+     * @return xt::xtensor<t_float, 1>
+     */
+    xt::xtensor<t_float, 1> get_coordinates(size_t axis) const
+    {
+        xt::xtensor<t_float, 1> coordinates = xt::empty<t_float>({ _shape[axis] });
+        for (size_t i = 0; i < _shape[axis]; ++i)
+            coordinates.unchecked(i) =
+                _base[axis] + t_float(_first_cell[axis] + int64_t(i)) * _res[axis];
+
+        return coordinates;
+    }
+
+    // ----- objectprinter -----
+    tools::classhelper::ObjectPrinter __printer__(unsigned int float_precision,
+                                                  bool         superscript_exponents) const
+    {
+        tools::classhelper::ObjectPrinter printer(
+            fmt::format("GriddingSession{}D", Dim), float_precision, superscript_exponents);
+
+        static constexpr std::array<const char*, 3> axes = { "x", "y", "z" };
+
+        printer.register_section("grid parameters");
+        printer.register_value("chunk_size", _chunk_size);
+        printer.register_value("max_cells", _max_cells);
+        for (size_t d = 0; d < Dim; ++d)
+        {
+            printer.register_value(fmt::format("{}res", axes[d]), _res[d]);
+            printer.register_value(fmt::format("{}base", axes[d]), _base[d]);
+        }
+
+        printer.register_section("current extent");
+        for (size_t d = 0; d < Dim; ++d)
+        {
+            printer.register_value(fmt::format("n{}", axes[d]), _shape[d]);
+            if (!empty())
+            {
+                printer.register_value(fmt::format("{}min", axes[d]), get_min(d));
+                printer.register_value(fmt::format("{}max", axes[d]), get_max(d));
+            }
+        }
+
+        return printer;
+    }
+
+    // ----- class helper macros -----
+    __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
+
+  private:
+    /**
+     * @brief ForwardGridder2D / ForwardGridder3D for the current extent of the images
+     */
+    auto _get_gridder() const
+    {
+        if constexpr (Dim == 2)
+            return ForwardGridder2D<t_float>::from_cells(_res[0],
+                                                         _res[1],
+                                                         get_min(0),
+                                                         int(_shape[0]),
+                                                         get_min(1),
+                                                         int(_shape[1]),
+                                                         _base[0],
+                                                         _base[1]);
+        else
+            return ForwardGridder3D<t_float>::from_cells(_res[0],
+                                                         _res[1],
+                                                         _res[2],
+                                                         get_min(0),
+                                                         int(_shape[0]),
+                                                         get_min(1),
+                                                         int(_shape[1]),
+                                                         get_min(2),
+                                                         int(_shape[2]),
+                                                         _base[0],
+                                                         _base[1],
+                                                         _base[2]);
+    }
+
+    /**
+     * @brief Grow the grid (in chunk_size steps) such that it contains all cells the given
+     * points (with finite values) contribute to.
+     *
+     * @tparam T_vector
+     * @param coordinates pointers to the coordinate vectors (x, y[, z])
+     * @param s_val values (points with non-finite values are ignored)
+     */
+    template<typename T_vector>
+    void _grow_to_fit(const std::array<const T_vector*, Dim>& coordinates, const T_vector& s_val)
+    {
+        std::array<int64_t, Dim> lo, hi;
+        lo.fill(std::numeric_limits<int64_t>::max());
+        hi.fill(std::numeric_limits<int64_t>::min());
+
+        for (size_t i = 0; i < size_t(s_val.size()); ++i)
+        {
+            if (!std::isfinite(s_val[i]))
+                continue;
+
+            std::array<t_float, Dim> fraction;
+            bool                     finite = true;
+            for (size_t d = 0; d < Dim; ++d)
+            {
+                fraction[d] = functions::get_index_fraction(
+                    t_float((*coordinates[d])[i]), _base[d], _res[d]);
+                finite = finite && std::isfinite(fraction[d]);
+            }
+            if (!finite)
+                continue;
+
+            // cell indices beyond 2^60 can not be represented (and would exceed max_cells)
+            for (size_t d = 0; d < Dim; ++d)
+                if (!(std::abs(fraction[d]) < t_float(int64_t(1) << 60)))
+                    throw std::runtime_error(fmt::format(
+                        "ERROR[GriddingSession]: point {} ({}) is too far from the grid base "
+                        "(axis {})",
+                        i,
+                        (*coordinates[d])[i],
+                        d));
+
+            // floor / ceil covers the cells of block mean and weighted mean interpolation,
+            // the extra cell guards against rounding differences (index relative to xmin)
+            for (size_t d = 0; d < Dim; ++d)
+            {
+                lo[d] = std::min(lo[d], int64_t(std::floor(fraction[d])) - 1);
+                hi[d] = std::max(hi[d], int64_t(std::ceil(fraction[d])) + 1);
+            }
+        }
+
+        if (lo[0] > hi[0]) // no valid points
+            return;
+
+        grow_to_cells(lo, hi);
+    }
+
+    std::array<t_float, Dim> _res;
+    std::array<t_float, Dim> _base;
+    size_t                   _chunk_size;
+    size_t                   _max_cells;
+
+    std::array<int64_t, Dim> _first_cell; ///< global cell index of the first image cell
+    std::array<size_t, Dim>  _shape;
+
+    t_image _image_values;
+    t_image _image_weights;
+    t_image _image; ///< buffer for get_image
+};
+
+template<std::floating_point t_float>
+using GriddingSession2D = GriddingSession<t_float, 2>;
+
+template<std::floating_point t_float>
+using GriddingSession3D = GriddingSession<t_float, 3>;
+
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
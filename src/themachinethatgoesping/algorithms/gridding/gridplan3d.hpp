@@ -0,0 +1,412 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/gridplan3d.doc.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/tools/classhelper/objectprinter.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "forwardgridder3d.hpp"
+#include "functions/gridfunctions.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+
+/**
+ * @brief Precomputed gridding plan for value arrays that share the same xyz coordinates (e.g.
+ * Sv, TS, angles and masks of the same pings).
+ *
+ * The plan computes the grid cells and interpolation weights of each point once (block mean:
+ * the nearest cell, weighted mean: the up to 8 surrounding cells within the grid) and stores
+ * them in a compact structure of arrays layout (per point offsets, linear cell indices,
+ * weights). Applying the plan to a value array is then a plain scatter without any index /
+ * weight computations. A 2D stack of value arrays is gridded in a single pass over the plan.
+ *
+ * The images are identical to ForwardGridder3D::interpolate_block_mean /
+ * interpolate_weighted_mean with the same coordinates and mp_cores.
+ */
+template<std::floating_point t_float>
+class GridPlan3D
+{
+  public:
+    // ----- factory methods -----
+    /**
+     * @brief Create a plan for block mean interpolation (each point is added to the nearest grid
+     * cell)
+     *
+     * @tparam T_vector
+     * @param gridder ForwardGridder3D that defines the grid
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @return GridPlan3D
+     */
+    template<typename T_vector>
+    static GridPlan3D from_block_mean(const ForwardGridder3D<t_float>& gridder,
+                                      const T_vector&                  sx,
+                                      const T_vector&                  sy,
+                                      const T_vector&                  sz)
+    {
+        GridPlan3D plan(gridder, sx, sy, sz);
+
+        for (size_t i = 0; i < plan._number_of_points; ++i)
+        {
+            functions::detail::for_each_block_mean_cell(
+                std::array{ t_float(sx[i]), t_float(sy[i]), t_float(sz[i]) },
+                plan._mins,
+                plan._ress,
+                plan._ns,
+                [&](const std::array<int, 3>& index, t_float weight) {
+                    plan._add_entry(index, weight);
+                });
+
+            plan._point_offsets[i + 1] = plan._cells.size();
+        }
+
+        plan._cells.shrink_to_fit();
+        plan._weights.shrink_to_fit();
+        return plan;
+    }
+
+    /**
+     * @brief Create a plan for weighted mean interpolation (each point is distributed onto the 8
+     * surrounding grid cells using trilinear weights)
+     *
+     * @tparam T_vector
+     * @param gridder ForwardGridder3D that defines the grid
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @return GridPlan3D
+     */
+    template<typename T_vector>
+    static GridPlan3D from_weighted_mean(const ForwardGridder3D<t_float>& gridder,
+                                         const T_vector&                  sx,
+                                         const T_vector&                  sy,
+                                         const T_vector&                  sz)
+    {
+        GridPlan3D plan(gridder, sx, sy, sz);
+
+        for (size_t i = 0; i < plan._number_of_points; ++i)
+        {
+            // same corner order / conditions as functions::grd_weighted_mean
+            functions::detail::for_each_weighted_mean_cell(
+                std::array{ t_float(sx[i]), t_float(sy[i]), t_float(sz[i]) },
+                plan._mins,
+                plan._ress,
+                plan._ns,
+                [&](const std::array<int, 3>& index, t_float weight) {
+                    plan._add_entry(index, weight);
+                });
+
+            plan._point_offsets[i + 1] = plan._cells.size();
+        }
+
+        plan._cells.shrink_to_fit();
+        plan._weights.shrink_to_fit();
+        return plan;
+    }
+
+    // ----- apply -----
+    /**
+     * @brief Grid a value array (one value per point) into existing images
+     *
+     * @tparam T_vector
+     * @tparam t_xtensor_3d
+     * @param s_val values (non-finite values are ignored)
+     * @param image_values Image with values will be edited inplace
+     * @param image_weights Image with weights will be edited inplace
+     * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+     * disjoint x slabs of the images, see functions::detail::scatter_points)
+     */
+    template<typename T_vector, tools::helper::c_xtensor_3d t_xtensor_3d>
+    void apply_inplace(const T_vector& s_val,
+                       t_xtensor_3d&   image_values,
+                       t_xtensor_3d&   image_weights,
+                       const int       mp_cores = 1) const
+    {
+        _check_number_of_values(s_val.size());
+        _check_image_shape(image_values, 0, "image_values");
+        _check_image_shape(image_weights, 0, "image_weights");
+
+        auto scatter_point = [&](size_t i, auto& values, auto& weights) {
+            const auto v = s_val[i];
+            if (!std::isfinite(v))
+                return;
+
+            auto* values_data  = values.data();
+            auto* weights_data = weights.data();
+            for (size_t e = _point_offsets[i]; e < _point_offsets[i + 1]; ++e)
+            {
+                values_data[_cells[e]] += v * _weights[e];
+                weights_data[_cells[e]] += _weights[e];
+            }
+        };
+
+        functions::detail::scatter_points(_number_of_points,
+                                          image_values,
+                                          image_weights,
+                                          scatter_point,
+                                          size_t(_ns[0]),
+                                          [&](size_t i) { return _get_rows(i); },
+                                          mp_cores);
+    }
+
+    /**
+     * @brief Grid a value array (one value per point)
+     *
+     * @tparam t_xtensor_3d
+     * @tparam T_vector
+     * @param s_val values (non-finite values are ignored)
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<t_xtensor_3d, t_xtensor_3d> (image_values, image_weights)
+     */
+    template<tools::helper::c_xtensor_3d t_xtensor_3d, typename T_vector>
+    std::tuple<t_xtensor_3d, t_xtensor_3d> apply(const T_vector& s_val,
+                                                 const int       mp_cores = 1) const
+    {
+        auto [image_values, image_weights] = _gridder.template get_empty_grd_images<t_xtensor_3d>();
+        apply_inplace(s_val, image_values, image_weights, mp_cores);
+        return std::make_tuple(std::move(image_values), std::move(image_weights));
+    }
+
+    /**
+     * @brief Grid a stack of value arrays (one row per value array, one column per point) into
+     * existing 4D images (value array, x, y, z) in a single pass over the plan. Each value array
+     * has its own weights, as non-finite values are ignored per array.
+     *
+     * @tparam t_xtensor_2d
+     * @tparam t_xtensor_4d
+     * @param s_vals 2D array of values (n_arrays x n_points)
+     * @param image_values 4D image (n_arrays x nx x ny x nz) with values will be edited inplace
+     * @param image_weights 4D image (n_arrays x nx x ny x nz) with weights will be edited
+     * inplace
+     * @param mp_cores Number of cores to use (> 1: the points are scattered in parallel into
+     * disjoint x slabs of the images, see functions::detail::scatter_points)
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, tools::helper::c_xtensor t_xtensor_4d>
+        requires(std::tuple_size_v<typename t_xtensor_4d::shape_type> == 4)
+    void apply_stack_inplace(const t_xtensor_2d& s_vals,
+                             t_xtensor_4d&       image_values,
+                             t_xtensor_4d&       image_weights,
+                             const int           mp_cores = 1) const
+    {
+        const size_t n_arrays = s_vals.shape()[0];
+
+        _check_number_of_values(s_vals.shape()[1]);
+        for (auto* image : { &image_values, &image_weights })
+            if (size_t(image->shape()[0]) != n_arrays)
+                throw std::runtime_error(fmt::format(
+                    "ERROR[GridPlan3D::apply_stack_inplace]: Expected {} images (one per value "
+                    "array), got {}",
+                    n_arrays,
+                    image->shape()[0]));
+        _check_image_shape(image_values, 1, "image_values");
+        _check_image_shape(image_weights, 1, "image_weights");
+
+        const size_t n_cells = size_t(_gridder.get_nx()) * size_t(_gridder.get_ny()) *
+                               size_t(_gridder.get_nz());
+
+        auto scatter_point = [&](size_t i, auto& values, auto& weights) {
+            auto* values_data  = values.data();
+            auto* weights_data = weights.data();
+
+            for (size_t a = 0; a < n_arrays; ++a)
+            {
+                const auto v = s_vals.unchecked(a, i);
+                if (!std::isfinite(v))
+                    continue;
+
+                const size_t offset = a * n_cells;
+                for (size_t e = _point_offsets[i]; e < _point_offsets[i + 1]; ++e)
+                {
+                    values_data[offset + _cells[e]] += v * _weights[e];
+                    weights_data[offset + _cells[e]] += _weights[e];
+                }
+            }
+        };
+
+        functions::detail::scatter_points(_number_of_points,
+                                          image_values,
+                                          image_weights,
+                                          scatter_point,
+                                          size_t(_ns[0]),
+                                          [&](size_t i) { return _get_rows(i); },
+                                          mp_cores);
+    }
+
+    /**
+     * @brief Grid a stack of value arrays (one row per value array, one column per point) in a
+     * single pass over the plan
+     *
+     * @tparam t_xtensor_4d
+     * @tparam t_xtensor_2d
+     * @param s_vals 2D array of values (n_arrays x n_points)
+     * @param mp_cores Number of cores to use for parallelization
+     * @return std::tuple<t_xtensor_4d, t_xtensor_4d> (image_values, image_weights) with shape
+     * (n_arrays, nx, ny, nz)
+     */
+    template<tools::helper::c_xtensor t_xtensor_4d, tools::helper::c_xtensor_2d t_xtensor_2d>
+        requires(std::tuple_size_v<typename t_xtensor_4d::shape_type> == 4)
+    std::tuple<t_xtensor_4d, t_xtensor_4d> apply_stack(const t_xtensor_2d& s_vals,
+                                                       const int           mp_cores = 1) const
+    {
+        const std::array<size_t, 4> shape = { size_t(s_vals.shape()[0]),
+                                              size_t(_gridder.get_nx()),
+                                              size_t(_gridder.get_ny()),
+                                              size_t(_gridder.get_nz()) };
+
+        t_xtensor_4d image_values  = xt::zeros<typename t_xtensor_4d::value_type>(shape);
+        t_xtensor_4d image_weights = xt::zeros<typename t_xtensor_4d::value_type>(shape);
+        apply_stack_inplace(s_vals, image_values, image_weights, mp_cores);
+        return std::make_tuple(std::move(image_values), std::move(image_weights));
+    }
+
+    // ----- getters -----
+    const ForwardGridder3D<t_float>& get_gridder() const { return _gridder; }
+    size_t                           get_number_of_points() const { return _number_of_points; }
+
+    /**
+     * @brief Number of stored (point, cell, weight) entries
+     *
+     * @return size_t
+     */
+    size_t get_number_of_entries() const { return _cells.size(); }
+
+    // ----- objectprinter -----
+    tools::classhelper::ObjectPrinter __printer__(unsigned int float_precision,
+                                                  bool         superscript_exponents) const
+    {
+        tools::classhelper::ObjectPrinter printer(
+            "GridPlan3D", float_precision, superscript_exponents);
+
+        printer.register_section("plan");
+        printer.register_value("number_of_points", _number_of_points);
+        printer.register_value("number_of_entries", get_number_of_entries());
+
+        printer.register_section("grid");
+        printer.append(_gridder.__printer__(float_precision, superscript_exponents));
+
+        return printer;
+    }
+
+    // ----- class helper macros -----
+    __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
+
+  private:
+    ForwardGridder3D<t_float> _gridder;
+    size_t                    _number_of_points = 0;
+
+    // grid parameters in the layout of the functions::detail N-D kernels
+    std::array<t_float, 3> _mins;
+    std::array<t_float, 3> _ress;
+    std::array<int, 3>     _ns;
+
+    // structure of arrays: the entries of point i are [_point_offsets[i], _point_offsets[i+1])
+    std::vector<size_t>   _point_offsets;
+    std::vector<uint64_t> _cells; ///< linear cell index (ix * ny * nz + iy * nz + iz)
+    std::vector<t_float>  _weights;
+
+    /**
+     * @brief First and last x index of the cells of point i (the cells of a point are ordered with
+     * x varying slowest). Used to partition the points for parallel scattering.
+     */
+    std::pair<size_t, size_t> _get_rows(const size_t i) const
+    {
+        if (_point_offsets[i] == _point_offsets[i + 1])
+            return { 0, 0 };
+
+        const uint64_t row_size = uint64_t(_ns[1]) * uint64_t(_ns[2]);
+        return { size_t(_cells[_point_offsets[i]] / row_size),
+                 size_t(_cells[_point_offsets[i + 1] - 1] / row_size) };
+    }
+
+    template<typename T_vector>
+    GridPlan3D(const ForwardGridder3D<t_float>& gridder,
+               const T_vector&                  sx,
+               const T_vector&                  sy,
+               const T_vector&                  sz)
+        : _gridder(gridder)
+        , _number_of_points(sx.size())
+        , _mins{ gridder.get_xmin(), gridder.get_ymin(), gridder.get_zmin() }
+        , _ress{ gridder.get_xres(), gridder.get_yres(), gridder.get_zres() }
+        , _ns{ gridder.get_nx(), gridder.get_ny(), gridder.get_nz() }
+        , _point_offsets(sx.size() + 1, 0)
+    {
+        if (sx.size() != sy.size() || sy.size() != sz.size())
+            throw std::runtime_error(
+                fmt::format("ERROR[GridPlan3D]: Expected equal array lengths. "
+                            "sx.size() = {}, sy.size() = {}, sz.size() = {}",
+                            sx.size(),
+                            sy.size(),
+                            sz.size()));
+
+        _cells.reserve(sx.size());
+        _weights.reserve(sx.size());
+    }
+
+    void _add_entry(const std::array<int, 3>& index, const t_float weight)
+    {
+        _cells.push_back((uint64_t(index[0]) * uint64_t(_ns[1]) + uint64_t(index[1])) *
+                             uint64_t(_ns[2]) +
+                         uint64_t(index[2]));
+        _weights.push_back(weight);
+    }
+
+    void _check_number_of_values(const size_t number_of_values) const
+    {
+        if (number_of_values != _number_of_points)
+            throw std::runtime_error(
+                fmt::format("ERROR[GridPlan3D]: Expected {} values (one per point), got {}",
+                            _number_of_points,
+                            number_of_values));
+    }
+
+    template<typename t_xtensor>
+    void _check_image_shape(const t_xtensor&  image,
+                            const size_t      first_axis,
+                            const std::string name) const
+    {
+        const std::array<size_t, 3> shape = { size_t(_gridder.get_nx()),
+                                              size_t(_gridder.get_ny()),
+                                              size_t(_gridder.get_nz()) };
+
+        for (size_t d = 0; d < 3; ++d)
+            if (size_t(image.shape()[first_axis + d]) != shape[d])
+                throw std::runtime_error(
+                    fmt::format("ERROR[GridPlan3D]: {} dimensions ({}, {}, {}) do not fit the "
+                                "grid dimensions ({}, {}, {})",
+                                name,
+                                image.shape()[first_axis],
+                                image.shape()[first_axis + 1],
+                                image.shape()[first_axis + 2],
+                                shape[0],
+                                shape[1],
+                                shape[2]));
+    }
+};
+
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
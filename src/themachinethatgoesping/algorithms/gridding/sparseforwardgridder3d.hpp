@@ -0,0 +1,419 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/sparseforwardgridder3d.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/tools/classhelper/objectprinter.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "forwardgridder3d.hpp"
+#include "functions/gridfunctions.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+
+namespace detail {
+/**
+ * @brief Open addressing (linear probing) hash map from linear cell index to accumulated
+ * value / weight. Keys, values and weights are stored in separate arrays. The capacity is a
+ * power of two and is doubled when the map is half full.
+ *
+ * @tparam t_float floating point type of the values / weights
+ */
+template<std::floating_point t_float>
+class SparseCellMap
+{
+    static constexpr uint64_t _empty_key = std::numeric_limits<uint64_t>::max();
+
+  public:
+    void add(const uint64_t key, const t_float value, const t_float weight)
+    {
+        if (2 * (_size + 1) > _keys.size())
+            _rehash(std::max<size_t>(64, 2 * _keys.size()));
+
+        const size_t slot = _find_slot(key);
+        if (_keys[slot] == _empty_key)
+        {
+            _keys[slot] = key;
+            ++_size;
+        }
+        _values[slot] += value;
+        _weights[slot] += weight;
+    }
+
+    void merge(const SparseCellMap& other)
+    {
+        for (size_t slot = 0; slot < other._keys.size(); ++slot)
+            if (other._keys[slot] != _empty_key)
+                add(other._keys[slot], other._values[slot], other._weights[slot]);
+    }
+
+    /**
+     * @brief Call function(key, value, weight) for all cells (in unspecified order)
+     */
+    template<typename t_function>
+    void for_each(const t_function& function) const
+    {
+        for (size_t slot = 0; slot < _keys.size(); ++slot)
+            if (_keys[slot] != _empty_key)
+                function(_keys[slot], _values[slot], _weights[slot]);
+    }
+
+    void clear()
+    {
+        _keys.clear();
+        _values.clear();
+        _weights.clear();
+        _size  = 0;
+        _shift = 64;
+    }
+
+    size_t size() const { return _size; }
+    size_t capacity() const { return _keys.size(); }
+
+  private:
+    std::vector<uint64_t> _keys;
+    std::vector<t_float>  _values;
+    std::vector<t_float>  _weights;
+    size_t                _size  = 0;
+    int                   _shift = 64; ///< 64 - log2(capacity)
+
+    size_t _find_slot(const uint64_t key) const
+    {
+        // fibonacci hashing (capacity is a power of two)
+        const size_t mask = _keys.size() - 1;
+        size_t       slot = size_t((key * 0x9E3779B97F4A7C15ull) >> _shift);
+
+        while (_keys[slot] != key && _keys[slot] != _empty_key)
+            slot = (slot + 1) & mask;
+
+        return slot;
+    }
+
+    void _rehash(const size_t capacity)
+    {
+        std::vector<uint64_t> keys(capacity, _empty_key);
+        std::vector<t_float>  values(capacity, 0);
+        std::vector<t_float>  weights(capacity, 0);
+
+        std::swap(keys, _keys);
+        std::swap(values, _values);
+        std::swap(weights, _weights);
+        _shift = 64 - std::countr_zero(capacity);
+
+        for (size_t slot = 0; slot < keys.size(); ++slot)
+        {
+            if (keys[slot] == _empty_key)
+                continue;
+
+            const size_t new_slot = _find_slot(keys[slot]);
+            _keys[new_slot]       = keys[slot];
+            _values[new_slot]     = values[slot];
+            _weights[new_slot]    = weights[slot];
+        }
+    }
+};
+} // namespace detail
+
+/**
+ * @brief Sparse (hash backed) version of ForwardGridder3D for very sparse data (e.g. bubble
+ * plumes or fish schools that fill only a small fraction of the grid). Only cells that received
+ * data are stored (open addressing hash map on the linear cell index), memory thus scales with
+ * the number of filled cells instead of nx * ny * nz. The dense images (get_images) or the list
+ * of filled cells (get_cells) are only created on request.
+ *
+ * The values / weights are the same as for ForwardGridder3D (up to floating point summation
+ * order for mp_cores > 1).
+ */
+template<std::floating_point t_float>
+class SparseForwardGridder3D
+{
+  public:
+    using t_image = xt::xtensor<t_float, 3>;
+
+    /**
+     * @brief Initialize sparse forward gridder
+     *
+     * @param gridder ForwardGridder3D that defines the grid parameters
+     */
+    explicit SparseForwardGridder3D(ForwardGridder3D<t_float> gridder)
+        : _gridder(std::move(gridder))
+        , _mins{ _gridder.get_xmin(), _gridder.get_ymin(), _gridder.get_zmin() }
+        , _ress{ _gridder.get_xres(), _gridder.get_yres(), _gridder.get_zres() }
+        , _ns{ _gridder.get_nx(), _gridder.get_ny(), _gridder.get_nz() }
+    {
+    }
+
+    // ----- interpolation -----
+    /**
+     * @brief Add 3D points to the sparse grid using block mean interpolation (each point is added
+     * to the nearest grid cell)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @param s_val amplitudes / volume backscattering coefficients (non-finite values are
+     * ignored)
+     * @param mp_cores Number of cores to use for parallelization (> 1: each thread accumulates
+     * into a private hash map that is merged at the end)
+     */
+    template<typename T_vector>
+    void interpolate_block_mean_inplace(const T_vector& sx,
+                                        const T_vector& sy,
+                                        const T_vector& sz,
+                                        const T_vector& s_val,
+                                        const int       mp_cores = 1)
+    {
+        _interpolate_inplace(
+            sx.size(),
+            [&](size_t i, auto&& add_to_cell) {
+                if (!std::isfinite(s_val[i]))
+                    return;
+
+                functions::detail::for_each_block_mean_cell(
+                    std::array{ t_float(sx[i]), t_float(sy[i]), t_float(sz[i]) },
+                    _mins,
+                    _ress,
+                    _ns,
+                    [&](const std::array<int, 3>& index, t_float weight) {
+                        add_to_cell(index, t_float(s_val[i]), weight);
+                    });
+            },
+            mp_cores);
+    }
+
+    /**
+     * @brief Add 3D points to the sparse grid using weighted mean interpolation (each point is
+     * distributed onto the 8 surrounding grid cells, weighted by the distance to the cell
+     * centers)
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @param s_val amplitudes / volume backscattering coefficients (non-finite values are
+     * ignored)
+     * @param mp_cores Number of cores to use for parallelization (> 1: each thread accumulates
+     * into a private hash map that is merged at the end)
+     */
+    template<typename T_vector>
+    void interpolate_weighted_mean_inplace(const T_vector& sx,
+                                           const T_vector& sy,
+                                           const T_vector& sz,
+                                           const T_vector& s_val,
+                                           const int       mp_cores = 1)
+    {
+        _interpolate_inplace(
+            sx.size(),
+            [&](size_t i, auto&& add_to_cell) {
+                if (!std::isfinite(s_val[i]))
+                    return;
+
+                functions::detail::for_each_weighted_mean_cell(
+                    std::array{ t_float(sx[i]), t_float(sy[i]), t_float(sz[i]) },
+                    _mins,
+                    _ress,
+                    _ns,
+                    [&](const std::array<int, 3>& index, t_float weight) {
+                        add_to_cell(index, t_float(s_val[i]), weight);
+                    });
+            },
+            mp_cores);
+    }
+
+    /**
+     * @brief Remove all accumulated data (and release the memory)
+     */
+    void clear() { _cells.clear(); }
+
+    // ----- conversion -----
+    /**
+     * @brief Get the filled cells as coordinate lists (sorted by linear cell index, i.e. x major)
+     *
+     * @return std::tuple<xt::xtensor<int, 1>, xt::xtensor<int, 1>, xt::xtensor<int, 1>,
+     * xt::xtensor<t_float, 1>, xt::xtensor<t_float, 1>> ix, iy, iz, values, weights
+     */
+    std::tuple<xt::xtensor<int, 1>,
+               xt::xtensor<int, 1>,
+               xt::xtensor<int, 1>,
+               xt::xtensor<t_float, 1>,
+               xt::xtensor<t_float, 1>>
+    get_cells() const
+    {
+        std::vector<uint64_t> keys;
+        std::vector<t_float>  unsorted_values, unsorted_weights;
+        keys.reserve(_cells.size());
+        unsorted_values.reserve(_cells.size());
+        unsorted_weights.reserve(_cells.size());
+
+        _cells.for_each([&](uint64_t key, t_float value, t_float weight) {
+            keys.push_back(key);
+            unsorted_values.push_back(value);
+            unsorted_weights.push_back(weight);
+        });
+
+        std::vector<size_t> order(keys.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&keys](size_t a, size_t b) {
+            return keys[a] < keys[b];
+        });
+
+        const size_t            n       = keys.size();
+        xt::xtensor<int, 1>     ix      = xt::empty<int>({ n });
+        xt::xtensor<int, 1>     iy      = xt::empty<int>({ n });
+        xt::xtensor<int, 1>     iz      = xt::empty<int>({ n });
+        xt::xtensor<t_float, 1> values  = xt::empty<t_float>({ n });
+        xt::xtensor<t_float, 1> weights = xt::empty<t_float>({ n });
+
+        const uint64_t ny = uint64_t(_gridder.get_ny()), nz = uint64_t(_gridder.get_nz());
+        for (size_t i = 0; i < n; ++i)
+        {
+            const uint64_t key   = keys[order[i]];
+            ix.unchecked(i)      = int(key / (ny * nz));
+            iy.unchecked(i)      = int((key / nz) % ny);
+            iz.unchecked(i)      = int(key % nz);
+            values.unchecked(i)  = unsorted_values[order[i]];
+            weights.unchecked(i) = unsorted_weights[order[i]];
+        }
+
+        return std::make_tuple(ix, iy, iz, values, weights);
+    }
+
+    /**
+     * @brief Convert the sparse grid to dense values / weights images. This allocates
+     * nx * ny * nz cells and is thus only useful for grids that fit into memory.
+     *
+     * @return std::tuple<xt::xtensor<t_float, 3>, xt::xtensor<t_float, 3>> image_values,
+     * image_weights
+     */
+    std::tuple<t_image, t_image> get_images() const
+    {
+        auto [image_values, image_weights] = _gridder.template get_empty_grd_images<t_image>();
+
+        // linear cell index == flat (row major) index of the dense images
+        auto* values  = image_values.data();
+        auto* weights = image_weights.data();
+        _cells.for_each([&](uint64_t key, t_float value, t_float weight) {
+            values[key]  = value;
+            weights[key] = weight;
+        });
+
+        return std::make_tuple(image_values, image_weights);
+    }
+
+    // ----- getters -----
+    const ForwardGridder3D<t_float>& get_gridder() const { return _gridder; }
+
+    /**
+     * @brief Number of cells that received data
+     *
+     * @return size_t
+     */
+    size_t get_number_of_cells() const { return _cells.size(); }
+
+    /**
+     * @brief Number of allocated hash map slots (memory: capacity * (8 + 2 * sizeof(t_float))
+     * bytes)
+     *
+     * @return size_t
+     */
+    size_t get_capacity() const { return _cells.capacity(); }
+
+    // ----- objectprinter -----
+    tools::classhelper::ObjectPrinter __printer__(unsigned int float_precision,
+                                                  bool         superscript_exponents) const
+    {
+        tools::classhelper::ObjectPrinter printer(
+            "SparseForwardGridder3D", float_precision, superscript_exponents);
+
+        printer.register_section("sparse cells");
+        printer.register_value("number_of_cells", get_number_of_cells());
+        printer.register_value("capacity", get_capacity());
+
+        printer.register_section("grid");
+        printer.append(_gridder.__printer__(float_precision, superscript_exponents));
+
+        return printer;
+    }
+
+    // ----- class helper macros -----
+    __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
+
+  private:
+    ForwardGridder3D<t_float> _gridder;
+
+    // grid parameters in the layout of the functions::detail N-D kernels
+    std::array<t_float, 3> _mins;
+    std::array<t_float, 3> _ress;
+    std::array<int, 3>     _ns;
+
+    detail::SparseCellMap<t_float> _cells;
+
+    /**
+     * @brief Add all points to the hash map. for_each_cell(i, add_to_cell) calls
+     * add_to_cell(index, value, weight) for each grid cell (index: std::array<int, 3>) point i
+     * contributes to.
+     */
+    template<typename t_for_each_cell>
+    void _interpolate_inplace(const size_t           n_points,
+                              const t_for_each_cell& for_each_cell,
+                              const int              mp_cores)
+    {
+        const uint64_t ny = uint64_t(_ns[1]), nz = uint64_t(_ns[2]);
+
+        auto add_points = [&](size_t i_begin, size_t i_end, detail::SparseCellMap<t_float>& cells) {
+            for (size_t i = i_begin; i < i_end; ++i)
+                for_each_cell(
+                    i, [&](const std::array<int, 3>& index, t_float value, t_float weight) {
+                        cells.add((uint64_t(index[0]) * ny + uint64_t(index[1])) * nz +
+                                      uint64_t(index[2]),
+                                  value * weight,
+                                  weight);
+                    });
+        };
+
+        if (mp_cores <= 1 || n_points < 2)
+        {
+            add_points(0, n_points, _cells);
+            return;
+        }
+
+        const int threads = static_cast<int>(std::min<size_t>(size_t(mp_cores), n_points));
+        std::vector<detail::SparseCellMap<t_float>> thread_cells(threads);
+
+#pragma omp parallel for num_threads(threads) schedule(static, 1)
+        for (int t = 0; t < threads; ++t)
+            add_points(n_points * size_t(t) / size_t(threads),
+                       n_points * size_t(t + 1) / size_t(threads),
+                       thread_cells[t]);
+
+        for (const auto& cells : thread_cells)
+            _cells.merge(cells);
+    }
+};
+
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -0,0 +1,620 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/tiledforwardgridder3d.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <xtensor/containers/xtensor.hpp>
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <themachinethatgoesping/tools/classhelper/objectprinter.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "forwardgridder3d.hpp"
+#include "functions/gridfunctions.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace gridding {
+
+/**
+ * @brief Tiled (out-of-core) version of ForwardGridder3D. The grid is split into tiles of
+ * tile_nx * tile_ny * tile_nz cells. Only tiles that are touched by the interpolated points are
+ * allocated. Finished tiles can be flushed to a tile directory (one binary file per tile) to keep
+ * the memory bounded. Flushed tiles are reloaded automatically when they are touched again.
+ *
+ * A tile file exists while its tile is flushed: it is removed when the tile is reloaded and clear
+ * removes the files of all flushed tiles. The destructor does not remove tile files (copies of
+ * the gridder refer to the same files), call clear to clean up the tile directory.
+ *
+ * The results are identical to ForwardGridder3D (per cell the points are added in the same
+ * order).
+ */
+template<std::floating_point t_float>
+class TiledForwardGridder3D
+{
+  public:
+    using t_tile_index = std::array<int, 3>;
+    using t_image      = xt::xtensor<t_float, 3>;
+
+    /**
+     * @brief Initialize tiled forward gridder
+     *
+     * @param gridder ForwardGridder3D that defines the grid parameters
+     * @param tile_nx number of grid cells per tile in x
+     * @param tile_ny number of grid cells per tile in y
+     * @param tile_nz number of grid cells per tile in z
+     * @param tile_directory directory for flushed tiles (empty: flushing is not possible)
+     */
+    TiledForwardGridder3D(ForwardGridder3D<t_float> gridder,
+                          int                       tile_nx,
+                          int                       tile_ny,
+                          int                       tile_nz,
+                          std::string               tile_directory = "")
+        : _gridder(std::move(gridder))
+        , _mins{ _gridder.get_xmin(), _gridder.get_ymin(), _gridder.get_zmin() }
+        , _ress{ _gridder.get_xres(), _gridder.get_yres(), _gridder.get_zres() }
+        , _ns{ _gridder.get_nx(), _gridder.get_ny(), _gridder.get_nz() }
+        , _tile_nx(tile_nx)
+        , _tile_ny(tile_ny)
+        , _tile_nz(tile_nz)
+        , _tile_directory(std::move(tile_directory))
+    {
+        if (_tile_nx < 1 || _tile_ny < 1 || _tile_nz < 1)
+            throw std::runtime_error(fmt::format(
+                "ERROR[TiledForwardGridder3D]: tile sizes must be >= 1 (got {}, {}, {})",
+                _tile_nx,
+                _tile_ny,
+                _tile_nz));
+
+        if (!_tile_directory.empty())
+            std::filesystem::create_directories(_tile_directory);
+    }
+
+    // ----- interpolation -----
+    /**
+     * @brief Add 3D points to the tiles using block mean interpolation (each point is added to the
+     * nearest grid cell). Call get_images or get_tile_images to get the values / weights.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @param s_val amplitudes / volume backscattering coefficients (non-finite values are
+     * ignored)
+     * @param mp_cores Number of cores to use for parallelization (over tiles)
+     */
+    template<typename T_vector>
+    void interpolate_block_mean_inplace(const T_vector& sx,
+                                        const T_vector& sy,
+                                        const T_vector& sz,
+                                        const T_vector& s_val,
+                                        const int       mp_cores = 1)
+    {
+        _interpolate_inplace(
+            sx.size(),
+            [&](size_t i, auto&& add_to_cell) {
+                if (!std::isfinite(s_val[i]))
+                    return;
+
+                functions::detail::for_each_block_mean_cell(
+                    std::array{ t_float(sx[i]), t_float(sy[i]), t_float(sz[i]) },
+                    _mins,
+                    _ress,
+                    _ns,
+                    [&](const std::array<int, 3>& index, t_float weight) {
+                        add_to_cell(index, t_float(s_val[i]), weight);
+                    });
+            },
+            mp_cores);
+    }
+
+    /**
+     * @brief Add 3D points to the tiles using weighted mean interpolation (each point is
+     * distributed onto the 8 surrounding grid cells, weighted by the distance to the cell
+     * centers). Call get_images or get_tile_images to get the values / weights.
+     *
+     * @tparam T_vector
+     * @param sx x values
+     * @param sy y values
+     * @param sz z values
+     * @param s_val amplitudes / volume backscattering coefficients (non-finite values are
+     * ignored)
+     * @param mp_cores Number of cores to use for parallelization (over tiles)
+     */
+    template<typename T_vector>
+    void interpolate_weighted_mean_inplace(const T_vector& sx,
+                                           const T_vector& sy,
+                                           const T_vector& sz,
+                                           const T_vector& s_val,
+                                           const int       mp_cores = 1)
+    {
+        _interpolate_inplace(
+            sx.size(),
+            [&](size_t i, auto&& add_to_cell) {
+                if (!std::isfinite(s_val[i]))
+                    return;
+
+                functions::detail::for_each_weighted_mean_cell(
+                    std::array{ t_float(sx[i]), t_float(sy[i]), t_float(sz[i]) },
+                    _mins,
+                    _ress,
+                    _ns,
+                    [&](const std::array<int, 3>& index, t_float weight) {
+                        add_to_cell(index, t_float(s_val[i]), weight);
+                    });
+            },
+            mp_cores);
+    }
+
+    // ----- tile access -----
+    /**
+     * @brief Get the indices of all tiles that hold data (in memory or flushed)
+     *
+     * @return std::vector<t_tile_index> sorted tile indices
+     */
+    std::vector<t_tile_index> get_tile_indices() const
+    {
+        std::set<t_tile_index> tile_indices(_flushed_tiles.begin(), _flushed_tiles.end());
+        for (const auto& [tile_index, tile] : _tiles)
+            tile_indices.insert(tile_index);
+
+        return std::vector<t_tile_index>(tile_indices.begin(), tile_indices.end());
+    }
+
+    /**
+     * @brief Get the indices of the tiles that are currently held in memory
+     *
+     * @return std::vector<t_tile_index> sorted tile indices
+     */
+    std::vector<t_tile_index> get_loaded_tile_indices() const
+    {
+        std::vector<t_tile_index> tile_indices;
+        for (const auto& [tile_index, tile] : _tiles)
+            tile_indices.push_back(tile_index);
+
+        return tile_indices;
+    }
+
+    /**
+     * @brief Get the indices of the tiles that are flushed to the tile directory (and not loaded)
+     *
+     * @return std::vector<t_tile_index> sorted tile indices
+     */
+    std::vector<t_tile_index> get_flushed_tile_indices() const
+    {
+        return std::vector<t_tile_index>(_flushed_tiles.begin(), _flushed_tiles.end());
+    }
+
+    /**
+     * @brief Get the shape of a tile (tiles at the upper grid borders may be smaller than
+     * tile_nx * tile_ny * tile_nz)
+     *
+     * @param tile_index tile index (x, y, z)
+     * @return std::array<size_t, 3> number of cells of the tile in x, y and z
+     */
+    std::array<size_t, 3> get_tile_shape(const t_tile_index& tile_index) const
+    {
+        _check_tile_index(tile_index);
+
+        return { static_cast<size_t>(
+                     std::min(_tile_nx, _gridder.get_nx() - tile_index[0] * _tile_nx)),
+                 static_cast<size_t>(
+                     std::min(_tile_ny, _gridder.get_ny() - tile_index[1] * _tile_ny)),
+                 static_cast<size_t>(
+                     std::min(_tile_nz, _gridder.get_nz() - tile_index[2] * _tile_nz)) };
+    }
+
+    /**
+     * @brief Get the values / weights images of a single tile. Flushed tiles are read from the
+     * tile directory (without loading them), tiles without data return empty (zero) images.
+     *
+     * @param tile_index tile index (x, y, z)
+     * @return std::tuple<xt::xtensor<t_float, 3>, xt::xtensor<t_float, 3>> image_values,
+     * image_weights
+     */
+    std::tuple<t_image, t_image> get_tile_images(const t_tile_index& tile_index) const
+    {
+        auto it = _tiles.find(tile_index);
+        if (it != _tiles.end())
+            return it->second;
+
+        if (_flushed_tiles.contains(tile_index))
+            return _read_tile(tile_index);
+
+        return _empty_tile(tile_index);
+    }
+
+    /**
+     * @brief Assemble the full (dense) values / weights images from all tiles. This allocates
+     * nx * ny * nz cells and is thus only useful for grids that fit into memory.
+     *
+     * @return std::tuple<xt::xtensor<t_float, 3>, xt::xtensor<t_float, 3>> image_values,
+     * image_weights
+     */
+    std::tuple<t_image, t_image> get_images() const
+    {
+        auto [image_values, image_weights] = _gridder.template get_empty_grd_images<t_image>();
+
+        for (const auto& tile_index : get_tile_indices())
+        {
+            const auto [tile_values, tile_weights] = get_tile_images(tile_index);
+            const auto shape                       = get_tile_shape(tile_index);
+
+            const size_t x0 = size_t(tile_index[0]) * size_t(_tile_nx);
+            const size_t y0 = size_t(tile_index[1]) * size_t(_tile_ny);
+            const size_t z0 = size_t(tile_index[2]) * size_t(_tile_nz);
+
+            for (size_t ix = 0; ix < shape[0]; ++ix)
+                for (size_t iy = 0; iy < shape[1]; ++iy)
+                    for (size_t iz = 0; iz < shape[2]; ++iz)
+                    {
+                        image_values.unchecked(x0 + ix, y0 + iy, z0 + iz) =
+                            tile_values.unchecked(ix, iy, iz);
+                        image_weights.unchecked(x0 + ix, y0 + iy, z0 + iz) =
+                            tile_weights.unchecked(ix, iy, iz);
+                    }
+        }
+
+        return std::make_tuple(image_values, image_weights);
+    }
+
+    // ----- flushing -----
+    /**
+     * @brief Write the given tiles to the tile directory and release their memory. Tiles that
+     * are not loaded are ignored.
+     *
+     * @param tile_indices tiles to flush
+     */
+    void flush_tiles(const std::vector<t_tile_index>& tile_indices)
+    {
+        if (_tile_directory.empty())
+            throw std::runtime_error(
+                "ERROR[TiledForwardGridder3D::flush_tiles]: no tile directory specified!");
+
+        for (const auto& tile_index : tile_indices)
+        {
+            auto it = _tiles.find(tile_index);
+            if (it == _tiles.end())
+                continue;
+
+            _write_tile(tile_index, it->second);
+            _flushed_tiles.insert(tile_index);
+            _tiles.erase(it);
+        }
+    }
+
+    /**
+     * @brief Write all loaded tiles to the tile directory and release their memory
+     */
+    void flush_all_tiles() { flush_tiles(get_loaded_tile_indices()); }
+
+    /**
+     * @brief Release all loaded tiles and remove the files of all flushed tiles. The grid
+     * parameters and the tile directory are kept.
+     */
+    void clear()
+    {
+        _tiles.clear();
+
+        for (const auto& tile_index : _flushed_tiles)
+            std::filesystem::remove(get_tile_file(tile_index));
+        _flushed_tiles.clear();
+    }
+
+    /**
+     * @brief Get the path of the file that stores a flushed tile
+     *
+     * @param tile_index tile index (x, y, z)
+     * @return std::string file path
+     */
+    std::string get_tile_file(const t_tile_index& tile_index) const
+    {
+        return (std::filesystem::path(_tile_directory) /
+                fmt::format("tile_{}_{}_{}.bin", tile_index[0], tile_index[1], tile_index[2]))
+            .string();
+    }
+
+    // ----- getters -----
+    const ForwardGridder3D<t_float>& get_gridder() const { return _gridder; }
+    int                              get_tile_nx() const { return _tile_nx; }
+    int                              get_tile_ny() const { return _tile_ny; }
+    int                              get_tile_nz() const { return _tile_nz; }
+    const std::string&               get_tile_directory() const { return _tile_directory; }
+
+    int get_number_of_tiles_x() const { return (_gridder.get_nx() + _tile_nx - 1) / _tile_nx; }
+    int get_number_of_tiles_y() const { return (_gridder.get_ny() + _tile_ny - 1) / _tile_ny; }
+    int get_number_of_tiles_z() const { return (_gridder.get_nz() + _tile_nz - 1) / _tile_nz; }
+
+    // ----- objectprinter -----
+    tools::classhelper::ObjectPrinter __printer__(unsigned int float_precision,
+                                                  bool         superscript_exponents) const
+    {
+        tools::classhelper::ObjectPrinter printer(
+            "TiledForwardGridder3D", float_precision, superscript_exponents);
+
+        printer.register_section("tiles");
+        printer.register_value("tile_nx", _tile_nx);
+        printer.register_value("tile_ny", _tile_ny);
+        printer.register_value("tile_nz", _tile_nz);
+        printer.register_string("tile_directory", _tile_directory);
+        printer.register_value("loaded_tiles", _tiles.size());
+        printer.register_value("flushed_tiles", _flushed_tiles.size());
+
+        printer.register_section("grid");
+        printer.append(_gridder.__printer__(float_precision, superscript_exponents));
+
+        return printer;
+    }
+
+    // ----- class helper macros -----
+    __CLASSHELPER_DEFAULT_PRINTING_FUNCTIONS__
+
+  private:
+    ForwardGridder3D<t_float> _gridder;
+
+    // grid parameters in the layout of the functions::detail N-D kernels
+    std::array<t_float, 3> _mins;
+    std::array<t_float, 3> _ress;
+    std::array<int, 3>     _ns;
+
+    int         _tile_nx, _tile_ny, _tile_nz;
+    std::string _tile_directory;
+
+    std::map<t_tile_index, std::tuple<t_image, t_image>> _tiles;
+    std::set<t_tile_index>                               _flushed_tiles;
+
+    /**
+     * @brief Distribute the points onto the tiles and add them to the tile images.
+     * for_each_cell(i, add_to_cell) must call add_to_cell(index, value, weight) for each grid
+     * cell (index: std::array<int, 3>) the point i contributes to. The points are processed in
+     * blocks of max_block_points: for_each_cell is called once per point (in parallel over point
+     * chunks), the contributions are sorted into the touched tiles (stable counting sort, so per
+     * cell the points keep their order) and the tiles are processed in parallel.
+     *
+     * @param n_points number of points
+     * @param for_each_cell callable (size_t i, auto&& add_to_cell)
+     * @param mp_cores Number of cores to use for parallelization
+     */
+    template<typename t_for_each_cell>
+    void _interpolate_inplace(const size_t           n_points,
+                              const t_for_each_cell& for_each_cell,
+                              const int              mp_cores)
+    {
+        // bounds the buffered contributions (at most 8 per point)
+        static constexpr size_t max_block_points = size_t(1) << 16;
+
+        if (n_points == 0)
+            return;
+
+        // contribution of a point to a grid cell. tile: flat tile id (later: job index),
+        // cell: offset of the cell within the tile images
+        struct t_contribution
+        {
+            int64_t tile;
+            size_t  cell;
+            t_float value;
+            t_float weight;
+        };
+
+        const int threads = static_cast<int>(
+            std::min({ size_t(std::max(mp_cores, 1)), n_points, max_block_points }));
+
+        const int64_t n_tiles_y = get_number_of_tiles_y();
+        const int64_t n_tiles_z = get_number_of_tiles_z();
+
+        // buffers, reused for all blocks
+        std::vector<std::vector<t_contribution>>   chunk_contributions(threads);
+        std::vector<std::vector<int64_t>>          chunk_tiles(threads);
+        std::vector<int64_t>                       tiles;
+        std::vector<size_t>                        job_offsets;
+        std::vector<t_contribution>                contributions;
+        std::vector<std::tuple<t_image, t_image>*> jobs;
+
+        for (size_t block_begin = 0; block_begin < n_points; block_begin += max_block_points)
+        {
+            const size_t block_size = std::min(max_block_points, n_points - block_begin);
+
+            // evaluate the footprint of each point once (point chunks per thread)
+#pragma omp parallel for num_threads(threads) schedule(static, 1)
+            for (int t = 0; t < threads; ++t)
+            {
+                const size_t i_begin = block_begin + block_size * size_t(t) / size_t(threads);
+                const size_t i_end   = block_begin + block_size * size_t(t + 1) / size_t(threads);
+
+                auto& chunk          = chunk_contributions[t];
+                auto& chunk_tile_ids = chunk_tiles[t];
+                chunk.clear();
+                chunk_tile_ids.clear();
+
+                for (size_t i = i_begin; i < i_end; ++i)
+                    for_each_cell(i, [&](const std::array<int, 3>& index, t_float v, t_float w) {
+                        const int tx = index[0] / _tile_nx;
+                        const int ty = index[1] / _tile_ny;
+                        const int tz = index[2] / _tile_nz;
+
+                        // tiles at the upper grid borders may be smaller
+                        const size_t ny   = size_t(std::min(_tile_ny, _ns[1] - ty * _tile_ny));
+                        const size_t nz   = size_t(std::min(_tile_nz, _ns[2] - tz * _tile_nz));
+                        const size_t cell = (size_t(index[0] - tx * _tile_nx) * ny +
+                                             size_t(index[1] - ty * _tile_ny)) *
+                                                nz +
+                                            size_t(index[2] - tz * _tile_nz);
+
+                        const int64_t tile = (tx * n_tiles_y + ty) * n_tiles_z + tz;
+                        chunk.push_back({ tile, cell, v * w, w });
+                        if (chunk_tile_ids.empty() || chunk_tile_ids.back() != tile)
+                            chunk_tile_ids.push_back(tile);
+                    });
+
+                std::sort(chunk_tile_ids.begin(), chunk_tile_ids.end());
+                chunk_tile_ids.erase(std::unique(chunk_tile_ids.begin(), chunk_tile_ids.end()),
+                                     chunk_tile_ids.end());
+            }
+
+            // touched tiles (sorted by tile index)
+            tiles.clear();
+            for (const auto& chunk_tile_ids : chunk_tiles)
+                tiles.insert(tiles.end(), chunk_tile_ids.begin(), chunk_tile_ids.end());
+            std::sort(tiles.begin(), tiles.end());
+            tiles.erase(std::unique(tiles.begin(), tiles.end()), tiles.end());
+
+            const size_t n_jobs = tiles.size();
+
+            // stable counting sort of the contributions into the tiles
+            job_offsets.assign(n_jobs * threads + 1, 0);
+
+#pragma omp parallel for num_threads(threads) schedule(static, 1)
+            for (int t = 0; t < threads; ++t)
+                for (auto& contribution : chunk_contributions[t])
+                {
+                    contribution.tile =
+                        std::lower_bound(tiles.begin(), tiles.end(), contribution.tile) -
+                        tiles.begin();
+                    ++job_offsets[size_t(contribution.tile) * threads + t + 1];
+                }
+            for (size_t k = 1; k < job_offsets.size(); ++k)
+                job_offsets[k] += job_offsets[k - 1];
+
+            contributions.resize(job_offsets.back());
+
+#pragma omp parallel for num_threads(threads) schedule(static, 1)
+            for (int t = 0; t < threads; ++t)
+            {
+                std::vector<size_t> fill(n_jobs);
+                for (size_t j = 0; j < n_jobs; ++j)
+                    fill[j] = job_offsets[j * threads + t];
+
+                for (const auto& contribution : chunk_contributions[t])
+                    contributions[fill[contribution.tile]++] = contribution;
+            }
+
+            // allocate / reload the tiles (serial)
+            jobs.resize(n_jobs);
+            for (size_t j = 0; j < n_jobs; ++j)
+                jobs[j] = &_get_tile({ int(tiles[j] / (n_tiles_y * n_tiles_z)),
+                                       int(tiles[j] / n_tiles_z % n_tiles_y),
+                                       int(tiles[j] % n_tiles_z) });
+
+            // add the contributions to the tiles (tiles are independent)
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+            for (int64_t j = 0; j < int64_t(n_jobs); ++j)
+            {
+                t_float* values  = std::get<0>(*jobs[j]).data();
+                t_float* weights = std::get<1>(*jobs[j]).data();
+
+                for (size_t k = job_offsets[j * threads]; k < job_offsets[(j + 1) * threads];
+                     ++k)
+                {
+                    values[contributions[k].cell] += contributions[k].value;
+                    weights[contributions[k].cell] += contributions[k].weight;
+                }
+            }
+        }
+    }
+
+    void _check_tile_index(const t_tile_index& tile_index) const
+    {
+        if (tile_index[0] < 0 || tile_index[1] < 0 || tile_index[2] < 0 ||
+            tile_index[0] >= get_number_of_tiles_x() || tile_index[1] >= get_number_of_tiles_y() ||
+            tile_index[2] >= get_number_of_tiles_z())
+            throw std::runtime_error(
+                fmt::format("ERROR[TiledForwardGridder3D]: tile index ({}, {}, {}) out of range",
+                            tile_index[0],
+                            tile_index[1],
+                            tile_index[2]));
+    }
+
+    std::tuple<t_image, t_image> _empty_tile(const t_tile_index& tile_index) const
+    {
+        const auto shape = get_tile_shape(tile_index);
+
+        t_image values  = xt::zeros<t_float>({ shape[0], shape[1], shape[2] });
+        t_image weights = xt::zeros<t_float>({ shape[0], shape[1], shape[2] });
+
+        return std::make_tuple(std::move(values), std::move(weights));
+    }
+
+    std::tuple<t_image, t_image>& _get_tile(const t_tile_index& tile_index)
+    {
+        auto it = _tiles.find(tile_index);
+        if (it != _tiles.end())
+            return it->second;
+
+        if (_flushed_tiles.contains(tile_index))
+        {
+            auto& tile = _tiles.emplace(tile_index, _read_tile(tile_index)).first->second;
+            _flushed_tiles.erase(tile_index);
+            std::filesystem::remove(get_tile_file(tile_index));
+            return tile;
+        }
+
+        return _tiles.emplace(tile_index, _empty_tile(tile_index)).first->second;
+    }
+
+    void _write_tile(const t_tile_index& tile_index, const std::tuple<t_image, t_image>& tile) const
+    {
+        std::ofstream ofs(get_tile_file(tile_index), std::ios::binary | std::ios::trunc);
+        if (!ofs)
+            throw std::runtime_error(
+                fmt::format("ERROR[TiledForwardGridder3D]: could not open tile file '{}'",
+                            get_tile_file(tile_index)));
+
+        for (const auto* image : { &std::get<0>(tile), &std::get<1>(tile) })
+            ofs.write(reinterpret_cast<const char*>(image->data()),
+                      sizeof(t_float) * image->size());
+        ofs.flush();
+
+        if (!ofs)
+            throw std::runtime_error(
+                fmt::format("ERROR[TiledForwardGridder3D]: could not write tile file '{}'",
+                            get_tile_file(tile_index)));
+    }
+
+    std::tuple<t_image, t_image> _read_tile(const t_tile_index& tile_index) const
+    {
+        std::ifstream ifs(get_tile_file(tile_index), std::ios::binary);
+        if (!ifs)
+            throw std::runtime_error(
+                fmt::format("ERROR[TiledForwardGridder3D]: could not open tile file '{}'",
+                            get_tile_file(tile_index)));
+
+        auto tile = _empty_tile(tile_index);
+
+        for (auto* image : { &std::get<0>(tile), &std::get<1>(tile) })
+        {
+            const std::streamsize n_bytes = sizeof(t_float) * image->size();
+            ifs.read(reinterpret_cast<char*>(image->data()), n_bytes);
+
+            if (!ifs || ifs.gcount() != n_bytes)
+                throw std::runtime_error(fmt::format(
+                    "ERROR[TiledForwardGridder3D]: could not read tile file '{}' (truncated?)",
+                    get_tile_file(tile_index)));
+        }
+
+        return tile;
+    }
+};
+
+} // namespace gridding
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -1,4 +1,4 @@
-//sourcehash: 5b1664917c6fd0f16c03ac7cebd0c467c5817a96a90cd8b9a475cd518054915a
+//sourcehash: 77e52242f241adcf83e67abc3bf4a3542567fedad33004dbfb45a6ca6810011c
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -9,6 +9,11 @@
 #include ".docstrings/functions.doc.hpp"
 
 #include "functions/backwardmapping.hpp"
+#include "functions/filters.hpp"
 #include "functions/find_local_maxima.hpp"
 #include "functions/find_local_maxima2.hpp"
+#include "functions/find_local_maxima_radius.hpp"
 #include "functions/grow_regions.hpp"
+#include "functions/label_connected_components.hpp"
+#include "functions/region_statistics.hpp"
+#include "functions/scan_order_buffers.hpp"
@@ -1,4 +1,4 @@
-//sourcehash: a60ef1677900792f2299b46d9585247f3697f338faafe868e8d108a55db4225c
+//sourcehash: ad9cf1c9c8cce4b06d5076a2ed47369f745388ebea1fb7efb9c339926a2d199e
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,6 +41,92 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan =
+R"doc(Precomputed backward mapping from a reference image grid (reference_x,
+reference_y) to a new image grid (new_x, new_y).
+
+The nearest indices and bilinear brackets only depend on one axis
+each, so they are computed once per axis (O(nx + ny)) when the plan is
+created. Applying the plan is a pure gather and can be repeated for
+any number of reference images that share the same axes (e.g. echogram
+tiles).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_BackwardMappingPlan = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_BackwardMappingPlan_2 =
+R"doc(Create a plan from (sorted) reference and new coordinate arrays
+
+Raises:
+    std: :invalid_argument: if a reference coordinate array is empty
+         while the matching new coordinate array is not)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_BackwardMappingPlan_3 =
+R"doc(Create a plan from uniform reference and new axes
+
+Raises:
+    std: :invalid_argument: if an axis is invalid (see UniformAxis))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_check_reference_shape = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_check_target_shape = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_for_each_bilinear =
+R"doc(Call store(ix, iy, value) with the bilinear interpolated value of each
+new cell)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_get_nearest_x = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_get_nearest_y = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_get_new_x_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_get_new_y_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_get_reference_x_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_get_reference_y_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_map_bilinear =
+R"doc(Map the reference image to the new grid using bilinear interpolation
+
+Raises:
+    std: :invalid_argument: if the reference image does not match the
+         reference axes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_map_bilinear_add =
+R"doc(Add the bilinear interpolated reference values to a target image on
+the new grid
+
+Raises:
+    std: :invalid_argument: if the reference image does not match the
+         reference axes or the target image does not match the new
+         axes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_map_nearest =
+R"doc(Map the reference image to the new grid using the nearest reference
+cell
+
+Raises:
+    std: :invalid_argument: if the reference image does not match the
+         reference axes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_map_nearest_add =
+R"doc(Add the nearest reference cell values to a target image on the new
+grid
+
+Raises:
+    std: :invalid_argument: if the reference image does not match the
+         reference axes or the target image does not match the new
+         axes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_reference_x_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_reference_y_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_x = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_BackwardMappingPlan_y = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_UniformAxis = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_UniformAxis_UniformAxis = R"doc()doc";
@@ -71,6 +157,25 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_fun
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_backward_map_nearest_add_2 = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_AxisMapping =
+R"doc(Per axis lookup tables of a backward mapping: for each new coordinate
+the nearest reference index and the bilinear bracket (lower index,
+upper index, weight of the upper index))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_AxisMapping_lower = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_AxisMapping_nearest = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_AxisMapping_resize = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_AxisMapping_set = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_AxisMapping_size = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_AxisMapping_upper = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_AxisMapping_weight = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_Bracket = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_Bracket_lower = R"doc()doc";
@@ -85,6 +190,10 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_fun
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_lower_bound_index = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_make_axis_mapping = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_make_axis_mapping_2 = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_nearest_index = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_nearest_index_uniform = R"doc()doc";
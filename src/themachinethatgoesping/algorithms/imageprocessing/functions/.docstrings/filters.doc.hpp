@@ -0,0 +1,198 @@
+//sourcehash: 368460572ae61f5d2facdaeecf9e1664f78e43fc039b9b1ac3903a5b8094477f
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_box_filter_inplace = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_box_filter_inplace_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_LineFilterBuffers =
+R"doc(Per thread scratch buffers of the line filters)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_LineFilterBuffers_first = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_LineFilterBuffers_g = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_LineFilterBuffers_h = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_LineFilterBuffers_second = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_StridedVolume =
+R"doc(Strided 2D or 3D tensor memory as 3 axes (2D tensors have a third axis
+of size 1))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_StridedVolume_data = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_StridedVolume_from_xtensor = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_StridedVolume_shape = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_StridedVolume_strides = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_box_filter_inplace = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_check_filter_sizes = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_convolve_symmetric_lanes =
+R"doc(NaN aware (normalized) convolution with a symmetric kernel (weights[0]
+is the center weight) along one axis of n_lanes parallel lines. NaNs
+and values outside the line are ignored (the weights of the valid
+values are normalized), windows without valid values result in NaN. If
+normalize is false, the weighted sums are returned instead and NaNs
+propagate. in and out may point to the same memory.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_extremum_filter_inplace = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_for_each_line_block =
+R"doc(Call f(line_begin, n, stride, n_lanes, lane_stride, buffers) for
+blocks of parallel lines along axis that cover the whole volume. The
+lanes are the last axis where possible (contiguous memory for row
+major tensors). The blocks are processed in parallel.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_gaussian_filter_inplace = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_median_filter_inplace =
+R"doc(In place median filter over the (clipped) box window of a strided
+volume. The x range is split into chunks (one per thread). Each chunk
+keeps the original values of the x planes within its window in a ring
+buffer. The planes behind the chunk (overwritten by the next chunk)
+are copied before any chunk is processed, so no second volume is
+allocated.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_min_of =
+R"doc(Minimum of a and b. If accept_nans is true, NaNs are ignored (the
+result is only NaN if both values are NaN), otherwise NaNs propagate
+(the result is NaN if any value is NaN).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_running_extremum_lanes =
+R"doc(Running maximum (t_maximum = true) or minimum with window 2 * radius +
+1 (van Herk / Gil-Werman) along one axis of n_lanes parallel lines.
+Element i of lane l is located at in[i * stride + l * lane_stride].
+The cost per element is constant (3 comparisons) regardless of the
+radius. Values outside the line are ignored (with accept_nans, a
+window that only contains NaNs results in NaN). in and out may point
+to the same memory.
+
+Args:
+    in: input values
+    out: output values (extremum of in[i - radius : i + radius + 1]
+         per lane)
+    n: number of elements per line
+    n_lanes: number of parallel lines
+    stride: distance between two elements of a line
+    lane_stride: distance between two lanes
+    radius: radius of the window
+    accept_nans: If true, NaNs are ignored, otherwise NaNs propagate
+                 (see max_of)
+    g: scratch buffer (prefix extrema, resized as needed)
+    h: scratch buffer (suffix extrema, resized as needed))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_running_max_lanes =
+R"doc(Running maximum with contiguous lanes (see running_extremum_lanes))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_running_max_planes =
+R"doc(Running maximum with window 2 * radius + 1 along a stream of n planes
+(van Herk / Gil-Werman, same windows as running_max_lanes along the
+plane axis). Only a ring of 2 * radius + 1 planes (window blocks,
+suffix maxima are computed in place) and one prefix maximum plane are
+stored, not the n planes. The planes are loaded in order, the maximum
+of plane i is passed to use_plane after loading plane i + radius.
+
+Args:
+    n: number of planes
+    plane_size: number of values per plane
+    radius: radius of the window
+    accept_nans: If true, NaNs are ignored, otherwise NaNs propagate
+                 (see max_of)
+    load_plane: callable (size_t i, t_value* plane) that writes plane
+                i (plane_size values)
+    use_plane: callable (size_t i, const t_value* max_plane) called
+               for i = 0 ... n - 1
+    ring: scratch buffer (ring of planes, resized as needed)
+    prefix: scratch buffer (prefix maxima, resized as needed)
+    max_plane: scratch buffer (output plane, resized as needed))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_running_mean_lanes =
+R"doc(NaN aware running mean with window 2 * radius + 1 along one axis of
+n_lanes parallel lines (prefix sums, constant cost per element). NaNs
+and values outside the line are ignored, windows without valid values
+result in NaN. Infinite values are counted separately (not summed) so
+that they only affect the windows that contain them: windows with +inf
+(-inf) result in +inf (-inf), windows with both result in NaN. If
+normalize is false, the window sums are returned instead and NaNs
+propagate (windows containing a NaN result in NaN). in and out may
+point to the same memory.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_separable_mean_filter_inplace =
+R"doc(Apply a separable NaN aware mean filter. filter_line(axis, line, n,
+stride, n_lanes, lane_stride, normalize, buffers) filters one block of
+lines along axis (see running_mean_lanes).
+
+Without NaNs the per axis normalized passes equal the full window mean
+and the filter is applied directly. Otherwise, normalizing per axis
+would result in a mean of means for windows with NaNs. In this case
+the NaNs are set to 0, the passes are applied without normalization to
+the values and to a volume of valid weights (1 for valid values, 0 for
+NaNs) and the value sums are divided by the weight sums once at the
+end.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_gaussian_filter_inplace = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_gaussian_filter_inplace_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_maximum_filter_inplace = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_maximum_filter_inplace_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_median_filter_inplace = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_median_filter_inplace_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_minimum_filter_inplace = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_minimum_filter_inplace_2 = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
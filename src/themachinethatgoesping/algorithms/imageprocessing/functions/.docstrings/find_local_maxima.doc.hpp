@@ -1,4 +1,4 @@
-//sourcehash: 471596f761afa82a5c11b33164701a62eb175d7505e62cbb764ad8bea66a8524
+//sourcehash: dd4d0233012f8b1d8319239fcbb698a865987ecfb3d8c9a9872af0a32077a18a
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,6 +41,22 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_max_of =
+R"doc(Maximum of a and b. If accept_nans is true, NaNs are ignored (the
+result is only NaN if both values are NaN), otherwise NaNs propagate
+(the result is NaN if any value is NaN).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_running_max_plane =
+R"doc(Running maximum (window 3) of one (y, z) plane of data: plane_max(y,
+z) is the maximum of data(x, y-1:y+2, z-1:z+2). Only the interior
+cells (1 <= y < ny-1, 1 <= z < nz-1) are computed. z_max is a scratch
+buffer of size ny * nz.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_running_max_row =
+R"doc(Running maximum (window 3) of one row of data: row_max(y) is the
+maximum of data(x, y-1:y+2). Only the interior cells (1 <= y < ny-1)
+are computed.)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_find_local_maxima = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_find_local_maxima_2 = R"doc()doc";
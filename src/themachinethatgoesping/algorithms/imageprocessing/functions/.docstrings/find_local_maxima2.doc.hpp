@@ -1,4 +1,4 @@
-//sourcehash: 3324ecdafb02c372332ca057b508813d9c0c04c79d58ea1a9f641e15bc9694a2
+//sourcehash: 7f05ab32a3a0b32ea2acc4482f4cdda4b82f5b4f473604d819067f4294adc213
 
 /*
   This file contains docstrings for use in the Python bindings.
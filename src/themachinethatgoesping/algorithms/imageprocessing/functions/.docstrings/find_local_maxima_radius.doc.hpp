@@ -0,0 +1,100 @@
+//sourcehash: dec1e17555ad77c8bb74259e3217d0a0ce0e413f150af41556f76efce79a3103
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers =
+R"doc(Per thread scratch buffers for find_local_maxima_radius)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_first =
+R"doc(< data plane and temporary plane)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_g = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_h = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_max_plane =
+R"doc(< plane ring and prefix maxima of running_max_planes)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_plane =
+R"doc(< van Herk / Gil-Werman prefix / suffix maxima)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_prefix =
+R"doc(< per plane maxima)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_ring =
+R"doc(< per plane maxima)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_second =
+R"doc(< data plane and temporary plane)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RunningMaxBuffers_tmp =
+R"doc(< van Herk / Gil-Werman prefix / suffix maxima)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_check_radius_parameters = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_plane_max =
+R"doc(Maxima of a (ny, nz) plane over the in-plane part of the structuring
+element. If lines is true: maximum over the y and z line segments
+through the cell. Otherwise maximum over the (2r+1) x (2r+1) square in
+the y, z plane.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_suppress_non_maxima =
+R"doc(Greedy non-maximum suppression: visit the candidates in order of
+decreasing value (ties: scan order) and keep a candidate only if no
+kept candidate is closer than min_distance (euclidean distance in
+cells). Uses a hash grid with cell size min_distance.
+
+Returns:
+    std::vector<size_t> indices of the kept candidates in ascending
+        order (scan order))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_find_local_maxima_radius = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_find_local_maxima_radius_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_find_local_maxima_radius_3 = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
@@ -1,4 +1,4 @@
-//sourcehash: 1302f6e20b9473035da2fcd37dd26f8e7e730237d740b8b9f022b498be72245a
+//sourcehash: c3c929f8dd8b51fbbd4ab89cc7c48eef05e5b7b3d82dab764b4cad56afb30771
 
 /*
   This file contains docstrings for use in the Python bindings.
@@ -41,6 +41,27 @@
 #endif
 
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_grow_regions_frontier =
+R"doc(Frontier based implementation of grow_regions_until_converged. The
+region labels and the data are accessed in place (element strides),
+cells are identified by their row major index. Iteration k only
+evaluates the cells in the neighborhood of the cells that changed in
+iteration k - 1 (the first iteration evaluates all cells). The
+decision for a cell only depends on its neighborhood, such that all
+other cells would not change anyways. The assignments of an iteration
+are computed from the labels of the previous iteration (as in
+grow_regions).
+
+Returns:
+    int64_t number of iterations that assigned at least one cell)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_grow_regions_frontier_2 =
+R"doc(Run grow_regions_frontier on the memory of N dimensional xtensors (no
+copies))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_is_non_null_neighbor =
+R"doc(Scalar version of get_non_null_mask)doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_get_non_null_mask = R"doc()doc";
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_grow_regions = R"doc()doc";
@@ -49,6 +70,12 @@ static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_fun
 
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_grow_regions_3 = R"doc()doc";
 
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_grow_regions_until_converged = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_grow_regions_until_converged_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_grow_regions_until_converged_3 = R"doc()doc";
+
 static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_is_null_region = R"doc()doc";
 
 #if defined(__GNUG__)
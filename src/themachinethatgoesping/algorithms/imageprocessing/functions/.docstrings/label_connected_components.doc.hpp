@@ -0,0 +1,88 @@
+//sourcehash: bd75b7a7734bb94bb0399017bbcb9693b2e2f7dacd0e5c17146f8adac0eca9b6
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_find_root =
+R"doc(Root of cell i in a union-find forest (path halving). Roots are the
+smallest cell index of their component.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_find_root_const =
+R"doc(Root of cell i without modifying the forest (safe for concurrent
+reads))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_get_backward_neighbor_offsets =
+R"doc(Offsets of the neighbors that precede a cell in scan order (first non
+zero offset is -1) for a connectivity given as the maximum number of
+non zero offsets (1: 4 / 6, 2: 8 / 18, 3: 26 connectivity).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_get_max_nonzero_offsets = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_label_connected_components_flat =
+R"doc(Union-find connected component labeling of a row major (flat)
+foreground mask.
+
+1. The x axis is split into slabs (one per thread). Each slab joins
+its cells with the preceding neighbors within the slab. 2. The slab
+borders are joined (serial, one plane per border). 3. The component
+roots are labeled in scan order (1, 2, ...) using a prefix sum over
+the number of roots per slab, then all cells are labeled (parallel).
+4. Voxel counts and bounding boxes are accumulated per slab and
+merged.
+
+Returns:
+    tuple(voxel counts, bounding box minima, bounding box maxima) per
+        label)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_unite =
+R"doc(Join the components of cell a and b. The smaller root becomes the root
+of the joined component (the root is the first cell of the component
+in scan order).)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_label_connected_components = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_label_connected_components_2 = R"doc()doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
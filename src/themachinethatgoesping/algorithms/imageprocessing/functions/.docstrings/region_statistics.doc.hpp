@@ -0,0 +1,144 @@
+//sourcehash: 3b8ac89bc76d8dc0e2a7e6b0a6afe40c2ae17c8d9f3a722478b51e05867a96d6
+
+/*
+  This file contains docstrings for use in the Python bindings.
+  Do not edit! They were automatically extracted by pybind11_mkdoc.
+
+  This is a modified version which allows for more than 8 arguments and includes def-guard
+ */
+
+#pragma once
+
+#ifndef __DOCSTRINGS_HPP__
+#define __DOCSTRINGS_HPP__
+
+#define MKD_EXPAND(x)                                      x
+#define MKD_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, COUNT, ...)  COUNT
+#define MKD_VA_SIZE(...)                                   MKD_EXPAND(MKD_COUNT(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define MKD_CAT1(a, b)                                     a ## b
+#define MKD_CAT2(a, b)                                     MKD_CAT1(a, b)
+#define MKD_DOC1(n1)                                       mkd_doc_##n1
+#define MKD_DOC2(n1, n2)                                   mkd_doc_##n1##_##n2
+#define MKD_DOC3(n1, n2, n3)                               mkd_doc_##n1##_##n2##_##n3
+#define MKD_DOC4(n1, n2, n3, n4)                           mkd_doc_##n1##_##n2##_##n3##_##n4
+#define MKD_DOC5(n1, n2, n3, n4, n5)                       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5
+#define MKD_DOC6(n1, n2, n3, n4, n5, n6)                   mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6
+#define MKD_DOC7(n1, n2, n3, n4, n5, n6, n7)               mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7
+#define MKD_DOC8(n1, n2, n3, n4, n5, n6, n7, n8)           mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8
+#define MKD_DOC9(n1, n2, n3, n4, n5, n6, n7, n8, n9)       mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9
+#define MKD_DOC10(n1, n2, n3, n4, n5, n6, n7, n8, n9, n10) mkd_doc_##n1##_##n2##_##n3##_##n4##_##n5##_##n6##_##n7##_##n8##_##n9##_##n10
+#define DOC(...)                                           MKD_EXPAND(MKD_EXPAND(MKD_CAT2(MKD_DOC, MKD_VA_SIZE(__VA_ARGS__)))(__VA_ARGS__))
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+#endif // __DOCSTRINGS_HPP__
+#if defined(__GNUG__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics =
+R"doc(Per region statistics table (one row per region, sorted by region
+label). Columns of the per data tables correspond to the data volumes.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_bbox_max =
+R"doc(< inclusive minimum cell index (n_regions, n_dims))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_bbox_min =
+R"doc(< mean cell index (n_regions, n_dims))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_centroids =
+R"doc(< number of cells per region)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_maxima =
+R"doc(< sums / valid_counts (n_regions, n_data))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_means =
+R"doc(< sum of the valid values (n_regions, n_data))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_regions = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_size =
+R"doc(< peak value, NaN if no valid value)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_sums =
+R"doc(< number of non NaN values (n_regions, n_data))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_valid_counts =
+R"doc(< inclusive maximum cell index (n_regions, n_dims))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_RegionStatistics_voxel_counts =
+R"doc(< region labels (sorted))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_compute_region_statistics = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_compute_region_statistics_2 = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator =
+R"doc(Accumulator for the statistics of one region)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_RegionAccumulator = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_add = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_add_cell = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_add_value = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_count = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_index_sum = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_max = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_maxima = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_min = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_sums = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulator_valid_counts = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators =
+R"doc(Per chunk (thread) region accumulators. Consecutive cells of the same
+region (runs along the last axis) only require one hash lookup.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_RegionAccumulators = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_accumulators = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_get = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_get_accumulators = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_get_index = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_index = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_last = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_last_region = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_RegionAccumulators_n_data = R"doc()doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_get_summed_value =
+R"doc(Value that is summed (linear if db_to_linear is true))doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_is_region_label =
+R"doc(True if region is a region label: not null_region (see is_null_region)
+and not NaN. NaN labels are always treated as null (as in
+get_non_null_mask), also if null_region is not NaN.)doc";
+
+static const char *mkd_doc_themachinethatgoesping_algorithms_imageprocessing_functions_detail_merge_region_accumulators =
+R"doc(Merge the per chunk accumulators into a RegionStatistics table (sorted
+by region))doc";
+
+#if defined(__GNUG__)
+#pragma GCC diagnostic pop
+#endif
+
+
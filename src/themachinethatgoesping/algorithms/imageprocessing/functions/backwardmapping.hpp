@@ -13,6 +13,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <themachinethatgoesping/tools/helper/xtensor.hpp>
 #include <xtensor/containers/xtensor.hpp>
@@ -248,8 +249,305 @@ inline Bracket bracket_indices_uniform(const UniformAxis& axis, const double inv
     return Bracket{ lower, upper, frac };
 }
 
+/**
+ * @brief Per axis lookup tables of a backward mapping: for each new coordinate the nearest
+ * reference index and the bilinear bracket (lower index, upper index, weight of the upper index)
+ */
+struct AxisMapping
+{
+    std::vector<size_t> nearest;
+    std::vector<size_t> lower;
+    std::vector<size_t> upper;
+    std::vector<double> weight;
+
+    void resize(const size_t size)
+    {
+        nearest.resize(size);
+        lower.resize(size);
+        upper.resize(size);
+        weight.resize(size);
+    }
+
+    void set(const size_t index, const size_t nearest_index, const Bracket& bracket)
+    {
+        nearest[index] = nearest_index;
+        lower[index]   = bracket.lower;
+        upper[index]   = bracket.upper;
+        weight[index]  = bracket.weight;
+    }
+
+    size_t size() const { return nearest.size(); }
+};
+
+template<tools::helper::c_xtensor_1d t_xtensor_ref, tools::helper::c_xtensor_1d t_xtensor_new>
+inline AxisMapping make_axis_mapping(const t_xtensor_ref& coords, const t_xtensor_new& new_coords)
+{
+    AxisMapping mapping;
+    mapping.resize(new_coords.size());
+
+    for (size_t i = 0; i < new_coords.size(); ++i)
+        mapping.set(i, nearest_index(coords, new_coords(i)), bracket_indices(coords, new_coords(i)));
+
+    return mapping;
+}
+
+inline AxisMapping make_axis_mapping(const UniformAxis& axis, const UniformAxis& new_axis)
+{
+    AxisMapping mapping;
+    mapping.resize(new_axis.size);
+
+    const double inv_spacing = (axis.size > 1) ? 1.0 / axis.spacing : 0.0;
+
+    for (size_t i = 0; i < new_axis.size; ++i)
+    {
+        const double coord = new_axis.origin + new_axis.spacing * static_cast<double>(i);
+
+        if (axis.size == 1)
+            mapping.set(i, 0, Bracket{ 0, 0, 0.0 });
+        else
+            mapping.set(i,
+                        nearest_index_uniform(axis, inv_spacing, coord),
+                        bracket_indices_uniform(axis, inv_spacing, coord));
+    }
+
+    return mapping;
+}
+
 } // namespace detail
 
+/**
+ * @brief Precomputed backward mapping from a reference image grid (reference_x, reference_y) to a
+ * new image grid (new_x, new_y).
+ *
+ * The nearest indices and bilinear brackets only depend on one axis each, so they are computed
+ * once per axis (O(nx + ny)) when the plan is created. Applying the plan is a pure gather and can
+ * be repeated for any number of reference images that share the same axes (e.g. echogram tiles).
+ */
+class BackwardMappingPlan
+{
+    size_t              _reference_x_size = 0;
+    size_t              _reference_y_size = 0;
+    detail::AxisMapping _x;
+    detail::AxisMapping _y;
+
+  public:
+    BackwardMappingPlan() = default;
+
+    /**
+     * @brief Create a plan from (sorted) reference and new coordinate arrays
+     *
+     * @throws std::invalid_argument if a reference coordinate array is empty while the matching
+     *         new coordinate array is not
+     */
+    template<tools::helper::c_xtensor_1d t_xtensor_ref_x,
+             tools::helper::c_xtensor_1d t_xtensor_ref_y,
+             tools::helper::c_xtensor_1d t_xtensor_new_x,
+             tools::helper::c_xtensor_1d t_xtensor_new_y>
+    BackwardMappingPlan(const t_xtensor_ref_x& reference_x,
+                        const t_xtensor_ref_y& reference_y,
+                        const t_xtensor_new_x& new_x,
+                        const t_xtensor_new_y& new_y)
+        : _reference_x_size(reference_x.size())
+        , _reference_y_size(reference_y.size())
+        , _x(detail::make_axis_mapping(reference_x, new_x))
+        , _y(detail::make_axis_mapping(reference_y, new_y))
+    {
+    }
+
+    /**
+     * @brief Create a plan from uniform reference and new axes
+     *
+     * @throws std::invalid_argument if an axis is invalid (see UniformAxis)
+     */
+    BackwardMappingPlan(const UniformAxis& reference_x,
+                        const UniformAxis& reference_y,
+                        const UniformAxis& new_x,
+                        const UniformAxis& new_y)
+    {
+        detail::validate_uniform_axis(reference_x, "reference_x");
+        detail::validate_uniform_axis(reference_y, "reference_y");
+        detail::validate_uniform_axis(new_x, "new_x", true);
+        detail::validate_uniform_axis(new_y, "new_y", true);
+
+        _reference_x_size = reference_x.size;
+        _reference_y_size = reference_y.size;
+        _x                = detail::make_axis_mapping(reference_x, new_x);
+        _y                = detail::make_axis_mapping(reference_y, new_y);
+    }
+
+    size_t get_reference_x_size() const { return _reference_x_size; }
+    size_t get_reference_y_size() const { return _reference_y_size; }
+    size_t get_new_x_size() const { return _x.size(); }
+    size_t get_new_y_size() const { return _y.size(); }
+
+    const std::vector<size_t>& get_nearest_x() const { return _x.nearest; }
+    const std::vector<size_t>& get_nearest_y() const { return _y.nearest; }
+
+    /**
+     * @brief Map the reference image to the new grid using the nearest reference cell
+     *
+     * @throws std::invalid_argument if the reference image does not match the reference axes
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d>
+    xt::xtensor<typename t_xtensor_2d::value_type, 2> map_nearest(const t_xtensor_2d& reference,
+                                                                  const int mp_cores = 1) const
+    {
+        using value_type = typename t_xtensor_2d::value_type;
+
+        check_reference_shape(reference);
+
+        auto output = xt::xtensor<value_type, 2>::from_shape({ _x.size(), _y.size() });
+
+        const int     threads    = std::max(1, mp_cores);
+        const size_t  new_y_size = _y.size();
+        const size_t* nearest_y  = _y.nearest.data();
+
+#pragma omp parallel for if (threads > 1) num_threads(threads)
+        for (size_t ix = 0; ix < _x.size(); ++ix)
+        {
+            const size_t ref_ix = _x.nearest[ix];
+
+            for (size_t iy = 0; iy < new_y_size; ++iy)
+                output.unchecked(ix, iy) = reference.unchecked(ref_ix, nearest_y[iy]);
+        }
+
+        return output;
+    }
+
+    /**
+     * @brief Map the reference image to the new grid using bilinear interpolation
+     *
+     * @throws std::invalid_argument if the reference image does not match the reference axes
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d>
+    xt::xtensor<typename t_xtensor_2d::value_type, 2> map_bilinear(const t_xtensor_2d& reference,
+                                                                   const int mp_cores = 1) const
+    {
+        using value_type = typename t_xtensor_2d::value_type;
+
+        check_reference_shape(reference);
+
+        auto output = xt::xtensor<value_type, 2>::from_shape({ _x.size(), _y.size() });
+
+        for_each_bilinear(reference, mp_cores, [&output](size_t ix, size_t iy, double value) {
+            output.unchecked(ix, iy) = static_cast<value_type>(value);
+        });
+
+        return output;
+    }
+
+    /**
+     * @brief Add the nearest reference cell values to a target image on the new grid
+     *
+     * @throws std::invalid_argument if the reference image does not match the reference axes or
+     *         the target image does not match the new axes
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_reference,
+             tools::helper::c_xtensor_2d t_xtensor_target>
+    void map_nearest_add(const t_xtensor_reference& reference,
+                         t_xtensor_target&          target,
+                         const int                  mp_cores = 1) const
+    {
+        using target_value_type = typename t_xtensor_target::value_type;
+
+        check_reference_shape(reference);
+        check_target_shape(target);
+
+        const int     threads    = std::max(1, mp_cores);
+        const size_t  new_y_size = _y.size();
+        const size_t* nearest_y  = _y.nearest.data();
+
+#pragma omp parallel for if (threads > 1) num_threads(threads)
+        for (size_t ix = 0; ix < _x.size(); ++ix)
+        {
+            const size_t ref_ix = _x.nearest[ix];
+
+            for (size_t iy = 0; iy < new_y_size; ++iy)
+                target.unchecked(ix, iy) +=
+                    static_cast<target_value_type>(reference.unchecked(ref_ix, nearest_y[iy]));
+        }
+    }
+
+    /**
+     * @brief Add the bilinear interpolated reference values to a target image on the new grid
+     *
+     * @throws std::invalid_argument if the reference image does not match the reference axes or
+     *         the target image does not match the new axes
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_reference,
+             tools::helper::c_xtensor_2d t_xtensor_target>
+    void map_bilinear_add(const t_xtensor_reference& reference,
+                          t_xtensor_target&          target,
+                          const int                  mp_cores = 1) const
+    {
+        using target_value_type = typename t_xtensor_target::value_type;
+
+        check_reference_shape(reference);
+        check_target_shape(target);
+
+        for_each_bilinear(reference, mp_cores, [&target](size_t ix, size_t iy, double value) {
+            target.unchecked(ix, iy) += static_cast<target_value_type>(value);
+        });
+    }
+
+  private:
+    template<tools::helper::c_xtensor_2d t_xtensor_2d>
+    void check_reference_shape(const t_xtensor_2d& reference) const
+    {
+        if (reference.shape()[0] != _reference_x_size || reference.shape()[1] != _reference_y_size)
+            throw std::invalid_argument(
+                "Reference image shape must match the reference axes of the mapping plan");
+    }
+
+    template<tools::helper::c_xtensor_2d t_xtensor_2d>
+    void check_target_shape(const t_xtensor_2d& target) const
+    {
+        if (target.shape()[0] != _x.size() || target.shape()[1] != _y.size())
+            throw std::invalid_argument(
+                "Target image shape must match the new axes of the mapping plan");
+    }
+
+    /**
+     * @brief Call store(ix, iy, value) with the bilinear interpolated value of each new cell
+     */
+    template<tools::helper::c_xtensor_2d t_xtensor_2d, typename t_store>
+    void for_each_bilinear(const t_xtensor_2d& reference,
+                           const int           mp_cores,
+                           const t_store&      store) const
+    {
+        const int     threads    = std::max(1, mp_cores);
+        const size_t  new_y_size = _y.size();
+        const size_t* lower_y    = _y.lower.data();
+        const size_t* upper_y    = _y.upper.data();
+        const double* weight_y   = _y.weight.data();
+
+#pragma omp parallel for if (threads > 1) num_threads(threads)
+        for (size_t ix = 0; ix < _x.size(); ++ix)
+        {
+            const size_t lower_x = _x.lower[ix];
+            const size_t upper_x = _x.upper[ix];
+            const double wx0     = 1.0 - _x.weight[ix];
+            const double wx1     = _x.weight[ix];
+
+            for (size_t iy = 0; iy < new_y_size; ++iy)
+            {
+                const auto& v00 = reference.unchecked(lower_x, lower_y[iy]);
+                const auto& v01 = reference.unchecked(lower_x, upper_y[iy]);
+                const auto& v10 = reference.unchecked(upper_x, lower_y[iy]);
+                const auto& v11 = reference.unchecked(upper_x, upper_y[iy]);
+
+                const double wy0 = 1.0 - weight_y[iy];
+                const double wy1 = weight_y[iy];
+
+                store(ix,
+                      iy,
+                      wx0 * (wy0 * static_cast<double>(v00) + wy1 * static_cast<double>(v01)) +
+                          wx1 * (wy0 * static_cast<double>(v10) + wy1 * static_cast<double>(v11)));
+            }
+        }
+    }
+};
+
 template<tools::helper::c_xtensor_2d t_xtensor_2d,
          tools::helper::c_xtensor_1d t_xtensor_ref_x,
          tools::helper::c_xtensor_1d t_xtensor_ref_y,
@@ -263,28 +561,11 @@ xt::xtensor<typename t_xtensor_2d::value_type, 2> backward_map_nearest(
     const t_xtensor_new_y& new_y,
     const int              mp_cores = 1)
 {
-    using value_type = typename t_xtensor_2d::value_type;
-
     if (std::cmp_not_equal(reference.shape()[0], reference_x.size()) ||
         std::cmp_not_equal(reference.shape()[1], reference_y.size()))
         throw std::invalid_argument("Reference coordinate arrays must match reference image shape");
 
-    auto output = xt::xtensor<value_type, 2>::from_shape({ new_x.size(), new_y.size() });
-
-    const int threads = std::max(1, mp_cores);
-
-#pragma omp parallel for collapse(2) if (threads > 1) num_threads(threads)
-    for (size_t ix = 0; ix < new_x.size(); ++ix)
-    {
-        for (size_t iy = 0; iy < new_y.size(); ++iy)
-        {
-            const auto ref_ix = detail::nearest_index(reference_x, new_x(ix));
-            const auto ref_iy = detail::nearest_index(reference_y, new_y(iy));
-            output(ix, iy)    = reference(ref_ix, ref_iy);
-        }
-    }
-
-    return output;
+    return BackwardMappingPlan(reference_x, reference_y, new_x, new_y).map_nearest(reference, mp_cores);
 }
 
 template<tools::helper::c_xtensor_2d t_xtensor_2d>
@@ -296,48 +577,12 @@ xt::xtensor<typename t_xtensor_2d::value_type, 2> backward_map_nearest(
     const UniformAxis&  new_y,
     const int           mp_cores = 1)
 {
-    using value_type = typename t_xtensor_2d::value_type;
-
-    detail::validate_uniform_axis(reference_x, "reference_x");
-    detail::validate_uniform_axis(reference_y, "reference_y");
-    detail::validate_uniform_axis(new_x, "new_x", true);
-    detail::validate_uniform_axis(new_y, "new_y", true);
+    const BackwardMappingPlan plan(reference_x, reference_y, new_x, new_y);
 
     if (reference.shape()[0] != reference_x.size || reference.shape()[1] != reference_y.size)
         throw std::invalid_argument("Reference axes must match reference image shape");
 
-    auto output = xt::xtensor<value_type, 2>::from_shape({ new_x.size, new_y.size });
-
-    const int    threads            = std::max(1, mp_cores);
-    const double inv_ref_x_spacing  = (reference_x.size > 1) ? 1.0 / reference_x.spacing : 0.0;
-    const double inv_ref_y_spacing  = (reference_y.size > 1) ? 1.0 / reference_y.spacing : 0.0;
-    const double new_x_origin       = new_x.origin;
-    const double new_x_spacing      = new_x.spacing;
-    const double new_y_origin       = new_y.origin;
-    const double new_y_spacing      = new_y.spacing;
-    const size_t new_x_size         = new_x.size;
-    const size_t new_y_size         = new_y.size;
-
-#pragma omp parallel for collapse(2) if (threads > 1) num_threads(threads)
-    for (size_t ix = 0; ix < new_x_size; ++ix)
-    {
-        for (size_t iy = 0; iy < new_y_size; ++iy)
-        {
-            const double coord_x = new_x_origin + new_x_spacing * static_cast<double>(ix);
-            const double coord_y = new_y_origin + new_y_spacing * static_cast<double>(iy);
-
-            const auto ref_ix = (reference_x.size == 1)
-                                    ? size_t{ 0 }
-                                    : detail::nearest_index_uniform(reference_x, inv_ref_x_spacing, coord_x);
-            const auto ref_iy = (reference_y.size == 1)
-                                    ? size_t{ 0 }
-                                    : detail::nearest_index_uniform(reference_y, inv_ref_y_spacing, coord_y);
-
-            output(ix, iy) = reference(ref_ix, ref_iy);
-        }
-    }
-
-    return output;
+    return plan.map_nearest(reference, mp_cores);
 }
 
 template<tools::helper::c_xtensor_2d t_xtensor_2d,
@@ -353,44 +598,11 @@ xt::xtensor<typename t_xtensor_2d::value_type, 2> backward_map_bilinear(
     const t_xtensor_new_y& new_y,
     const int              mp_cores = 1)
 {
-    using value_type = typename t_xtensor_2d::value_type;
-
     if (std::cmp_not_equal(reference.shape()[0], reference_x.size()) ||
         std::cmp_not_equal(reference.shape()[1], reference_y.size()))
         throw std::invalid_argument("Reference coordinate arrays must match reference image shape");
 
-    auto output = xt::xtensor<value_type, 2>::from_shape({ new_x.size(), new_y.size() });
-
-    const int threads = std::max(1, mp_cores);
-
-#pragma omp parallel for collapse(2) if (threads > 1) num_threads(threads)
-    for (size_t ix = 0; ix < new_x.size(); ++ix)
-    {
-        for (size_t iy = 0; iy < new_y.size(); ++iy)
-        {
-            const auto bx = detail::bracket_indices(reference_x, new_x(ix));
-            const auto by = detail::bracket_indices(reference_y, new_y(iy));
-
-            const auto& v00 = reference(bx.lower, by.lower);
-            const auto& v01 = reference(bx.lower, by.upper);
-            const auto& v10 = reference(bx.upper, by.lower);
-            const auto& v11 = reference(bx.upper, by.upper);
-
-            const double wx0 = 1.0 - bx.weight;
-            const double wx1 = bx.weight;
-            const double wy0 = 1.0 - by.weight;
-            const double wy1 = by.weight;
-
-            const double interpolated = wx0 * (wy0 * static_cast<double>(v00) +
-                                               wy1 * static_cast<double>(v01)) +
-                                         wx1 * (wy0 * static_cast<double>(v10) +
-                                               wy1 * static_cast<double>(v11));
-
-            output(ix, iy) = static_cast<value_type>(interpolated);
-        }
-    }
-
-    return output;
+    return BackwardMappingPlan(reference_x, reference_y, new_x, new_y).map_bilinear(reference, mp_cores);
 }
 
 template<tools::helper::c_xtensor_2d t_xtensor_2d>
@@ -402,61 +614,12 @@ xt::xtensor<typename t_xtensor_2d::value_type, 2> backward_map_bilinear(
     const UniformAxis&  new_y,
     const int           mp_cores = 1)
 {
-    using value_type = typename t_xtensor_2d::value_type;
-
-    detail::validate_uniform_axis(reference_x, "reference_x");
-    detail::validate_uniform_axis(reference_y, "reference_y");
-    detail::validate_uniform_axis(new_x, "new_x", true);
-    detail::validate_uniform_axis(new_y, "new_y", true);
+    const BackwardMappingPlan plan(reference_x, reference_y, new_x, new_y);
 
     if (reference.shape()[0] != reference_x.size || reference.shape()[1] != reference_y.size)
         throw std::invalid_argument("Reference axes must match reference image shape");
 
-    auto output = xt::xtensor<value_type, 2>::from_shape({ new_x.size, new_y.size });
-
-    const int    threads            = std::max(1, mp_cores);
-    const double inv_ref_x_spacing  = (reference_x.size > 1) ? 1.0 / reference_x.spacing : 0.0;
-    const double inv_ref_y_spacing  = (reference_y.size > 1) ? 1.0 / reference_y.spacing : 0.0;
-    const double new_x_origin       = new_x.origin;
-    const double new_x_spacing      = new_x.spacing;
-    const double new_y_origin       = new_y.origin;
-    const double new_y_spacing      = new_y.spacing;
-    const size_t new_x_size         = new_x.size;
-    const size_t new_y_size         = new_y.size;
-
-#pragma omp parallel for collapse(2) if (threads > 1) num_threads(threads)
-    for (size_t ix = 0; ix < new_x_size; ++ix)
-    {
-        for (size_t iy = 0; iy < new_y_size; ++iy)
-        {
-            const double coord_x = new_x_origin + new_x_spacing * static_cast<double>(ix);
-            const double coord_y = new_y_origin + new_y_spacing * static_cast<double>(iy);
-
-            const auto bx = (reference_x.size == 1)
-                                ? detail::Bracket{ 0, 0, 0.0 }
-                                : detail::bracket_indices_uniform(reference_x, inv_ref_x_spacing, coord_x);
-            const auto by = (reference_y.size == 1)
-                                ? detail::Bracket{ 0, 0, 0.0 }
-                                : detail::bracket_indices_uniform(reference_y, inv_ref_y_spacing, coord_y);
-
-            const auto& v00 = reference(bx.lower, by.lower);
-            const auto& v01 = reference(bx.lower, by.upper);
-            const auto& v10 = reference(bx.upper, by.lower);
-            const auto& v11 = reference(bx.upper, by.upper);
-
-            const double wx0 = 1.0 - bx.weight;
-            const double wx1 = bx.weight;
-            const double wy0 = 1.0 - by.weight;
-            const double wy1 = by.weight;
-
-            const double interpolated = wx0 * (wy0 * static_cast<double>(v00) + wy1 * static_cast<double>(v01)) +
-                                         wx1 * (wy0 * static_cast<double>(v10) + wy1 * static_cast<double>(v11));
-
-            output(ix, iy) = static_cast<value_type>(interpolated);
-        }
-    }
-
-    return output;
+    return plan.map_bilinear(reference, mp_cores);
 }
 
 template<tools::helper::c_xtensor_2d t_xtensor_reference,
@@ -474,8 +637,6 @@ void backward_map_nearest_add(
     const t_xtensor_target_y&     target_y,
     const int                     mp_cores = 1)
 {
-    using target_value_type = typename t_xtensor_target::value_type;
-
     if (std::cmp_not_equal(reference.shape()[0], reference_x.size()) ||
         std::cmp_not_equal(reference.shape()[1], reference_y.size()))
         throw std::invalid_argument("Reference coordinate arrays must match reference image shape");
@@ -484,18 +645,8 @@ void backward_map_nearest_add(
         std::cmp_not_equal(target.shape()[1], target_y.size()))
         throw std::invalid_argument("Target coordinate arrays must match target image shape");
 
-    const int threads = std::max(1, mp_cores);
-
-#pragma omp parallel for collapse(2) if (threads > 1) num_threads(threads)
-    for (size_t ix = 0; ix < target_x.size(); ++ix)
-    {
-        for (size_t iy = 0; iy < target_y.size(); ++iy)
-        {
-            const auto ref_ix = detail::nearest_index(reference_x, target_x(ix));
-            const auto ref_iy = detail::nearest_index(reference_y, target_y(iy));
-            target(ix, iy) += static_cast<target_value_type>(reference(ref_ix, ref_iy));
-        }
-    }
+    BackwardMappingPlan(reference_x, reference_y, target_x, target_y)
+        .map_nearest_add(reference, target, mp_cores);
 }
 
 template<tools::helper::c_xtensor_2d t_xtensor_reference, tools::helper::c_xtensor_2d t_xtensor_target>
@@ -508,12 +659,7 @@ void backward_map_nearest_add(
     const UniformAxis&         target_y,
     const int                  mp_cores = 1)
 {
-    using target_value_type = typename t_xtensor_target::value_type;
-
-    detail::validate_uniform_axis(reference_x, "reference_x");
-    detail::validate_uniform_axis(reference_y, "reference_y");
-    detail::validate_uniform_axis(target_x, "target_x", true);
-    detail::validate_uniform_axis(target_y, "target_y", true);
+    const BackwardMappingPlan plan(reference_x, reference_y, target_x, target_y);
 
     if (reference.shape()[0] != reference_x.size || reference.shape()[1] != reference_y.size)
         throw std::invalid_argument("Reference axes must match reference image shape");
@@ -521,34 +667,7 @@ void backward_map_nearest_add(
     if (target.shape()[0] != target_x.size || target.shape()[1] != target_y.size)
         throw std::invalid_argument("Target axes must match target image shape");
 
-    const int    threads            = std::max(1, mp_cores);
-    const double inv_ref_x_spacing  = (reference_x.size > 1) ? 1.0 / reference_x.spacing : 0.0;
-    const double inv_ref_y_spacing  = (reference_y.size > 1) ? 1.0 / reference_y.spacing : 0.0;
-    const double target_x_origin    = target_x.origin;
-    const double target_x_spacing   = target_x.spacing;
-    const double target_y_origin    = target_y.origin;
-    const double target_y_spacing   = target_y.spacing;
-    const size_t target_x_size      = target_x.size;
-    const size_t target_y_size      = target_y.size;
-
-#pragma omp parallel for collapse(2) if (threads > 1) num_threads(threads)
-    for (size_t ix = 0; ix < target_x_size; ++ix)
-    {
-        for (size_t iy = 0; iy < target_y_size; ++iy)
-        {
-            const double coord_x = target_x_origin + target_x_spacing * static_cast<double>(ix);
-            const double coord_y = target_y_origin + target_y_spacing * static_cast<double>(iy);
-
-            const auto ref_ix = (reference_x.size == 1)
-                                    ? size_t{ 0 }
-                                    : detail::nearest_index_uniform(reference_x, inv_ref_x_spacing, coord_x);
-            const auto ref_iy = (reference_y.size == 1)
-                                    ? size_t{ 0 }
-                                    : detail::nearest_index_uniform(reference_y, inv_ref_y_spacing, coord_y);
-
-            target(ix, iy) += static_cast<target_value_type>(reference(ref_ix, ref_iy));
-        }
-    }
+    plan.map_nearest_add(reference, target, mp_cores);
 }
 
 template<tools::helper::c_xtensor_2d t_xtensor_reference,
@@ -566,8 +685,6 @@ void backward_map_bilinear_add(
     const t_xtensor_target_y&     target_y,
     const int                     mp_cores = 1)
 {
-    using target_value_type = typename t_xtensor_target::value_type;
-
     if (std::cmp_not_equal(reference.shape()[0], reference_x.size()) ||
         std::cmp_not_equal(reference.shape()[1], reference_y.size()))
         throw std::invalid_argument("Reference coordinate arrays must match reference image shape");
@@ -576,34 +693,8 @@ void backward_map_bilinear_add(
         std::cmp_not_equal(target.shape()[1], target_y.size()))
         throw std::invalid_argument("Target coordinate arrays must match target image shape");
 
-    const int threads = std::max(1, mp_cores);
-
-#pragma omp parallel for collapse(2) if (threads > 1) num_threads(threads)
-    for (size_t ix = 0; ix < target_x.size(); ++ix)
-    {
-        for (size_t iy = 0; iy < target_y.size(); ++iy)
-        {
-            const auto bx = detail::bracket_indices(reference_x, target_x(ix));
-            const auto by = detail::bracket_indices(reference_y, target_y(iy));
-
-            const auto& v00 = reference(bx.lower, by.lower);
-            const auto& v01 = reference(bx.lower, by.upper);
-            const auto& v10 = reference(bx.upper, by.lower);
-            const auto& v11 = reference(bx.upper, by.upper);
-
-            const double wx0 = 1.0 - bx.weight;
-            const double wx1 = bx.weight;
-            const double wy0 = 1.0 - by.weight;
-            const double wy1 = by.weight;
-
-            const double interpolated = wx0 * (wy0 * static_cast<double>(v00) +
-                                               wy1 * static_cast<double>(v01)) +
-                                         wx1 * (wy0 * static_cast<double>(v10) +
-                                               wy1 * static_cast<double>(v11));
-
-            target(ix, iy) += static_cast<target_value_type>(interpolated);
-        }
-    }
+    BackwardMappingPlan(reference_x, reference_y, target_x, target_y)
+        .map_bilinear_add(reference, target, mp_cores);
 }
 
 template<tools::helper::c_xtensor_2d t_xtensor_reference, tools::helper::c_xtensor_2d t_xtensor_target>
@@ -616,12 +707,7 @@ void backward_map_bilinear_add(
     const UniformAxis&         target_y,
     const int                  mp_cores = 1)
 {
-    using target_value_type = typename t_xtensor_target::value_type;
-
-    detail::validate_uniform_axis(reference_x, "reference_x");
-    detail::validate_uniform_axis(reference_y, "reference_y");
-    detail::validate_uniform_axis(target_x, "target_x", true);
-    detail::validate_uniform_axis(target_y, "target_y", true);
+    const BackwardMappingPlan plan(reference_x, reference_y, target_x, target_y);
 
     if (reference.shape()[0] != reference_x.size || reference.shape()[1] != reference_y.size)
         throw std::invalid_argument("Reference axes must match reference image shape");
@@ -629,50 +715,10 @@ void backward_map_bilinear_add(
     if (target.shape()[0] != target_x.size || target.shape()[1] != target_y.size)
         throw std::invalid_argument("Target axes must match target image shape");
 
-    const int    threads            = std::max(1, mp_cores);
-    const double inv_ref_x_spacing  = (reference_x.size > 1) ? 1.0 / reference_x.spacing : 0.0;
-    const double inv_ref_y_spacing  = (reference_y.size > 1) ? 1.0 / reference_y.spacing : 0.0;
-    const double target_x_origin    = target_x.origin;
-    const double target_x_spacing   = target_x.spacing;
-    const double target_y_origin    = target_y.origin;
-    const double target_y_spacing   = target_y.spacing;
-    const size_t target_x_size      = target_x.size;
-    const size_t target_y_size      = target_y.size;
-
-#pragma omp parallel for collapse(2) if (threads > 1) num_threads(threads)
-    for (size_t ix = 0; ix < target_x_size; ++ix)
-    {
-        for (size_t iy = 0; iy < target_y_size; ++iy)
-        {
-            const double coord_x = target_x_origin + target_x_spacing * static_cast<double>(ix);
-            const double coord_y = target_y_origin + target_y_spacing * static_cast<double>(iy);
-
-            const auto bx = (reference_x.size == 1)
-                                ? detail::Bracket{ 0, 0, 0.0 }
-                                : detail::bracket_indices_uniform(reference_x, inv_ref_x_spacing, coord_x);
-            const auto by = (reference_y.size == 1)
-                                ? detail::Bracket{ 0, 0, 0.0 }
-                                : detail::bracket_indices_uniform(reference_y, inv_ref_y_spacing, coord_y);
-
-            const auto& v00 = reference(bx.lower, by.lower);
-            const auto& v01 = reference(bx.lower, by.upper);
-            const auto& v10 = reference(bx.upper, by.lower);
-            const auto& v11 = reference(bx.upper, by.upper);
-
-            const double wx0 = 1.0 - bx.weight;
-            const double wx1 = bx.weight;
-            const double wy0 = 1.0 - by.weight;
-            const double wy1 = by.weight;
-
-            const double interpolated = wx0 * (wy0 * static_cast<double>(v00) + wy1 * static_cast<double>(v01)) +
-                                         wx1 * (wy0 * static_cast<double>(v10) + wy1 * static_cast<double>(v11));
-
-            target(ix, iy) += static_cast<target_value_type>(interpolated);
-        }
-    }
+    plan.map_bilinear_add(reference, target, mp_cores);
 }
 
 } // namespace functions
 } // namespace imageprocessing
 } // namespace algorithms
-} // namespace themachinethatgoesping
\ No newline at end of file
+} // namespace themachinethatgoesping
@@ -0,0 +1,1127 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/filters.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "find_local_maxima.hpp"
+#include "scan_order_buffers.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace imageprocessing {
+namespace functions {
+
+namespace detail {
+/**
+ * @brief Minimum of a and b. If accept_nans is true, NaNs are ignored (the result is only NaN if
+ * both values are NaN), otherwise NaNs propagate (the result is NaN if any value is NaN).
+ */
+template<typename t_value>
+inline t_value min_of(const t_value a, const t_value b, const bool accept_nans)
+{
+    if constexpr (std::is_floating_point_v<t_value>)
+    {
+        if (accept_nans)
+            return (b < a || std::isnan(a)) ? b : a;
+
+        return (a < b || std::isnan(a)) ? a : b;
+    }
+
+    return a < b ? a : b;
+}
+
+/**
+ * @brief Running maximum (t_maximum = true) or minimum with window 2 * radius + 1
+ * (van Herk / Gil-Werman) along one axis of n_lanes parallel lines. Element i of lane l is
+ * located at in[i * stride + l * lane_stride]. The cost per element is constant (3 comparisons)
+ * regardless of the radius. Values outside the line are ignored (with accept_nans, a window
+ * that only contains NaNs results in NaN). in and out may point to the same memory.
+ *
+ * @param in input values
+ * @param out output values (extremum of in[i - radius : i + radius + 1] per lane)
+ * @param n number of elements per line
+ * @param n_lanes number of parallel lines
+ * @param stride distance between two elements of a line
+ * @param lane_stride distance between two lanes
+ * @param radius radius of the window
+ * @param accept_nans If true, NaNs are ignored, otherwise NaNs propagate (see max_of)
+ * @param g scratch buffer (prefix extrema, resized as needed)
+ * @param h scratch buffer (suffix extrema, resized as needed)
+ */
+template<bool t_maximum, typename t_value>
+inline void running_extremum_lanes(const t_value*        in,
+                                   t_value*              out,
+                                   const size_t          n,
+                                   const size_t          n_lanes,
+                                   const int64_t         stride,
+                                   const int64_t         lane_stride,
+                                   const size_t          radius,
+                                   const bool            accept_nans,
+                                   std::vector<t_value>& g,
+                                   std::vector<t_value>& h)
+{
+    if (n == 0 || n_lanes == 0)
+        return;
+
+    auto select = [accept_nans](const t_value a, const t_value b) {
+        if constexpr (t_maximum)
+            return max_of(a, b, accept_nans);
+        else
+            return min_of(a, b, accept_nans);
+    };
+
+    // the line is padded with radius elements on both sides so that each window has the full
+    // size. The padded line is split into blocks of window size
+    const size_t window   = 2 * radius + 1;
+    const size_t n_padded = ((n + 2 * radius + window - 1) / window) * window;
+
+    // padding values never win (NaN is ignored if accept_nans is true)
+    t_value pad = t_maximum ? std::numeric_limits<t_value>::lowest()
+                            : std::numeric_limits<t_value>::max();
+    if constexpr (std::is_floating_point_v<t_value>)
+        if (accept_nans)
+            pad = std::numeric_limits<t_value>::quiet_NaN();
+
+    g.resize(n_padded * n_lanes);
+    h.resize(n_padded * n_lanes);
+
+    for (size_t p = 0; p < n_padded; ++p)
+    {
+        t_value* h_p = h.data() + p * n_lanes;
+        if (p < radius || p >= n + radius)
+            std::fill_n(h_p, n_lanes, pad);
+        else
+        {
+            const t_value* in_p = in + int64_t(p - radius) * stride;
+            for (size_t l = 0; l < n_lanes; ++l)
+                h_p[l] = in_p[int64_t(l) * lane_stride];
+        }
+    }
+
+    // prefix extrema within each block
+    for (size_t p = 0; p < n_padded; ++p)
+    {
+        t_value*       g_p = g.data() + p * n_lanes;
+        const t_value* v_p = h.data() + p * n_lanes;
+
+        if (p % window == 0)
+            std::copy_n(v_p, n_lanes, g_p);
+        else
+        {
+            const t_value* g_prev = g_p - n_lanes;
+            for (size_t l = 0; l < n_lanes; ++l)
+                g_p[l] = select(g_prev[l], v_p[l]);
+        }
+    }
+
+    // suffix extrema within each block (in place)
+    for (size_t p = n_padded - 1; p-- > 0;)
+    {
+        if (p % window == window - 1)
+            continue;
+
+        t_value*       h_p    = h.data() + p * n_lanes;
+        const t_value* h_next = h_p + n_lanes;
+        for (size_t l = 0; l < n_lanes; ++l)
+            h_p[l] = select(h_p[l], h_next[l]);
+    }
+
+    // element i covers the padded range [i, i + 2 * radius]
+    for (size_t i = 0; i < n; ++i)
+    {
+        const t_value* h_i   = h.data() + i * n_lanes;
+        const t_value* g_i   = g.data() + (i + 2 * radius) * n_lanes;
+        t_value*       out_i = out + int64_t(i) * stride;
+        for (size_t l = 0; l < n_lanes; ++l)
+            out_i[int64_t(l) * lane_stride] = select(h_i[l], g_i[l]);
+    }
+}
+
+/**
+ * @brief Running maximum with contiguous lanes (see running_extremum_lanes)
+ */
+template<typename t_value>
+inline void running_max_lanes(const t_value*        in,
+                              t_value*              out,
+                              const size_t          n,
+                              const size_t          n_lanes,
+                              const size_t          stride,
+                              const size_t          radius,
+                              const bool            accept_nans,
+                              std::vector<t_value>& g,
+                              std::vector<t_value>& h)
+{
+    running_extremum_lanes<true>(
+        in, out, n, n_lanes, int64_t(stride), 1, radius, accept_nans, g, h);
+}
+
+/**
+ * @brief Running maximum with window 2 * radius + 1 along a stream of n planes (van Herk /
+ * Gil-Werman, same windows as running_max_lanes along the plane axis). Only a ring of
+ * 2 * radius + 1 planes (window blocks, suffix maxima are computed in place) and one prefix
+ * maximum plane are stored, not the n planes. The planes are loaded in order, the maximum of
+ * plane i is passed to use_plane after loading plane i + radius.
+ *
+ * @param n number of planes
+ * @param plane_size number of values per plane
+ * @param radius radius of the window
+ * @param accept_nans If true, NaNs are ignored, otherwise NaNs propagate (see max_of)
+ * @param load_plane callable (size_t i, t_value* plane) that writes plane i (plane_size values)
+ * @param use_plane callable (size_t i, const t_value* max_plane) called for i = 0 ... n - 1
+ * @param ring scratch buffer (ring of planes, resized as needed)
+ * @param prefix scratch buffer (prefix maxima, resized as needed)
+ * @param max_plane scratch buffer (output plane, resized as needed)
+ */
+template<typename t_value, typename t_load_plane, typename t_use_plane>
+inline void running_max_planes(const size_t          n,
+                               const size_t          plane_size,
+                               size_t                radius,
+                               const bool            accept_nans,
+                               const t_load_plane&   load_plane,
+                               const t_use_plane&    use_plane,
+                               std::vector<t_value>& ring,
+                               std::vector<t_value>& prefix,
+                               std::vector<t_value>& max_plane)
+{
+    if (n == 0 || plane_size == 0)
+        return;
+
+    // windows that cover the whole stream do not change for larger radii
+    radius              = std::min(radius, n - 1);
+    const size_t window = 2 * radius + 1;
+
+    // padding values never win (NaN is ignored if accept_nans is true)
+    t_value pad = std::numeric_limits<t_value>::lowest();
+    if constexpr (std::is_floating_point_v<t_value>)
+        if (accept_nans)
+            pad = std::numeric_limits<t_value>::quiet_NaN();
+
+    ring.resize(window * plane_size);
+    prefix.resize(plane_size);
+    max_plane.resize(plane_size);
+
+    // padded position p holds plane p - radius (padding outside [0, n)). The blocks start at
+    // multiples of window, so position p is stored in ring slot p % window
+    for (size_t p = 0; p < n + 2 * radius; ++p)
+    {
+        t_value* slot = ring.data() + (p % window) * plane_size;
+        if (p < radius || p >= n + radius)
+            std::fill_n(slot, plane_size, pad);
+        else
+            load_plane(p - radius, slot);
+
+        // prefix maxima within the block
+        if (p % window == 0)
+            std::copy_n(slot, plane_size, prefix.data());
+        else
+            for (size_t j = 0; j < plane_size; ++j)
+                prefix[j] = max_of(prefix[j], slot[j], accept_nans);
+
+        // block complete: suffix maxima within the block (in place)
+        if (p % window == window - 1)
+            for (size_t q = window - 1; q-- > 0;)
+            {
+                t_value*       h_q    = ring.data() + q * plane_size;
+                const t_value* h_next = h_q + plane_size;
+                for (size_t j = 0; j < plane_size; ++j)
+                    h_q[j] = max_of(h_q[j], h_next[j], accept_nans);
+            }
+
+        // plane i covers the padded range [i, i + 2 * radius], its suffix maxima are stored in
+        // the slot that is overwritten next
+        if (p >= 2 * radius)
+        {
+            const t_value* h_i = ring.data() + ((p + 1) % window) * plane_size;
+            for (size_t j = 0; j < plane_size; ++j)
+                max_plane[j] = max_of(h_i[j], prefix[j], accept_nans);
+
+            use_plane(p - 2 * radius, static_cast<const t_value*>(max_plane.data()));
+        }
+    }
+}
+
+/**
+ * @brief NaN aware running mean with window 2 * radius + 1 along one axis of n_lanes parallel
+ * lines (prefix sums, constant cost per element). NaNs and values outside the line are ignored,
+ * windows without valid values result in NaN. Infinite values are counted separately (not summed)
+ * so that they only affect the windows that contain them: windows with +inf (-inf) result in +inf
+ * (-inf), windows with both result in NaN. If normalize is false, the window sums are returned
+ * instead and NaNs propagate (windows containing a NaN result in NaN). in and out may point to
+ * the same memory.
+ */
+template<typename t_value>
+inline void running_mean_lanes(const t_value*       in,
+                               t_value*             out,
+                               const size_t         n,
+                               const size_t         n_lanes,
+                               const int64_t        stride,
+                               const int64_t        lane_stride,
+                               const size_t         radius,
+                               const bool           normalize,
+                               std::vector<double>& sums,
+                               std::vector<double>& counts)
+{
+    // counts holds 3 prefix counts per lane: valid values, +inf values, -inf values
+    sums.assign((n + 1) * n_lanes, 0.);
+    counts.assign((n + 1) * n_lanes * 3, 0.);
+
+    // prefix sums: sums[p] is the sum of the finite values in [0, p)
+    for (size_t p = 0; p < n; ++p)
+    {
+        const t_value* in_p = in + int64_t(p) * stride;
+        for (size_t l = 0; l < n_lanes; ++l)
+        {
+            const double value  = double(in_p[int64_t(l) * lane_stride]);
+            const bool   finite = std::isfinite(value);
+            const bool   pinf   = value == std::numeric_limits<double>::infinity();
+            const bool   ninf   = value == -std::numeric_limits<double>::infinity();
+
+            const double* counts_p = counts.data() + (p * n_lanes + l) * 3;
+            double*       counts_n = counts.data() + ((p + 1) * n_lanes + l) * 3;
+
+            sums[(p + 1) * n_lanes + l] = sums[p * n_lanes + l] + (finite ? value : 0.);
+            counts_n[0]                 = counts_p[0] + (std::isnan(value) ? 0. : 1.);
+            counts_n[1]                 = counts_p[1] + (pinf ? 1. : 0.);
+            counts_n[2]                 = counts_p[2] + (ninf ? 1. : 0.);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const size_t begin = i > radius ? i - radius : 0;
+        const size_t end   = std::min(i + radius + 1, n);
+        t_value*     out_i = out + int64_t(i) * stride;
+        for (size_t l = 0; l < n_lanes; ++l)
+        {
+            const double* counts_b = counts.data() + (begin * n_lanes + l) * 3;
+            const double* counts_e = counts.data() + (end * n_lanes + l) * 3;
+
+            const double count  = counts_e[0] - counts_b[0];
+            const double n_pinf = counts_e[1] - counts_b[1];
+            const double n_ninf = counts_e[2] - counts_b[2];
+            const double sum    = sums[end * n_lanes + l] - sums[begin * n_lanes + l];
+
+            t_value& result = out_i[int64_t(l) * lane_stride];
+            if (normalize ? !(count > 0) : count < double(end - begin))
+                result = std::numeric_limits<t_value>::quiet_NaN();
+            else if (n_pinf > 0 && n_ninf > 0)
+                result = std::numeric_limits<t_value>::quiet_NaN();
+            else if (n_pinf > 0)
+                result = std::numeric_limits<t_value>::infinity();
+            else if (n_ninf > 0)
+                result = -std::numeric_limits<t_value>::infinity();
+            else
+                result = t_value(normalize ? sum / count : sum);
+        }
+    }
+}
+
+/**
+ * @brief NaN aware (normalized) convolution with a symmetric kernel (weights[0] is the center
+ * weight) along one axis of n_lanes parallel lines. NaNs and values outside the line are
+ * ignored (the weights of the valid values are normalized), windows without valid values result
+ * in NaN. If normalize is false, the weighted sums are returned instead and NaNs propagate. in and
+ * out may point to the same memory.
+ */
+template<typename t_value>
+inline void convolve_symmetric_lanes(const t_value*             in,
+                                     t_value*                   out,
+                                     const size_t               n,
+                                     const size_t               n_lanes,
+                                     const int64_t              stride,
+                                     const int64_t              lane_stride,
+                                     const std::vector<double>& weights,
+                                     const bool                 normalize,
+                                     std::vector<double>&       values,
+                                     std::vector<double>&       results)
+{
+    const int64_t radius = int64_t(weights.size()) - 1;
+
+    values.resize(n * n_lanes);
+    results.resize(2 * n_lanes);
+    for (size_t p = 0; p < n; ++p)
+    {
+        const t_value* in_p = in + int64_t(p) * stride;
+        for (size_t l = 0; l < n_lanes; ++l)
+            values[p * n_lanes + l] = double(in_p[int64_t(l) * lane_stride]);
+    }
+
+    double* weighted_sum = results.data();
+    double* weight_sum   = results.data() + n_lanes;
+    for (int64_t i = 0; i < int64_t(n); ++i)
+    {
+        std::fill_n(weighted_sum, n_lanes, 0.);
+        std::fill_n(weight_sum, n_lanes, 0.);
+
+        const int64_t begin = std::max<int64_t>(i - radius, 0);
+        const int64_t end   = std::min<int64_t>(i + radius + 1, n);
+        for (int64_t j = begin; j < end; ++j)
+        {
+            const double  weight   = weights[std::abs(j - i)];
+            const double* values_j = values.data() + j * n_lanes;
+            if (!normalize)
+                for (size_t l = 0; l < n_lanes; ++l)
+                    weighted_sum[l] += weight * values_j[l];
+            else
+                for (size_t l = 0; l < n_lanes; ++l)
+                    if (!std::isnan(values_j[l]))
+                    {
+                        weighted_sum[l] += weight * values_j[l];
+                        weight_sum[l] += weight;
+                    }
+        }
+
+        t_value* out_i = out + i * stride;
+        for (size_t l = 0; l < n_lanes; ++l)
+            if (!normalize)
+                out_i[int64_t(l) * lane_stride] = t_value(weighted_sum[l]);
+            else
+                out_i[int64_t(l) * lane_stride] = weight_sum[l] > 0
+                                                      ? t_value(weighted_sum[l] / weight_sum[l])
+                                                      : std::numeric_limits<t_value>::quiet_NaN();
+    }
+}
+
+/**
+ * @brief Strided 2D or 3D tensor memory as 3 axes (2D tensors have a third axis of size 1)
+ */
+template<typename t_value>
+struct StridedVolume
+{
+    t_value*               data;
+    std::array<int64_t, 3> shape;
+    std::array<int64_t, 3> strides;
+
+    template<typename t_xtensor>
+    static StridedVolume from_xtensor(t_xtensor& tensor)
+    {
+        static constexpr size_t N = std::tuple_size_v<typename t_xtensor::shape_type>;
+        static_assert(N == 2 || N == 3, "Template parameter must be a 2D or 3D tensor");
+
+        StridedVolume volume{ tensor.data(), { 1, 1, 1 }, { 0, 0, 0 } };
+        for (size_t d = 0; d < N; ++d)
+        {
+            volume.shape[d]   = int64_t(tensor.shape()[d]);
+            volume.strides[d] = int64_t(tensor.strides()[d]);
+        }
+        return volume;
+    }
+};
+
+/**
+ * @brief Per thread scratch buffers of the line filters
+ */
+template<typename t_value>
+struct LineFilterBuffers
+{
+    std::vector<t_value> g, h;
+    std::vector<double>  first, second;
+};
+
+/**
+ * @brief Call f(line_begin, n, stride, n_lanes, lane_stride, buffers) for blocks of parallel
+ * lines along axis that cover the whole volume. The lanes are the last axis where possible
+ * (contiguous memory for row major tensors). The blocks are processed in parallel.
+ */
+template<typename t_value, typename t_function>
+inline void for_each_line_block(const StridedVolume<t_value>& volume,
+                                const size_t                  axis,
+                                const int                     mp_cores,
+                                const t_function&             f)
+{
+    const auto& shape   = volume.shape;
+    const auto& strides = volume.strides;
+
+    if (shape[0] == 0 || shape[1] == 0 || shape[2] == 0)
+        return;
+
+    switch (axis)
+    {
+        case 2: // lines along z, one per (x, y)
+#pragma omp parallel num_threads(mp_cores)
+        {
+            LineFilterBuffers<t_value> buffers;
+#pragma omp for schedule(static)
+            for (int64_t x = 0; x < shape[0]; ++x)
+                for (int64_t y = 0; y < shape[1]; ++y)
+                    f(volume.data + x * strides[0] + y * strides[1],
+                      shape[2], strides[2], 1, 0, buffers);
+        }
+        break;
+
+        case 1: // lines along y, lanes: z
+#pragma omp parallel num_threads(mp_cores)
+        {
+            LineFilterBuffers<t_value> buffers;
+#pragma omp for schedule(static)
+            for (int64_t x = 0; x < shape[0]; ++x)
+                f(volume.data + x * strides[0],
+                  shape[1],
+                  strides[1],
+                  shape[2],
+                  strides[2],
+                  buffers);
+        }
+        break;
+
+        case 0:
+            if (shape[2] > 1) // lines along x, lanes: z
+            {
+#pragma omp parallel num_threads(mp_cores)
+                {
+                    LineFilterBuffers<t_value> buffers;
+#pragma omp for schedule(static)
+                    for (int64_t y = 0; y < shape[1]; ++y)
+                        f(volume.data + y * strides[1],
+                          shape[0], strides[0], shape[2], strides[2], buffers);
+                }
+            }
+            else // 2D: lines along x, lanes: blocks of y
+            {
+                const int64_t block_size = 64;
+                const int64_t n_blocks   = (shape[1] + block_size - 1) / block_size;
+#pragma omp parallel num_threads(mp_cores)
+                {
+                    LineFilterBuffers<t_value> buffers;
+#pragma omp for schedule(static)
+                    for (int64_t b = 0; b < n_blocks; ++b)
+                        f(volume.data + b * block_size * strides[1],
+                          shape[0],
+                          strides[0],
+                          std::min(block_size, shape[1] - b * block_size),
+                          strides[1],
+                          buffers);
+                }
+            }
+            break;
+
+        default:
+            throw std::invalid_argument("for_each_line_block: axis must be 0, 1 or 2.");
+    }
+}
+
+template<size_t N, typename t_number>
+inline void check_filter_sizes(const std::array<t_number, N>& sizes, const char* name)
+{
+    for (const auto size : sizes)
+        if (!(size >= 0))
+            throw std::invalid_argument(std::string(name) + " must be >= 0.");
+}
+
+template<bool t_maximum, typename t_xtensor, size_t N>
+inline void extremum_filter_inplace(t_xtensor&                     data,
+                                    const std::array<int64_t, N>& radii,
+                                    const int                      mp_cores)
+{
+    using t_value = typename t_xtensor::value_type;
+    check_filter_sizes(radii, "radii");
+
+    const auto volume = StridedVolume<t_value>::from_xtensor(data);
+    for (size_t axis = 0; axis < N; ++axis)
+    {
+        if (radii[axis] == 0)
+            continue;
+
+        for_each_line_block(volume,
+                            axis,
+                            mp_cores,
+                            [&](t_value*                    line,
+                                const int64_t               n,
+                                const int64_t               stride,
+                                const int64_t               n_lanes,
+                                const int64_t               lane_stride,
+                                LineFilterBuffers<t_value>& buffers) {
+                                running_extremum_lanes<t_maximum>(line,
+                                                                  line,
+                                                                  n,
+                                                                  n_lanes,
+                                                                  stride,
+                                                                  lane_stride,
+                                                                  radii[axis],
+                                                                  true,
+                                                                  buffers.g,
+                                                                  buffers.h);
+                            });
+    }
+}
+
+/**
+ * @brief Apply a separable NaN aware mean filter. filter_line(axis, line, n, stride, n_lanes,
+ * lane_stride, normalize, buffers) filters one block of lines along axis (see
+ * running_mean_lanes).
+ *
+ * Without NaNs the per axis normalized passes equal the full window mean and the filter is
+ * applied directly. Otherwise, normalizing per axis would result in a mean of means for windows
+ * with NaNs. In this case the NaNs are set to 0, the passes are applied without normalization
+ * to the values and to a volume of valid weights (1 for valid values, 0 for NaNs) and the value
+ * sums are divided by the weight sums once at the end.
+ */
+template<typename t_xtensor, size_t N, typename t_line_filter>
+inline void separable_mean_filter_inplace(t_xtensor&                  data,
+                                          const std::array<bool, N>& axes,
+                                          const int                   mp_cores,
+                                          const t_line_filter&        filter_line)
+{
+    using t_value = typename t_xtensor::value_type;
+
+    if (std::none_of(axes.begin(), axes.end(), [](bool axis) { return axis; }))
+        return;
+
+    t_value*      values = data.data();
+    const int64_t size   = int64_t(data.size());
+
+    bool contains_nans = false;
+#pragma omp parallel for num_threads(mp_cores) reduction(|| : contains_nans)
+    for (int64_t i = 0; i < size; ++i)
+        contains_nans = contains_nans || std::isnan(values[i]);
+
+    const auto volume = StridedVolume<t_value>::from_xtensor(data);
+    if (!contains_nans)
+    {
+        for (size_t axis = 0; axis < N; ++axis)
+            if (axes[axis])
+                for_each_line_block(volume,
+                                    axis,
+                                    mp_cores,
+                                    [&](t_value*                    line,
+                                        const int64_t               n,
+                                        const int64_t               stride,
+                                        const int64_t               n_lanes,
+                                        const int64_t               lane_stride,
+                                        LineFilterBuffers<t_value>& buffers) {
+                                        filter_line(axis,
+                                                    line,
+                                                    n,
+                                                    stride,
+                                                    n_lanes,
+                                                    lane_stride,
+                                                    true,
+                                                    buffers);
+                                    });
+        return;
+    }
+
+    // the weights share the memory layout of data (offsets into data are valid for weights)
+    std::vector<t_value> weights(size);
+#pragma omp parallel for num_threads(mp_cores)
+    for (int64_t i = 0; i < size; ++i)
+    {
+        const bool valid = !std::isnan(values[i]);
+        weights[i]       = valid ? t_value(1) : t_value(0);
+        if (!valid)
+            values[i] = 0;
+    }
+
+    for (size_t axis = 0; axis < N; ++axis)
+        if (axes[axis])
+            for_each_line_block(volume,
+                                axis,
+                                mp_cores,
+                                [&](t_value*                    line,
+                                    const int64_t               n,
+                                    const int64_t               stride,
+                                    const int64_t               n_lanes,
+                                    const int64_t               lane_stride,
+                                    LineFilterBuffers<t_value>& buffers) {
+                                    filter_line(axis,
+                                                line,
+                                                n,
+                                                stride,
+                                                n_lanes,
+                                                lane_stride,
+                                                false,
+                                                buffers);
+                                    filter_line(axis,
+                                                weights.data() + (line - volume.data),
+                                                n,
+                                                stride,
+                                                n_lanes,
+                                                lane_stride,
+                                                false,
+                                                buffers);
+                                });
+
+#pragma omp parallel for num_threads(mp_cores)
+    for (int64_t i = 0; i < size; ++i)
+        values[i] = weights[i] > 0 ? t_value(values[i] / weights[i])
+                                   : std::numeric_limits<t_value>::quiet_NaN();
+}
+
+template<typename t_xtensor, size_t N>
+inline void box_filter_inplace(t_xtensor&                     data,
+                               const std::array<int64_t, N>& radii,
+                               const int                      mp_cores)
+{
+    using t_value = typename t_xtensor::value_type;
+    static_assert(std::is_floating_point_v<t_value>, "box_filter requires floating point data");
+    check_filter_sizes(radii, "radii");
+
+    std::array<bool, N> axes;
+    for (size_t axis = 0; axis < N; ++axis)
+        axes[axis] = radii[axis] > 0;
+
+    separable_mean_filter_inplace(data,
+                                  axes,
+                                  mp_cores,
+                                  [&](const size_t                axis,
+                                      t_value*                    line,
+                                      const int64_t               n,
+                                      const int64_t               stride,
+                                      const int64_t               n_lanes,
+                                      const int64_t               lane_stride,
+                                      const bool                  normalize,
+                                      LineFilterBuffers<t_value>& buffers) {
+                                      running_mean_lanes(line,
+                                                         line,
+                                                         n,
+                                                         n_lanes,
+                                                         stride,
+                                                         lane_stride,
+                                                         radii[axis],
+                                                         normalize,
+                                                         buffers.first,
+                                                         buffers.second);
+                                  });
+}
+
+template<typename t_xtensor, size_t N>
+inline void gaussian_filter_inplace(t_xtensor&                    data,
+                                    const std::array<double, N>& sigmas,
+                                    const double                  truncate,
+                                    const int                     mp_cores)
+{
+    using t_value = typename t_xtensor::value_type;
+    static_assert(std::is_floating_point_v<t_value>,
+                  "gaussian_filter requires floating point data");
+    check_filter_sizes(sigmas, "sigmas");
+    if (!(truncate > 0))
+        throw std::invalid_argument("gaussian_filter: truncate must be > 0.");
+
+    // kernel weights per axis (center first)
+    std::array<bool, N>                axes;
+    std::array<std::vector<double>, N> weights;
+    for (size_t axis = 0; axis < N; ++axis)
+    {
+        axes[axis] = sigmas[axis] > 0;
+        if (!axes[axis])
+            continue;
+
+        const int64_t radius = int64_t(truncate * sigmas[axis] + 0.5);
+        weights[axis].resize(radius + 1);
+        for (int64_t j = 0; j <= radius; ++j)
+            weights[axis][j] = std::exp(-0.5 * double(j * j) / (sigmas[axis] * sigmas[axis]));
+    }
+
+    separable_mean_filter_inplace(data,
+                                  axes,
+                                  mp_cores,
+                                  [&](const size_t                axis,
+                                      t_value*                    line,
+                                      const int64_t               n,
+                                      const int64_t               stride,
+                                      const int64_t               n_lanes,
+                                      const int64_t               lane_stride,
+                                      const bool                  normalize,
+                                      LineFilterBuffers<t_value>& buffers) {
+                                      convolve_symmetric_lanes(line,
+                                                               line,
+                                                               n,
+                                                               n_lanes,
+                                                               stride,
+                                                               lane_stride,
+                                                               weights[axis],
+                                                               normalize,
+                                                               buffers.first,
+                                                               buffers.second);
+                                  });
+}
+
+/**
+ * @brief In place median filter over the (clipped) box window of a strided volume. The x range
+ * is split into chunks (one per thread). Each chunk keeps the original values of the x planes
+ * within its window in a ring buffer. The planes behind the chunk (overwritten by the next
+ * chunk) are copied before any chunk is processed, so no second volume is allocated.
+ */
+template<typename t_value>
+inline void median_filter_inplace(const StridedVolume<t_value>& volume,
+                                  const std::array<int64_t, 3>& radii,
+                                  const int                     mp_cores)
+{
+    const auto&   shape   = volume.shape;
+    const auto&   strides = volume.strides;
+    const int64_t n_plane = shape[1] * shape[2];
+    const int64_t rx      = radii[0];
+
+    if (shape[0] == 0 || n_plane == 0)
+        return;
+
+    auto copy_plane = [&](const int64_t x, t_value* plane) {
+        const t_value* source = volume.data + x * strides[0];
+        for (int64_t y = 0, i = 0; y < shape[1]; ++y)
+            for (int64_t z = 0; z < shape[2]; ++z, ++i)
+                plane[i] = source[y * strides[1] + z * strides[2]];
+    };
+
+    const auto    chunk_begins = split_range(0, shape[0], mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    // original planes [begin - rx, begin) and [end, end + rx) of each chunk
+    std::vector<std::vector<t_value>> halos_before(n_chunks), halos_after(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+    {
+        halos_before[c].resize(rx * n_plane);
+        halos_after[c].resize(rx * n_plane);
+        for (int64_t k = 0; k < rx; ++k)
+        {
+            const int64_t before = chunk_begins[c] - rx + k;
+            const int64_t after  = chunk_begins[c + 1] + k;
+            if (before >= 0)
+                copy_plane(before, halos_before[c].data() + k * n_plane);
+            if (after < shape[0])
+                copy_plane(after, halos_after[c].data() + k * n_plane);
+        }
+    }
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+    {
+        const int64_t begin  = chunk_begins[c];
+        const int64_t end    = chunk_begins[c + 1];
+        const int64_t window = 2 * rx + 1;
+
+        // ring buffer of the original planes x - rx ... x + rx
+        std::vector<t_value> ring(window * n_plane);
+        auto                 ring_plane = [&](const int64_t x) {
+            return ring.data() + ((x % window + window) % window) * n_plane;
+        };
+        auto load_plane = [&](const int64_t x) {
+            if (x < 0 || x >= shape[0])
+                return;
+            if (x < begin)
+                std::copy_n(halos_before[c].data() + (x - begin + rx) * n_plane,
+                            n_plane,
+                            ring_plane(x));
+            else if (x >= end)
+                std::copy_n(halos_after[c].data() + (x - end) * n_plane, n_plane, ring_plane(x));
+            else
+                copy_plane(x, ring_plane(x));
+        };
+
+        for (int64_t x = begin - rx; x < begin + rx; ++x)
+            load_plane(x);
+
+        std::vector<t_value> window_values;
+        for (int64_t x = begin; x < end; ++x)
+        {
+            load_plane(x + rx);
+
+            const int64_t x0 = std::max<int64_t>(x - rx, 0);
+            const int64_t x1 = std::min<int64_t>(x + rx + 1, shape[0]);
+
+            for (int64_t y = 0; y < shape[1]; ++y)
+            {
+                const int64_t y0 = std::max<int64_t>(y - radii[1], 0);
+                const int64_t y1 = std::min<int64_t>(y + radii[1] + 1, shape[1]);
+                for (int64_t z = 0; z < shape[2]; ++z)
+                {
+                    const int64_t z0 = std::max<int64_t>(z - radii[2], 0);
+                    const int64_t z1 = std::min<int64_t>(z + radii[2] + 1, shape[2]);
+
+                    window_values.clear();
+                    for (int64_t a = x0; a < x1; ++a)
+                    {
+                        const t_value* plane = ring_plane(a);
+                        for (int64_t b = y0; b < y1; ++b)
+                            for (int64_t d = z0; d < z1; ++d)
+                            {
+                                const t_value value = plane[b * shape[2] + d];
+                                if constexpr (std::is_floating_point_v<t_value>)
+                                    if (std::isnan(value))
+                                        continue;
+                                window_values.push_back(value);
+                            }
+                    }
+
+                    t_value median = std::numeric_limits<t_value>::quiet_NaN();
+                    if (!window_values.empty())
+                    {
+                        // lower median for an even number of values
+                        auto middle = window_values.begin() + (window_values.size() - 1) / 2;
+                        std::nth_element(window_values.begin(), middle, window_values.end());
+                        median = *middle;
+                    }
+
+                    volume.data[x * strides[0] + y * strides[1] + z * strides[2]] = median;
+                }
+            }
+        }
+    }
+}
+} // namespace detail
+
+template<tools::helper::c_xtensor_3d t_xtensor_3d>
+/**
+ * @brief In place maximum filter (grey dilation) with a (2r+1) box window per axis.
+ *
+ * The filter is applied separably with van Herk / Gil-Werman running maxima (constant cost per
+ * voxel regardless of the radius). NaNs are ignored, windows that only contain NaNs result in
+ * NaN. The window is clipped at the border. No second volume is allocated.
+ *
+ * @tparam t_xtensor_3d Type of the 3D tensor
+ * @param data 3D tensor, will be modified by the function
+ * @param radii window radius per axis (x, y, z), 0 disables the filter along an axis
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a radius is negative
+ */
+void maximum_filter_inplace(t_xtensor_3d&                 data,
+                            const std::array<int64_t, 3>& radii,
+                            const int                     mp_cores = 1)
+{
+    detail::extremum_filter_inplace<true>(data, radii, mp_cores);
+}
+
+template<tools::helper::c_xtensor_2d t_xtensor_2d>
+/**
+ * @brief In place maximum filter (grey dilation) with a (2r+1) box window per axis.
+ *
+ * The filter is applied separably with van Herk / Gil-Werman running maxima (constant cost per
+ * cell regardless of the radius). NaNs are ignored, windows that only contain NaNs result in
+ * NaN. The window is clipped at the border. No second image is allocated.
+ *
+ * @tparam t_xtensor_2d Type of the 2D tensor
+ * @param data 2D tensor, will be modified by the function
+ * @param radii window radius per axis (x, y), 0 disables the filter along an axis
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a radius is negative
+ */
+void maximum_filter_inplace(t_xtensor_2d&                 data,
+                            const std::array<int64_t, 2>& radii,
+                            const int                     mp_cores = 1)
+{
+    detail::extremum_filter_inplace<true>(data, radii, mp_cores);
+}
+
+template<tools::helper::c_xtensor_3d t_xtensor_3d>
+/**
+ * @brief In place minimum filter (grey erosion) with a (2r+1) box window per axis.
+ *
+ * The filter is applied separably with van Herk / Gil-Werman running minima (constant cost per
+ * voxel regardless of the radius). NaNs are ignored, windows that only contain NaNs result in
+ * NaN. The window is clipped at the border. No second volume is allocated.
+ *
+ * @tparam t_xtensor_3d Type of the 3D tensor
+ * @param data 3D tensor, will be modified by the function
+ * @param radii window radius per axis (x, y, z), 0 disables the filter along an axis
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a radius is negative
+ */
+void minimum_filter_inplace(t_xtensor_3d&                 data,
+                            const std::array<int64_t, 3>& radii,
+                            const int                     mp_cores = 1)
+{
+    detail::extremum_filter_inplace<false>(data, radii, mp_cores);
+}
+
+template<tools::helper::c_xtensor_2d t_xtensor_2d>
+/**
+ * @brief In place minimum filter (grey erosion) with a (2r+1) box window per axis.
+ *
+ * The filter is applied separably with van Herk / Gil-Werman running minima (constant cost per
+ * cell regardless of the radius). NaNs are ignored, windows that only contain NaNs result in
+ * NaN. The window is clipped at the border. No second image is allocated.
+ *
+ * @tparam t_xtensor_2d Type of the 2D tensor
+ * @param data 2D tensor, will be modified by the function
+ * @param radii window radius per axis (x, y), 0 disables the filter along an axis
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a radius is negative
+ */
+void minimum_filter_inplace(t_xtensor_2d&                 data,
+                            const std::array<int64_t, 2>& radii,
+                            const int                     mp_cores = 1)
+{
+    detail::extremum_filter_inplace<false>(data, radii, mp_cores);
+}
+
+template<tools::helper::c_xtensor_3d t_xtensor_3d>
+/**
+ * @brief In place box (mean) filter with a (2r+1) window per axis.
+ *
+ * The filter is applied separably with running sums (constant cost per voxel regardless of the
+ * radius). NaNs and cells outside the volume are ignored (the mean is computed over the valid
+ * values of the window), windows without valid values result in NaN. Infinite values only affect
+ * the windows that contain them (+inf and -inf in one window result in NaN). If data contains
+ * NaNs, a volume of valid counts is allocated and the value and count sums are divided once
+ * after the separable passes, otherwise no second volume is allocated.
+ *
+ * @tparam t_xtensor_3d Type of the 3D tensor (floating point)
+ * @param data 3D tensor, will be modified by the function
+ * @param radii window radius per axis (x, y, z), 0 disables the filter along an axis
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a radius is negative
+ */
+void box_filter_inplace(t_xtensor_3d&                 data,
+                        const std::array<int64_t, 3>& radii,
+                        const int                     mp_cores = 1)
+{
+    detail::box_filter_inplace(data, radii, mp_cores);
+}
+
+template<tools::helper::c_xtensor_2d t_xtensor_2d>
+/**
+ * @brief In place box (mean) filter with a (2r+1) window per axis.
+ *
+ * The filter is applied separably with running sums (constant cost per cell regardless of the
+ * radius). NaNs and cells outside the image are ignored (the mean is computed over the valid
+ * values of the window), windows without valid values result in NaN. Infinite values only affect
+ * the windows that contain them (+inf and -inf in one window result in NaN). If data contains
+ * NaNs, an image of valid counts is allocated and the value and count sums are divided once
+ * after the separable passes, otherwise no second image is allocated.
+ *
+ * @tparam t_xtensor_2d Type of the 2D tensor (floating point)
+ * @param data 2D tensor, will be modified by the function
+ * @param radii window radius per axis (x, y), 0 disables the filter along an axis
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a radius is negative
+ */
+void box_filter_inplace(t_xtensor_2d&                 data,
+                        const std::array<int64_t, 2>& radii,
+                        const int                     mp_cores = 1)
+{
+    detail::box_filter_inplace(data, radii, mp_cores);
+}
+
+template<tools::helper::c_xtensor_3d t_xtensor_3d>
+/**
+ * @brief In place gaussian filter (separable, kernel truncated at truncate * sigma).
+ *
+ * NaNs and cells outside the volume are ignored (normalized convolution over the full kernel:
+ * the weights of the valid values are normalized), windows without valid values result in NaN.
+ * If data contains NaNs, a volume of valid weights is allocated and the weighted value and weight
+ * sums are divided once after the separable passes, otherwise no second volume is allocated.
+ *
+ * @tparam t_xtensor_3d Type of the 3D tensor (floating point)
+ * @param data 3D tensor, will be modified by the function
+ * @param sigmas standard deviation in cells per axis (x, y, z), 0 disables the filter along an
+ *               axis
+ * @param truncate kernel radius in standard deviations
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a sigma is negative or truncate is not positive
+ */
+void gaussian_filter_inplace(t_xtensor_3d&                data,
+                             const std::array<double, 3>& sigmas,
+                             const double                 truncate = 4.,
+                             const int                    mp_cores = 1)
+{
+    detail::gaussian_filter_inplace(data, sigmas, truncate, mp_cores);
+}
+
+template<tools::helper::c_xtensor_2d t_xtensor_2d>
+/**
+ * @brief In place gaussian filter (separable, kernel truncated at truncate * sigma).
+ *
+ * NaNs and cells outside the image are ignored (normalized convolution over the full kernel:
+ * the weights of the valid values are normalized), windows without valid values result in NaN.
+ * If data contains NaNs, an image of valid weights is allocated and the weighted value and weight
+ * sums are divided once after the separable passes, otherwise no second image is allocated.
+ *
+ * @tparam t_xtensor_2d Type of the 2D tensor (floating point)
+ * @param data 2D tensor, will be modified by the function
+ * @param sigmas standard deviation in cells per axis (x, y), 0 disables the filter along an axis
+ * @param truncate kernel radius in standard deviations
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a sigma is negative or truncate is not positive
+ */
+void gaussian_filter_inplace(t_xtensor_2d&                data,
+                             const std::array<double, 2>& sigmas,
+                             const double                 truncate = 4.,
+                             const int                    mp_cores = 1)
+{
+    detail::gaussian_filter_inplace(data, sigmas, truncate, mp_cores);
+}
+
+template<tools::helper::c_xtensor_3d t_xtensor_3d>
+/**
+ * @brief In place median filter with a (2r+1) box window per axis.
+ *
+ * The median is not separable, the cost per voxel grows with the window size. NaNs and cells
+ * outside the volume are ignored (the lower median of the valid values is used), windows
+ * without valid values result in NaN. Only the x planes within the window of each thread are
+ * buffered, no second volume is allocated.
+ *
+ * @tparam t_xtensor_3d Type of the 3D tensor
+ * @param data 3D tensor, will be modified by the function
+ * @param radii window radius per axis (x, y, z)
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a radius is negative
+ */
+void median_filter_inplace(t_xtensor_3d&                 data,
+                           const std::array<int64_t, 3>& radii,
+                           const int                     mp_cores = 1)
+{
+    using t_value = typename t_xtensor_3d::value_type;
+    detail::check_filter_sizes(radii, "radii");
+
+    detail::median_filter_inplace(
+        detail::StridedVolume<t_value>::from_xtensor(data), radii, mp_cores);
+}
+
+template<tools::helper::c_xtensor_2d t_xtensor_2d>
+/**
+ * @brief In place median filter with a (2r+1) box window per axis.
+ *
+ * The median is not separable, the cost per cell grows with the window size. NaNs and cells
+ * outside the image are ignored (the lower median of the valid values is used), windows without
+ * valid values result in NaN. Only the rows within the window of each thread are buffered, no
+ * second image is allocated.
+ *
+ * @tparam t_xtensor_2d Type of the 2D tensor
+ * @param data 2D tensor, will be modified by the function
+ * @param radii window radius per axis (x, y)
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @throws std::invalid_argument if a radius is negative
+ */
+void median_filter_inplace(t_xtensor_2d&                 data,
+                           const std::array<int64_t, 2>& radii,
+                           const int                     mp_cores = 1)
+{
+    using t_value = typename t_xtensor_2d::value_type;
+    detail::check_filter_sizes(radii, "radii");
+
+    detail::median_filter_inplace(detail::StridedVolume<t_value>::from_xtensor(data),
+                                  { radii[0], radii[1], 0 },
+                                  mp_cores);
+}
+
+} // namespace functions
+} // namespace imageprocessing
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -8,17 +8,23 @@
 /* generated doc strings */
 #include ".docstrings/find_local_maxima.doc.hpp"
 
-#include <omp.h>
-#include <vector>
-#include <xtensor/containers/xadapt.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
-#include <xtensor/misc/xsort.hpp>
 #include <xtensor/containers/xtensor.hpp>
-#include <xtensor/views/xview.hpp>
+#include <xtensor/core/xmath.hpp>
 
 #include <themachinethatgoesping/tools/helper/xtensor.hpp>
 
+#include "scan_order_buffers.hpp"
+
 namespace themachinethatgoesping {
 namespace algorithms {
 namespace imageprocessing {
@@ -38,6 +44,84 @@ inline auto get_max_val(const T& a, const bool& accept_nans)
     return xt::amax(a)();
 }
 
+namespace detail {
+/**
+ * @brief Maximum of a and b. If accept_nans is true, NaNs are ignored (the result is only NaN if
+ * both values are NaN), otherwise NaNs propagate (the result is NaN if any value is NaN).
+ */
+template<typename t_value>
+inline t_value max_of(const t_value a, const t_value b, const bool accept_nans)
+{
+    if constexpr (std::is_floating_point_v<t_value>)
+    {
+        if (accept_nans)
+            return (b > a || std::isnan(a)) ? b : a;
+
+        return (a > b || std::isnan(a)) ? a : b;
+    }
+
+    return a > b ? a : b;
+}
+
+/**
+ * @brief Running maximum (window 3) of one (y, z) plane of data: plane_max(y, z) is the maximum
+ * of data(x, y-1:y+2, z-1:z+2). Only the interior cells (1 <= y < ny-1, 1 <= z < nz-1) are
+ * computed. z_max is a scratch buffer of size ny * nz.
+ */
+template<tools::helper::c_xtensor_3d t_xtensor_3d, typename t_value>
+inline void running_max_plane(const t_xtensor_3d&   data,
+                              const int64_t         x,
+                              const bool            accept_nans,
+                              std::vector<t_value>& z_max,
+                              std::vector<t_value>& plane_max)
+{
+    const int64_t ny = data.shape()[1];
+    const int64_t nz = data.shape()[2];
+
+    // pass 1: running max along z
+    for (int64_t y = 0; y < ny; ++y)
+    {
+        t_value* row = z_max.data() + y * nz;
+        for (int64_t z = 1; z < nz - 1; ++z)
+            row[z] = max_of(
+                max_of(data.unchecked(x, y, z - 1), data.unchecked(x, y, z), accept_nans),
+                data.unchecked(x, y, z + 1),
+                accept_nans);
+    }
+
+    // pass 2: running max along y
+    for (int64_t y = 1; y < ny - 1; ++y)
+    {
+        const t_value* prev = z_max.data() + (y - 1) * nz;
+        const t_value* curr = z_max.data() + y * nz;
+        const t_value* next = z_max.data() + (y + 1) * nz;
+        t_value*       row  = plane_max.data() + y * nz;
+
+        for (int64_t z = 1; z < nz - 1; ++z)
+            row[z] = max_of(max_of(prev[z], curr[z], accept_nans), next[z], accept_nans);
+    }
+}
+
+/**
+ * @brief Running maximum (window 3) of one row of data: row_max(y) is the maximum of
+ * data(x, y-1:y+2). Only the interior cells (1 <= y < ny-1) are computed.
+ */
+template<tools::helper::c_xtensor_2d t_xtensor_2d, typename t_value>
+inline void running_max_row(const t_xtensor_2d&   data,
+                            const int64_t         x,
+                            const bool            accept_nans,
+                            std::vector<t_value>& row_max)
+{
+    const int64_t ny = data.shape()[1];
+
+    for (int64_t y = 1; y < ny - 1; ++y)
+        row_max[y] = max_of(max_of(data.unchecked(x, y - 1), data.unchecked(x, y), accept_nans),
+                            data.unchecked(x, y + 1),
+                            accept_nans);
+}
+
+} // namespace detail
+
 template<tools::helper::c_xtensor_3d t_xtensor_3d>
 /**
  * @brief Finds the local maxima in a 3D tensor.
@@ -51,10 +135,14 @@ template<tools::helper::c_xtensor_3d t_xtensor_3d>
  * @param data The 3D tensor in which to find local maxima.
  * @param threshold An optional threshold value. Only values greater than this
  *                  threshold will be considered as potential local maxima.
+ * @param accept_nans If true, NaN neighbors are ignored. If false, values with a NaN
+ *                    neighbor are not considered as local maxima.
  * @param mp_cores The number of cores to use for parallel processing. Defaults to 1.
  * @return A tuple containing four vectors: X, Y, Z coordinates of the local maxima,
  *         and their corresponding values.
  *
+ * @note The neighborhood maximum is computed with separable running maxima (window 3) per
+ *       axis. The results are ordered by index (x major) independent of mp_cores.
  * @note The function uses OpenMP for parallel processing.
  * @note The template parameter must be a 3D tensor.
  */
@@ -69,52 +157,75 @@ auto find_local_maxima(
     static_assert(tools::helper::c_xtensor_3d<t_xtensor_3d>,
                   "Template parameter must be a 3D tensor");
 
-    const int64_t max_z = data.shape()[2] - 1;
-    const int64_t max_y = data.shape()[1] - 1;
-    const int64_t max_x = data.shape()[0] - 1;
-
-    std::vector<int64_t>    X;
-    std::vector<int64_t>    Y;
-    std::vector<int64_t>    Z;
-    std::vector<value_type> V;
+    const int64_t nx = data.shape()[0];
+    const int64_t ny = data.shape()[1];
+    const int64_t nz = data.shape()[2];
 
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the interior x range is split into contiguous chunks (one per thread) so that the merged
+    // results are ordered by x, y, z
+    const auto    chunk_begins = detail::split_range(1, nx - 1, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<int64_t>    chunk_X(n_chunks), chunk_Y(n_chunks), chunk_Z(n_chunks);
+    detail::ScanOrderBuffers<value_type> chunk_V(n_chunks);
+
+    // without interior cells there is nothing to do (the chunk loop would read outside data)
+    if (nx > 2 && ny > 2 && nz > 2)
     {
-#pragma omp for collapse(3) schedule(guided)
-        for (int64_t x = 1; x < max_x; ++x)
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+        for (int64_t c = 0; c < n_chunks; ++c)
         {
-            for (int64_t y = 1; y < max_y; ++y)
+            // scratch buffers: z running max and the (y, z) running max of the planes x-1, x, x+1
+            std::vector<value_type>                z_max(ny * nz);
+            std::array<std::vector<value_type>, 3> planes;
+            for (auto& plane : planes)
+                plane.resize(ny * nz);
+
+            detail::running_max_plane(data, chunk_begins[c] - 1, accept_nans, z_max, planes[0]);
+            detail::running_max_plane(data, chunk_begins[c], accept_nans, z_max, planes[1]);
+
+            for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
             {
-                for (int64_t z = 1; z < max_z; ++z)
-                {
-                    const value_type val = data.unchecked(x, y, z);
+                // pass 3: running max along x (planes is a ring buffer of x-1, x, x+1)
+                const auto& prev = planes[(x - chunk_begins[c]) % 3];
+                const auto& curr = planes[(x - chunk_begins[c] + 1) % 3];
+                auto&       next = planes[(x - chunk_begins[c] + 2) % 3];
+                detail::running_max_plane(data, x + 1, accept_nans, z_max, next);
+
+                for (int64_t y = 1; y < ny - 1; ++y)
+                    for (int64_t z = 1; z < nz - 1; ++z)
+                    {
+                        const value_type val = data.unchecked(x, y, z);
 
-                    if (!(val > threshold_val))
-                        continue;
+                        if (!(val > threshold_val))
+                            continue;
 
-                    auto neighborhood = xt::view(data,
-                                                 xt::range(x - 1, x + 2),
-                                                 xt::range(y - 1, y + 2),
-                                                 xt::range(z - 1, z + 2));
+                        const int64_t    i = y * nz + z;
+                        const value_type max_val =
+                            detail::max_of(detail::max_of(prev[i], curr[i], accept_nans),
+                                           next[i],
+                                           accept_nans);
 
-                    if (val == get_max_val(neighborhood, accept_nans))
-                    {
-#pragma omp critical
+                        if (val == max_val)
                         {
-                            X.push_back(x);
-                            Y.push_back(y);
-                            Z.push_back(z);
-                            V.push_back(val);
+                            chunk_X[c].push_back(x);
+                            chunk_Y[c].push_back(y);
+                            chunk_Z[c].push_back(z);
+                            chunk_V[c].push_back(val);
                         }
                     }
-                }
             }
         }
     }
 
+    std::vector<int64_t>    X = chunk_X.merge(mp_cores);
+    std::vector<int64_t>    Y = chunk_Y.merge(mp_cores);
+    std::vector<int64_t>    Z = chunk_Z.merge(mp_cores);
+    std::vector<value_type> V = chunk_V.merge(mp_cores);
+
     return std::tuple(X, Y, Z, V);
 }
 
@@ -131,10 +242,14 @@ template<tools::helper::c_xtensor_2d t_xtensor_2d>
  * @param data The 2D tensor in which to find local maxima.
  * @param threshold An optional threshold value. Only values greater than this
  *                  threshold will be considered as potential local maxima.
+ * @param accept_nans If true, NaN neighbors are ignored. If false, values with a NaN
+ *                    neighbor are not considered as local maxima.
  * @param mp_cores The number of cores to use for parallel processing. Defaults to 1.
  * @return A tuple containing three vectors: X, Y coordinates of the local maxima,
  *         and their corresponding values.
  *
+ * @note The neighborhood maximum is computed with separable running maxima (window 3) per
+ *       axis. The results are ordered by index (x major) independent of mp_cores.
  * @note The function uses OpenMP for parallel processing.
  * @note The template parameter must be a 2D tensor.
  */
@@ -149,44 +264,67 @@ auto find_local_maxima(
     static_assert(tools::helper::c_xtensor_2d<t_xtensor_2d>,
                   "Template parameter must be a 2D tensor");
 
-    const int64_t max_y = data.shape()[1] - 1;
-    const int64_t max_x = data.shape()[0] - 1;
-
-    std::vector<int64_t>    X;
-    std::vector<int64_t>    Y;
-    std::vector<value_type> V;
+    const int64_t nx = data.shape()[0];
+    const int64_t ny = data.shape()[1];
 
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the interior x range is split into contiguous chunks (one per thread) so that the merged
+    // results are ordered by x, y
+    const auto    chunk_begins = detail::split_range(1, nx - 1, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<int64_t>    chunk_X(n_chunks), chunk_Y(n_chunks);
+    detail::ScanOrderBuffers<value_type> chunk_V(n_chunks);
+
+    // without interior cells there is nothing to do (the chunk loop would read outside data)
+    if (nx > 2 && ny > 2)
     {
-#pragma omp for collapse(2) schedule(guided)
-        for (int64_t x = 1; x < max_x; ++x)
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+        for (int64_t c = 0; c < n_chunks; ++c)
         {
-            for (int64_t y = 1; y < max_y; ++y)
-            {
-                const value_type val = data.unchecked(x, y);
+            // scratch buffers: y running max of the rows x-1, x, x+1
+            std::array<std::vector<value_type>, 3> rows;
+            for (auto& row : rows)
+                row.resize(ny);
 
-                if (!(val > threshold_val))
-                    continue;
+            detail::running_max_row(data, chunk_begins[c] - 1, accept_nans, rows[0]);
+            detail::running_max_row(data, chunk_begins[c], accept_nans, rows[1]);
 
-                auto neighborhood =
-                    xt::view(data, xt::range(x - 1, x + 2), xt::range(y - 1, y + 2));
+            for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
+            {
+                // running max along x (rows is a ring buffer of x-1, x, x+1)
+                const auto& prev = rows[(x - chunk_begins[c]) % 3];
+                const auto& curr = rows[(x - chunk_begins[c] + 1) % 3];
+                auto&       next = rows[(x - chunk_begins[c] + 2) % 3];
+                detail::running_max_row(data, x + 1, accept_nans, next);
 
-                if (val == get_max_val(neighborhood, accept_nans))
+                for (int64_t y = 1; y < ny - 1; ++y)
                 {
-#pragma omp critical
+                    const value_type val = data.unchecked(x, y);
+
+                    if (!(val > threshold_val))
+                        continue;
+
+                    const value_type max_val = detail::max_of(
+                        detail::max_of(prev[y], curr[y], accept_nans), next[y], accept_nans);
+
+                    if (val == max_val)
                     {
-                        X.push_back(x);
-                        Y.push_back(y);
-                        V.push_back(val);
+                        chunk_X[c].push_back(x);
+                        chunk_Y[c].push_back(y);
+                        chunk_V[c].push_back(val);
                     }
                 }
             }
         }
     }
 
+    std::vector<int64_t>    X = chunk_X.merge(mp_cores);
+    std::vector<int64_t>    Y = chunk_Y.merge(mp_cores);
+    std::vector<value_type> V = chunk_V.merge(mp_cores);
+
     return std::tuple(X, Y, V);
 }
 
@@ -203,10 +341,14 @@ template<tools::helper::c_xtensor_1d t_xtensor_1d>
  * @param data The 1D tensor in which to find local maxima.
  * @param threshold An optional threshold value. Only values greater than this
  *                  threshold will be considered as potential local maxima.
+ * @param accept_nans If true, NaN neighbors are ignored. If false, values with a NaN
+ *                    neighbor are not considered as local maxima.
  * @param mp_cores The number of cores to use for parallel processing. Defaults to 1.
  * @return A tuple containing two vectors: indices of the local maxima,
  *         and their corresponding values.
  *
+ * @note The neighborhood maximum is computed with separable running maxima (window 3) per
+ *       axis. The results are ordered by index (x major) independent of mp_cores.
  * @note The function uses OpenMP for parallel processing.
  * @note The template parameter must be a 1D tensor.
  */
@@ -221,37 +363,45 @@ auto find_local_maxima(
     static_assert(tools::helper::c_xtensor_1d<t_xtensor_1d>,
                   "Template parameter must be a 1D tensor");
 
-    const int64_t max_x = data.shape()[0] - 1;
-
-    std::vector<int64_t>    X;
-    std::vector<value_type> V;
+    const int64_t nx = data.shape()[0];
 
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the interior range is split into contiguous chunks (one per thread) so that the merged
+    // results are ordered by x
+    const auto    chunk_begins = detail::split_range(1, nx - 1, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<int64_t>    chunk_X(n_chunks);
+    detail::ScanOrderBuffers<value_type> chunk_V(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
     {
-#pragma omp for schedule(guided)
-        for (int64_t x = 1; x < max_x; ++x)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
         {
             const value_type val = data.unchecked(x);
 
             if (!(val > threshold_val))
                 continue;
 
-            auto neighborhood = xt::view(data, xt::range(x - 1, x + 2));
+            const value_type max_val = detail::max_of(
+                detail::max_of(data.unchecked(x - 1), val, accept_nans),
+                data.unchecked(x + 1),
+                accept_nans);
 
-            if (val == get_max_val(neighborhood, accept_nans))
+            if (val == max_val)
             {
-#pragma omp critical
-                {
-                    X.push_back(x);
-                    V.push_back(val);
-                }
+                chunk_X[c].push_back(x);
+                chunk_V[c].push_back(val);
             }
         }
     }
 
+    std::vector<int64_t>    X = chunk_X.merge(mp_cores);
+    std::vector<value_type> V = chunk_V.merge(mp_cores);
+
     return std::tuple(X, V);
 }
 
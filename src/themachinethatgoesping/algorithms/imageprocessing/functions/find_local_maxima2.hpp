@@ -20,6 +20,8 @@
 
 #include <themachinethatgoesping/tools/helper/xtensor.hpp>
 
+#include "scan_order_buffers.hpp"
+
 namespace themachinethatgoesping {
 namespace algorithms {
 namespace imageprocessing {
@@ -56,7 +58,8 @@ template<tools::helper::c_xtensor_3d t_xtensor_3d>
  * @return A tuple containing four vectors: X, Y, Z coordinates of the local maxima,
  *         and their corresponding values.
  *
- * @note The function uses OpenMP for parallel processing.
+ * @note The function uses OpenMP for parallel processing. The results are ordered by index
+ *       (x major) independent of mp_cores.
  * @note The template parameter must be a 3D tensor.
  */
 auto find_local_maxima2(
@@ -74,15 +77,20 @@ auto find_local_maxima2(
     const int64_t max_y = data.shape()[1] - 1;
     const int64_t max_x = data.shape()[0] - 1;
 
-    std::vector<xt::xtensor_fixed<int64_t, xt::xshape<3>>> XYZ;
-
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the x range is split into contiguous chunks (one per thread) so that the merged results
+    // are ordered by x, y, z
+    const auto    chunk_begins = detail::split_range(1, max_x, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<xt::xtensor_fixed<int64_t, xt::xshape<3>>> chunk_XYZ(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
     {
-#pragma omp for collapse(3) schedule(guided)
-        for (int64_t x = 1; x < max_x; ++x)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
         {
             for (int64_t y = 1; y < max_y; ++y)
             {
@@ -99,18 +107,13 @@ auto find_local_maxima2(
                                                  xt::range(z - 1, z + 2));
 
                     if (val == get_max_val2(neighborhood, accept_nans))
-                    {
-#pragma omp critical
-                        {
-                            XYZ.push_back({ x, y, z });
-                        }
-                    }
+                        chunk_XYZ[c].push_back({ x, y, z });
                 }
             }
         }
     }
 
-    return XYZ;
+    return chunk_XYZ.merge(mp_cores);
 }
 
 template<tools::helper::c_xtensor_2d t_xtensor_2d>
@@ -130,7 +133,8 @@ template<tools::helper::c_xtensor_2d t_xtensor_2d>
  * @return A tuple containing three vectors: X, Y coordinates of the local maxima,
  *         and their corresponding values.
  *
- * @note The function uses OpenMP for parallel processing.
+ * @note The function uses OpenMP for parallel processing. The results are ordered by index
+ *       (x major) independent of mp_cores.
  * @note The template parameter must be a 2D tensor.
  */
 auto find_local_maxima2(
@@ -147,15 +151,20 @@ auto find_local_maxima2(
     const int64_t max_y = data.shape()[1] - 1;
     const int64_t max_x = data.shape()[0] - 1;
 
-    std::vector<xt::xtensor_fixed<int64_t, xt::xshape<2>>> XY;
-
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the x range is split into contiguous chunks (one per thread) so that the merged results
+    // are ordered by x, y
+    const auto    chunk_begins = detail::split_range(1, max_x, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<xt::xtensor_fixed<int64_t, xt::xshape<2>>> chunk_XY(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
     {
-#pragma omp for collapse(2) schedule(guided)
-        for (int64_t x = 1; x < max_x; ++x)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
         {
             for (int64_t y = 1; y < max_y; ++y)
             {
@@ -168,17 +177,12 @@ auto find_local_maxima2(
                     xt::view(data, xt::range(x - 1, x + 2), xt::range(y - 1, y + 2));
 
                 if (val == get_max_val2(neighborhood, accept_nans))
-                {
-#pragma omp critical
-                    {
-                        XY.push_back({ x, y });
-                    }
-                }
+                    chunk_XY[c].push_back({ x, y });
             }
         }
     }
 
-    return XY;
+    return chunk_XY.merge(mp_cores);
 }
 
 template<tools::helper::c_xtensor_1d t_xtensor_1d>
@@ -198,7 +202,8 @@ template<tools::helper::c_xtensor_1d t_xtensor_1d>
  * @return A tuple containing two vectors: indices of the local maxima,
  *         and their corresponding values.
  *
- * @note The function uses OpenMP for parallel processing.
+ * @note The function uses OpenMP for parallel processing. The results are ordered by index
+ *       (x major) independent of mp_cores.
  * @note The template parameter must be a 1D tensor.
  */
 auto find_local_maxima2(
@@ -214,15 +219,20 @@ auto find_local_maxima2(
 
     const int64_t max_x = data.shape()[0] - 1;
 
-    std::vector<int64_t> X;
-
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the x range is split into contiguous chunks (one per thread) so that the merged results
+    // are ordered by x
+    const auto    chunk_begins = detail::split_range(1, max_x, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<int64_t> chunk_X(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
     {
-#pragma omp for schedule(guided)
-        for (int64_t x = 1; x < max_x; ++x)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
         {
             const value_type val = data.unchecked(x);
 
@@ -232,16 +242,11 @@ auto find_local_maxima2(
             auto neighborhood = xt::view(data, xt::range(x - 1, x + 2));
 
             if (val == get_max_val2(neighborhood, accept_nans))
-            {
-#pragma omp critical
-                {
-                    X.push_back(x);
-                }
-            }
+                chunk_X[c].push_back(x);
         }
     }
 
-    return X;
+    return chunk_X.merge(mp_cores);
 }
 
 }
@@ -0,0 +1,635 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/find_local_maxima_radius.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "filters.hpp"
+#include "find_local_maxima.hpp"
+#include "scan_order_buffers.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace imageprocessing {
+namespace functions {
+
+namespace detail {
+/**
+ * @brief Per thread scratch buffers for find_local_maxima_radius
+ */
+template<typename t_value>
+struct RunningMaxBuffers
+{
+    std::vector<t_value> g, h;          ///< van Herk / Gil-Werman prefix / suffix maxima
+    std::vector<t_value> plane, tmp;    ///< data plane and temporary plane
+    std::vector<t_value> first, second; ///< per plane maxima
+    std::vector<t_value> ring, prefix;  ///< plane ring and prefix maxima of running_max_planes
+    std::vector<t_value> max_plane;     ///< output plane of running_max_planes
+};
+
+/**
+ * @brief Maxima of a (ny, nz) plane over the in-plane part of the structuring element. If
+ * lines is true: maximum over the y and z line segments through the cell. Otherwise maximum over
+ * the (2r+1) x (2r+1) square in the y, z plane.
+ */
+template<typename t_value>
+inline void plane_max(const size_t                ny,
+                      const size_t                nz,
+                      const size_t                radius,
+                      const bool                  lines,
+                      const bool                  accept_nans,
+                      RunningMaxBuffers<t_value>& buffers,
+                      std::vector<t_value>&       out)
+{
+    auto& plane = buffers.plane;
+    auto& tmp   = buffers.tmp;
+    tmp.resize(ny * nz);
+    out.resize(ny * nz);
+
+    // along y (lanes: z)
+    running_max_lanes(
+        plane.data(), tmp.data(), ny, nz, nz, radius, accept_nans, buffers.g, buffers.h);
+
+    if (lines)
+    {
+        // along z (one lane per y), combined with the y maxima
+        for (size_t y = 0; y < ny; ++y)
+            running_max_lanes(plane.data() + y * nz,
+                              out.data() + y * nz,
+                              nz,
+                              1,
+                              1,
+                              radius,
+                              accept_nans,
+                              buffers.g,
+                              buffers.h);
+
+        for (size_t i = 0; i < out.size(); ++i)
+            out[i] = max_of(out[i], tmp[i], accept_nans);
+    }
+    else
+    {
+        // square: along z on the y maxima
+        for (size_t y = 0; y < ny; ++y)
+            running_max_lanes(tmp.data() + y * nz,
+                              out.data() + y * nz,
+                              nz,
+                              1,
+                              1,
+                              radius,
+                              accept_nans,
+                              buffers.g,
+                              buffers.h);
+    }
+}
+
+/**
+ * @brief Greedy non-maximum suppression: visit the candidates in order of decreasing value
+ * (ties: scan order) and keep a candidate only if no kept candidate is closer than min_distance
+ * (euclidean distance in cells). Uses a hash grid with cell size min_distance.
+ *
+ * @return std::vector<size_t> indices of the kept candidates in ascending order (scan order)
+ */
+template<size_t N, typename t_value>
+inline std::vector<size_t> suppress_non_maxima(
+    const std::vector<std::array<int64_t, N>>& coordinates,
+    const std::vector<t_value>&                values,
+    const double                               min_distance)
+{
+    std::vector<size_t> order(values.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&values](size_t a, size_t b) {
+        return values[a] > values[b];
+    });
+
+    const double  min_distance_2 = min_distance * min_distance;
+    const int64_t cell_size      = std::max<int64_t>(1, int64_t(std::ceil(min_distance)));
+
+    auto get_cell = [cell_size](const std::array<int64_t, N>& coordinate) {
+        std::array<int64_t, N> cell;
+        for (size_t d = 0; d < N; ++d)
+            cell[d] = coordinate[d] / cell_size; // coordinates are >= 0
+        return cell;
+    };
+    auto get_key = [](const std::array<int64_t, N>& cell) {
+        uint64_t key = 0;
+        for (size_t d = 0; d < N; ++d)
+            key = key * 0x9E3779B97F4A7C15ull + uint64_t(cell[d] + 1);
+        return key;
+    };
+
+    std::unordered_map<uint64_t, std::vector<size_t>> grid;
+    std::vector<size_t>                               kept;
+
+    static constexpr size_t n_neighbor_cells = [] {
+        size_t n = 1;
+        for (size_t d = 0; d < N; ++d)
+            n *= 3;
+        return n;
+    }();
+
+    for (const size_t candidate : order)
+    {
+        const auto cell       = get_cell(coordinates[candidate]);
+        bool       suppressed = false;
+
+        for (size_t neighbor = 0; neighbor < n_neighbor_cells && !suppressed; ++neighbor)
+        {
+            std::array<int64_t, N> neighbor_cell;
+            size_t                 code = neighbor;
+            for (size_t d = 0; d < N; ++d)
+            {
+                neighbor_cell[d] = cell[d] + int64_t(code % 3) - 1;
+                code /= 3;
+            }
+
+            auto it = grid.find(get_key(neighbor_cell));
+            if (it == grid.end())
+                continue;
+
+            for (const size_t other : it->second)
+            {
+                double distance_2 = 0;
+                for (size_t d = 0; d < N; ++d)
+                {
+                    const double delta =
+                        double(coordinates[candidate][d] - coordinates[other][d]);
+                    distance_2 += delta * delta;
+                }
+
+                if (distance_2 < min_distance_2)
+                {
+                    suppressed = true;
+                    break;
+                }
+            }
+        }
+
+        if (suppressed)
+            continue;
+
+        grid[get_key(cell)].push_back(candidate);
+        kept.push_back(candidate);
+    }
+
+    std::sort(kept.begin(), kept.end());
+    return kept;
+}
+
+inline void check_radius_parameters(const int                    radius,
+                                    const std::optional<double>& min_distance,
+                                    const std::string&           function_name)
+{
+    if (radius < 1)
+        throw std::invalid_argument(function_name + ": radius must be >= 1.");
+
+    if (min_distance.has_value() && !(*min_distance >= 0))
+        throw std::invalid_argument(function_name + ": min_distance must be >= 0.");
+}
+} // namespace detail
+
+template<tools::helper::c_xtensor_3d t_xtensor_3d>
+/**
+ * @brief Finds the local maxima in a 3D tensor that dominate a neighborhood of the given radius.
+ *
+ * A local maximum is a value that is greater than or equal to all values within the
+ * neighborhood. The neighborhood is defined by the radius and the connectivity:
+ * - 6: the x, y and z line segments through the cell (length 2 * radius + 1)
+ * - 18: the squares in the xy, xz and yz planes through the cell
+ * - 26: the cube with edge length 2 * radius + 1
+ * For radius 1 these are the 6, 18 and 26 connected neighborhoods. The neighborhood maxima are
+ * computed with separable van Herk / Gil-Werman running maxima, the cost per voxel does thus not
+ * depend on the radius. Along x the yz planes are streamed through a ring of 2 * radius + 1
+ * planes (per thread), no copy of the tensor is made. Cells on the border of the tensor are not
+ * considered as maxima (as in find_local_maxima), the neighborhoods are clipped at the border.
+ *
+ * @tparam t_xtensor_3d The type of the 3D tensor.
+ * @param data The 3D tensor in which to find local maxima.
+ * @param radius radius of the neighborhood (>= 1)
+ * @param connectivity 6, 18 or 26
+ * @param threshold An optional threshold value. Only values greater than this
+ *                  threshold will be considered as potential local maxima.
+ * @param accept_nans If true, NaN neighbors are ignored. If false, values with a NaN
+ *                    neighbor are not considered as local maxima.
+ * @param min_distance Optional minimum (euclidean) distance in cells between two maxima
+ *                     (non-maximum suppression). Maxima are kept in order of decreasing value.
+ * @param mp_cores The number of cores to use for parallel processing. Defaults to 1.
+ * @return A tuple containing four vectors: X, Y, Z coordinates of the local maxima,
+ *         and their corresponding values (ordered by index, x major).
+ *
+ * @throws std::invalid_argument if radius < 1, min_distance < 0 or connectivity is not 6, 18
+ *         or 26
+ */
+auto find_local_maxima_radius(
+    const t_xtensor_3d&                                    data,
+    const int                                              radius,
+    const int                                              connectivity = 26,
+    const std::optional<typename t_xtensor_3d::value_type> threshold    = std::nullopt,
+    const bool                                             accept_nans  = true,
+    const std::optional<double>                            min_distance = std::nullopt,
+    const int                                              mp_cores     = 1)
+{
+    using value_type = typename t_xtensor_3d::value_type;
+
+    detail::check_radius_parameters(radius, min_distance, "find_local_maxima_radius");
+    if (connectivity != 6 && connectivity != 18 && connectivity != 26)
+        throw std::invalid_argument("find_local_maxima_radius: connectivity must be 6, 18 or 26.");
+
+    const int64_t nx = data.shape()[0];
+    const int64_t ny = data.shape()[1];
+    const int64_t nz = data.shape()[2];
+    const size_t  r  = size_t(radius);
+
+    if (nx < 3 || ny < 3 || nz < 3)
+        return std::tuple(std::vector<int64_t>(),
+                          std::vector<int64_t>(),
+                          std::vector<int64_t>(),
+                          std::vector<value_type>());
+
+    // neighborhood maximum = max(R_x(A), B) where A and B are maxima within the yz plane:
+    // 6:  A = data,                  B = max(R_y(data), R_z(data))
+    // 18: A = max(R_y(data), R_z(data)), B = R_z(R_y(data))
+    // 26: A = R_z(R_y(data)),        B = none
+    // (running maxima commute with the pointwise maximum)
+    auto load_plane = [&](int64_t x, value_type* plane) {
+        for (int64_t y = 0; y < ny; ++y)
+            for (int64_t z = 0; z < nz; ++z)
+                plane[y * nz + z] = data.unchecked(x, y, z);
+    };
+
+    const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
+
+    const auto    chunk_begins = detail::split_range(1, nx - 1, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<std::array<int64_t, 3>> chunk_XYZ(n_chunks);
+    detail::ScanOrderBuffers<value_type>             chunk_V(n_chunks);
+
+    // R_x is computed per chunk on a stream of A planes (ring of 2 * radius + 1 planes), the
+    // planes within radius of the chunk are streamed as well
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+    {
+        detail::RunningMaxBuffers<value_type> buffers;
+        buffers.plane.resize(ny * nz);
+
+        const int64_t x_begin = chunk_begins[c];
+        const int64_t x_end   = chunk_begins[c + 1];
+        const int64_t x0      = std::max<int64_t>(0, x_begin - int64_t(r));
+        const int64_t x1      = std::min<int64_t>(nx, x_end + int64_t(r));
+
+        auto load_plane_a = [&](size_t i, value_type* plane_a) {
+            if (connectivity == 6)
+            {
+                load_plane(x0 + int64_t(i), plane_a);
+                return;
+            }
+
+            load_plane(x0 + int64_t(i), buffers.plane.data());
+            detail::plane_max(ny, nz, r, connectivity == 18, accept_nans, buffers, buffers.first);
+            std::copy_n(buffers.first.data(), ny * nz, plane_a);
+        };
+
+        auto compare_plane = [&](size_t i, const value_type* plane_max) {
+            const int64_t x = x0 + int64_t(i);
+            if (x < x_begin || x >= x_end)
+                return;
+
+            const value_type* plane_b = nullptr;
+            if (connectivity != 26)
+            {
+                load_plane(x, buffers.plane.data());
+                detail::plane_max(
+                    ny, nz, r, connectivity == 6, accept_nans, buffers, buffers.second);
+                plane_b = buffers.second.data();
+            }
+
+            for (int64_t y = 1; y < ny - 1; ++y)
+                for (int64_t z = 1; z < nz - 1; ++z)
+                {
+                    const value_type val = data.unchecked(x, y, z);
+
+                    if (!(val > threshold_val))
+                        continue;
+
+                    const int64_t i_yz    = y * nz + z;
+                    value_type    max_val = plane_max[i_yz];
+                    if (plane_b != nullptr)
+                        max_val = detail::max_of(max_val, plane_b[i_yz], accept_nans);
+
+                    if (val == max_val)
+                    {
+                        chunk_XYZ[c].push_back({ x, y, z });
+                        chunk_V[c].push_back(val);
+                    }
+                }
+        };
+
+        detail::running_max_planes(size_t(x1 - x0),
+                                   size_t(ny * nz),
+                                   r,
+                                   accept_nans,
+                                   load_plane_a,
+                                   compare_plane,
+                                   buffers.ring,
+                                   buffers.prefix,
+                                   buffers.max_plane);
+    }
+
+    auto XYZ = chunk_XYZ.merge(mp_cores);
+    auto V   = chunk_V.merge(mp_cores);
+
+    std::vector<size_t> kept;
+    if (min_distance.has_value())
+        kept = detail::suppress_non_maxima<3>(XYZ, V, *min_distance);
+    else
+    {
+        kept.resize(XYZ.size());
+        std::iota(kept.begin(), kept.end(), 0);
+    }
+
+    std::vector<int64_t>    X(kept.size()), Y(kept.size()), Z(kept.size());
+    std::vector<value_type> values(kept.size());
+    for (size_t k = 0; k < kept.size(); ++k)
+    {
+        X[k]      = XYZ[kept[k]][0];
+        Y[k]      = XYZ[kept[k]][1];
+        Z[k]      = XYZ[kept[k]][2];
+        values[k] = V[kept[k]];
+    }
+
+    return std::tuple(X, Y, Z, values);
+}
+
+template<tools::helper::c_xtensor_2d t_xtensor_2d>
+/**
+ * @brief Finds the local maxima in a 2D tensor that dominate a neighborhood of the given radius.
+ *
+ * A local maximum is a value that is greater than or equal to all values within the
+ * neighborhood. The neighborhood is defined by the radius and the connectivity:
+ * - 4: the x and y line segments through the cell (length 2 * radius + 1)
+ * - 8: the square with edge length 2 * radius + 1
+ * The neighborhood maxima are computed with separable van Herk / Gil-Werman running maxima, the
+ * cost per cell does thus not depend on the radius. Along x the rows are streamed through a ring
+ * of 2 * radius + 1 rows (per thread), no copy of the tensor is made. Cells on the border of the
+ * tensor are not considered as maxima (as in find_local_maxima), the neighborhoods are clipped at
+ * the border.
+ *
+ * @tparam t_xtensor_2d The type of the 2D tensor.
+ * @param data The 2D tensor in which to find local maxima.
+ * @param radius radius of the neighborhood (>= 1)
+ * @param connectivity 4 or 8
+ * @param threshold An optional threshold value. Only values greater than this
+ *                  threshold will be considered as potential local maxima.
+ * @param accept_nans If true, NaN neighbors are ignored. If false, values with a NaN
+ *                    neighbor are not considered as local maxima.
+ * @param min_distance Optional minimum (euclidean) distance in cells between two maxima
+ *                     (non-maximum suppression). Maxima are kept in order of decreasing value.
+ * @param mp_cores The number of cores to use for parallel processing. Defaults to 1.
+ * @return A tuple containing three vectors: X, Y coordinates of the local maxima,
+ *         and their corresponding values (ordered by index, x major).
+ *
+ * @throws std::invalid_argument if radius < 1, min_distance < 0 or connectivity is not 4 or 8
+ */
+auto find_local_maxima_radius(
+    const t_xtensor_2d&                                    data,
+    const int                                              radius,
+    const int                                              connectivity = 8,
+    const std::optional<typename t_xtensor_2d::value_type> threshold    = std::nullopt,
+    const bool                                             accept_nans  = true,
+    const std::optional<double>                            min_distance = std::nullopt,
+    const int                                              mp_cores     = 1)
+{
+    using value_type = typename t_xtensor_2d::value_type;
+
+    detail::check_radius_parameters(radius, min_distance, "find_local_maxima_radius");
+    if (connectivity != 4 && connectivity != 8)
+        throw std::invalid_argument("find_local_maxima_radius: connectivity must be 4 or 8.");
+
+    const int64_t nx = data.shape()[0];
+    const int64_t ny = data.shape()[1];
+    const size_t  r  = size_t(radius);
+
+    if (nx < 3 || ny < 3)
+        return std::tuple(
+            std::vector<int64_t>(), std::vector<int64_t>(), std::vector<value_type>());
+
+    // neighborhood maximum:
+    // 4: max(R_x(data), R_y(data))
+    // 8: R_x(R_y(data))
+    auto load_row = [&](int64_t x, value_type* row) {
+        for (int64_t y = 0; y < ny; ++y)
+            row[y] = data.unchecked(x, y);
+    };
+
+    const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
+
+    const auto    chunk_begins = detail::split_range(1, nx - 1, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<std::array<int64_t, 2>> chunk_XY(n_chunks);
+    detail::ScanOrderBuffers<value_type>             chunk_V(n_chunks);
+
+    // R_x is computed per chunk on a stream of rows (ring of 2 * radius + 1 rows), the rows
+    // within radius of the chunk are streamed as well
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+    {
+        detail::RunningMaxBuffers<value_type> buffers;
+        buffers.plane.resize(ny);
+
+        const int64_t x_begin = chunk_begins[c];
+        const int64_t x_end   = chunk_begins[c + 1];
+        const int64_t x0      = std::max<int64_t>(0, x_begin - int64_t(r));
+        const int64_t x1      = std::min<int64_t>(nx, x_end + int64_t(r));
+
+        auto load_row_a = [&](size_t i, value_type* row_a) {
+            if (connectivity == 4)
+            {
+                load_row(x0 + int64_t(i), row_a);
+                return;
+            }
+
+            load_row(x0 + int64_t(i), buffers.plane.data());
+            detail::running_max_lanes(
+                buffers.plane.data(), row_a, ny, 1, 1, r, accept_nans, buffers.g, buffers.h);
+        };
+
+        auto compare_row = [&](size_t i, const value_type* row_max) {
+            const int64_t x = x0 + int64_t(i);
+            if (x < x_begin || x >= x_end)
+                return;
+
+            if (connectivity == 4)
+            {
+                buffers.first.resize(ny);
+                load_row(x, buffers.plane.data());
+                detail::running_max_lanes(buffers.plane.data(),
+                                          buffers.first.data(),
+                                          ny,
+                                          1,
+                                          1,
+                                          r,
+                                          accept_nans,
+                                          buffers.g,
+                                          buffers.h);
+            }
+
+            for (int64_t y = 1; y < ny - 1; ++y)
+            {
+                const value_type val = data.unchecked(x, y);
+
+                if (!(val > threshold_val))
+                    continue;
+
+                value_type max_val = row_max[y];
+                if (connectivity == 4)
+                    max_val = detail::max_of(max_val, buffers.first[y], accept_nans);
+
+                if (val == max_val)
+                {
+                    chunk_XY[c].push_back({ x, y });
+                    chunk_V[c].push_back(val);
+                }
+            }
+        };
+
+        detail::running_max_planes(size_t(x1 - x0),
+                                   size_t(ny),
+                                   r,
+                                   accept_nans,
+                                   load_row_a,
+                                   compare_row,
+                                   buffers.ring,
+                                   buffers.prefix,
+                                   buffers.max_plane);
+    }
+
+    auto XY = chunk_XY.merge(mp_cores);
+    auto V  = chunk_V.merge(mp_cores);
+
+    std::vector<size_t> kept;
+    if (min_distance.has_value())
+        kept = detail::suppress_non_maxima<2>(XY, V, *min_distance);
+    else
+    {
+        kept.resize(XY.size());
+        std::iota(kept.begin(), kept.end(), 0);
+    }
+
+    std::vector<int64_t>    X(kept.size()), Y(kept.size());
+    std::vector<value_type> values(kept.size());
+    for (size_t k = 0; k < kept.size(); ++k)
+    {
+        X[k]      = XY[kept[k]][0];
+        Y[k]      = XY[kept[k]][1];
+        values[k] = V[kept[k]];
+    }
+
+    return std::tuple(X, Y, values);
+}
+
+template<tools::helper::c_xtensor_1d t_xtensor_1d>
+/**
+ * @brief Finds the local maxima in a 1D tensor that dominate a neighborhood of the given radius.
+ *
+ * A local maximum is a value that is greater than or equal to all values within
+ * [x - radius, x + radius]. The neighborhood maxima are computed with a van Herk / Gil-Werman
+ * running maximum, the cost per cell does thus not depend on the radius. The first and last
+ * cell are not considered as maxima (as in find_local_maxima), the neighborhoods are clipped at
+ * the border.
+ *
+ * @tparam t_xtensor_1d The type of the 1D tensor.
+ * @param data The 1D tensor in which to find local maxima.
+ * @param radius radius of the neighborhood (>= 1)
+ * @param threshold An optional threshold value. Only values greater than this
+ *                  threshold will be considered as potential local maxima.
+ * @param accept_nans If true, NaN neighbors are ignored. If false, values with a NaN
+ *                    neighbor are not considered as local maxima.
+ * @param min_distance Optional minimum distance in cells between two maxima
+ *                     (non-maximum suppression). Maxima are kept in order of decreasing value.
+ * @return A tuple containing two vectors: indices of the local maxima,
+ *         and their corresponding values (ordered by index).
+ *
+ * @throws std::invalid_argument if radius < 1 or min_distance < 0
+ */
+auto find_local_maxima_radius(
+    const t_xtensor_1d&                                    data,
+    const int                                              radius,
+    const std::optional<typename t_xtensor_1d::value_type> threshold    = std::nullopt,
+    const bool                                             accept_nans  = true,
+    const std::optional<double>                            min_distance = std::nullopt)
+{
+    using value_type = typename t_xtensor_1d::value_type;
+
+    detail::check_radius_parameters(radius, min_distance, "find_local_maxima_radius");
+
+    const int64_t nx = data.shape()[0];
+
+    if (nx < 3)
+        return std::tuple(std::vector<int64_t>(), std::vector<value_type>());
+
+    std::vector<value_type> values(nx), max_values(nx), g, h;
+    for (int64_t x = 0; x < nx; ++x)
+        values[x] = data.unchecked(x);
+
+    detail::running_max_lanes(
+        values.data(), max_values.data(), nx, 1, 1, size_t(radius), accept_nans, g, h);
+
+    const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
+
+    std::vector<std::array<int64_t, 1>> X;
+    std::vector<value_type>             V;
+    for (int64_t x = 1; x < nx - 1; ++x)
+    {
+        const value_type val = values[x];
+
+        if (val > threshold_val && val == max_values[x])
+        {
+            X.push_back({ x });
+            V.push_back(val);
+        }
+    }
+
+    std::vector<size_t> kept;
+    if (min_distance.has_value())
+        kept = detail::suppress_non_maxima<1>(X, V, *min_distance);
+    else
+    {
+        kept.resize(X.size());
+        std::iota(kept.begin(), kept.end(), 0);
+    }
+
+    std::vector<int64_t>    indices(kept.size());
+    std::vector<value_type> kept_values(kept.size());
+    for (size_t k = 0; k < kept.size(); ++k)
+    {
+        indices[k]     = X[kept[k]][0];
+        kept_values[k] = V[kept[k]];
+    }
+
+    return std::tuple(indices, kept_values);
+}
+
+} // namespace functions
+} // namespace imageprocessing
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -11,6 +11,9 @@
 /* generated doc strings */
 #include ".docstrings/find_local_maxima.doc.hpp"
 
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <vector>
 
@@ -20,6 +23,8 @@
 #include <xtensor/containers/xtensor.hpp>
 #include <xtensor/views/xview.hpp>
 
+#include "scan_order_buffers.hpp"
+
 namespace themachinethatgoesping {
 namespace algorithms {
 namespace imageprocessing {
@@ -77,7 +82,8 @@ template<tools::helper::c_xtensor_3d t_xtensor_regions, tools::helper::c_xtensor
  *
  * @throws std::invalid_argument if regions_volume and data_volume have different shapes
  *
- * @note The function uses OpenMP for parallel processing when mp_cores > 1
+ * @note The function uses OpenMP for parallel processing when mp_cores > 1 (the result does
+ *       not depend on mp_cores)
  * @note Template parameters must be 3D tensors (checked via static_assert)
  */
 bool grow_regions(
@@ -105,17 +111,21 @@ bool grow_regions(
     const int64_t ny = data_volume.shape()[1];
     const int64_t nx = data_volume.shape()[0];
 
-    // create vectors to store region changes
-    std::vector<xt::xtensor_fixed<int64_t, xt::xshape<3>>> grow_region_indices;
-    std::vector<region_type>                               grow_region_regions;
-
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the x range is split into contiguous chunks (one per thread), the region changes of each
+    // chunk are collected in separate buffers that are merged in scan order
+    const auto    chunk_begins = detail::split_range(0, nx, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<xt::xtensor_fixed<int64_t, xt::xshape<3>>> chunk_indices(n_chunks);
+    detail::ScanOrderBuffers<region_type>                                 chunk_regions(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
     {
-#pragma omp for
-        for (int64_t x = 0; x < nx; ++x)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
         {
             const int64_t start_x = std::max(x - 1, int64_t(0));
             const int64_t end_x   = std::min(x + 2, nx);
@@ -179,17 +189,16 @@ bool grow_regions(
                         non_null_data.unchecked(max_index) < val)
                         continue;
 
-#pragma omp critical
-                    {
-                        grow_region_indices.push_back({ x, y, z });
-                        grow_region_regions.push_back(neighbor_regions.unchecked(max_index));
-                    }
+                    chunk_indices[c].push_back({ x, y, z });
+                    chunk_regions[c].push_back(neighbor_regions.unchecked(max_index));
                 }
             }
         }
     }
 
     // update regions
+    const auto grow_region_indices = chunk_indices.merge(mp_cores);
+    const auto grow_region_regions = chunk_regions.merge(mp_cores);
     xt::index_view(regions_volume, grow_region_indices) = xt::adapt(grow_region_regions);
 
     return grow_region_indices.size() > 0;
@@ -221,7 +230,8 @@ template<tools::helper::c_xtensor_2d t_xtensor_regions, tools::helper::c_xtensor
  *
  * @throws std::invalid_argument if regions_image and data_image have different shapes
  *
- * @note The function uses OpenMP for parallel processing when mp_cores > 1
+ * @note The function uses OpenMP for parallel processing when mp_cores > 1 (the result does
+ *       not depend on mp_cores)
  * @note Template parameters must be 2D tensors (checked via static_assert)
  */
 bool grow_regions([[maybe_unused]] t_xtensor_regions&                      regions_image,
@@ -246,17 +256,21 @@ bool grow_regions([[maybe_unused]] t_xtensor_regions&                      regio
     const int64_t ny = data_image.shape()[1];
     const int64_t nx = data_image.shape()[0];
 
-    // create vectors to store region changes
-    std::vector<xt::xtensor_fixed<int64_t, xt::xshape<2>>> grow_region_indices;
-    std::vector<region_type>                               grow_region_regions;
-
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the x range is split into contiguous chunks (one per thread), the region changes of each
+    // chunk are collected in separate buffers that are merged in scan order
+    const auto    chunk_begins = detail::split_range(0, nx, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<xt::xtensor_fixed<int64_t, xt::xshape<2>>> chunk_indices(n_chunks);
+    detail::ScanOrderBuffers<region_type>                                 chunk_regions(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
     {
-#pragma omp for
-        for (int64_t x = 0; x < nx; ++x)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
         {
             const int64_t start_x = std::max(x - 1, int64_t(0));
             const int64_t end_x   = std::min(x + 2, nx);
@@ -310,16 +324,15 @@ bool grow_regions([[maybe_unused]] t_xtensor_regions&                      regio
                     non_null_data.unchecked(max_index) < val)
                     continue;
 
-#pragma omp critical
-                {
-                    grow_region_indices.push_back({ x, y });
-                    grow_region_regions.push_back(neighbor_regions.unchecked(max_index));
-                }
+                chunk_indices[c].push_back({ x, y });
+                chunk_regions[c].push_back(neighbor_regions.unchecked(max_index));
             }
         }
     }
 
     // update regions
+    const auto grow_region_indices = chunk_indices.merge(mp_cores);
+    const auto grow_region_regions = chunk_regions.merge(mp_cores);
     xt::index_view(regions_image, grow_region_indices) = xt::adapt(grow_region_regions);
 
     return grow_region_indices.size() > 0;
@@ -351,7 +364,8 @@ template<tools::helper::c_xtensor_1d t_xtensor_regions, tools::helper::c_xtensor
  *
  * @throws std::invalid_argument if regions_array and data_array have different shapes
  *
- * @note The function uses OpenMP for parallel processing when mp_cores > 1
+ * @note The function uses OpenMP for parallel processing when mp_cores > 1 (the result does
+ *       not depend on mp_cores)
  * @note Template parameters must be 1D tensors (checked via static_assert)
  */
 bool grow_regions([[maybe_unused]] t_xtensor_regions&                      regions_array,
@@ -375,17 +389,21 @@ bool grow_regions([[maybe_unused]] t_xtensor_regions&                      regio
 
     const int64_t nx = data_array.shape()[0];
 
-    // create vectors to store region changes
-    std::vector<xt::xtensor_fixed<int64_t, xt::xshape<1>>> grow_region_indices;
-    std::vector<region_type>                               grow_region_regions;
-
     // preprocess threshold
     const auto threshold_val = threshold.value_or(std::numeric_limits<value_type>::lowest());
 
-#pragma omp parallel num_threads(mp_cores)
+    // the x range is split into contiguous chunks (one per thread), the region changes of each
+    // chunk are collected in separate buffers that are merged in scan order
+    const auto    chunk_begins = detail::split_range(0, nx, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    detail::ScanOrderBuffers<xt::xtensor_fixed<int64_t, xt::xshape<1>>> chunk_indices(n_chunks);
+    detail::ScanOrderBuffers<region_type>                                 chunk_regions(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
     {
-#pragma omp for
-        for (int64_t x = 0; x < nx; ++x)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
         {
             const int64_t start_x = std::max(x - 1, int64_t(0));
             const int64_t end_x   = std::min(x + 2, nx);
@@ -433,21 +451,401 @@ bool grow_regions([[maybe_unused]] t_xtensor_regions&                      regio
                 non_null_data.unchecked(max_index) < val)
                 continue;
 
-#pragma omp critical
-            {
-                grow_region_indices.push_back({ x });
-                grow_region_regions.push_back(neighbor_regions.unchecked(max_index));
-            }
+            chunk_indices[c].push_back({ x });
+            chunk_regions[c].push_back(neighbor_regions.unchecked(max_index));
         }
     }
 
     // update regions
+    const auto grow_region_indices = chunk_indices.merge(mp_cores);
+    const auto grow_region_regions = chunk_regions.merge(mp_cores);
     xt::index_view(regions_array, grow_region_indices) = xt::adapt(grow_region_regions);
 
     return grow_region_indices.size() > 0;
 }
 
+namespace detail {
+/**
+ * @brief Scalar version of get_non_null_mask
+ */
+template<typename t_region>
+inline bool is_non_null_neighbor(const t_region& region, const t_region& null_region)
+{
+    if constexpr (std::is_floating_point_v<t_region>)
+    {
+        if (std::isnan(null_region))
+            return std::isfinite(region);
+    }
+
+    return region != null_region;
+}
+
+/**
+ * @brief Frontier based implementation of grow_regions_until_converged. The region labels and
+ * the data are accessed in place (element strides), cells are identified by their row major
+ * index. Iteration k only evaluates the cells in the neighborhood of the cells that changed in
+ * iteration k - 1 (the first iteration evaluates all cells). The decision for a cell only
+ * depends on its neighborhood, such that all other cells would not change anyways. The
+ * assignments of an iteration are computed from the labels of the previous iteration (as in
+ * grow_regions).
+ *
+ * @return int64_t number of iterations that assigned at least one cell
+ */
+template<size_t N, typename t_region, typename t_value>
+inline int64_t grow_regions_frontier(t_region*                     regions,
+                                     const std::array<int64_t, N>& region_strides,
+                                     const t_value*                data,
+                                     const std::array<int64_t, N>& data_strides,
+                                     const std::array<int64_t, N>& shape,
+                                     const t_region                null_region,
+                                     const std::optional<t_value>  threshold,
+                                     const bool                    force_negative_gradient,
+                                     const bool                    eat_neighbor_regions,
+                                     const std::optional<int64_t>  max_iterations,
+                                     const int                     mp_cores)
+{
+    static constexpr int64_t n_neighbors = [] {
+        int64_t n = 1;
+        for (size_t d = 0; d < N; ++d)
+            n *= 3;
+        return n;
+    }();
+
+    const auto threshold_val = threshold.value_or(std::numeric_limits<t_value>::lowest());
+
+    // row major strides of the cell index
+    std::array<int64_t, N> strides;
+    strides[N - 1] = 1;
+    for (size_t d = N - 1; d > 0; --d)
+        strides[d - 1] = strides[d] * shape[d];
+
+    const int64_t n_cells = strides[0] * shape[0];
+
+    auto get_coordinates = [&strides](const int64_t i) {
+        std::array<int64_t, N> coordinates;
+        int64_t                rest = i;
+        for (size_t d = 0; d < N; ++d)
+        {
+            coordinates[d] = rest / strides[d];
+            rest %= strides[d];
+        }
+        return coordinates;
+    };
+
+    auto get_offset = [](const std::array<int64_t, N>& coordinates,
+                         const std::array<int64_t, N>& element_strides) {
+        int64_t offset = 0;
+        for (size_t d = 0; d < N; ++d)
+            offset += coordinates[d] * element_strides[d];
+        return offset;
+    };
+
+    // calls f(neighbor_index, region_offset, data_offset) for all cells of the (clipped) 3^N
+    // neighborhood of the cell at coordinates, in row major order (the order of the
+    // neighborhood views in grow_regions)
+    auto for_each_neighbor = [&](const std::array<int64_t, N>& coordinates, auto&& f) {
+        for (int64_t code = 0; code < n_neighbors; ++code)
+        {
+            int64_t neighbor = 0, region_offset = 0, data_offset = 0, digits = code;
+            bool    inside = true;
+            for (size_t d = N; d-- > 0;)
+            {
+                const int64_t c = coordinates[d] + digits % 3 - 1;
+                digits /= 3;
+                if (c < 0 || c >= shape[d])
+                {
+                    inside = false;
+                    break;
+                }
+                neighbor += c * strides[d];
+                region_offset += c * region_strides[d];
+                data_offset += c * data_strides[d];
+            }
+            if (inside)
+                f(neighbor, region_offset, data_offset);
+        }
+    };
+
+    // candidates of the current iteration (all cells in the first iteration)
+    bool                 all_cells = true;
+    std::vector<int64_t> candidates;
+
+    // cells that are already part of the next candidates (deduplication)
+    std::vector<bool> is_candidate(n_cells, false);
+
+    int64_t iterations = 0;
+    while (!max_iterations.has_value() || iterations < *max_iterations)
+    {
+        const int64_t n_candidates = all_cells ? n_cells : int64_t(candidates.size());
+        if (n_candidates == 0)
+            break;
+
+        const auto    chunk_begins = split_range(0, n_candidates, mp_cores);
+        const int64_t n_chunks     = chunk_begins.size() - 1;
+
+        ScanOrderBuffers<int64_t>  chunk_indices(n_chunks);
+        ScanOrderBuffers<t_region> chunk_regions(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+        for (int64_t c = 0; c < n_chunks; ++c)
+        {
+            for (int64_t k = chunk_begins[c]; k < chunk_begins[c + 1]; ++k)
+            {
+                const int64_t  i           = all_cells ? k : candidates[k];
+                const auto     coordinates = get_coordinates(i);
+                const t_region region      = regions[get_offset(coordinates, region_strides)];
+
+                const bool region_is_null = is_null_region(region, null_region);
+                if (!region_is_null && !eat_neighbor_regions)
+                    continue;
+
+                const t_value val = data[get_offset(coordinates, data_strides)];
+                if (!(val > threshold_val))
+                    continue;
+
+                // first neighbor with the maximum data value within the non-null neighbors
+                bool     found = false;
+                t_value  best_val{};
+                t_region best_region{};
+                for_each_neighbor(
+                    coordinates,
+                    [&](int64_t, const int64_t region_offset, const int64_t data_offset) {
+                        const t_region neighbor_region = regions[region_offset];
+                        if (!is_non_null_neighbor(neighbor_region, null_region))
+                            return;
+                        if (eat_neighbor_regions && !region_is_null && neighbor_region == region)
+                            return;
+                        if (!found || data[data_offset] > best_val)
+                        {
+                            found       = true;
+                            best_val    = data[data_offset];
+                            best_region = neighbor_region;
+                        }
+                    });
+
+                if (!found)
+                    continue;
+
+                if ((force_negative_gradient || !region_is_null) && best_val < val)
+                    continue;
+
+                chunk_indices[c].push_back(i);
+                chunk_regions[c].push_back(best_region);
+            }
+        }
+
+        const auto changed_indices = chunk_indices.merge(mp_cores);
+        const auto changed_regions = chunk_regions.merge(mp_cores);
+
+        if (changed_indices.empty())
+            break;
+
+        ++iterations;
+        for (size_t k = 0; k < changed_indices.size(); ++k)
+            regions[get_offset(get_coordinates(changed_indices[k]), region_strides)] =
+                changed_regions[k];
+
+        // next frontier: the neighborhoods of the changed cells
+        all_cells = false;
+        candidates.clear();
+        for (const int64_t i : changed_indices)
+            for_each_neighbor(get_coordinates(i), [&](const int64_t n, int64_t, int64_t) {
+                if (is_candidate[n])
+                    return;
+                is_candidate[n] = true;
+                candidates.push_back(n);
+            });
+        for (const int64_t n : candidates)
+            is_candidate[n] = false;
+    }
+
+    return iterations;
+}
+
+/**
+ * @brief Run grow_regions_frontier on the memory of N dimensional xtensors (no copies)
+ */
+template<size_t N, typename t_xtensor_regions, typename t_xtensor_data>
+inline int64_t grow_regions_frontier(
+    t_xtensor_regions&                                       regions,
+    const t_xtensor_data&                                    data,
+    const typename t_xtensor_regions::value_type             null_region,
+    const std::optional<typename t_xtensor_data::value_type> threshold,
+    const bool                                               force_negative_gradient,
+    const bool                                               eat_neighbor_regions,
+    const std::optional<int64_t>                             max_iterations,
+    const int                                                mp_cores)
+{
+    std::array<int64_t, N> shape, region_strides, data_strides;
+    for (size_t d = 0; d < N; ++d)
+    {
+        shape[d]          = int64_t(data.shape()[d]);
+        region_strides[d] = int64_t(regions.strides()[d]);
+        data_strides[d]   = int64_t(data.strides()[d]);
+    }
+
+    return grow_regions_frontier<N>(regions.data(),
+                                    region_strides,
+                                    data.data(),
+                                    data_strides,
+                                    shape,
+                                    null_region,
+                                    threshold,
+                                    force_negative_gradient,
+                                    eat_neighbor_regions,
+                                    max_iterations,
+                                    mp_cores);
+}
+} // namespace detail
+
+template<tools::helper::c_xtensor_3d t_xtensor_regions, tools::helper::c_xtensor_3d t_xtensor_data>
+/**
+ * @brief Grow regions in a 3D volume until no more cells are assigned. The result is the same
+ * as calling grow_regions until it returns false, but only the neighborhood of the cells that
+ * changed in the previous iteration is evaluated (frontier) instead of the full volume.
+ *
+ * @tparam t_xtensor_regions Type of the 3D tensor containing region labels
+ * @tparam t_xtensor_data Type of the 3D tensor containing data values
+ *
+ * @param regions_volume 3D tensor containing region labels, will be modified by the function
+ * @param data_volume 3D tensor containing data values, used to determine region growth
+ * @param null_region Value representing unlabeled/null regions in the regions_volume
+ * @param threshold Optional minimum data value for a cell to be considered for region assignment
+ *                  If not provided, all cells are considered regardless of value
+ * @param force_negative_gradient If true, only grow regions where the neighbor's data value
+ *                                is less than the current cell's value (enforcing a negative
+ * gradient)
+ * @param eat_neighbor_regions If true, the function will also consider neighboring regions
+ * @param max_iterations Optional maximum number of iterations (eating neighbor regions does not
+ *                       necessarily converge)
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @return int64_t number of iterations that assigned at least one cell
+ *
+ * @throws std::invalid_argument if regions_volume and data_volume have different shapes
+ */
+int64_t grow_regions_until_converged(
+    t_xtensor_regions&                                       regions_volume,
+    const t_xtensor_data&                                    data_volume,
+    const typename t_xtensor_regions::value_type             null_region,
+    const std::optional<typename t_xtensor_data::value_type> threshold               = std::nullopt,
+    const bool                                               force_negative_gradient = true,
+    const bool                                               eat_neighbor_regions    = false,
+    const std::optional<int64_t>                             max_iterations          = std::nullopt,
+    const int                                                mp_cores                = 1)
+{
+    if (regions_volume.shape() != data_volume.shape())
+        throw std::invalid_argument("regions_volume and data_volume must have the same shape.");
+
+    return detail::grow_regions_frontier<3>(regions_volume,
+                                            data_volume,
+                                            null_region,
+                                            threshold,
+                                            force_negative_gradient,
+                                            eat_neighbor_regions,
+                                            max_iterations,
+                                            mp_cores);
+}
+
+template<tools::helper::c_xtensor_2d t_xtensor_regions, tools::helper::c_xtensor_2d t_xtensor_data>
+/**
+ * @brief Grow regions in a 2D image until no more cells are assigned. The result is the same
+ * as calling grow_regions until it returns false, but only the neighborhood of the cells that
+ * changed in the previous iteration is evaluated (frontier) instead of the full image.
+ *
+ * @tparam t_xtensor_regions Type of the 2D tensor containing region labels
+ * @tparam t_xtensor_data Type of the 2D tensor containing data values
+ *
+ * @param regions_image 2D tensor containing region labels, will be modified by the function
+ * @param data_image 2D tensor containing data values, used to determine region growth
+ * @param null_region Value representing unlabeled/null regions in the regions_image
+ * @param threshold Optional minimum data value for a cell to be considered for region assignment
+ *                  If not provided, all cells are considered regardless of value
+ * @param force_negative_gradient If true, only grow regions where the neighbor's data value
+ *                                is less than the current cell's value (enforcing a negative
+ * gradient)
+ * @param eat_neighbor_regions If true, the function will also consider neighboring regions
+ * @param max_iterations Optional maximum number of iterations (eating neighbor regions does not
+ *                       necessarily converge)
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @return int64_t number of iterations that assigned at least one cell
+ *
+ * @throws std::invalid_argument if regions_image and data_image have different shapes
+ */
+int64_t grow_regions_until_converged(
+    t_xtensor_regions&                                       regions_image,
+    const t_xtensor_data&                                    data_image,
+    const typename t_xtensor_regions::value_type             null_region,
+    const std::optional<typename t_xtensor_data::value_type> threshold               = std::nullopt,
+    const bool                                               force_negative_gradient = true,
+    const bool                                               eat_neighbor_regions    = false,
+    const std::optional<int64_t>                             max_iterations          = std::nullopt,
+    const int                                                mp_cores                = 1)
+{
+    if (regions_image.shape() != data_image.shape())
+        throw std::invalid_argument("regions_image and data_image must have the same shape.");
+
+    return detail::grow_regions_frontier<2>(regions_image,
+                                            data_image,
+                                            null_region,
+                                            threshold,
+                                            force_negative_gradient,
+                                            eat_neighbor_regions,
+                                            max_iterations,
+                                            mp_cores);
+}
+
+template<tools::helper::c_xtensor_1d t_xtensor_regions, tools::helper::c_xtensor_1d t_xtensor_data>
+/**
+ * @brief Grow regions in a 1D array until no more cells are assigned. The result is the same
+ * as calling grow_regions until it returns false, but only the neighborhood of the cells that
+ * changed in the previous iteration is evaluated (frontier) instead of the full array.
+ *
+ * @tparam t_xtensor_regions Type of the 1D tensor containing region labels
+ * @tparam t_xtensor_data Type of the 1D tensor containing data values
+ *
+ * @param regions_array 1D tensor containing region labels, will be modified by the function
+ * @param data_array 1D tensor containing data values, used to determine region growth
+ * @param null_region Value representing unlabeled/null regions in the regions_array
+ * @param threshold Optional minimum data value for a cell to be considered for region assignment
+ *                  If not provided, all cells are considered regardless of value
+ * @param force_negative_gradient If true, only grow regions where the neighbor's data value
+ *                                is less than the current cell's value (enforcing a negative
+ * gradient)
+ * @param eat_neighbor_regions If true, the function will also consider neighboring regions
+ * @param max_iterations Optional maximum number of iterations (eating neighbor regions does not
+ *                       necessarily converge)
+ * @param mp_cores Number of cores to use for parallel processing
+ *
+ * @return int64_t number of iterations that assigned at least one cell
+ *
+ * @throws std::invalid_argument if regions_array and data_array have different shapes
+ */
+int64_t grow_regions_until_converged(
+    t_xtensor_regions&                                       regions_array,
+    const t_xtensor_data&                                    data_array,
+    const typename t_xtensor_regions::value_type             null_region,
+    const std::optional<typename t_xtensor_data::value_type> threshold               = std::nullopt,
+    const bool                                               force_negative_gradient = true,
+    const bool                                               eat_neighbor_regions    = false,
+    const std::optional<int64_t>                             max_iterations          = std::nullopt,
+    const int                                                mp_cores                = 1)
+{
+    if (regions_array.shape() != data_array.shape())
+        throw std::invalid_argument("regions_array and data_array must have the same shape.");
+
+    return detail::grow_regions_frontier<1>(regions_array,
+                                            data_array,
+                                            null_region,
+                                            threshold,
+                                            force_negative_gradient,
+                                            eat_neighbor_regions,
+                                            max_iterations,
+                                            mp_cores);
+}
+
+}
 }
 }
 }
-}
\ No newline at end of file
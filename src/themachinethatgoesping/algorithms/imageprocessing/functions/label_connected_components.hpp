@@ -0,0 +1,437 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/label_connected_components.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "scan_order_buffers.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace imageprocessing {
+namespace functions {
+
+namespace detail {
+/**
+ * @brief Root of cell i in a union-find forest (path halving). Roots are the smallest cell index
+ * of their component.
+ */
+inline int64_t find_root(std::vector<int64_t>& parent, int64_t i)
+{
+    while (parent[i] != i)
+    {
+        parent[i] = parent[parent[i]];
+        i         = parent[i];
+    }
+    return i;
+}
+
+/**
+ * @brief Root of cell i without modifying the forest (safe for concurrent reads)
+ */
+inline int64_t find_root_const(const std::vector<int64_t>& parent, int64_t i)
+{
+    while (parent[i] != i)
+        i = parent[i];
+    return i;
+}
+
+/**
+ * @brief Join the components of cell a and b. The smaller root becomes the root of the joined
+ * component (the root is the first cell of the component in scan order).
+ */
+inline void unite(std::vector<int64_t>& parent, const int64_t a, const int64_t b)
+{
+    const int64_t root_a = find_root(parent, a);
+    const int64_t root_b = find_root(parent, b);
+
+    if (root_a < root_b)
+        parent[root_b] = root_a;
+    else if (root_b < root_a)
+        parent[root_a] = root_b;
+}
+
+/**
+ * @brief Offsets of the neighbors that precede a cell in scan order (first non zero offset is -1)
+ * for a connectivity given as the maximum number of non zero offsets (1: 4 / 6, 2: 8 / 18,
+ * 3: 26 connectivity).
+ */
+template<size_t N>
+inline std::vector<std::array<int64_t, N>> get_backward_neighbor_offsets(
+    const size_t max_nonzero_offsets)
+{
+    std::vector<std::array<int64_t, N>> offsets;
+
+    size_t n_codes = 1;
+    for (size_t d = 0; d < N; ++d)
+        n_codes *= 3;
+
+    for (size_t code = 0; code < n_codes; ++code)
+    {
+        std::array<int64_t, N> offset;
+        size_t                 digits = code;
+        for (size_t d = N; d-- > 0;)
+        {
+            offset[d] = int64_t(digits % 3) - 1;
+            digits /= 3;
+        }
+
+        size_t n_nonzero = 0;
+        int    first     = 0;
+        for (size_t d = 0; d < N; ++d)
+            if (offset[d] != 0)
+            {
+                if (n_nonzero == 0)
+                    first = int(offset[d]);
+                ++n_nonzero;
+            }
+
+        if (first == -1 && n_nonzero <= max_nonzero_offsets)
+            offsets.push_back(offset);
+    }
+
+    return offsets;
+}
+
+/**
+ * @brief Union-find connected component labeling of a row major (flat) foreground mask.
+ *
+ * 1. The x axis is split into slabs (one per thread). Each slab joins its cells with the
+ *    preceding neighbors within the slab.
+ * 2. The slab borders are joined (serial, one plane per border).
+ * 3. The component roots are labeled in scan order (1, 2, ...) using a prefix sum over the
+ *    number of roots per slab, then all cells are labeled (parallel).
+ * 4. Voxel counts and bounding boxes are accumulated per slab and merged.
+ *
+ * @return tuple(voxel counts, bounding box minima, bounding box maxima) per label
+ */
+template<size_t N, typename t_region>
+inline auto label_connected_components_flat(const std::vector<uint8_t>&   foreground,
+                                            const std::array<int64_t, N>& shape,
+                                            const size_t                  max_nonzero_offsets,
+                                            t_region*                     regions,
+                                            const int                     mp_cores)
+{
+    std::array<int64_t, N> strides;
+    strides[N - 1] = 1;
+    for (size_t d = N - 1; d > 0; --d)
+        strides[d - 1] = strides[d] * shape[d];
+
+    const int64_t n_cells = strides[0] * shape[0];
+
+    const auto offsets = get_backward_neighbor_offsets<N>(max_nonzero_offsets);
+
+    auto get_coordinates = [&strides](int64_t i) {
+        std::array<int64_t, N> coordinates;
+        for (size_t d = 0; d < N; ++d)
+        {
+            coordinates[d] = i / strides[d];
+            i %= strides[d];
+        }
+        return coordinates;
+    };
+
+    // joins cell i with its preceding foreground neighbors with x >= x_min
+    auto join_backward_neighbors = [&](std::vector<int64_t>& parent,
+                                       const int64_t         i,
+                                       const int64_t         x_min,
+                                       const bool            only_previous_plane) {
+        const auto coordinates = get_coordinates(i);
+        for (const auto& offset : offsets)
+        {
+            if (only_previous_plane && offset[0] != -1)
+                continue;
+
+            int64_t neighbor = 0;
+            bool    inside   = true;
+            for (size_t d = 0; d < N; ++d)
+            {
+                const int64_t c = coordinates[d] + offset[d];
+                if (c < (d == 0 ? x_min : 0) || c >= shape[d])
+                {
+                    inside = false;
+                    break;
+                }
+                neighbor += c * strides[d];
+            }
+
+            if (inside && foreground[neighbor])
+                unite(parent, i, neighbor);
+        }
+    };
+
+    std::vector<int64_t> parent(n_cells);
+
+    const auto    chunk_begins = split_range(0, shape[0], mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    // 1. join within slabs
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+        for (int64_t i = chunk_begins[c] * strides[0]; i < chunk_begins[c + 1] * strides[0]; ++i)
+        {
+            parent[i] = i;
+            if (foreground[i])
+                join_backward_neighbors(parent, i, chunk_begins[c], false);
+        }
+
+    // 2. join across the slab borders
+    for (int64_t c = 1; c < n_chunks; ++c)
+        for (int64_t i = chunk_begins[c] * strides[0]; i < (chunk_begins[c] + 1) * strides[0]; ++i)
+            if (foreground[i])
+                join_backward_neighbors(parent, i, 0, true);
+
+    // 3. label the roots in scan order, then all cells
+    std::vector<int64_t> n_roots(n_chunks + 1, 0);
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+        for (int64_t i = chunk_begins[c] * strides[0]; i < chunk_begins[c + 1] * strides[0]; ++i)
+            if (foreground[i] && parent[i] == i)
+                ++n_roots[c + 1];
+
+    // exclusive prefix sum: first label - 1 of each slab
+    for (int64_t c = 0; c < n_chunks; ++c)
+        n_roots[c + 1] += n_roots[c];
+    const int64_t n_labels = n_roots.back();
+
+    if (n_labels > int64_t(std::numeric_limits<t_region>::max()))
+        throw std::runtime_error(
+            "label_connected_components: the number of labels exceeds the region type.");
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+    {
+        int64_t label = n_roots[c];
+        for (int64_t i = chunk_begins[c] * strides[0]; i < chunk_begins[c + 1] * strides[0]; ++i)
+            regions[i] = (foreground[i] && parent[i] == i) ? t_region(++label) : t_region(0);
+    }
+
+    // 4. label the remaining cells and accumulate the statistics
+    struct Statistics
+    {
+        int64_t                count = 0;
+        std::array<int64_t, N> min, max;
+
+        void add(const std::array<int64_t, N>& coordinates)
+        {
+            if (count == 0)
+                min = max = coordinates;
+            else
+                for (size_t d = 0; d < N; ++d)
+                {
+                    min[d] = std::min(min[d], coordinates[d]);
+                    max[d] = std::max(max[d], coordinates[d]);
+                }
+            ++count;
+        }
+
+        void add(const Statistics& other)
+        {
+            if (count == 0)
+            {
+                *this = other;
+                return;
+            }
+
+            for (size_t d = 0; d < N; ++d)
+            {
+                min[d] = std::min(min[d], other.min[d]);
+                max[d] = std::max(max[d], other.max[d]);
+            }
+            count += other.count;
+        }
+    };
+
+    std::vector<Statistics> statistics(n_labels);
+
+    // components that started in a previous slab (per slab, merged serially)
+    std::vector<std::unordered_map<int64_t, Statistics>> foreign_statistics(n_chunks);
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+    {
+        auto& foreign = foreign_statistics[c];
+        for (int64_t i = chunk_begins[c] * strides[0]; i < chunk_begins[c + 1] * strides[0]; ++i)
+        {
+            if (!foreground[i])
+                continue;
+
+            const int64_t root  = find_root_const(parent, i);
+            const int64_t label = int64_t(regions[root]);
+            if (root != i)
+                regions[i] = regions[root];
+
+            // the labels of the roots within this slab are only accessed by this thread
+            if (label > n_roots[c])
+                statistics[label - 1].add(get_coordinates(i));
+            else
+                foreign[label].add(get_coordinates(i));
+        }
+    }
+
+    for (const auto& foreign : foreign_statistics)
+        for (const auto& [label, label_statistics] : foreign)
+            statistics[label - 1].add(label_statistics);
+
+    std::vector<int64_t> voxel_counts(n_labels);
+    auto                 bbox_min = xt::xtensor<int64_t, 2>::from_shape({ size_t(n_labels), N });
+    auto                 bbox_max = xt::xtensor<int64_t, 2>::from_shape({ size_t(n_labels), N });
+    for (int64_t l = 0; l < n_labels; ++l)
+    {
+        voxel_counts[l] = statistics[l].count;
+        for (size_t d = 0; d < N; ++d)
+        {
+            bbox_min.unchecked(l, d) = statistics[l].min[d];
+            bbox_max.unchecked(l, d) = statistics[l].max[d];
+        }
+    }
+
+    return std::tuple(voxel_counts, bbox_min, bbox_max);
+}
+
+inline size_t get_max_nonzero_offsets(const int connectivity, const size_t n_dims)
+{
+    if (n_dims == 3)
+    {
+        switch (connectivity)
+        {
+            case 6:
+                return 1;
+            case 18:
+                return 2;
+            case 26:
+                return 3;
+            default:
+                throw std::invalid_argument(
+                    "label_connected_components: connectivity must be 6, 18 or 26 for 3D masks.");
+        }
+    }
+
+    switch (connectivity)
+    {
+        case 4:
+            return 1;
+        case 8:
+            return 2;
+        default:
+            throw std::invalid_argument(
+                "label_connected_components: connectivity must be 4 or 8 for 2D masks.");
+    }
+}
+} // namespace detail
+
+template<typename t_region = int64_t, tools::helper::c_xtensor_3d t_xtensor_mask>
+/**
+ * @brief Label the connected components of a 3D mask (union-find, parallel by x slabs).
+ *
+ * All non zero cells of the mask are foreground. The components are labeled 1, 2, ... in the
+ * scan order (x major) of their first cell, background cells are 0. The region volume can thus
+ * be used directly in grow_regions (null_region = 0). The result does not depend on mp_cores.
+ *
+ * @tparam t_region Type of the region labels
+ * @tparam t_xtensor_mask Type of the 3D mask tensor
+ * @param mask 3D mask (non zero: foreground)
+ * @param connectivity 6, 18 or 26
+ * @param mp_cores Number of cores to use for parallel processing
+ * @return tuple(regions (nx, ny, nz), voxel counts per label (n_labels),
+ *         bounding box minima (n_labels, 3), bounding box maxima (n_labels, 3)). Row l
+ *         corresponds to label l + 1, the bounding boxes are inclusive cell indices.
+ *
+ * @throws std::invalid_argument if the connectivity is not 6, 18 or 26
+ * @throws std::runtime_error if the number of labels exceeds the range of t_region
+ */
+auto label_connected_components(const t_xtensor_mask& mask,
+                                const int             connectivity = 26,
+                                const int             mp_cores     = 1)
+{
+    const size_t max_nonzero_offsets = detail::get_max_nonzero_offsets(connectivity, 3);
+
+    const std::array<int64_t, 3> shape = { int64_t(mask.shape()[0]),
+                                           int64_t(mask.shape()[1]),
+                                           int64_t(mask.shape()[2]) };
+
+    auto regions = xt::xtensor<t_region, 3>::from_shape(
+        { size_t(shape[0]), size_t(shape[1]), size_t(shape[2]) });
+
+    std::vector<uint8_t> foreground(regions.size());
+#pragma omp parallel for num_threads(mp_cores)
+    for (int64_t x = 0; x < shape[0]; ++x)
+        for (int64_t y = 0, i = x * shape[1] * shape[2]; y < shape[1]; ++y)
+            for (int64_t z = 0; z < shape[2]; ++z, ++i)
+                foreground[i] = mask.unchecked(x, y, z) != 0;
+
+    auto [voxel_counts, bbox_min, bbox_max] = detail::label_connected_components_flat<3>(
+        foreground, shape, max_nonzero_offsets, regions.data(), mp_cores);
+
+    return std::tuple(std::move(regions),
+                      std::move(voxel_counts),
+                      std::move(bbox_min),
+                      std::move(bbox_max));
+}
+
+template<typename t_region = int64_t, tools::helper::c_xtensor_2d t_xtensor_mask>
+/**
+ * @brief Label the connected components of a 2D mask (union-find, parallel by x slabs).
+ *
+ * All non zero cells of the mask are foreground. The components are labeled 1, 2, ... in the
+ * scan order (x major) of their first cell, background cells are 0. The region image can thus
+ * be used directly in grow_regions (null_region = 0). The result does not depend on mp_cores.
+ *
+ * @tparam t_region Type of the region labels
+ * @tparam t_xtensor_mask Type of the 2D mask tensor
+ * @param mask 2D mask (non zero: foreground)
+ * @param connectivity 4 or 8
+ * @param mp_cores Number of cores to use for parallel processing
+ * @return tuple(regions (nx, ny), voxel counts per label (n_labels),
+ *         bounding box minima (n_labels, 2), bounding box maxima (n_labels, 2)). Row l
+ *         corresponds to label l + 1, the bounding boxes are inclusive cell indices.
+ *
+ * @throws std::invalid_argument if the connectivity is not 4 or 8
+ * @throws std::runtime_error if the number of labels exceeds the range of t_region
+ */
+auto label_connected_components(const t_xtensor_mask& mask,
+                                const int             connectivity = 8,
+                                const int             mp_cores     = 1)
+{
+    const size_t max_nonzero_offsets = detail::get_max_nonzero_offsets(connectivity, 2);
+
+    const std::array<int64_t, 2> shape = { int64_t(mask.shape()[0]), int64_t(mask.shape()[1]) };
+
+    auto regions =
+        xt::xtensor<t_region, 2>::from_shape({ size_t(shape[0]), size_t(shape[1]) });
+
+    std::vector<uint8_t> foreground(regions.size());
+#pragma omp parallel for num_threads(mp_cores)
+    for (int64_t x = 0; x < shape[0]; ++x)
+        for (int64_t y = 0, i = x * shape[1]; y < shape[1]; ++y, ++i)
+            foreground[i] = mask.unchecked(x, y) != 0;
+
+    auto [voxel_counts, bbox_min, bbox_max] = detail::label_connected_components_flat<2>(
+        foreground, shape, max_nonzero_offsets, regions.data(), mp_cores);
+
+    return std::tuple(std::move(regions),
+                      std::move(voxel_counts),
+                      std::move(bbox_min),
+                      std::move(bbox_max));
+}
+
+} // namespace functions
+} // namespace imageprocessing
+} // namespace algorithms
+} // namespace themachinethatgoesping
@@ -0,0 +1,391 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/region_statistics.doc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <themachinethatgoesping/tools/helper/xtensor.hpp>
+
+#include "grow_regions.hpp"
+#include "scan_order_buffers.hpp"
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace imageprocessing {
+namespace functions {
+
+/**
+ * @brief Per region statistics table (one row per region, sorted by region label). Columns of
+ * the per data tables correspond to the data volumes.
+ */
+template<typename t_region>
+struct RegionStatistics
+{
+    std::vector<t_region>   regions;      ///< region labels (sorted)
+    std::vector<int64_t>    voxel_counts; ///< number of cells per region
+    xt::xtensor<double, 2>  centroids;    ///< mean cell index (n_regions, n_dims)
+    xt::xtensor<int64_t, 2> bbox_min;     ///< inclusive minimum cell index (n_regions, n_dims)
+    xt::xtensor<int64_t, 2> bbox_max;     ///< inclusive maximum cell index (n_regions, n_dims)
+    xt::xtensor<int64_t, 2> valid_counts; ///< number of non NaN values (n_regions, n_data)
+    xt::xtensor<double, 2>  sums;         ///< sum of the valid values (n_regions, n_data)
+    xt::xtensor<double, 2>  means;        ///< sums / valid_counts (n_regions, n_data)
+    xt::xtensor<double, 2>  maxima;       ///< peak value, NaN if no valid value
+
+    size_t size() const { return regions.size(); }
+};
+
+namespace detail {
+/**
+ * @brief Accumulator for the statistics of one region
+ */
+template<size_t N>
+struct RegionAccumulator
+{
+    int64_t                count = 0;
+    std::array<double, N>  index_sum{};
+    std::array<int64_t, N> min, max;
+    std::vector<int64_t>   valid_counts;
+    std::vector<double>    sums, maxima;
+
+    explicit RegionAccumulator(const size_t n_data)
+        : valid_counts(n_data, 0)
+        , sums(n_data, 0.)
+        , maxima(n_data, std::numeric_limits<double>::quiet_NaN())
+    {
+        min.fill(std::numeric_limits<int64_t>::max());
+        max.fill(std::numeric_limits<int64_t>::lowest());
+    }
+
+    void add_cell(const std::array<int64_t, N>& index)
+    {
+        ++count;
+        for (size_t d = 0; d < N; ++d)
+        {
+            index_sum[d] += double(index[d]);
+            min[d] = std::min(min[d], index[d]);
+            max[d] = std::max(max[d], index[d]);
+        }
+    }
+
+    void add_value(const size_t k, const double value, const double peak_value)
+    {
+        if (std::isnan(value))
+            return;
+
+        ++valid_counts[k];
+        sums[k] += value;
+        if (!(peak_value <= maxima[k]))
+            maxima[k] = peak_value;
+    }
+
+    void add(const RegionAccumulator& other)
+    {
+        count += other.count;
+        for (size_t d = 0; d < N; ++d)
+        {
+            index_sum[d] += other.index_sum[d];
+            min[d] = std::min(min[d], other.min[d]);
+            max[d] = std::max(max[d], other.max[d]);
+        }
+        for (size_t k = 0; k < sums.size(); ++k)
+        {
+            valid_counts[k] += other.valid_counts[k];
+            sums[k] += other.sums[k];
+            if (!(other.maxima[k] <= maxima[k]) && !std::isnan(other.maxima[k]))
+                maxima[k] = other.maxima[k];
+        }
+    }
+};
+
+/**
+ * @brief Per chunk (thread) region accumulators. Consecutive cells of the same region (runs
+ * along the last axis) only require one hash lookup.
+ */
+template<size_t N, typename t_region>
+class RegionAccumulators
+{
+  public:
+    explicit RegionAccumulators(const size_t n_data)
+        : _n_data(n_data)
+    {
+    }
+
+    RegionAccumulator<N>& get(const t_region region)
+    {
+        if (_last < _accumulators.size() && _last_region == region)
+            return _accumulators[_last];
+
+        auto [it, inserted] = _index.try_emplace(region, _accumulators.size());
+        if (inserted)
+            _accumulators.emplace_back(_n_data);
+
+        _last_region = region;
+        _last        = it->second;
+        return _accumulators[_last];
+    }
+
+    const auto& get_index() const { return _index; }
+    const auto& get_accumulators() const { return _accumulators; }
+
+  private:
+    size_t                               _n_data;
+    std::unordered_map<t_region, size_t> _index;
+    std::vector<RegionAccumulator<N>>    _accumulators;
+    t_region                             _last_region{};
+    size_t                               _last = std::numeric_limits<size_t>::max();
+};
+
+/**
+ * @brief Merge the per chunk accumulators into a RegionStatistics table (sorted by region)
+ */
+template<size_t N, typename t_region>
+inline RegionStatistics<t_region> merge_region_accumulators(
+    const std::vector<RegionAccumulators<N, t_region>>& chunk_accumulators,
+    const size_t                                        n_data)
+{
+    std::unordered_map<t_region, size_t> index;
+    std::vector<RegionAccumulator<N>>    accumulators;
+    std::vector<t_region>                regions;
+
+    for (const auto& chunk : chunk_accumulators)
+        for (const auto& [region, i] : chunk.get_index())
+        {
+            auto [it, inserted] = index.try_emplace(region, accumulators.size());
+            if (inserted)
+            {
+                accumulators.emplace_back(n_data);
+                regions.push_back(region);
+            }
+            accumulators[it->second].add(chunk.get_accumulators()[i]);
+        }
+
+    std::vector<size_t> order(regions.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&regions](size_t a, size_t b) {
+        return regions[a] < regions[b];
+    });
+
+    const size_t               n = regions.size();
+    RegionStatistics<t_region> statistics;
+    statistics.regions.resize(n);
+    statistics.voxel_counts.resize(n);
+    statistics.centroids    = xt::xtensor<double, 2>::from_shape({ n, N });
+    statistics.bbox_min     = xt::xtensor<int64_t, 2>::from_shape({ n, N });
+    statistics.bbox_max     = xt::xtensor<int64_t, 2>::from_shape({ n, N });
+    statistics.valid_counts = xt::xtensor<int64_t, 2>::from_shape({ n, n_data });
+    statistics.sums         = xt::xtensor<double, 2>::from_shape({ n, n_data });
+    statistics.means        = xt::xtensor<double, 2>::from_shape({ n, n_data });
+    statistics.maxima       = xt::xtensor<double, 2>::from_shape({ n, n_data });
+
+    for (size_t r = 0; r < n; ++r)
+    {
+        const auto& accumulator = accumulators[order[r]];
+
+        statistics.regions[r]      = regions[order[r]];
+        statistics.voxel_counts[r] = accumulator.count;
+        for (size_t d = 0; d < N; ++d)
+        {
+            statistics.centroids.unchecked(r, d) =
+                accumulator.index_sum[d] / double(accumulator.count);
+            statistics.bbox_min.unchecked(r, d) = accumulator.min[d];
+            statistics.bbox_max.unchecked(r, d) = accumulator.max[d];
+        }
+        for (size_t k = 0; k < n_data; ++k)
+        {
+            statistics.valid_counts.unchecked(r, k) = accumulator.valid_counts[k];
+            statistics.sums.unchecked(r, k)         = accumulator.sums[k];
+            statistics.means.unchecked(r, k) =
+                accumulator.valid_counts[k] > 0
+                    ? accumulator.sums[k] / double(accumulator.valid_counts[k])
+                    : std::numeric_limits<double>::quiet_NaN();
+            statistics.maxima.unchecked(r, k) = accumulator.maxima[k];
+        }
+    }
+
+    return statistics;
+}
+
+/**
+ * @brief Value that is summed (linear if db_to_linear is true)
+ */
+inline double get_summed_value(const double value, const bool db_to_linear)
+{
+    return db_to_linear ? std::pow(10., value * 0.1) : value;
+}
+
+/**
+ * @brief True if region is a region label: not null_region (see is_null_region) and not NaN.
+ * NaN labels are always treated as null (as in get_non_null_mask), also if null_region is not
+ * NaN.
+ */
+template<typename t_region>
+inline bool is_region_label(const t_region& region, const t_region& null_region)
+{
+    if constexpr (std::is_floating_point_v<t_region>)
+    {
+        if (std::isnan(region))
+            return false;
+    }
+
+    return !is_null_region(region, null_region);
+}
+} // namespace detail
+
+template<tools::helper::c_xtensor_3d t_xtensor_regions, tools::helper::c_xtensor_3d t_xtensor_data>
+/**
+ * @brief Compute per region statistics of a 3D region volume in a single (parallel) pass.
+ *
+ * For each region (all labels that are not null_region and not NaN, see
+ * detail::is_region_label) the number of cells, the centroid (mean cell index), the bounding box
+ * and for each data volume the number of valid (non NaN) values, their sum, mean and maximum are
+ * computed.
+ *
+ * @tparam t_xtensor_regions Type of the 3D tensor containing region labels
+ * @tparam t_xtensor_data Type of the 3D data tensors
+ * @param regions_volume 3D tensor containing region labels
+ * @param data_volumes data volumes (same shape as regions_volume)
+ * @param null_region Value representing unlabeled/null regions (may be NaN)
+ * @param db_to_linear If true, the data are converted from dB to linear (10^(v/10)) before
+ *                     they are summed (sums and means are linear, maxima remain in dB)
+ * @param mp_cores Number of cores to use for parallel processing
+ * @return RegionStatistics table (sorted by region label, independent of mp_cores up to
+ *         floating point summation order)
+ *
+ * @throws std::invalid_argument if a data volume does not have the shape of regions_volume
+ */
+RegionStatistics<typename t_xtensor_regions::value_type> compute_region_statistics(
+    const t_xtensor_regions&                     regions_volume,
+    const std::vector<t_xtensor_data>&           data_volumes,
+    const typename t_xtensor_regions::value_type null_region,
+    const bool                                   db_to_linear = false,
+    const int                                    mp_cores     = 1)
+{
+    using region_type = typename t_xtensor_regions::value_type;
+
+    for (const auto& data_volume : data_volumes)
+        if (data_volume.shape() != regions_volume.shape())
+            throw std::invalid_argument(
+                "compute_region_statistics: data_volumes and regions_volume must have the same "
+                "shape.");
+
+    const int64_t nx     = regions_volume.shape()[0];
+    const int64_t ny     = regions_volume.shape()[1];
+    const int64_t nz     = regions_volume.shape()[2];
+    const size_t  n_data = data_volumes.size();
+
+    const auto    chunk_begins = detail::split_range(0, nx, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    std::vector<detail::RegionAccumulators<3, region_type>> chunk_accumulators(
+        n_chunks, detail::RegionAccumulators<3, region_type>(n_data));
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
+            for (int64_t y = 0; y < ny; ++y)
+                for (int64_t z = 0; z < nz; ++z)
+                {
+                    const region_type region = regions_volume.unchecked(x, y, z);
+                    if (!detail::is_region_label(region, null_region))
+                        continue;
+
+                    auto& accumulator = chunk_accumulators[c].get(region);
+                    accumulator.add_cell({ x, y, z });
+                    for (size_t k = 0; k < n_data; ++k)
+                    {
+                        const double value = double(data_volumes[k].unchecked(x, y, z));
+                        accumulator.add_value(
+                            k, detail::get_summed_value(value, db_to_linear), value);
+                    }
+                }
+
+    return detail::merge_region_accumulators(chunk_accumulators, n_data);
+}
+
+template<tools::helper::c_xtensor_2d t_xtensor_regions, tools::helper::c_xtensor_2d t_xtensor_data>
+/**
+ * @brief Compute per region statistics of a 2D region image in a single (parallel) pass.
+ *
+ * For each region (all labels that are not null_region and not NaN, see
+ * detail::is_region_label) the number of cells, the centroid (mean cell index), the bounding box
+ * and for each data image the number of valid (non NaN) values, their sum, mean and maximum are
+ * computed.
+ *
+ * @tparam t_xtensor_regions Type of the 2D tensor containing region labels
+ * @tparam t_xtensor_data Type of the 2D data tensors
+ * @param regions_image 2D tensor containing region labels
+ * @param data_images data images (same shape as regions_image)
+ * @param null_region Value representing unlabeled/null regions (may be NaN)
+ * @param db_to_linear If true, the data are converted from dB to linear (10^(v/10)) before
+ *                     they are summed (sums and means are linear, maxima remain in dB)
+ * @param mp_cores Number of cores to use for parallel processing
+ * @return RegionStatistics table (sorted by region label, independent of mp_cores up to
+ *         floating point summation order)
+ *
+ * @throws std::invalid_argument if a data image does not have the shape of regions_image
+ */
+RegionStatistics<typename t_xtensor_regions::value_type> compute_region_statistics(
+    const t_xtensor_regions&                     regions_image,
+    const std::vector<t_xtensor_data>&           data_images,
+    const typename t_xtensor_regions::value_type null_region,
+    const bool                                   db_to_linear = false,
+    const int                                    mp_cores     = 1)
+{
+    using region_type = typename t_xtensor_regions::value_type;
+
+    for (const auto& data_image : data_images)
+        if (data_image.shape() != regions_image.shape())
+            throw std::invalid_argument(
+                "compute_region_statistics: data_images and regions_image must have the same "
+                "shape.");
+
+    const int64_t nx     = regions_image.shape()[0];
+    const int64_t ny     = regions_image.shape()[1];
+    const size_t  n_data = data_images.size();
+
+    const auto    chunk_begins = detail::split_range(0, nx, mp_cores);
+    const int64_t n_chunks     = chunk_begins.size() - 1;
+
+    std::vector<detail::RegionAccumulators<2, region_type>> chunk_accumulators(
+        n_chunks, detail::RegionAccumulators<2, region_type>(n_data));
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+    for (int64_t c = 0; c < n_chunks; ++c)
+        for (int64_t x = chunk_begins[c]; x < chunk_begins[c + 1]; ++x)
+            for (int64_t y = 0; y < ny; ++y)
+            {
+                const region_type region = regions_image.unchecked(x, y);
+                if (!detail::is_region_label(region, null_region))
+                    continue;
+
+                auto& accumulator = chunk_accumulators[c].get(region);
+                accumulator.add_cell({ x, y });
+                for (size_t k = 0; k < n_data; ++k)
+                {
+                    const double value = double(data_images[k].unchecked(x, y));
+                    accumulator.add_value(k, detail::get_summed_value(value, db_to_linear), value);
+                }
+            }
+
+    return detail::merge_region_accumulators(chunk_accumulators, n_data);
+}
+
+} // namespace functions
+} // namespace imageprocessing
+} // namespace algorithms
+} // namespace themachinethatgoesping
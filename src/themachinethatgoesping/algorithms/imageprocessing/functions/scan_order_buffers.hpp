@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2025 Peter Urban, Ghent University
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/* generated doc strings */
+#include ".docstrings/scan_order_buffers.doc.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace themachinethatgoesping {
+namespace algorithms {
+namespace imageprocessing {
+namespace functions {
+namespace detail {
+
+/**
+ * @brief Split the range [begin, end) into at most mp_cores contiguous chunks of (almost) equal
+ * size. Chunk c covers [chunk_begins[c], chunk_begins[c + 1]).
+ *
+ * @param begin first index of the range
+ * @param end end of the range (exclusive)
+ * @param mp_cores maximum number of chunks
+ * @return std::vector<int64_t> chunk_begins (n_chunks + 1 values, at least one chunk)
+ */
+inline std::vector<int64_t> split_range(const int64_t begin, const int64_t end, const int mp_cores)
+{
+    const int64_t n        = std::max<int64_t>(end - begin, 0);
+    const int64_t n_chunks = std::max<int64_t>(1, std::min<int64_t>(mp_cores, n));
+
+    std::vector<int64_t> chunk_begins(n_chunks + 1);
+    for (int64_t c = 0; c <= n_chunks; ++c)
+        chunk_begins[c] = begin + n * c / n_chunks;
+
+    return chunk_begins;
+}
+
+/**
+ * @brief Per chunk (thread) output buffers that replace pushing into a shared vector within an
+ * omp critical section. Each chunk appends to its own buffer without synchronization. merge
+ * computes the output offset of each chunk (prefix sum over the chunk sizes), preallocates the
+ * result and copies the chunks in parallel. If the chunks are contiguous parts of a scan (see
+ * split_range), the result is in scan order independent of the number of threads.
+ *
+ * @tparam t_value type of the collected values
+ */
+template<typename t_value>
+class ScanOrderBuffers
+{
+  public:
+    explicit ScanOrderBuffers(size_t n_chunks)
+        : _chunks(n_chunks)
+    {
+    }
+
+    std::vector<t_value>&       operator[](size_t chunk) { return _chunks[chunk]; }
+    const std::vector<t_value>& operator[](size_t chunk) const { return _chunks[chunk]; }
+
+    size_t get_number_of_chunks() const { return _chunks.size(); }
+
+    /**
+     * @brief Total number of collected values (all chunks)
+     */
+    size_t size() const
+    {
+        size_t size = 0;
+        for (const auto& chunk : _chunks)
+            size += chunk.size();
+
+        return size;
+    }
+
+    /**
+     * @brief Concatenate all chunks (in chunk order) into one vector. The chunk buffers are
+     * released.
+     *
+     * @param mp_cores Number of cores to use for the parallel copy
+     * @return std::vector<t_value>
+     */
+    std::vector<t_value> merge(const int mp_cores = 1)
+    {
+        // exclusive prefix sum over the chunk sizes
+        std::vector<size_t> offsets(_chunks.size() + 1, 0);
+        for (size_t c = 0; c < _chunks.size(); ++c)
+            offsets[c + 1] = offsets[c] + _chunks[c].size();
+
+        std::vector<t_value> merged(offsets.back());
+
+#pragma omp parallel for num_threads(mp_cores) schedule(static, 1)
+        for (int64_t c = 0; c < int64_t(_chunks.size()); ++c)
+        {
+            std::move(_chunks[c].begin(), _chunks[c].end(), merged.begin() + offsets[c]);
+            std::vector<t_value>().swap(_chunks[c]);
+        }
+
+        return merged;
+    }
+
+  private:
+    std::vector<std::vector<t_value>> _chunks;
+};
+
+} // namespace detail
+} // namespace functions
+} // namespace imageprocessing
+} // namespace algorithms
+} // namespace themachinethatgoesping